@@ -63,6 +63,10 @@ int main(void)
     led_blinking_task();
 
     cdc_task();
+
+    #if CFG_TUSB_TRACE
+    board_trace_task();
+    #endif
   }
 
   return 0;
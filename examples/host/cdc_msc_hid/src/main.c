@@ -70,14 +70,10 @@ int main(void)
 // USB CDC
 //--------------------------------------------------------------------+
 #if CFG_TUH_CDC
-CFG_TUSB_MEM_SECTION static char serial_in_buffer[64] = { 0 };
-
 void tuh_mount_cb(uint8_t dev_addr)
 {
   // application set-up
   printf("\na CDC device  (address %d) is mounted\n", dev_addr);
-
-  tuh_cdc_receive(dev_addr, serial_in_buffer, sizeof(serial_in_buffer), true); // schedule first transfer
 }
 
 void tuh_umount_cb(uint8_t dev_addr)
@@ -86,17 +82,17 @@ void tuh_umount_cb(uint8_t dev_addr)
   printf("\na CDC device (address %d) is unmounted \n", dev_addr);
 }
 
-// invoked ISR context
-void tuh_cdc_xfer_isr(uint8_t dev_addr, xfer_result_t event, cdc_pipeid_t pipe_id, uint32_t xferred_bytes)
+// Invoked when received new data
+void tuh_cdc_rx_cb(uint8_t dev_addr)
 {
-  (void) event;
-  (void) pipe_id;
-  (void) xferred_bytes;
+  char buf[64+1];
+  uint32_t count;
 
-  printf(serial_in_buffer);
-  tu_memclr(serial_in_buffer, sizeof(serial_in_buffer));
-
-  tuh_cdc_receive(dev_addr, serial_in_buffer, sizeof(serial_in_buffer), true); // waiting for next data
+  while ( (count = tuh_cdc_read(dev_addr, buf, sizeof(buf)-1)) > 0 )
+  {
+    buf[count] = 0;
+    printf("%s", buf);
+  }
 }
 
 void cdc_task(void)
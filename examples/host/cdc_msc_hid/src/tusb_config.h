@@ -73,7 +73,7 @@
 #define CFG_TUH_CDC                 1
 #define CFG_TUH_HID_KEYBOARD        0
 #define CFG_TUH_HID_MOUSE           0
-#define CFG_TUSB_HOST_HID_GENERIC   0 // (not yet supported)
+#define CFG_TUSB_HOST_HID_GENERIC   0
 #define CFG_TUH_MSC                 0
 
 #define CFG_TUSB_HOST_DEVICE_MAX    (CFG_TUH_HUB ? 5 : 1) // normal hub has 4 ports
@@ -0,0 +1,209 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+/*
+this uses an attached CDC-ECM, CDC-NCM or RNDIS adapter (USB Ethernet dongle, LTE modem, phone tethering)
+as network interface of lwip, and obtains an address with DHCP once the link is up
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bsp/board.h"
+#include "tusb.h"
+
+#include "lwip/init.h"
+#include "lwip/timeouts.h"
+#include "lwip/dhcp.h"
+#include "lwip/etharp.h"
+#include "netif/ethernet.h"
+
+/* lwip context */
+static struct netif netif_data;
+static uint8_t netif_dev_addr;
+
+/* frames accepted by tuh_network_recv_cb() wait here for service_traffic() */
+#define RX_QUEUE_SIZE 8
+static struct pbuf *rx_queue[RX_QUEUE_SIZE];
+static uint8_t rx_rd, rx_count;
+
+static err_t linkoutput_fn(struct netif *netif, struct pbuf *p)
+{
+  (void)netif;
+
+  for (;;)
+  {
+    /* if adapter is gone, we must signal back to lwip that there is nothing we can do */
+    if (!tuh_network_mounted(netif_dev_addr))
+      return ERR_USE;
+
+    /* frame is copied into transfer buffer, possibly together with previous ones */
+    if (tuh_network_can_xmit(netif_dev_addr))
+    {
+      tuh_network_xmit(netif_dev_addr, p);
+      return ERR_OK;
+    }
+
+    /* transfer execution to TinyUSB in the hopes that it will finish transmitting prior frames */
+    tuh_task();
+  }
+}
+
+static err_t netif_init_cb(struct netif *netif)
+{
+  LWIP_ASSERT("netif != NULL", (netif != NULL));
+  netif->mtu = CFG_TUH_NET_MTU - SIZEOF_ETH_HDR;
+  netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP;
+  netif->state = NULL;
+  netif->name[0] = 'U';
+  netif->name[1] = 'H';
+  netif->linkoutput = linkoutput_fn;
+  netif->output = etharp_output;
+  return ERR_OK;
+}
+
+//--------------------------------------------------------------------+
+// Network adapter
+//--------------------------------------------------------------------+
+void tuh_network_mount_cb(uint8_t dev_addr)
+{
+  struct netif *netif = &netif_data;
+
+  printf("network adapter (address %d) is mounted\r\n", dev_addr);
+  netif_dev_addr = dev_addr;
+
+  netif->hwaddr_len = 6;
+  tuh_network_get_mac(dev_addr, netif->hwaddr);
+
+  netif_add(netif, IP4_ADDR_ANY4, IP4_ADDR_ANY4, IP4_ADDR_ANY4, NULL, netif_init_cb, ethernet_input);
+  netif_set_default(netif);
+  netif_set_up(netif);
+}
+
+void tuh_network_umount_cb(uint8_t dev_addr)
+{
+  printf("network adapter (address %d) is unmounted\r\n", dev_addr);
+
+  dhcp_stop(&netif_data);
+  netif_remove(&netif_data);
+
+  while (rx_count)
+  {
+    pbuf_free(rx_queue[rx_rd]);
+    rx_rd = (rx_rd + 1) % RX_QUEUE_SIZE;
+    rx_count--;
+  }
+}
+
+void tuh_network_link_cb(uint8_t dev_addr, bool up)
+{
+  (void)dev_addr;
+
+  printf("link %s\r\n", up ? "up" : "down");
+
+  if (up)
+  {
+    netif_set_link_up(&netif_data);
+    dhcp_start(&netif_data);
+  }
+  else
+  {
+    netif_set_link_down(&netif_data);
+  }
+}
+
+bool tuh_network_recv_cb(uint8_t dev_addr, struct pbuf *p)
+{
+  (void)dev_addr;
+
+  /* when the queue is full, driver holds remaining frames until tuh_network_recv_renew() */
+  if (rx_count == RX_QUEUE_SIZE) return false;
+
+  rx_queue[(rx_rd + rx_count) % RX_QUEUE_SIZE] = p;
+  rx_count++;
+  return true;
+}
+
+static void service_traffic(void)
+{
+  bool const was_full = (rx_count == RX_QUEUE_SIZE);
+
+  /* handle frames received by tuh_network_recv_cb() */
+  while (rx_count)
+  {
+    struct pbuf *p = rx_queue[rx_rd];
+    rx_rd = (rx_rd + 1) % RX_QUEUE_SIZE;
+    rx_count--;
+
+    if (netif_data.input(p, &netif_data) != ERR_OK) pbuf_free(p);
+  }
+
+  if (was_full) tuh_network_recv_renew(netif_dev_addr);
+
+  sys_check_timeouts();
+}
+
+//--------------------------------------------------------------------+
+// Main
+//--------------------------------------------------------------------+
+int main(void)
+{
+  board_init();
+  tusb_init();
+  lwip_init();
+
+  ip4_addr_t last_addr = { 0 };
+
+  while (1)
+  {
+    tuh_task();
+    service_traffic();
+
+    /* report address assigned by DHCP */
+    if (!ip4_addr_cmp(netif_ip4_addr(&netif_data), &last_addr))
+    {
+      last_addr = *netif_ip4_addr(&netif_data);
+      printf("ip address %s\r\n", ip4addr_ntoa(&last_addr));
+    }
+  }
+
+  return 0;
+}
+
+/* lwip has provision for using a mutex, when applicable */
+sys_prot_t sys_arch_protect(void)
+{
+  return 0;
+}
+void sys_arch_unprotect(sys_prot_t pval)
+{
+  (void)pval;
+}
+
+/* lwip needs a millisecond time source, and the TinyUSB board support code has one available */
+uint32_t sys_now(void)
+{
+  return board_millis();
+}
@@ -78,6 +78,11 @@ ifneq ($(LOG),)
   CFLAGS += -DCFG_TUSB_DEBUG=$(LOG)
 endif
 
+# Binary event trace, decoded by tools/trace_decode.py
+ifneq ($(TRACE),)
+  CFLAGS += -DCFG_TUSB_TRACE=$(TRACE)
+endif
+
 # Logger: default is uart, can be set to rtt or swo
 ifeq ($(LOGGER),rtt)
 	RTT_SRC = lib/SEGGER_RTT
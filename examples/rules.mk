@@ -21,11 +21,16 @@ else
 # GNU Make build system
 
 # libc
+ifeq ($(BOARD), usbip)
+# native build use host libc
+LIBS += -lm -lc
+else
 LIBS += -lgcc -lm -lnosys
 
 ifneq ($(BOARD), spresense)
 LIBS += -lc
 endif
+endif
 
 # TinyUSB Stack source
 SRC_C += \
@@ -40,6 +45,7 @@ SRC_C += \
 	src/class/msc/msc_device.c \
 	src/class/net/net_device.c \
 	src/class/usbtmc/usbtmc_device.c \
+	src/class/vendor/vendor_bridge.c \
 	src/class/vendor/vendor_device.c \
 	src/portable/$(VENDOR)/$(CHIP_FAMILY)/dcd_$(CHIP_FAMILY).c
 
@@ -49,7 +55,9 @@ INC += $(TOP)/src
 CFLAGS += $(addprefix -I,$(INC))
 
 # TODO Skip nanolib for MSP430
-ifeq ($(BOARD), msp_exp430f5529lp)
+ifeq ($(BOARD), usbip)
+  LDFLAGS += $(CFLAGS) -Wl,-Map=$@.map -Wl,-cref -Wl,-gc-sections
+else ifeq ($(BOARD), msp_exp430f5529lp)
   LDFLAGS += $(CFLAGS) -fshort-enums -Wl,-T,$(TOP)/$(LD_FILE) -Wl,-Map=$@.map -Wl,-cref -Wl,-gc-sections
 else
   LDFLAGS += $(CFLAGS) -fshort-enums -Wl,-T,$(TOP)/$(LD_FILE) -Wl,-Map=$@.map -Wl,-cref -Wl,-gc-sections -specs=nosys.specs -specs=nano.specs
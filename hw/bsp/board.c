@@ -93,3 +93,52 @@ TU_ATTR_USED int sys_read (int fhdl, char *buf, size_t count)
 }
 
 #endif
+
+//--------------------------------------------------------------------+
+// Time source for tud_task_ext() timeout
+//--------------------------------------------------------------------+
+#if TUSB_OPT_DEVICE_ENABLED && CFG_TUSB_OS == OPT_OS_NONE
+
+uint32_t tud_time_millis_cb(void)
+{
+  return board_millis();
+}
+
+#endif
+
+//--------------------------------------------------------------------+
+// Binary trace
+//--------------------------------------------------------------------+
+#if CFG_TUSB_TRACE
+
+#if defined(LOGGER_RTT)
+// Separated RTT channel so that trace records are not mixed with printf
+#define BOARD_TRACE_RTT_CHANNEL   1
+static uint8_t _trace_rtt_buf[CFG_TUSB_TRACE_DEPTH*sizeof(tusb_trace_record_t)];
+#endif
+
+void board_trace_task(void)
+{
+#if defined(LOGGER_RTT)
+  static bool rtt_inited = false;
+  if ( !rtt_inited )
+  {
+    SEGGER_RTT_ConfigUpBuffer(BOARD_TRACE_RTT_CHANNEL, "tusb_trace", _trace_rtt_buf, sizeof(_trace_rtt_buf), SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    rtt_inited = true;
+  }
+#endif
+
+  tusb_trace_record_t records[16];
+  uint32_t count;
+
+  while ( 0 != (count = tusb_trace_read(records, TU_ARRAY_SIZE(records))) )
+  {
+#if defined(LOGGER_RTT)
+    SEGGER_RTT_Write(BOARD_TRACE_RTT_CHANNEL, records, count*sizeof(tusb_trace_record_t));
+#else
+    board_uart_write(records, count*sizeof(tusb_trace_record_t));
+#endif
+  }
+}
+
+#endif
@@ -64,6 +64,11 @@ int board_uart_read(uint8_t* buf, int len);
 // Send characters to UART
 int board_uart_write(void const * buf, int len);
 
+#if CFG_TUSB_TRACE
+// Send binary trace records to host: RTT channel 1 with LOGGER=rtt, otherwise UART
+void board_trace_task(void);
+#endif
+
 #if CFG_TUSB_OS == OPT_OS_NONE
   // Get current milliseconds, must be implemented when no RTOS is used
   uint32_t board_millis(void);
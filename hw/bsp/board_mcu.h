@@ -116,6 +116,9 @@
 #elif CFG_TUSB_MCU == OPT_MCU_DA1469X
   #include "DA1469xAB.h"
 
+#elif CFG_TUSB_MCU == OPT_MCU_USBIP
+  // no header needed
+
 #else
   #error "Missing MCU header"
 #endif
@@ -0,0 +1,23 @@
+CFLAGS += \
+  -DCFG_TUSB_MCU=OPT_MCU_USBIP \
+  -DBOARD_DEVICE_RHPORT_SPEED=OPT_MODE_HIGH_SPEED
+
+# Native build, runs as a process on the host
+CROSS_COMPILE =
+
+# Allow to change listening port at build time, default is 3240
+ifneq ($(USBIP_PORT),)
+  CFLAGS += -DCFG_TUD_USBIP_PORT=$(USBIP_PORT)
+endif
+
+LIBS += -lpthread
+
+# For TinyUSB port source: src/portable/usbip/dcd_usbip.c
+VENDOR = .
+CHIP_FAMILY = usbip
+
+# Run the simulated device, then attach with
+# - Linux vhci : sudo usbip attach -r localhost -b 1-1
+# - test client: python3 tools/usbip_client.py
+run: $(BUILD)/$(BOARD)-firmware.elf
+	$^
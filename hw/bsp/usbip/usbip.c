@@ -1,7 +1,7 @@
 /* 
  * The MIT License (MIT)
  *
- * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ * Copyright (c) 2020 Ha Thach (tinyusb.org)
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -24,40 +24,59 @@
  * This file is part of the TinyUSB stack.
  */
 
-/** \ingroup CDC_RNDIS
- * \defgroup CDC_RNSID_Host Host
- *  @{ */
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "bsp/board.h"
 
-#ifndef _TUSB_CDC_RNDIS_HOST_H_
-#define _TUSB_CDC_RNDIS_HOST_H_
+//--------------------------------------------------------------------+
+// Board porting API
+// Device runs as a process on the host, USB is exported via USB/IP
+//--------------------------------------------------------------------+
 
-#include "common/tusb_common.h"
-#include "host/usbh.h"
-#include "cdc_rndis.h"
+void board_init(void)
+{
+  // unbuffered stdout so that log is shown immediately
+  setvbuf(stdout, NULL, _IONBF, 0);
 
-#ifdef __cplusplus
- extern "C" {
-#endif
+  // stdin is used as uart rx
+  fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+}
 
-//--------------------------------------------------------------------+
-// INTERNAL RNDIS-CDC Driver API
-//--------------------------------------------------------------------+
-typedef struct {
-  OSAL_SEM_DEF(semaphore_notification);
-  osal_semaphore_handle_t sem_notification_hdl;  // used to wait on notification pipe
-  uint32_t max_xfer_size; // got from device's msg initialize complete
-  uint8_t mac_address[6];
-}rndish_data_t;
-
-void rndish_init(void);
-tusb_error_t rndish_open_subtask(uint8_t dev_addr, cdch_data_t *p_cdc);
-void rndish_xfer_isr(cdch_data_t *p_cdc, pipe_handle_t pipe_hdl, xfer_result_t event, uint32_t xferred_bytes);
-void rndish_close(uint8_t dev_addr);
-
-#ifdef __cplusplus
- }
-#endif
+void board_led_write(bool state)
+{
+  static int led_state = -1;
 
-#endif /* _TUSB_CDC_RNDIS_HOST_H_ */
+  // only print on change, blinky would flood the console otherwise
+  if ( led_state != (int) state )
+  {
+    led_state = state;
+    TU_LOG2("LED %s\r\n", state ? "on" : "off");
+  }
+}
 
-/** @} */
+uint32_t board_button_read(void)
+{
+  return 0;
+}
+
+int board_uart_read(uint8_t* buf, int len)
+{
+  ssize_t const count = read(STDIN_FILENO, buf, (size_t) len);
+  return (count > 0) ? (int) count : 0;
+}
+
+int board_uart_write(void const * buf, int len)
+{
+  return (int) write(STDOUT_FILENO, buf, (size_t) len);
+}
+
+#if CFG_TUSB_OS == OPT_OS_NONE
+uint32_t board_millis(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (uint32_t) (ts.tv_sec*1000 + ts.tv_nsec/1000000);
+}
+#endif
@@ -32,12 +32,20 @@
 //--------------------------------------------------------------------+
 #include "ffconf.h"
 #include "diskio.h"
+
+#if CFG_TUH_MSC_CACHE
+#include "class/msc/msc_host_cache.h"
+#endif
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
 //--------------------------------------------------------------------+
 // TODO change it to portable init
 static DSTATUS disk_state[CFG_TUSB_HOST_DEVICE_MAX];
 
+#if CFG_TUH_MSC_CACHE
+CFG_TUSB_MEM_SECTION static tuh_msc_cache_t disk_cache[CFG_TUSB_HOST_DEVICE_MAX];
+#endif
+
 //--------------------------------------------------------------------+
 // INTERNAL OBJECT & FUNCTION DECLARATION
 //--------------------------------------------------------------------+
@@ -67,6 +75,10 @@ void diskio_init(void)
 //pdrv Specifies the physical drive number.
 DSTATUS disk_initialize ( BYTE pdrv )
 {
+#if CFG_TUH_MSC_CACHE
+  if ( !tuh_msc_cache_mount(&disk_cache[pdrv], pdrv+1) ) return disk_state[pdrv];
+#endif
+
   disk_state[pdrv] &= (~STA_NOINIT); // clear NOINIT bit
   return disk_state[pdrv];
 }
@@ -92,21 +104,29 @@ DSTATUS disk_status (BYTE pdrv)
 //    must not be split into single sector transactions to the device, or you may not get good read performance.
 DRESULT disk_read (BYTE pdrv, BYTE*buff, DWORD sector, BYTE count)
 {
+#if CFG_TUH_MSC_CACHE
+  return tuh_msc_cache_read(&disk_cache[pdrv], sector, buff, count) ? RES_OK : RES_ERROR;
+#else
   uint8_t usb_addr = pdrv+1;
 
 	if ( TUSB_ERROR_NONE != tuh_msc_read10(usb_addr, 0, buff, sector, count) )		return RES_ERROR;
 
 	return wait_for_io_complete(usb_addr);
+#endif
 }
 
 
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, DWORD sector, BYTE count)
 {
+#if CFG_TUH_MSC_CACHE
+  return tuh_msc_cache_write(&disk_cache[pdrv], sector, buff, count) ? RES_OK : RES_ERROR;
+#else
   uint8_t usb_addr = pdrv+1;
 
 	if ( TUSB_ERROR_NONE != tuh_msc_write10(usb_addr, 0, buff, sector, count) )		return RES_ERROR;
 
 	return wait_for_io_complete(usb_addr);
+#endif
 }
 
 /* [IN] Drive number */
@@ -117,7 +137,13 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff)
   (void) buff; (void) pdrv; // compiler warnings
 
   if (cmd != CTRL_SYNC) return RES_ERROR;
+
+#if CFG_TUH_MSC_CACHE
+  // write back dirty sectors when FatFs closes/syncs a file
+  return tuh_msc_cache_sync(&disk_cache[pdrv]) ? RES_OK : RES_ERROR;
+#else
   return RES_OK;
+#endif
 }
 
 static inline uint8_t month2number(char* p_ch)
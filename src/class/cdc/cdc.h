@@ -69,7 +69,8 @@ typedef enum
   CDC_COMM_SUBCLASS_DEVICE_MANAGEMENT                 , ///< Device Management  [USBWMC1.1]
   CDC_COMM_SUBCLASS_MOBILE_DIRECT_LINE_MODEL          , ///< Mobile Direct Line Model  [USBWMC1.1]
   CDC_COMM_SUBCLASS_OBEX                              , ///< OBEX  [USBWMC1.1]
-  CDC_COMM_SUBCLASS_ETHERNET_EMULATION_MODEL            ///< Ethernet Emulation Model  [USBEEM1.0]
+  CDC_COMM_SUBCLASS_ETHERNET_EMULATION_MODEL          , ///< Ethernet Emulation Model  [USBEEM1.0]
+  CDC_COMM_SUBCLASS_NETWORK_CONTROL_MODEL               ///< Network Control Model  [USBNCM1.0]
 } cdc_comm_sublcass_type_t;
 
 /// Communication Interface Protocol Codes
@@ -114,7 +115,8 @@ typedef enum
   CDC_FUNC_DESC_COMMAND_SET                                      = 0x16 , ///< Command Set Functional Descriptor
   CDC_FUNC_DESC_COMMAND_SET_DETAIL                               = 0x17 , ///< Command Set Detail Functional Descriptor
   CDC_FUNC_DESC_TELEPHONE_CONTROL_MODEL                          = 0x18 , ///< Telephone Control Model Functional Descriptor
-  CDC_FUNC_DESC_OBEX_SERVICE_IDENTIFIER                          = 0x19   ///< OBEX Service Identifier Functional Descriptor
+  CDC_FUNC_DESC_OBEX_SERVICE_IDENTIFIER                          = 0x19 , ///< OBEX Service Identifier Functional Descriptor
+  CDC_FUNC_DESC_NCM                                              = 0x1A   ///< NCM Functional Descriptor
 }cdc_func_desc_type_t;
 
 //--------------------------------------------------------------------+
@@ -188,8 +190,30 @@ typedef enum
   CDC_REQUEST_GET_ATM_VC_STATISTICS                        = 0x53,
 
   CDC_REQUEST_MDLM_SEMANTIC_MODEL                          = 0x60,
+
+  CDC_REQUEST_GET_NTB_PARAMETERS                           = 0x80,
+  CDC_REQUEST_GET_NET_ADDRESS                              = 0x81,
+  CDC_REQUEST_SET_NET_ADDRESS                              = 0x82,
+  CDC_REQUEST_GET_NTB_FORMAT                               = 0x83,
+  CDC_REQUEST_SET_NTB_FORMAT                               = 0x84,
+  CDC_REQUEST_GET_NTB_INPUT_SIZE                           = 0x85,
+  CDC_REQUEST_SET_NTB_INPUT_SIZE                           = 0x86,
+  CDC_REQUEST_GET_MAX_DATAGRAM_SIZE                        = 0x87,
+  CDC_REQUEST_SET_MAX_DATAGRAM_SIZE                        = 0x88,
+  CDC_REQUEST_GET_CRC_MODE                                 = 0x89,
+  CDC_REQUEST_SET_CRC_MODE                                 = 0x8A,
 }cdc_management_request_t;
 
+/// Packet filter bitmap of \ref CDC_REQUEST_SET_ETHERNET_PACKET_FILTER
+typedef enum
+{
+  CDC_PACKET_TYPE_PROMISCUOUS   = TU_BIT(0),
+  CDC_PACKET_TYPE_ALL_MULTICAST = TU_BIT(1),
+  CDC_PACKET_TYPE_DIRECTED      = TU_BIT(2),
+  CDC_PACKET_TYPE_BROADCAST     = TU_BIT(3),
+  CDC_PACKET_TYPE_MULTICAST     = TU_BIT(4),
+}cdc_ethernet_packet_filter_t;
+
 //--------------------------------------------------------------------+
 // Management Elemenent Notification (Notification Endpoint)
 //--------------------------------------------------------------------+
@@ -262,6 +286,19 @@ typedef struct TU_ATTR_PACKED
   uint16_t wCountryCode[no_country] ;\
 }
 
+/// Ethernet Networking Functional Descriptor (Communication Interface)
+typedef struct TU_ATTR_PACKED
+{
+  uint8_t  bLength              ; ///< Size of this descriptor in bytes.
+  uint8_t  bDescriptorType      ; ///< Descriptor Type, must be Class-Specific
+  uint8_t  bDescriptorSubType   ; ///< Descriptor SubType must be \ref CDC_FUNC_DESC_ETHERNET_NETWORKING
+  uint8_t  iMACAddress          ; ///< Index of string descriptor holding the 48bit MAC address as 12 hexadecimal digits
+  uint32_t bmEthernetStatistics ; ///< Ethernet statistics capabilities
+  uint16_t wMaxSegmentSize      ; ///< Maximum segment size of Ethernet device, typically 1514 bytes
+  uint16_t wNumberMCFilters     ; ///< Number of multicast filters that can be configured by the host
+  uint8_t  bNumberPowerFilters  ; ///< Number of pattern filters for host wake-up
+}cdc_desc_func_ethernet_t;
+
 //--------------------------------------------------------------------+
 // PUBLIC SWITCHED TELEPHONE NETWORK (PSTN) SUBCLASS
 //--------------------------------------------------------------------+
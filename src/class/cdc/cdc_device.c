@@ -36,6 +36,7 @@
 //--------------------------------------------------------------------+
 typedef struct
 {
+  uint8_t rhport;
   uint8_t itf_num;
   uint8_t ep_notif;
   uint8_t ep_in;
@@ -78,13 +79,13 @@ static void _prep_out_transaction (uint8_t itf)
   cdcd_interface_t* p_cdc = &_cdcd_itf[itf];
 
   // skip if previous transfer not complete
-  if ( usbd_edpt_busy(TUD_OPT_RHPORT, p_cdc->ep_out) ) return;
+  if ( usbd_edpt_busy(p_cdc->rhport, p_cdc->ep_out) ) return;
 
   // Prepare for incoming data but only allow what we can store in the ring buffer.
   uint16_t max_read = tu_fifo_remaining(&p_cdc->rx_ff);
   if ( max_read >= TU_ARRAY_SIZE(p_cdc->epout_buf) )
   {
-    usbd_edpt_xfer(TUD_OPT_RHPORT, p_cdc->ep_out, p_cdc->epout_buf, TU_ARRAY_SIZE(p_cdc->epout_buf));
+    usbd_edpt_xfer(p_cdc->rhport, p_cdc->ep_out, p_cdc->epout_buf, TU_ARRAY_SIZE(p_cdc->epout_buf));
   }
 }
 
@@ -94,7 +95,7 @@ static void _prep_out_transaction (uint8_t itf)
 bool tud_cdc_n_connected(uint8_t itf)
 {
   // DTR (bit 0) active  is considered as connected
-  return tud_ready() && tu_bit_test(_cdcd_itf[itf].line_state, 0);
+  return tud_rhport_ready(_cdcd_itf[itf].rhport) && tu_bit_test(_cdcd_itf[itf].line_state, 0);
 }
 
 uint8_t tud_cdc_n_get_line_state (uint8_t itf)
@@ -162,13 +163,13 @@ uint32_t tud_cdc_n_write_flush (uint8_t itf)
   cdcd_interface_t* p_cdc = &_cdcd_itf[itf];
 
   // skip if previous transfer not complete yet
-  TU_VERIFY( !usbd_edpt_busy(TUD_OPT_RHPORT, p_cdc->ep_in), 0 );
+  TU_VERIFY( !usbd_edpt_busy(p_cdc->rhport, p_cdc->ep_in), 0 );
 
   uint16_t count = tu_fifo_read_n(&_cdcd_itf[itf].tx_ff, p_cdc->epin_buf, TU_ARRAY_SIZE(p_cdc->epin_buf));
   if ( count )
   {
     TU_VERIFY( tud_cdc_n_connected(itf), 0 ); // fifo is empty if not connected
-    TU_ASSERT( usbd_edpt_xfer(TUD_OPT_RHPORT, p_cdc->ep_in, p_cdc->epin_buf, count), 0 );
+    TU_ASSERT( usbd_edpt_xfer(p_cdc->rhport, p_cdc->ep_in, p_cdc->epin_buf, count), 0 );
   }
 
   return count;
@@ -212,10 +213,11 @@ void cdcd_init(void)
 
 void cdcd_reset(uint8_t rhport)
 {
-  (void) rhport;
-
   for(uint8_t i=0; i<CFG_TUD_CDC; i++)
   {
+    // interfaces opened by other device port are not affected
+    if ( _cdcd_itf[i].rhport != rhport ) continue;
+
     tu_memclr(&_cdcd_itf[i], ITF_MEM_RESET_SIZE);
     tu_fifo_clear(&_cdcd_itf[i].rx_ff);
     tu_fifo_clear(&_cdcd_itf[i].tx_ff);
@@ -245,6 +247,7 @@ uint16_t cdcd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint1
   TU_ASSERT(p_cdc, 0);
 
   //------------- Control Interface -------------//
+  p_cdc->rhport  = rhport;
   p_cdc->itf_num = itf_desc->bInterfaceNumber;
 
   uint16_t drv_len = sizeof(tusb_desc_interface_t);
@@ -292,8 +295,6 @@ uint16_t cdcd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint1
 // return false to stall control endpoint (e.g Host send non-sense DATA)
 bool cdcd_control_complete(uint8_t rhport, tusb_control_request_t const * request)
 {
-  (void) rhport;
-
   //------------- Class Specific Request -------------//
   TU_VERIFY (request->bmRequestType_bit.type == TUSB_REQ_TYPE_CLASS);
 
@@ -305,7 +306,7 @@ bool cdcd_control_complete(uint8_t rhport, tusb_control_request_t const * reques
   {
     if (itf >= TU_ARRAY_SIZE(_cdcd_itf)) return false;
 
-    if ( p_cdc->itf_num == request->wIndex ) break;
+    if ( p_cdc->rhport == rhport && p_cdc->itf_num == request->wIndex ) break;
   }
 
   // Invoke callback
@@ -332,18 +333,20 @@ bool cdcd_control_request(uint8_t rhport, tusb_control_request_t const * request
   {
     if (itf >= TU_ARRAY_SIZE(_cdcd_itf)) return false;
 
-    if ( p_cdc->itf_num == request->wIndex ) break;
+    if ( p_cdc->rhport == rhport && p_cdc->itf_num == request->wIndex ) break;
   }
 
   switch ( request->bRequest )
   {
     case CDC_REQUEST_SET_LINE_CODING:
       TU_LOG2("  Set Line Coding\r\n");
+      TU_TRACE(TU_TRACE_CDC_LINE_CODING, p_cdc->itf_num, 1);
       tud_control_xfer(rhport, request, &p_cdc->line_coding, sizeof(cdc_line_coding_t));
     break;
 
     case CDC_REQUEST_GET_LINE_CODING:
       TU_LOG2("  Get Line Coding\r\n");
+      TU_TRACE(TU_TRACE_CDC_LINE_CODING, p_cdc->itf_num, 0);
       tud_control_xfer(rhport, request, &p_cdc->line_coding, sizeof(cdc_line_coding_t));
     break;
 
@@ -358,6 +361,7 @@ bool cdcd_control_request(uint8_t rhport, tusb_control_request_t const * request
       bool const rts = tu_bit_test(request->wValue, 1);
 
       p_cdc->line_state = (uint8_t) request->wValue;
+      TU_TRACE(TU_TRACE_CDC_LINE_STATE, p_cdc->itf_num, p_cdc->line_state);
 
       TU_LOG2("  Set Control Line State: DTR = %d, RTS = %d\r\n", dtr, rts);
 
@@ -376,7 +380,6 @@ bool cdcd_control_request(uint8_t rhport, tusb_control_request_t const * request
 
 bool cdcd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes)
 {
-  (void) rhport;
   (void) result;
 
   uint8_t itf;
@@ -386,7 +389,7 @@ bool cdcd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_
   for (itf = 0; itf < CFG_TUD_CDC; itf++)
   {
     p_cdc = &_cdcd_itf[itf];
-    if ( ( ep_addr == p_cdc->ep_out ) || ( ep_addr == p_cdc->ep_in ) ) break;
+    if ( p_cdc->rhport == rhport && ( ( ep_addr == p_cdc->ep_out ) || ( ep_addr == p_cdc->ep_in ) ) ) break;
   }
   TU_ASSERT(itf < CFG_TUD_CDC);
 
@@ -422,7 +425,7 @@ bool cdcd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_
       // xferred_bytes is multiple of EP size and not zero
       if ( xferred_bytes && (0 == (xferred_bytes % CFG_TUD_CDC_EPSIZE)) )
       {
-        usbd_edpt_xfer(TUD_OPT_RHPORT, p_cdc->ep_in, NULL, 0);
+        usbd_edpt_xfer(rhport, p_cdc->ep_in, NULL, 0);
       }
     }
   }
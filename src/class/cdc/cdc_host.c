@@ -30,6 +30,7 @@
 
 #include "common/tusb_common.h"
 #include "cdc_host.h"
+#include "common/tusb_fifo.h"
 
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
@@ -42,17 +43,83 @@ typedef struct {
   uint8_t ep_in;
   uint8_t ep_out;
 
+  uint16_t rx_xfer_len;      // IN transfer length, multiple of endpoint size
+  uint16_t ep_out_size;
+
+  // transfer in progress, cleared when its completion is processed in tuh_task()
+  volatile bool rx_busy;
+  volatile bool tx_busy;
+
   cdc_acm_capability_t acm_capability;
 
+  /*------------- From this point, data is not cleared by close -------------*/
+  // FIFO
+  tu_fifo_t rx_ff;
+  tu_fifo_t tx_ff;
+
+  uint8_t rx_ff_buf[CFG_TUH_CDC_RX_BUFSIZE];
+  uint8_t tx_ff_buf[CFG_TUH_CDC_TX_BUFSIZE];
+
+#if CFG_FIFO_MUTEX
+  osal_mutex_def_t rx_ff_mutex;
+  osal_mutex_def_t tx_ff_mutex;
+
+  // transfers are started by both application and tuh_task()
+  osal_mutex_def_t xfer_mutex_def;
+  osal_mutex_t     xfer_mutex;
+#endif
+
+  // Endpoint Transfer buffer
+  CFG_TUSB_MEM_ALIGN uint8_t epin_buf[CFG_TUH_CDC_XFER_BUFSIZE];
+  CFG_TUSB_MEM_ALIGN uint8_t epout_buf[CFG_TUH_CDC_XFER_BUFSIZE];
 } cdch_data_t;
 
+#define ITF_MEM_RESET_SIZE   offsetof(cdch_data_t, rx_ff)
+
 //--------------------------------------------------------------------+
 // INTERNAL OBJECT & FUNCTION DECLARATION
 //--------------------------------------------------------------------+
-static cdch_data_t cdch_data[CFG_TUSB_HOST_DEVICE_MAX];
+CFG_TUSB_MEM_SECTION static cdch_data_t cdch_data[CFG_TUSB_HOST_DEVICE_MAX];
+
+// Check and claim of rx_busy/tx_busy must not be interleaved between application and tuh_task()
+static inline void xfer_lock(cdch_data_t* p_cdc)
+{
+#if CFG_FIFO_MUTEX
+  osal_mutex_lock(p_cdc->xfer_mutex, OSAL_TIMEOUT_WAIT_FOREVER);
+#else
+  (void) p_cdc;
+#endif
+}
+
+static inline void xfer_unlock(cdch_data_t* p_cdc)
+{
+#if CFG_FIFO_MUTEX
+  osal_mutex_unlock(p_cdc->xfer_mutex);
+#else
+  (void) p_cdc;
+#endif
+}
+
+// Arm IN endpoint but only allow what we can store in the ring buffer
+static void prep_in_transfer(uint8_t dev_addr)
+{
+  cdch_data_t* p_cdc = &cdch_data[dev_addr-1];
+
+  xfer_lock(p_cdc);
+
+  if ( !p_cdc->rx_busy && p_cdc->ep_in && tu_fifo_remaining(&p_cdc->rx_ff) >= p_cdc->rx_xfer_len )
+  {
+    p_cdc->rx_busy = true;
+    if ( !hcd_pipe_xfer(dev_addr, p_cdc->ep_in, p_cdc->epin_buf, p_cdc->rx_xfer_len, true) ) p_cdc->rx_busy = false;
+  }
+
+  xfer_unlock(p_cdc);
+}
 
 bool tuh_cdc_mounted(uint8_t dev_addr)
 {
+  TU_VERIFY(0 < dev_addr && dev_addr <= CFG_TUSB_HOST_DEVICE_MAX);
+
   cdch_data_t* cdc = &cdch_data[dev_addr-1];
   return cdc->ep_in && cdc->ep_out;
 }
@@ -85,31 +152,88 @@ bool tuh_cdc_is_busy(uint8_t dev_addr, cdc_pipeid_t pipeid)
 bool tuh_cdc_serial_is_mounted(uint8_t dev_addr)
 {
   // TODO consider all AT Command as serial candidate
-  return tuh_cdc_mounted(dev_addr)                                         &&
-      (CDC_COMM_PROTOCOL_NONE <= cdch_data[dev_addr-1].itf_protocol) &&
+  // itf_protocol is unsigned, CDC_COMM_PROTOCOL_NONE (0) is the lower bound
+  return tuh_cdc_mounted(dev_addr) &&
       (cdch_data[dev_addr-1].itf_protocol <= CDC_COMM_PROTOCOL_ATCOMMAND_CDMA);
 }
 
-bool tuh_cdc_send(uint8_t dev_addr, void const * p_data, uint32_t length, bool is_notify)
+//--------------------------------------------------------------------+
+// READ API
+//--------------------------------------------------------------------+
+uint32_t tuh_cdc_available(uint8_t dev_addr)
 {
-  TU_VERIFY( tuh_cdc_mounted(dev_addr) );
-  TU_VERIFY( p_data != NULL && length, TUSB_ERROR_INVALID_PARA);
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), 0 );
+  return tu_fifo_count(&cdch_data[dev_addr-1].rx_ff);
+}
 
-  uint8_t const ep_out = cdch_data[dev_addr-1].ep_out;
-  if ( hcd_edpt_busy(dev_addr, ep_out) ) return false;
+uint32_t tuh_cdc_read(uint8_t dev_addr, void* buffer, uint32_t bufsize)
+{
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), 0 );
 
-  return hcd_pipe_xfer(dev_addr, ep_out, (void *) p_data, length, is_notify);
+  uint32_t num_read = tu_fifo_read_n(&cdch_data[dev_addr-1].rx_ff, buffer, (uint16_t) TU_MIN(bufsize, UINT16_MAX));
+  prep_in_transfer(dev_addr);
+  return num_read;
 }
 
-bool tuh_cdc_receive(uint8_t dev_addr, void * p_buffer, uint32_t length, bool is_notify)
+bool tuh_cdc_peek(uint8_t dev_addr, int pos, uint8_t* chr)
 {
   TU_VERIFY( tuh_cdc_mounted(dev_addr) );
-  TU_VERIFY( p_buffer != NULL && length, TUSB_ERROR_INVALID_PARA);
+  return tu_fifo_peek_at(&cdch_data[dev_addr-1].rx_ff, pos, chr);
+}
 
-  uint8_t const ep_in = cdch_data[dev_addr-1].ep_in;
-  if ( hcd_edpt_busy(dev_addr, ep_in) ) return false;
+void tuh_cdc_read_flush(uint8_t dev_addr)
+{
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), );
 
-  return hcd_pipe_xfer(dev_addr, ep_in, p_buffer, length, is_notify);
+  tu_fifo_clear(&cdch_data[dev_addr-1].rx_ff);
+  prep_in_transfer(dev_addr);
+}
+
+//--------------------------------------------------------------------+
+// WRITE API
+//--------------------------------------------------------------------+
+uint32_t tuh_cdc_write(uint8_t dev_addr, void const* buffer, uint32_t bufsize)
+{
+  // nothing would ever send it
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), 0 );
+
+  return tu_fifo_write_n(&cdch_data[dev_addr-1].tx_ff, buffer, (uint16_t) TU_MIN(bufsize, UINT16_MAX));
+}
+
+uint32_t tuh_cdc_write_flush(uint8_t dev_addr)
+{
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), 0 );
+
+  cdch_data_t* p_cdc = &cdch_data[dev_addr-1];
+
+  uint16_t count = 0;
+  bool queued = true;
+
+  xfer_lock(p_cdc);
+
+  // skip if previous transfer not complete yet
+  if ( !p_cdc->tx_busy )
+  {
+    count = tu_fifo_read_n(&p_cdc->tx_ff, p_cdc->epout_buf, CFG_TUH_CDC_XFER_BUFSIZE);
+    if ( count )
+    {
+      p_cdc->tx_busy = true;
+
+      queued = hcd_pipe_xfer(dev_addr, p_cdc->ep_out, p_cdc->epout_buf, count, true);
+      if ( !queued ) p_cdc->tx_busy = false;
+    }
+  }
+
+  xfer_unlock(p_cdc);
+
+  TU_ASSERT(queued, 0);
+  return count;
+}
+
+uint32_t tuh_cdc_write_available(uint8_t dev_addr)
+{
+  TU_VERIFY( tuh_cdc_mounted(dev_addr), 0 );
+  return tu_fifo_remaining(&cdch_data[dev_addr-1].tx_ff);
 }
 
 //--------------------------------------------------------------------+
@@ -117,7 +241,32 @@ bool tuh_cdc_receive(uint8_t dev_addr, void * p_buffer, uint32_t length, bool is
 //--------------------------------------------------------------------+
 void cdch_init(void)
 {
-  tu_memclr(cdch_data, sizeof(cdch_data_t)*CFG_TUSB_HOST_DEVICE_MAX);
+  tu_memclr(cdch_data, sizeof(cdch_data));
+
+  for(uint8_t i=0; i<CFG_TUSB_HOST_DEVICE_MAX; i++)
+  {
+    cdch_data_t* p_cdc = &cdch_data[i];
+
+    tu_fifo_config(&p_cdc->rx_ff, p_cdc->rx_ff_buf, TU_ARRAY_SIZE(p_cdc->rx_ff_buf), 1, false);
+    tu_fifo_config(&p_cdc->tx_ff, p_cdc->tx_ff_buf, TU_ARRAY_SIZE(p_cdc->tx_ff_buf), 1, false);
+
+#if CFG_FIFO_MUTEX
+    tu_fifo_config_mutex(&p_cdc->rx_ff, osal_mutex_create(&p_cdc->rx_ff_mutex));
+    tu_fifo_config_mutex(&p_cdc->tx_ff, osal_mutex_create(&p_cdc->tx_ff_mutex));
+    p_cdc->xfer_mutex = osal_mutex_create(&p_cdc->xfer_mutex_def);
+#endif
+  }
+}
+
+static bool set_control_line_state_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) dev_addr;
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  TU_LOG2("CDC Set Control Line State: %s\r\n", result == XFER_RESULT_SUCCESS ? "OK" : "Failed");
+  return result == XFER_RESULT_SUCCESS;
 }
 
 bool cdch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length)
@@ -180,14 +329,20 @@ bool cdch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *it
       TU_ASSERT(TUSB_DESC_ENDPOINT == ep_desc->bDescriptorType);
       TU_ASSERT(TUSB_XFER_BULK == ep_desc->bmAttributes.xfer);
 
+      // transfer buffer holds at least a packet
+      uint16_t const ep_size = ep_desc->wMaxPacketSize.size;
+      TU_ASSERT(ep_size && ep_size <= CFG_TUH_CDC_XFER_BUFSIZE);
+
       TU_ASSERT(hcd_edpt_open(rhport, dev_addr, ep_desc));
 
       if ( tu_edpt_dir(ep_desc->bEndpointAddress) ==  TUSB_DIR_IN )
       {
-        p_cdc->ep_in = ep_desc->bEndpointAddress;
+        p_cdc->ep_in       = ep_desc->bEndpointAddress;
+        p_cdc->rx_xfer_len = CFG_TUH_CDC_XFER_BUFSIZE - (CFG_TUH_CDC_XFER_BUFSIZE % ep_size);
       }else
       {
-        p_cdc->ep_out = ep_desc->bEndpointAddress;
+        p_cdc->ep_out      = ep_desc->bEndpointAddress;
+        p_cdc->ep_out_size = ep_size;
       }
 
       (*p_length) += p_desc[DESC_OFFSET_LEN];
@@ -196,7 +351,7 @@ bool cdch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *it
   }
 
   // FIXME move to seperate API : connect
-  tusb_control_request_t request =
+  tusb_control_request_t const request =
   {
     .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
     .bRequest = CDC_REQUEST_SET_CONTROL_LINE_STATE,
@@ -205,21 +360,71 @@ bool cdch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *it
     .wLength = 0
   };
 
-  TU_ASSERT( usbh_control_xfer(dev_addr, &request, NULL) );
+  // don't wait for the response, other interfaces of this device are opened meanwhile
+  TU_ASSERT( tuh_control_xfer_async(dev_addr, &request, NULL, set_control_line_state_complete, NULL) );
+
+  // start receiving, IN endpoint stays armed from now on
+  prep_in_transfer(dev_addr);
 
   return true;
 }
 
-void cdch_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+void cdch_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
 {
-  (void) ep_addr;
-  tuh_cdc_xfer_isr( dev_addr, event, 0, xferred_bytes );
+  cdch_data_t * p_cdc = &cdch_data[dev_addr-1];
+
+  // Received new data
+  if ( ep_addr == p_cdc->ep_in )
+  {
+    p_cdc->rx_busy = false;
+
+    // endpoint is not re-armed after error e.g stalled, until application reads again
+    if ( XFER_RESULT_SUCCESS != event ) return;
+
+    tu_fifo_write_n(&p_cdc->rx_ff, p_cdc->epin_buf, (uint16_t) xferred_bytes);
+
+    // invoke receive callback (if there is still data)
+    if ( tuh_cdc_rx_cb && tu_fifo_count(&p_cdc->rx_ff) ) tuh_cdc_rx_cb(dev_addr);
+
+    prep_in_transfer(dev_addr);
+  }
+
+  // Data sent to device, continue to send the rest of tx fifo
+  if ( ep_addr == p_cdc->ep_out )
+  {
+    p_cdc->tx_busy = false;
+
+    if ( 0 == tuh_cdc_write_flush(dev_addr) )
+    {
+      // There is no data left, a ZLP should be sent if
+      // xferred_bytes is multiple of EP size and not zero
+      if ( xferred_bytes && (0 == (xferred_bytes % p_cdc->ep_out_size)) )
+      {
+        xfer_lock(p_cdc);
+        if ( !p_cdc->tx_busy )
+        {
+          p_cdc->tx_busy = true;
+          if ( !hcd_pipe_xfer(dev_addr, p_cdc->ep_out, NULL, 0, true) ) p_cdc->tx_busy = false;
+        }
+        xfer_unlock(p_cdc);
+      }
+      else if ( tuh_cdc_tx_complete_cb )
+      {
+        tuh_cdc_tx_complete_cb(dev_addr);
+      }
+    }
+  }
+
+  // nothing to do with notif endpoint for now
 }
 
 void cdch_close(uint8_t dev_addr)
 {
   cdch_data_t * p_cdc = &cdch_data[dev_addr-1];
-  tu_memclr(p_cdc, sizeof(cdch_data_t));
+
+  tu_memclr(p_cdc, ITF_MEM_RESET_SIZE);
+  tu_fifo_clear(&p_cdc->rx_ff);
+  tu_fifo_clear(&p_cdc->tx_ff);
 }
 
 #endif
@@ -35,6 +35,28 @@
  extern "C" {
 #endif
 
+//--------------------------------------------------------------------+
+// Class Driver Configuration
+//--------------------------------------------------------------------+
+
+// RX FIFO size of each device
+#ifndef CFG_TUH_CDC_RX_BUFSIZE
+#define CFG_TUH_CDC_RX_BUFSIZE    512
+#endif
+
+// TX FIFO size of each device
+#ifndef CFG_TUH_CDC_TX_BUFSIZE
+#define CFG_TUH_CDC_TX_BUFSIZE    512
+#endif
+
+// Max bytes of a bulk transfer, must not be less than endpoint size (512 for high speed).
+// IN endpoint is kept armed while RX FIFO has room for a whole transfer
+#ifndef CFG_TUH_CDC_XFER_BUFSIZE
+#define CFG_TUH_CDC_XFER_BUFSIZE  512
+#endif
+
+TU_VERIFY_STATIC(CFG_TUH_CDC_XFER_BUFSIZE <= CFG_TUH_CDC_RX_BUFSIZE, "RX FIFO must hold a whole transfer");
+
 //--------------------------------------------------------------------+
 // CDC APPLICATION PUBLIC API
 //--------------------------------------------------------------------+
@@ -62,48 +84,59 @@ bool tuh_cdc_serial_is_mounted(uint8_t dev_addr);
  */
 bool tuh_cdc_is_busy(uint8_t dev_addr, cdc_pipeid_t pipeid);
 
-/** \brief 			Perform USB OUT transfer to device
- * \param[in]		dev_addr	device address
- * \param[in]	  p_data    Buffer containing data. Must be accessible by USB controller (see \ref CFG_TUSB_MEM_SECTION)
- * \param[in]		length    Number of bytes to be transferred via USB bus
- * \retval      TUSB_ERROR_NONE on success
- * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
- * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
- * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the
- *              interface's callback function. \a p_data must be declared with \ref CFG_TUSB_MEM_SECTION.
- */
-bool tuh_cdc_send(uint8_t dev_addr, void const * p_data, uint32_t length, bool is_notify);
+// Get the number of bytes available for reading
+uint32_t tuh_cdc_available       (uint8_t dev_addr);
 
-/** \brief 			Perform USB IN transfer to get data from device
- * \param[in]		dev_addr	device address
- * \param[in]	  p_buffer  Buffer containing received data. Must be accessible by USB controller (see \ref CFG_TUSB_MEM_SECTION)
- * \param[in]		length    Number of bytes to be transferred via USB bus
- * \retval      TUSB_ERROR_NONE on success
- * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
- * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
- * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the
- *              interface's callback function. \a p_data must be declared with \ref CFG_TUSB_MEM_SECTION.
- */
-bool tuh_cdc_receive(uint8_t dev_addr, void * p_buffer, uint32_t length, bool is_notify);
+// Read received bytes
+uint32_t tuh_cdc_read            (uint8_t dev_addr, void* buffer, uint32_t bufsize);
+
+// Read a byte, return -1 if there is none
+static inline
+int32_t  tuh_cdc_read_char       (uint8_t dev_addr);
+
+// Clear the received FIFO
+void     tuh_cdc_read_flush      (uint8_t dev_addr);
+
+// Get a byte from FIFO at the specified position without removing it
+bool     tuh_cdc_peek            (uint8_t dev_addr, int pos, uint8_t* u8);
+
+// Write bytes to TX FIFO, data may remain in the FIFO for a while
+uint32_t tuh_cdc_write           (uint8_t dev_addr, void const* buffer, uint32_t bufsize);
+
+// Write a byte
+static inline
+uint32_t tuh_cdc_write_char      (uint8_t dev_addr, char ch);
+
+// Force sending data if possible, return number of forced bytes.
+// Once started, TX FIFO keeps being sent in transfers of up to CFG_TUH_CDC_XFER_BUFSIZE until it is empty
+uint32_t tuh_cdc_write_flush     (uint8_t dev_addr);
+
+// Return the number of bytes available for writing to TX FIFO buffer in a single write operation.
+uint32_t tuh_cdc_write_available (uint8_t dev_addr);
 
 //--------------------------------------------------------------------+
 // CDC APPLICATION CALLBACKS
 //--------------------------------------------------------------------+
 
-/** \brief      Callback function that is invoked when an transferring event occurred
- * \param[in]		dev_addr	Address of device
- * \param[in]   event an value from \ref xfer_result_t
- * \param[in]   pipe_id value from \ref cdc_pipeid_t indicate the pipe
- * \param[in]   xferred_bytes Number of bytes transferred via USB bus
- * \note        event can be one of following
- *              - XFER_RESULT_SUCCESS : previously scheduled transfer completes successfully.
- *              - XFER_RESULT_FAILED   : previously scheduled transfer encountered a transaction error.
- *              - XFER_RESULT_STALLED : previously scheduled transfer is stalled by device.
- * \note
- */
-void tuh_cdc_xfer_isr(uint8_t dev_addr, xfer_result_t event, cdc_pipeid_t pipe_id, uint32_t xferred_bytes);
+// Invoked when received new data
+TU_ATTR_WEAK void tuh_cdc_rx_cb(uint8_t dev_addr);
+
+// Invoked when all data in TX FIFO is sent
+TU_ATTR_WEAK void tuh_cdc_tx_complete_cb(uint8_t dev_addr);
+
+//--------------------------------------------------------------------+
+// Inline Functions
+//--------------------------------------------------------------------+
+static inline int32_t tuh_cdc_read_char (uint8_t dev_addr)
+{
+  uint8_t ch;
+  return tuh_cdc_read(dev_addr, &ch, 1) ? (int32_t) ch : -1;
+}
+
+static inline uint32_t tuh_cdc_write_char (uint8_t dev_addr, char ch)
+{
+  return tuh_cdc_write(dev_addr, &ch, 1);
+}
 
 /// @} // group CDC_Serial_Host
 /// @}
@@ -113,7 +146,7 @@ void tuh_cdc_xfer_isr(uint8_t dev_addr, xfer_result_t event, cdc_pipeid_t pipe_i
 //--------------------------------------------------------------------+
 void cdch_init(void);
 bool cdch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length);
-void cdch_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
+void cdch_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
 void cdch_close(uint8_t dev_addr);
 
 #ifdef __cplusplus
@@ -192,6 +192,16 @@ typedef struct {
   uint32_t status     ; ///< The status of processing for the request message request by the device to which this message is the response.
 } rndis_msg_set_cmplt_t, rndis_msg_keep_alive_cmplt_t;
 
+/// \brief Indicate Status Message
+/// \details This message is sent by the device to indicate a change in its status, e.g. network medium is connected
+typedef struct {
+  uint32_t type                 ; ///< Message Type, must be \ref RNDIS_MSG_INDICATE_STATUS
+  uint32_t length               ; ///< Message length in bytes, including the header and the status buffer
+  uint32_t status               ; ///< The status being indicated, has value from \ref rndis_msg_status_t
+  uint32_t status_buffer_length ; ///< The length, in bytes, of the status buffer, 0 if there is none
+  uint32_t status_buffer_offset ; ///< The offset, in bytes, from the beginning of \a status field where the status buffer is located
+} rndis_msg_indicate_status_t;
+
 /// \brief Packet Data Message
 /// \brief This message MUST be used by the host and the device to send network data to one another.
 typedef struct {
@@ -40,6 +40,7 @@
 //--------------------------------------------------------------------+
 typedef struct
 {
+  uint8_t rhport;
   uint8_t itf_num;
   uint8_t ep_in;
   uint8_t ep_out;        // optional Out endpoint
@@ -57,11 +58,11 @@ typedef struct
 CFG_TUSB_MEM_SECTION static hidd_interface_t _hidd_itf[CFG_TUD_HID];
 
 /*------------- Helpers -------------*/
-static inline hidd_interface_t* get_interface_by_itfnum(uint8_t itf_num)
+static inline hidd_interface_t* get_interface_by_itfnum(uint8_t rhport, uint8_t itf_num)
 {
   for (uint8_t i=0; i < CFG_TUD_HID; i++ )
   {
-    if ( itf_num == _hidd_itf[i].itf_num ) return &_hidd_itf[i];
+    if ( rhport == _hidd_itf[i].rhport && itf_num == _hidd_itf[i].itf_num ) return &_hidd_itf[i];
   }
 
   return NULL;
@@ -73,8 +74,9 @@ static inline hidd_interface_t* get_interface_by_itfnum(uint8_t itf_num)
 bool tud_hid_ready(void)
 {
   uint8_t itf = 0;
-  uint8_t const ep_in = _hidd_itf[itf].ep_in;
-  return tud_ready() && (ep_in != 0) && usbd_edpt_ready(TUD_OPT_RHPORT, ep_in);
+  uint8_t const rhport = _hidd_itf[itf].rhport;
+  uint8_t const ep_in  = _hidd_itf[itf].ep_in;
+  return tud_rhport_ready(rhport) && (ep_in != 0) && usbd_edpt_ready(rhport, ep_in);
 }
 
 bool tud_hid_report(uint8_t report_id, void const* report, uint8_t len)
@@ -98,7 +100,7 @@ bool tud_hid_report(uint8_t report_id, void const* report, uint8_t len)
     memcpy(p_hid->epin_buf, report, len);
   }
 
-  return usbd_edpt_xfer(TUD_OPT_RHPORT, p_hid->ep_in, p_hid->epin_buf, len);
+  return usbd_edpt_xfer(p_hid->rhport, p_hid->ep_in, p_hid->epin_buf, len);
 }
 
 bool tud_hid_boot_mode(void)
@@ -149,13 +151,16 @@ bool tud_hid_mouse_report(uint8_t report_id, uint8_t buttons, int8_t x, int8_t y
 //--------------------------------------------------------------------+
 void hidd_init(void)
 {
-  hidd_reset(TUD_OPT_RHPORT);
+  tu_memclr(_hidd_itf, sizeof(_hidd_itf));
 }
 
 void hidd_reset(uint8_t rhport)
 {
-  (void) rhport;
-  tu_memclr(_hidd_itf, sizeof(_hidd_itf));
+  // interfaces opened by other device port are not affected
+  for (uint8_t i=0; i < CFG_TUD_HID; i++ )
+  {
+    if ( _hidd_itf[i].rhport == rhport ) tu_memclr(&_hidd_itf[i], sizeof(hidd_interface_t));
+  }
 }
 
 uint16_t hidd_open(uint8_t rhport, tusb_desc_interface_t const * desc_itf, uint16_t max_len)
@@ -193,6 +198,7 @@ uint16_t hidd_open(uint8_t rhport, tusb_desc_interface_t const * desc_itf, uint1
   if ( desc_itf->bInterfaceSubClass == HID_SUBCLASS_BOOT ) p_hid->boot_protocol = desc_itf->bInterfaceProtocol;
 
   p_hid->boot_mode = false; // default mode is REPORT
+  p_hid->rhport    = rhport;
   p_hid->itf_num   = desc_itf->bInterfaceNumber;
   
   // Use offsetof to avoid pointer to the odd/misaligned address
@@ -217,7 +223,7 @@ bool hidd_control_request(uint8_t rhport, tusb_control_request_t const * request
 {
   TU_VERIFY(request->bmRequestType_bit.recipient == TUSB_REQ_RCPT_INTERFACE);
 
-  hidd_interface_t* p_hid = get_interface_by_itfnum( (uint8_t) request->wIndex );
+  hidd_interface_t* p_hid = get_interface_by_itfnum(rhport, (uint8_t) request->wIndex );
   TU_ASSERT(p_hid);
 
   if (request->bmRequestType_bit.type == TUSB_REQ_TYPE_STANDARD)
@@ -310,8 +316,7 @@ bool hidd_control_request(uint8_t rhport, tusb_control_request_t const * request
 // return false to stall control endpoint (e.g Host send non-sense DATA)
 bool hidd_control_complete(uint8_t rhport, tusb_control_request_t const * p_request)
 {
-  (void) rhport;
-  hidd_interface_t* p_hid = get_interface_by_itfnum( (uint8_t) p_request->wIndex );
+  hidd_interface_t* p_hid = get_interface_by_itfnum(rhport, (uint8_t) p_request->wIndex );
   TU_ASSERT(p_hid);
 
   if (p_request->bmRequestType_bit.type == TUSB_REQ_TYPE_CLASS &&
@@ -338,7 +343,7 @@ bool hidd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_
   {
     if (itf >= TU_ARRAY_SIZE(_hidd_itf)) return false;
 
-    if ( ep_addr == p_hid->ep_out ) break;
+    if ( rhport == p_hid->rhport && ep_addr == p_hid->ep_out ) break;
   }
 
   if (ep_addr == p_hid->ep_out)
@@ -38,17 +38,72 @@
 //--------------------------------------------------------------------+
 // HID Interface common functions
 //--------------------------------------------------------------------+
-static inline bool hidh_interface_open(uint8_t dev_addr, uint8_t interface_number, tusb_desc_endpoint_t const *p_endpoint_desc, hidh_interface_info_t *p_hid)
+#if CFG_TUH_HID_RING
+// Queue free transfer buffers of ring on interrupt IN endpoint, return number of transfers queued on endpoint
+static uint8_t hidh_interface_arm(uint8_t dev_addr, hidh_interface_info_t *p_hid)
 {
-  p_hid->pipe_hdl         = hcd_edpt_open(dev_addr, p_endpoint_desc, TUSB_CLASS_HID);
+  uint8_t* buffer;
+  while ( NULL != (buffer = tuh_hid_ring_xfer_buffer(&p_hid->ring)) )
+  {
+    // out of transfer descriptors, remaining buffers are queued on next completion
+    if ( !hcd_pipe_xfer(dev_addr, p_hid->ep_in, buffer, p_hid->report_size, true) ) break;
+    tuh_hid_ring_xfer_queued(&p_hid->ring);
+  }
+
+  return p_hid->ring.xfer_count;
+}
+
+static void hidh_interface_xfer_done(uint8_t dev_addr, hidh_interface_info_t *p_hid, xfer_result_t event, uint32_t xferred_bytes)
+{
+  tuh_hid_ring_xfer_complete(&p_hid->ring, event, xferred_bytes, hcd_frame_number(p_hid->rhport));
+
+  // failed transfer stops polling: endpoint is halted or device is being removed
+  if ( XFER_RESULT_SUCCESS == event )
+  {
+    (void) hidh_interface_arm(dev_addr, p_hid);
+  }else
+  {
+    p_hid->stopped = true;
+  }
+}
+#endif
+
+static inline bool hidh_interface_open(uint8_t rhport, uint8_t dev_addr, uint8_t interface_number, tusb_desc_endpoint_t const *p_endpoint_desc, hidh_interface_info_t *p_hid)
+{
+#if CFG_TUH_HID_RING
+  TU_ASSERT( p_endpoint_desc->wMaxPacketSize.size <= CFG_TUH_HID_RING_REPORT_SIZE );
+#endif
+
+  TU_ASSERT( hcd_edpt_open(rhport, dev_addr, p_endpoint_desc) );
+
+  p_hid->ep_in            = p_endpoint_desc->bEndpointAddress;
   p_hid->report_size      = p_endpoint_desc->wMaxPacketSize.size; // TODO get size from report descriptor
   p_hid->interface_number = interface_number;
 
-  TU_ASSERT (pipehandle_is_valid(p_hid->pipe_hdl));
+#if CFG_TUH_HID_RING
+  p_hid->rhport = rhport;
+#endif
 
   return true;
 }
 
+// Requests sent at open are complete, interface is usable from now on
+static void hidh_interface_mount(uint8_t dev_addr, hidh_interface_info_t *p_hid)
+{
+#if CFG_TUH_HID_RING
+  p_hid->stopped = false;
+  tuh_hid_ring_init(&p_hid->ring);
+
+  // when out of transfer descriptors, interface is still mounted and the rest is queued by
+  // next completion or by tuh_hid_report_available()/tuh_hid_report_read()
+  (void) hidh_interface_arm(dev_addr, p_hid);
+#else
+  (void) dev_addr;
+#endif
+
+  p_hid->mounted = true;
+}
+
 static inline void hidh_interface_close(hidh_interface_info_t *p_hid)
 {
   tu_memclr(p_hid, sizeof(hidh_interface_info_t));
@@ -61,11 +116,18 @@ tusb_error_t hidh_interface_get_report(uint8_t dev_addr, void * report, hidh_int
   // TODO change to use is configured function
   TU_ASSERT (TUSB_DEVICE_STATE_CONFIGURED == tuh_device_get_state(dev_addr), TUSB_ERROR_DEVICE_NOT_READY);
   TU_VERIFY (report, TUSB_ERROR_INVALID_PARA);
-  TU_ASSERT (!hcd_edpt_busy(p_hid->pipe_hdl), TUSB_ERROR_INTERFACE_IS_BUSY);
 
-  TU_ASSERT_ERR( hcd_pipe_xfer(p_hid->pipe_hdl, report, p_hid->report_size, true) ) ;
+#if CFG_TUH_HID_RING
+  // endpoint is always armed by driver, reports are read from ring
+  (void) p_hid;
+  return TUSB_ERROR_INTERFACE_IS_BUSY;
+#else
+  TU_ASSERT (!hcd_edpt_busy(dev_addr, p_hid->ep_in), TUSB_ERROR_INTERFACE_IS_BUSY);
+
+  TU_ASSERT( hcd_pipe_xfer(dev_addr, p_hid->ep_in, report, p_hid->report_size, true), TUSB_ERROR_FAILED );
 
   return TUSB_ERROR_NONE;
+#endif
 }
 
 //--------------------------------------------------------------------+
@@ -85,12 +147,12 @@ uint8_t const hid_keycode_to_ascii_tbl[2][128] =
 };
 #endif
 
-static hidh_interface_info_t keyboardh_data[CFG_TUSB_HOST_DEVICE_MAX]; // does not have addr0, index = dev_address-1
+CFG_TUSB_MEM_SECTION static hidh_interface_info_t keyboardh_data[CFG_TUSB_HOST_DEVICE_MAX]; // does not have addr0, index = dev_address-1
 
 //------------- KEYBOARD PUBLIC API (parameter validation required) -------------//
 bool  tuh_hid_keyboard_is_mounted(uint8_t dev_addr)
 {
-  return tuh_device_is_configured(dev_addr) && pipehandle_is_valid(keyboardh_data[dev_addr-1].pipe_hdl);
+  return tuh_device_is_configured(dev_addr) && keyboardh_data[dev_addr-1].mounted;
 }
 
 tusb_error_t tuh_hid_keyboard_get_report(uint8_t dev_addr, void* p_report)
@@ -101,7 +163,7 @@ tusb_error_t tuh_hid_keyboard_get_report(uint8_t dev_addr, void* p_report)
 bool tuh_hid_keyboard_is_busy(uint8_t dev_addr)
 {
   return  tuh_hid_keyboard_is_mounted(dev_addr) &&
-          hcd_edpt_busy( keyboardh_data[dev_addr-1].pipe_hdl );
+          hcd_edpt_busy(dev_addr, keyboardh_data[dev_addr-1].ep_in);
 }
 
 #endif
@@ -111,18 +173,18 @@ bool tuh_hid_keyboard_is_busy(uint8_t dev_addr)
 //--------------------------------------------------------------------+
 #if CFG_TUH_HID_MOUSE
 
-static hidh_interface_info_t mouseh_data[CFG_TUSB_HOST_DEVICE_MAX]; // does not have addr0, index = dev_address-1
+CFG_TUSB_MEM_SECTION static hidh_interface_info_t mouseh_data[CFG_TUSB_HOST_DEVICE_MAX]; // does not have addr0, index = dev_address-1
 
 //------------- Public API -------------//
 bool tuh_hid_mouse_is_mounted(uint8_t dev_addr)
 {
-  return tuh_device_is_configured(dev_addr) && pipehandle_is_valid(mouseh_data[dev_addr-1].pipe_hdl);
+  return tuh_device_is_configured(dev_addr) && mouseh_data[dev_addr-1].mounted;
 }
 
 bool tuh_hid_mouse_is_busy(uint8_t dev_addr)
 {
   return  tuh_hid_mouse_is_mounted(dev_addr) &&
-          hcd_edpt_busy( mouseh_data[dev_addr-1].pipe_hdl );
+          hcd_edpt_busy(dev_addr, mouseh_data[dev_addr-1].ep_in);
 }
 
 tusb_error_t tuh_hid_mouse_get_report(uint8_t dev_addr, void * report)
@@ -137,9 +199,139 @@ tusb_error_t tuh_hid_mouse_get_report(uint8_t dev_addr, void * report)
 //--------------------------------------------------------------------+
 #if CFG_TUSB_HOST_HID_GENERIC
 
-//STATIC_ struct {
-//  hidh_interface_info_t
-//} generic_data[CFG_TUSB_HOST_DEVICE_MAX];
+typedef struct
+{
+  hidh_interface_info_t itf;
+  tuh_hid_report_map_t  report_map;
+  uint16_t              report_desc_len; // read after SET_IDLE
+} hidh_generic_info_t;
+
+CFG_TUSB_MEM_SECTION static hidh_generic_info_t generich_data[CFG_TUSB_HOST_DEVICE_MAX]; // does not have addr0, index = dev_address-1
+
+// Report descriptor is only needed while compiling it at mount, devices behind a hub may be mounted concurrently
+CFG_TUSB_MEM_SECTION TU_ATTR_ALIGNED(4) static uint8_t report_desc_buf[CFG_TUSB_HOST_DEVICE_MAX][CFG_TUH_HID_REPORT_DESC_BUFSIZE];
+
+//------------- Public API -------------//
+bool tuh_hid_generic_is_mounted(uint8_t dev_addr)
+{
+  return tuh_device_is_configured(dev_addr) && generich_data[dev_addr-1].itf.mounted;
+}
+
+bool tuh_hid_generic_is_busy(uint8_t dev_addr)
+{
+  return  tuh_hid_generic_is_mounted(dev_addr) &&
+          hcd_edpt_busy(dev_addr, generich_data[dev_addr-1].itf.ep_in);
+}
+
+tuh_hid_report_map_t const* tuh_hid_generic_get_report_map(uint8_t dev_addr)
+{
+  return tuh_hid_generic_is_mounted(dev_addr) ? &generich_data[dev_addr-1].report_map : NULL;
+}
+
+tusb_error_t tuh_hid_generic_get_report(uint8_t dev_addr, void* p_report)
+{
+  return hidh_interface_get_report(dev_addr, p_report, &generich_data[dev_addr-1].itf);
+}
+
+// Report descriptor is compiled into report map, generic interface is mounted
+static bool config_get_report_desc_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) user_ctx;
+
+  hidh_generic_info_t* p_generic = &generich_data[dev_addr-1];
+
+  // interface is left unmounted
+  TU_ASSERT(XFER_RESULT_SUCCESS == result);
+
+  // only the bytes received are parsed, device may return less than wDescriptorLength of HID descriptor.
+  // Fields compiled before an unsupported item are still usable
+  uint16_t const desc_len = (uint16_t) tu_min32(xferred_bytes, request->wLength);
+  if ( !tuh_hid_parse_report_descriptor(&p_generic->report_map, report_desc_buf[dev_addr-1], desc_len) )
+  {
+    TU_LOG2("HID report descriptor is not fully parsed, %u fields\r\n", p_generic->report_map.field_count);
+  }
+
+  hidh_interface_mount(dev_addr, &p_generic->itf);
+  tuh_hid_generic_mounted_cb(dev_addr);
+
+  return true;
+}
+
+// Fetch report descriptor to compile it into report map
+static bool generic_get_report_descriptor(uint8_t dev_addr, uint8_t itf_num, uint16_t desc_len)
+{
+  tusb_control_request_t const request = {
+        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+        .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+        .wValue = HID_DESC_TYPE_REPORT << 8,
+        .wIndex = itf_num,
+        .wLength = desc_len
+  };
+
+  return tuh_control_xfer_async(dev_addr, &request, report_desc_buf[dev_addr-1], config_get_report_desc_complete, NULL);
+}
+
+#endif
+
+//--------------------------------------------------------------------+
+// REPORT RING
+//--------------------------------------------------------------------+
+#if CFG_TUH_HID_RING
+
+static hidh_interface_info_t* ring_interface(uint8_t dev_addr, uint8_t protocol)
+{
+  TU_VERIFY(0 < dev_addr && dev_addr <= CFG_TUSB_HOST_DEVICE_MAX && tuh_device_is_configured(dev_addr), NULL);
+
+  hidh_interface_info_t* p_hid = NULL;
+  switch ( protocol )
+  {
+    #if CFG_TUH_HID_KEYBOARD
+    case HID_PROTOCOL_KEYBOARD: p_hid = &keyboardh_data[dev_addr-1]; break;
+    #endif
+
+    #if CFG_TUH_HID_MOUSE
+    case HID_PROTOCOL_MOUSE   : p_hid = &mouseh_data[dev_addr-1]; break;
+    #endif
+
+    #if CFG_TUSB_HOST_HID_GENERIC
+    case HID_PROTOCOL_NONE    : p_hid = &generich_data[dev_addr-1].itf; break;
+    #endif
+
+    default: break;
+  }
+
+  return (p_hid && p_hid->mounted) ? p_hid : NULL;
+}
+
+// Queue transfers that could not be queued at mount when transfer descriptors were exhausted
+static void ring_rearm(uint8_t dev_addr, hidh_interface_info_t* p_hid)
+{
+  if ( !p_hid->stopped && p_hid->ring.xfer_count < CFG_TUH_HID_RING_ARMED ) (void) hidh_interface_arm(dev_addr, p_hid);
+}
+
+uint8_t tuh_hid_report_available(uint8_t dev_addr, uint8_t protocol)
+{
+  hidh_interface_info_t* p_hid = ring_interface(dev_addr, protocol);
+  TU_VERIFY(p_hid, 0);
+
+  ring_rearm(dev_addr, p_hid);
+  return tuh_hid_ring_count(&p_hid->ring);
+}
+
+bool tuh_hid_report_read(uint8_t dev_addr, uint8_t protocol, tuh_hid_report_t* report)
+{
+  hidh_interface_info_t* p_hid = ring_interface(dev_addr, protocol);
+  TU_VERIFY(p_hid && report);
+
+  ring_rearm(dev_addr, p_hid);
+  return tuh_hid_ring_read(&p_hid->ring, report);
+}
+
+tuh_hid_ring_stats_t const* tuh_hid_report_stats(uint8_t dev_addr, uint8_t protocol)
+{
+  hidh_interface_info_t* p_hid = ring_interface(dev_addr, protocol);
+  return p_hid ? tuh_hid_ring_get_stats(&p_hid->ring) : NULL;
+}
 
 #endif
 
@@ -157,133 +349,180 @@ void hidh_init(void)
 #endif
 
 #if CFG_TUSB_HOST_HID_GENERIC
-  hidh_generic_init();
+  tu_memclr(&generich_data, sizeof(hidh_generic_info_t)*CFG_TUSB_HOST_DEVICE_MAX);
 #endif
 }
 
-#if 0
-CFG_TUSB_MEM_SECTION uint8_t report_descriptor[256];
-#endif
+static bool config_set_idle_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
 
-bool hidh_open_subtask(uint8_t dev_addr, tusb_desc_interface_t const *p_interface_desc, uint16_t *p_length)
+bool hidh_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *p_interface_desc, uint16_t *p_length)
 {
   uint8_t const *p_desc = (uint8_t const *) p_interface_desc;
 
   //------------- HID descriptor -------------//
-  p_desc += p_desc[DESC_OFFSET_LEN];
+  p_desc = tu_desc_next(p_desc);
   tusb_hid_descriptor_hid_t const *p_desc_hid = (tusb_hid_descriptor_hid_t const *) p_desc;
-  TU_ASSERT(HID_DESC_TYPE_HID == p_desc_hid->bDescriptorType, TUSB_ERROR_INVALID_PARA);
+  TU_ASSERT(HID_DESC_TYPE_HID == p_desc_hid->bDescriptorType);
 
   //------------- Endpoint Descriptor -------------//
-  p_desc += p_desc[DESC_OFFSET_LEN];
+  p_desc = tu_desc_next(p_desc);
   tusb_desc_endpoint_t const * p_endpoint_desc = (tusb_desc_endpoint_t const *) p_desc;
-  TU_ASSERT(TUSB_DESC_ENDPOINT == p_endpoint_desc->bDescriptorType, TUSB_ERROR_INVALID_PARA);
+  TU_ASSERT(TUSB_DESC_ENDPOINT == p_endpoint_desc->bDescriptorType);
+
+  // interface is skipped by usbh even if it is not supported
+  *p_length = sizeof(tusb_desc_interface_t) + sizeof(tusb_hid_descriptor_hid_t) + sizeof(tusb_desc_endpoint_t);
+
+  hidh_interface_info_t* p_hid = NULL;
+
+  if ( HID_SUBCLASS_BOOT == p_interface_desc->bInterfaceSubClass )
+  {
+    #if CFG_TUH_HID_KEYBOARD
+    if ( HID_PROTOCOL_KEYBOARD == p_interface_desc->bInterfaceProtocol) p_hid = &keyboardh_data[dev_addr-1];
+    #endif
+
+    #if CFG_TUH_HID_MOUSE
+    if ( HID_PROTOCOL_MOUSE == p_interface_desc->bInterfaceProtocol) p_hid = &mouseh_data[dev_addr-1];
+    #endif
+  }
+
+#if CFG_TUSB_HOST_HID_GENERIC
+  // first interface not claimed by boot keyboard/mouse, only IN endpoint is used
+  hidh_generic_info_t* p_generic = &generich_data[dev_addr-1];
+
+  if ( p_hid == NULL && p_generic->itf.ep_in == 0 && p_desc_hid->bNumDescriptors &&
+       p_desc_hid->bReportType == HID_DESC_TYPE_REPORT && tu_edpt_dir(p_endpoint_desc->bEndpointAddress) == TUSB_DIR_IN )
+  {
+    TU_ASSERT(p_desc_hid->wReportLength <= CFG_TUH_HID_REPORT_DESC_BUFSIZE);
+    p_generic->report_desc_len = p_desc_hid->wReportLength;
+    p_hid = &p_generic->itf;
+  }
+#endif
+
+  // Not supported subclass or protocol
+  TU_VERIFY(p_hid);
+
+  TU_ASSERT( hidh_interface_open(rhport, dev_addr, p_interface_desc->bInterfaceNumber, p_endpoint_desc, p_hid) );
 
   //------------- SET IDLE (0) request -------------//
-  tusb_control_request_t request = {
+  // interface is mounted from its completion, after report descriptor is read for generic interface
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
         .bRequest = HID_REQ_CONTROL_SET_IDLE,
         .wValue = 0, // idle_rate = 0
         .wIndex = p_interface_desc->bInterfaceNumber,
         .wLength = 0
   };
-  TU_ASSERT( usbh_control_xfer( dev_addr, &request, NULL ) );
+  TU_ASSERT( tuh_control_xfer_async(dev_addr, &request, NULL, config_set_idle_complete, p_hid) );
 
-#if 0
-  //------------- Get Report Descriptor TODO HID parser -------------//
-  if ( p_desc_hid->bNumDescriptors )
+  return true;
+}
+
+static bool config_set_idle_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) result; // optional request, device may stall it
+  (void) xferred_bytes;
+
+  hidh_interface_info_t* p_hid = (hidh_interface_info_t*) user_ctx;
+
+  #if CFG_TUH_HID_KEYBOARD
+  if ( p_hid == &keyboardh_data[dev_addr-1] )
   {
-    STASK_INVOKE(
-        usbh_control_xfer_subtask( dev_addr, bm_request_type(TUSB_DIR_IN, TUSB_REQ_TYPE_STANDARD, TUSB_REQ_RCPT_INTERFACE),
-                                   TUSB_REQ_GET_DESCRIPTOR, (p_desc_hid->bReportType << 8), 0,
-                                   p_desc_hid->wReportLength, report_descriptor ),
-        error
-    );
-    (void) error; // if error in getting report descriptor --> treating like there is none
+    hidh_interface_mount(dev_addr, p_hid);
+    tuh_hid_keyboard_mounted_cb(dev_addr);
+    return true;
   }
-#endif
+  #endif
 
-  if ( HID_SUBCLASS_BOOT == p_interface_desc->bInterfaceSubClass )
+  #if CFG_TUH_HID_MOUSE
+  if ( p_hid == &mouseh_data[dev_addr-1] )
   {
-    #if CFG_TUH_HID_KEYBOARD
-    if ( HID_PROTOCOL_KEYBOARD == p_interface_desc->bInterfaceProtocol)
-    {
-      TU_ASSERT( hidh_interface_open(dev_addr, p_interface_desc->bInterfaceNumber, p_endpoint_desc, &keyboardh_data[dev_addr-1]) );
-      tuh_hid_keyboard_mounted_cb(dev_addr);
-    } else
-    #endif
-
-    #if CFG_TUH_HID_MOUSE
-    if ( HID_PROTOCOL_MOUSE == p_interface_desc->bInterfaceProtocol)
-    {
-      TU_ASSERT ( hidh_interface_open(dev_addr, p_interface_desc->bInterfaceNumber, p_endpoint_desc, &mouseh_data[dev_addr-1]) );
-      tuh_hid_mouse_mounted_cb(dev_addr);
-    } else
-    #endif
+    hidh_interface_mount(dev_addr, p_hid);
+    tuh_hid_mouse_mounted_cb(dev_addr);
+    return true;
+  }
+  #endif
 
-    {
-      // Not supported protocol
-      return false;
-    }
-  }else
+  #if CFG_TUSB_HOST_HID_GENERIC
+  if ( p_hid == &generich_data[dev_addr-1].itf )
   {
-    // Not supported subclass
-    return false;
+    TU_ASSERT( generic_get_report_descriptor(dev_addr, p_hid->interface_number, generich_data[dev_addr-1].report_desc_len) );
+    return true;
   }
+  #endif
 
-  *p_length = sizeof(tusb_desc_interface_t) + sizeof(tusb_hid_descriptor_hid_t) + sizeof(tusb_desc_endpoint_t);
-
-  return true;
+  return false;
 }
 
-void hidh_isr(pipe_handle_t pipe_hdl, xfer_result_t event, uint32_t xferred_bytes)
+void hidh_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
 {
-  (void) xferred_bytes; // TODO may need to use this para later
+  (void) xferred_bytes; // reports of keyboard and mouse have fixed size
 
 #if CFG_TUH_HID_KEYBOARD
-  if ( pipehandle_is_equal(pipe_hdl, keyboardh_data[pipe_hdl.dev_addr-1].pipe_hdl) )
+  if ( ep_addr == keyboardh_data[dev_addr-1].ep_in )
   {
-    tuh_hid_keyboard_isr(pipe_hdl.dev_addr, event);
+    #if CFG_TUH_HID_RING
+    hidh_interface_xfer_done(dev_addr, &keyboardh_data[dev_addr-1], event, xferred_bytes);
+    #endif
+
+    tuh_hid_keyboard_isr(dev_addr, event);
     return;
   }
 #endif
 
 #if CFG_TUH_HID_MOUSE
-  if ( pipehandle_is_equal(pipe_hdl, mouseh_data[pipe_hdl.dev_addr-1].pipe_hdl) )
+  if ( ep_addr == mouseh_data[dev_addr-1].ep_in )
   {
-    tuh_hid_mouse_isr(pipe_hdl.dev_addr, event);
+    #if CFG_TUH_HID_RING
+    hidh_interface_xfer_done(dev_addr, &mouseh_data[dev_addr-1], event, xferred_bytes);
+    #endif
+
+    tuh_hid_mouse_isr(dev_addr, event);
     return;
   }
 #endif
 
 #if CFG_TUSB_HOST_HID_GENERIC
+  if ( ep_addr == generich_data[dev_addr-1].itf.ep_in )
+  {
+    #if CFG_TUH_HID_RING
+    hidh_interface_xfer_done(dev_addr, &generich_data[dev_addr-1].itf, event, xferred_bytes);
+    #endif
 
+    tuh_hid_generic_isr(dev_addr, event, xferred_bytes);
+    return;
+  }
 #endif
 }
 
 void hidh_close(uint8_t dev_addr)
 {
 #if CFG_TUH_HID_KEYBOARD
-  if ( pipehandle_is_valid( keyboardh_data[dev_addr-1].pipe_hdl ) )
+  if ( keyboardh_data[dev_addr-1].ep_in != 0 )
   {
+    bool const mounted = keyboardh_data[dev_addr-1].mounted;
     hidh_interface_close(&keyboardh_data[dev_addr-1]);
-    tuh_hid_keyboard_unmounted_cb(dev_addr);
+    if ( mounted ) tuh_hid_keyboard_unmounted_cb(dev_addr);
   }
 #endif
 
 #if CFG_TUH_HID_MOUSE
-  if( pipehandle_is_valid( mouseh_data[dev_addr-1].pipe_hdl ) )
+  if ( mouseh_data[dev_addr-1].ep_in != 0 )
   {
+    bool const mounted = mouseh_data[dev_addr-1].mounted;
     hidh_interface_close(&mouseh_data[dev_addr-1]);
-    tuh_hid_mouse_unmounted_cb( dev_addr );
+    if ( mounted ) tuh_hid_mouse_unmounted_cb( dev_addr );
   }
 #endif
 
 #if CFG_TUSB_HOST_HID_GENERIC
-  hidh_generic_close(dev_addr);
+  if ( generich_data[dev_addr-1].itf.ep_in != 0 )
+  {
+    bool const mounted = generich_data[dev_addr-1].itf.mounted;
+    tu_memclr(&generich_data[dev_addr-1], sizeof(hidh_generic_info_t));
+    if ( mounted ) tuh_hid_generic_unmounted_cb(dev_addr);
+  }
 #endif
 }
 
-
-
 #endif
@@ -33,6 +33,8 @@
 #include "common/tusb_common.h"
 #include "host/usbh.h"
 #include "hid.h"
+#include "hid_host_parser.h"
+#include "hid_host_ring.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -173,37 +175,87 @@ void tuh_hid_mouse_unmounted_cb(uint8_t dev_addr);
 //--------------------------------------------------------------------+
 // GENERIC Application API
 //--------------------------------------------------------------------+
-/** \addtogroup ClassDriver_HID_Generic Generic (not supported yet)
+/** \addtogroup ClassDriver_HID_Generic Generic
  *  @{ */
 
 /** \defgroup Generic_Host Host
- *  The interface API includes status checking function, data transferring function and callback functions
+ *  Interface other than boot keyboard and mouse e.g gamepad, digitizer. Report descriptor is compiled at mount
+ *  into a report map (see \ref HID_Host_Parser) used to extract values from received reports.
  *  @{ */
 
+// Buffer of each device to fetch report descriptor at mount, larger descriptor is not supported
+#ifndef CFG_TUH_HID_REPORT_DESC_BUFSIZE
+#define CFG_TUH_HID_REPORT_DESC_BUFSIZE   256
+#endif
+
 bool          tuh_hid_generic_is_mounted(uint8_t dev_addr);
-tusb_error_t  tuh_hid_generic_get_report(uint8_t dev_addr, void* p_report, bool int_on_complete);
-tusb_error_t  tuh_hid_generic_set_report(uint8_t dev_addr, void* p_report, bool int_on_complete);
-tusb_interface_status_t tuh_hid_generic_get_status(uint8_t dev_addr);
-tusb_interface_status_t tuh_hid_generic_set_status(uint8_t dev_addr);
+bool          tuh_hid_generic_is_busy(uint8_t dev_addr);
+
+/// Report map compiled from report descriptor, NULL if not mounted
+tuh_hid_report_map_t const* tuh_hid_generic_get_report_map(uint8_t dev_addr);
+
+/** \brief        Perform a get report from Generic interface
+ * \param[in]     dev_addr device address
+ * \param[in,out] p_report buffer of endpoint size to store report, first byte is report ID if device uses it.
+ *                Must be accessible by usb controller (see \ref CFG_TUSB_MEM_SECTION)
+ * \note          This function is non-blocking, the result is reported by \ref tuh_hid_generic_isr
+ */
+tusb_error_t  tuh_hid_generic_get_report(uint8_t dev_addr, void* p_report);
 
 //------------- Application Callback -------------//
-void tuh_hid_generic_isr(uint8_t dev_addr, xfer_result_t event);
+void tuh_hid_generic_isr(uint8_t dev_addr, xfer_result_t event, uint32_t xferred_bytes);
+void tuh_hid_generic_mounted_cb(uint8_t dev_addr);
+void tuh_hid_generic_unmounted_cb(uint8_t dev_addr);
 
 /** @} */ // Generic_Host
 /** @} */ // ClassDriver_HID_Generic
 
+//--------------------------------------------------------------------+
+// REPORT RING Application API
+//--------------------------------------------------------------------+
+/** \addtogroup HID_Host_Ring
+ *  @{
+ * \defgroup Ring_Host Host
+ *  With \ref CFG_TUH_HID_RING, interrupt IN endpoint of keyboard, mouse and generic interface is armed at mount and
+ *  stays armed until unmount or a failed transfer. The interface's isr callback is invoked for every report stored,
+ *  reports are read from the ring in order they are received. Interface is selected by protocol: HID_PROTOCOL_KEYBOARD,
+ *  HID_PROTOCOL_MOUSE or HID_PROTOCOL_NONE for generic. tuh_hid_*_get_report() return TUSB_ERROR_INTERFACE_IS_BUSY
+ *  since endpoint is owned by the driver. Transfers that could not be queued at mount because host controller was out
+ *  of transfer descriptors are queued by tuh_hid_report_available() and tuh_hid_report_read(), which must therefore
+ *  be called from the thread running tuh_task().
+ *  @{ */
+
+/// Number of unread reports, 0 if interface is not mounted
+uint8_t tuh_hid_report_available(uint8_t dev_addr, uint8_t protocol);
+
+/// Copy oldest unread report, return false if there is none
+bool tuh_hid_report_read(uint8_t dev_addr, uint8_t protocol, tuh_hid_report_t* report);
+
+/// Report and overrun statistics since mount, NULL if interface is not mounted
+tuh_hid_ring_stats_t const* tuh_hid_report_stats(uint8_t dev_addr, uint8_t protocol);
+
+/** @} */ // Ring_Host
+/** @} */ // HID_Host_Ring
+
 //--------------------------------------------------------------------+
 // Internal Class Driver API
 //--------------------------------------------------------------------+
 typedef struct {
-  pipe_handle_t pipe_hdl;
+  uint8_t  ep_in;
+  uint8_t  interface_number;
   uint16_t report_size;
-  uint8_t interface_number;
+  bool     mounted; // requests sent at open are complete
+
+#if CFG_TUH_HID_RING
+  uint8_t  rhport;
+  bool     stopped; // transfer failed, endpoint is no longer polled
+  tuh_hid_ring_t ring;
+#endif
 }hidh_interface_info_t;
 
 void hidh_init(void);
-bool hidh_open_subtask(uint8_t dev_addr, tusb_desc_interface_t const *p_interface_desc, uint16_t *p_length);
-void hidh_isr(pipe_handle_t pipe_hdl, xfer_result_t event, uint32_t xferred_bytes);
+bool hidh_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *p_interface_desc, uint16_t *p_length);
+void hidh_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
 void hidh_close(uint8_t dev_addr);
 
 #ifdef __cplusplus
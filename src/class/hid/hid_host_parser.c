@@ -0,0 +1,443 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_HID_PARSER
+
+#include "common/tusb_common.h"
+#include "hid_host_parser.h"
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+
+// Item tags HID 1.11 section 6.2.2
+enum
+{
+  MAIN_INPUT          = 8,
+  MAIN_OUTPUT         = 9,
+  MAIN_COLLECTION     = 10,
+  MAIN_FEATURE        = 11,
+  MAIN_COLLECTION_END = 12,
+
+  GLOBAL_USAGE_PAGE   = 0,
+  GLOBAL_LOGICAL_MIN  = 1,
+  GLOBAL_LOGICAL_MAX  = 2,
+  GLOBAL_REPORT_SIZE  = 7,
+  GLOBAL_REPORT_ID    = 8,
+  GLOBAL_REPORT_COUNT = 9,
+  GLOBAL_PUSH         = 10,
+  GLOBAL_POP          = 11,
+
+  LOCAL_USAGE         = 0,
+  LOCAL_USAGE_MIN     = 1,
+  LOCAL_USAGE_MAX     = 2,
+};
+
+enum { ITEM_LONG_PREFIX = 0xFE };
+
+enum { GLOBAL_STACK_DEPTH = 2 };
+
+typedef struct
+{
+  uint16_t usage_page;
+  uint8_t  report_id;
+  uint8_t  report_size;
+  uint16_t report_count;
+  int32_t  logical_min;
+  int32_t  logical_max;
+  bool     logical_max_unsigned; // 1-byte 0xFF for 255 is common with logical minimum 0
+  uint32_t logical_max_raw;
+} parser_global_t;
+
+typedef struct
+{
+  uint32_t usages[CFG_TUH_HID_USAGE_MAX]; // extended usage with page in high 16-bit
+  uint8_t  usage_count;
+
+  uint32_t usage_min;
+  uint32_t usage_max;
+  bool     has_min;
+  bool     has_max;
+} parser_local_t;
+
+typedef struct
+{
+  tuh_hid_report_map_t* map;
+
+  parser_global_t global;
+  parser_global_t stack[GLOBAL_STACK_DEPTH];
+  uint8_t         stack_depth;
+
+  parser_local_t  local;
+  uint8_t         collection_depth;
+} parser_t;
+
+//--------------------------------------------------------------------+
+// INTERNAL HELPER
+//--------------------------------------------------------------------+
+static inline uint32_t item_udata(uint8_t const* data, uint8_t size)
+{
+  uint32_t value = 0;
+  for(uint8_t i=0; i<size; i++) value |= ((uint32_t) data[i]) << (8*i);
+  return value;
+}
+
+static inline int32_t item_sdata(uint8_t const* data, uint8_t size)
+{
+  uint32_t const value = item_udata(data, size);
+  if ( size == 0 || size == 4 ) return (int32_t) value;
+
+  uint32_t const sign = 1UL << (8*size - 1);
+  return (int32_t) ((value ^ sign) - sign);
+}
+
+// extend 16-bit usage with current page, 32-bit usage already has its page
+static inline uint32_t usage_extended(parser_t const* p, uint8_t const* data, uint8_t size)
+{
+  uint32_t const usage = item_udata(data, size);
+  return (size == 4) ? usage : ((((uint32_t) p->global.usage_page) << 16) | usage);
+}
+
+// Bit position is tracked in report length field while parsing, converted to bytes at the end
+static tuh_hid_report_info_t* report_get(parser_t* p, uint8_t report_id)
+{
+  tuh_hid_report_map_t* map = p->map;
+
+  for(uint8_t i=0; i<map->report_count; i++)
+  {
+    if ( map->reports[i].report_id == report_id ) return &map->reports[i];
+  }
+
+  TU_VERIFY(map->report_count < CFG_TUH_HID_REPORT_MAX, NULL);
+
+  tuh_hid_report_info_t* report = &map->reports[map->report_count++];
+  report->report_id = report_id;
+
+  // data follows report ID byte
+  uint16_t const start = report_id ? 8 : 0;
+  for(uint8_t t=0; t<3; t++) report->length[t] = start;
+
+  return report;
+}
+
+static bool field_add(parser_t* p, uint8_t report_type, uint8_t flags, uint16_t bit_offset, uint16_t count,
+                      uint32_t usage_min, uint32_t usage_max)
+{
+  tuh_hid_report_map_t* map = p->map;
+  TU_VERIFY(map->field_count < CFG_TUH_HID_FIELD_MAX);
+
+  tuh_hid_field_t* field = &map->fields[map->field_count++];
+
+  field->usage_page  = (uint16_t) (usage_min >> 16);
+  field->usage_min   = (uint16_t) usage_min;
+  field->usage_max   = (uint16_t) usage_max;
+  field->bit_offset  = bit_offset;
+  field->count       = count;
+  field->bit_size    = p->global.report_size;
+  field->report_id   = p->global.report_id;
+  field->report_type = report_type;
+  field->flags       = flags;
+  field->logical_min = p->global.logical_min;
+  field->logical_max = p->global.logical_max;
+
+  if ( p->global.logical_max_unsigned && p->global.logical_min >= 0 )
+  {
+    field->logical_max = (int32_t) p->global.logical_max_raw;
+  }
+
+  return true;
+}
+
+// Usage of variable element i: from usage range or usage list.
+// Return 0 if element has no usage e.g report count is larger than number of usages
+static uint32_t variable_usage(parser_local_t const* local, uint16_t i)
+{
+  if ( local->has_min && local->has_max )
+  {
+    uint32_t const usage = local->usage_min + i;
+    return (usage <= local->usage_max) ? usage : 0;
+  }
+
+  if ( local->usage_count == 0 ) return 0;
+  return (i < local->usage_count) ? local->usages[i] : 0;
+}
+
+// Compile Input/Output/Feature item into fields
+static bool main_data_item(parser_t* p, uint8_t report_type, uint32_t flags)
+{
+  parser_global_t const* g = &p->global;
+  parser_local_t const* local = &p->local;
+
+  tuh_hid_report_info_t* report = report_get(p, g->report_id);
+  TU_VERIFY(report);
+
+  uint16_t const bit_offset = report->length[report_type-1];
+  uint32_t const total_bits = (uint32_t) g->report_size * g->report_count;
+
+  TU_VERIFY(bit_offset + total_bits <= UINT16_MAX);
+  report->length[report_type-1] = (uint16_t) (bit_offset + total_bits);
+
+  // padding or unsupported element size
+  if ( (flags & HID_CONSTANT) || g->report_size == 0 || g->report_size > 32 || g->report_count == 0 ) return true;
+
+  if ( flags & HID_VARIABLE )
+  {
+    // group elements with consecutive usages into one field
+    uint16_t i = 0;
+    while ( i < g->report_count )
+    {
+      uint32_t const first = variable_usage(local, i);
+      uint16_t n = 1;
+
+      while ( (i + n < g->report_count) && first && (variable_usage(local, i+n) == first + n) ) n++;
+
+      if ( first )
+      {
+        TU_VERIFY( field_add(p, report_type, (uint8_t) flags, (uint16_t) (bit_offset + i*g->report_size), n, first, first + n - 1) );
+      }
+
+      i += n;
+    }
+  }
+  else
+  {
+    // Array: element values are indexes into usage range
+    uint32_t usage_min, usage_max;
+
+    if ( local->has_min && local->has_max )
+    {
+      usage_min = local->usage_min;
+      usage_max = local->usage_max;
+    }
+    else if ( local->usage_count )
+    {
+      usage_min = local->usages[0];
+      usage_max = local->usages[local->usage_count-1];
+    }
+    else
+    {
+      return true;
+    }
+
+    TU_VERIFY( field_add(p, report_type, (uint8_t) flags, bit_offset, g->report_count, usage_min, usage_max) );
+  }
+
+  return true;
+}
+
+static bool parse_item(parser_t* p, uint8_t type, uint8_t tag, uint8_t const* data, uint8_t size)
+{
+  parser_global_t* g = &p->global;
+  parser_local_t* local = &p->local;
+
+  switch ( type )
+  {
+    case RI_TYPE_MAIN:
+    {
+      uint32_t const value = item_udata(data, size);
+
+      switch ( tag )
+      {
+        case MAIN_INPUT  : TU_VERIFY( main_data_item(p, HID_REPORT_TYPE_INPUT  , value) ); break;
+        case MAIN_OUTPUT : TU_VERIFY( main_data_item(p, HID_REPORT_TYPE_OUTPUT , value) ); break;
+        case MAIN_FEATURE: TU_VERIFY( main_data_item(p, HID_REPORT_TYPE_FEATURE, value) ); break;
+
+        case MAIN_COLLECTION:
+          if ( p->collection_depth == 0 && value == HID_COLLECTION_APPLICATION && p->map->usage == 0 && local->usage_count )
+          {
+            p->map->usage_page = (uint16_t) (local->usages[0] >> 16);
+            p->map->usage      = (uint16_t) local->usages[0];
+          }
+          p->collection_depth++;
+        break;
+
+        case MAIN_COLLECTION_END:
+          TU_VERIFY(p->collection_depth);
+          p->collection_depth--;
+        break;
+
+        default: break;
+      }
+
+      // local items only apply to the next main item
+      tu_memclr(local, sizeof(parser_local_t));
+    }
+    break;
+
+    case RI_TYPE_GLOBAL:
+      switch ( tag )
+      {
+        case GLOBAL_USAGE_PAGE  : g->usage_page   = (uint16_t) item_udata(data, size); break;
+        case GLOBAL_REPORT_SIZE : g->report_size  = (uint8_t ) item_udata(data, size); break;
+        case GLOBAL_REPORT_COUNT: g->report_count = (uint16_t) item_udata(data, size); break;
+        case GLOBAL_LOGICAL_MIN : g->logical_min  = item_sdata(data, size);            break;
+
+        case GLOBAL_LOGICAL_MAX:
+          g->logical_max          = item_sdata(data, size);
+          g->logical_max_raw      = item_udata(data, size);
+          g->logical_max_unsigned = (g->logical_max < 0);
+        break;
+
+        case GLOBAL_REPORT_ID:
+          g->report_id = (uint8_t) item_udata(data, size);
+          TU_VERIFY(g->report_id);
+        break;
+
+        case GLOBAL_PUSH:
+          TU_VERIFY(p->stack_depth < GLOBAL_STACK_DEPTH);
+          p->stack[p->stack_depth++] = *g;
+        break;
+
+        case GLOBAL_POP:
+          TU_VERIFY(p->stack_depth);
+          *g = p->stack[--p->stack_depth];
+        break;
+
+        default: break; // physical range, unit are not used
+      }
+    break;
+
+    case RI_TYPE_LOCAL:
+      switch ( tag )
+      {
+        case LOCAL_USAGE:
+          if ( local->usage_count < CFG_TUH_HID_USAGE_MAX ) local->usages[local->usage_count++] = usage_extended(p, data, size);
+        break;
+
+        case LOCAL_USAGE_MIN:
+          local->usage_min = usage_extended(p, data, size);
+          local->has_min   = true;
+        break;
+
+        case LOCAL_USAGE_MAX:
+          local->usage_max = usage_extended(p, data, size);
+          local->has_max   = true;
+        break;
+
+        default: break; // designator, string are not used
+      }
+    break;
+
+    default: break; // reserved
+  }
+
+  return true;
+}
+
+//--------------------------------------------------------------------+
+// APPLICATION API
+//--------------------------------------------------------------------+
+bool tuh_hid_parse_report_descriptor(tuh_hid_report_map_t* map, uint8_t const* desc, uint16_t desc_len)
+{
+  parser_t parser;
+  tu_memclr(&parser, sizeof(parser_t));
+  tu_memclr(map, sizeof(tuh_hid_report_map_t));
+  parser.map = map;
+
+  uint8_t const* desc_end = desc + desc_len;
+  bool ok = true;
+
+  while ( ok && desc < desc_end )
+  {
+    uint8_t const prefix = *desc;
+
+    if ( prefix == ITEM_LONG_PREFIX )
+    {
+      // long item: no long item tag is defined, skip it
+      ok = (desc + 3 <= desc_end);
+      if ( ok ) desc += 3 + desc[1];
+      continue;
+    }
+
+    uint8_t const size = (prefix & 0x03) == 3 ? 4 : (prefix & 0x03);
+    uint8_t const type = (prefix >> 2) & 0x03;
+    uint8_t const tag  = prefix >> 4;
+
+    ok = (desc + 1 + size <= desc_end) && parse_item(&parser, type, tag, desc + 1, size);
+    desc += 1 + size;
+  }
+
+  // convert bit position to report length in bytes
+  for(uint8_t i=0; i<map->report_count; i++)
+  {
+    tuh_hid_report_info_t* report = &map->reports[i];
+    uint16_t const start = report->report_id ? 8 : 0;
+
+    for(uint8_t t=0; t<3; t++)
+    {
+      report->length[t] = (report->length[t] == start) ? 0 : (uint16_t) ((report->length[t] + 7) / 8);
+    }
+  }
+
+  return ok && (desc == desc_end);
+}
+
+tuh_hid_field_t const* tuh_hid_find_field(tuh_hid_report_map_t const* map, uint8_t report_type, uint16_t usage_page, uint16_t usage)
+{
+  for(uint8_t i=0; i<map->field_count; i++)
+  {
+    tuh_hid_field_t const* field = &map->fields[i];
+
+    if ( field->report_type == report_type && field->usage_page == usage_page &&
+         field->usage_min <= usage && usage <= field->usage_max )
+    {
+      return field;
+    }
+  }
+
+  return NULL;
+}
+
+uint16_t tuh_hid_report_length(tuh_hid_report_map_t const* map, uint8_t report_type, uint8_t report_id)
+{
+  TU_VERIFY(report_type >= HID_REPORT_TYPE_INPUT && report_type <= HID_REPORT_TYPE_FEATURE, 0);
+
+  for(uint8_t i=0; i<map->report_count; i++)
+  {
+    if ( map->reports[i].report_id == report_id ) return map->reports[i].length[report_type-1];
+  }
+
+  return 0;
+}
+
+bool tuh_hid_field_array_contains(tuh_hid_field_t const* field, uint8_t const* report, uint16_t usage)
+{
+  TU_VERIFY(field->usage_min <= usage && usage <= field->usage_max);
+
+  // value of element is the index of usage in range
+  int32_t const value = field->logical_min + (usage - field->usage_min);
+
+  for(uint16_t i=0; i<field->count; i++)
+  {
+    if ( tuh_hid_field_get_value(field, report, i) == value ) return true;
+  }
+
+  return false;
+}
+
+#endif
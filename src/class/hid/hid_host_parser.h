@@ -0,0 +1,163 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#ifndef _TUSB_HID_HOST_PARSER_H_
+#define _TUSB_HID_HOST_PARSER_H_
+
+#include "common/tusb_common.h"
+#include "hid.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** \addtogroup ClassDriver_HID
+ *  @{
+ * \defgroup HID_Host_Parser Host Report Parser
+ *  Report descriptor is compiled once at mount into a table of fields with fixed bit offset, size and logical
+ *  range. Application looks up the fields it is interested in (e.g X, Y, buttons) once, then extracts values from
+ *  each received report with a shift and mask without walking the descriptor again.
+ *  @{ */
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Max number of fields compiled from a report descriptor
+#ifndef CFG_TUH_HID_FIELD_MAX
+#define CFG_TUH_HID_FIELD_MAX     32
+#endif
+
+// Max number of reports (report IDs) of a report descriptor
+#ifndef CFG_TUH_HID_REPORT_MAX
+#define CFG_TUH_HID_REPORT_MAX    4
+#endif
+
+// Max number of usages declared for a single main item
+#ifndef CFG_TUH_HID_USAGE_MAX
+#define CFG_TUH_HID_USAGE_MAX     16
+#endif
+
+//--------------------------------------------------------------------+
+// Report Map
+//--------------------------------------------------------------------+
+
+/// Consecutive elements of a main item sharing size and logical range.
+/// Variable element i has usage (usage_min + i). Array element holds index of usage (usage_min + value - logical_min)
+typedef struct
+{
+  uint16_t usage_page;
+  uint16_t usage_min;
+  uint16_t usage_max;
+  uint16_t bit_offset;  ///< of first element from start of report, including report ID byte if any
+  uint16_t count;       ///< number of elements
+  uint8_t  bit_size;    ///< of each element, up to 32
+  uint8_t  report_id;   ///< 0 if device does not use report ID
+  uint8_t  report_type; ///< \ref hid_report_type_t
+  uint8_t  flags;       ///< Input/Output/Feature item data e.g HID_VARIABLE, HID_RELATIVE
+  int32_t  logical_min;
+  int32_t  logical_max;
+} tuh_hid_field_t;
+
+typedef struct
+{
+  uint8_t  report_id;
+  uint16_t length[3];   ///< in bytes including report ID, indexed by (report_type - 1)
+} tuh_hid_report_info_t;
+
+typedef struct
+{
+  uint16_t usage_page;  ///< of first application collection e.g Desktop
+  uint16_t usage;       ///< of first application collection e.g Gamepad
+  uint8_t  field_count;
+  uint8_t  report_count;
+
+  tuh_hid_field_t       fields [CFG_TUH_HID_FIELD_MAX];
+  tuh_hid_report_info_t reports[CFG_TUH_HID_REPORT_MAX];
+} tuh_hid_report_map_t;
+
+/** \brief      Compile report descriptor into field table
+ * \retval      false if descriptor is malformed or does not fit in \ref CFG_TUH_HID_FIELD_MAX / \ref CFG_TUH_HID_REPORT_MAX.
+ *              Fields compiled before the error are still valid.
+ */
+bool tuh_hid_parse_report_descriptor(tuh_hid_report_map_t* map, uint8_t const* desc, uint16_t desc_len);
+
+/// Find data field of usage in reports of report_type, NULL if not found. Should be done once at mount
+tuh_hid_field_t const* tuh_hid_find_field(tuh_hid_report_map_t const* map, uint8_t report_type, uint16_t usage_page, uint16_t usage);
+
+/// Length in bytes including report ID, 0 if report does not exist
+uint16_t tuh_hid_report_length(tuh_hid_report_map_t const* map, uint8_t report_type, uint8_t report_id);
+
+/// Check if report received from device contains field
+static inline bool tuh_hid_field_in_report(tuh_hid_field_t const* field, uint8_t const* report)
+{
+  return (field->report_id == 0) || (report[0] == field->report_id);
+}
+
+/// Raw value of element, report must contain field
+static inline uint32_t tuh_hid_field_get_raw(tuh_hid_field_t const* field, uint8_t const* report, uint16_t index)
+{
+  uint32_t const bit   = field->bit_offset + (uint32_t) index*field->bit_size;
+  uint8_t  const shift = bit & 7;
+  uint8_t  const* p    = report + (bit >> 3);
+
+  // element spans at most 5 bytes
+  uint64_t value = 0;
+  for(uint8_t i=0; i < (shift + field->bit_size + 7)/8; i++) value |= ((uint64_t) p[i]) << (8*i);
+
+  return (uint32_t) ((value >> shift) & (UINT32_MAX >> (32 - field->bit_size)));
+}
+
+/// Value of element, sign extended if logical minimum is negative
+static inline int32_t tuh_hid_field_get_value(tuh_hid_field_t const* field, uint8_t const* report, uint16_t index)
+{
+  uint32_t const raw = tuh_hid_field_get_raw(field, report, index);
+
+  if ( field->logical_min < 0 && field->bit_size < 32 && (raw & (1UL << (field->bit_size-1))) )
+  {
+    return (int32_t) (raw | (UINT32_MAX << field->bit_size));
+  }
+
+  return (int32_t) raw;
+}
+
+/// Value of variable field's element having usage, usage must be within field's usage range
+static inline int32_t tuh_hid_field_get_usage_value(tuh_hid_field_t const* field, uint8_t const* report, uint16_t usage)
+{
+  return tuh_hid_field_get_value(field, report, (uint16_t) (usage - field->usage_min));
+}
+
+/// Check if usage of array field (e.g keycode) is present in report
+bool tuh_hid_field_array_contains(tuh_hid_field_t const* field, uint8_t const* report, uint16_t usage);
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_HID_HOST_PARSER_H_ */
+
+/// @}
+/// @}
@@ -0,0 +1,106 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_HID_RING
+
+#include "common/tusb_common.h"
+#include "hid_host_ring.h"
+
+//--------------------------------------------------------------------+
+// APPLICATION API
+//--------------------------------------------------------------------+
+void tuh_hid_ring_init(tuh_hid_ring_t* ring)
+{
+  tu_memclr(ring, offsetof(tuh_hid_ring_t, xfer_buf));
+}
+
+uint8_t* tuh_hid_ring_xfer_buffer(tuh_hid_ring_t* ring)
+{
+  if ( ring->xfer_count == CFG_TUH_HID_RING_ARMED ) return NULL;
+
+  return ring->xfer_buf[(ring->xfer_rd + ring->xfer_count) % CFG_TUH_HID_RING_ARMED];
+}
+
+void tuh_hid_ring_xfer_queued(tuh_hid_ring_t* ring)
+{
+  TU_ASSERT(ring->xfer_count < CFG_TUH_HID_RING_ARMED, );
+  ring->xfer_count++;
+}
+
+void tuh_hid_ring_xfer_complete(tuh_hid_ring_t* ring, xfer_result_t result, uint32_t xferred_bytes, uint32_t timestamp)
+{
+  // stale completion after ring is cleared
+  TU_VERIFY(ring->xfer_count, );
+
+  uint8_t const* buffer = ring->xfer_buf[ring->xfer_rd];
+  ring->xfer_rd = (uint8_t) ((ring->xfer_rd + 1) % CFG_TUH_HID_RING_ARMED);
+  ring->xfer_count--;
+
+  if ( XFER_RESULT_SUCCESS != result )
+  {
+    ring->stats.error_count++;
+    return;
+  }
+
+  if ( xferred_bytes == 0 ) return;
+
+  // full: newest report replaces oldest unread one
+  if ( ring->count == CFG_TUH_HID_RING_DEPTH )
+  {
+    ring->rd = (uint8_t) ((ring->rd + 1) % CFG_TUH_HID_RING_DEPTH);
+    ring->count--;
+    ring->stats.overrun_count++;
+  }
+
+  tuh_hid_report_t* report = &ring->report[(ring->rd + ring->count) % CFG_TUH_HID_RING_DEPTH];
+  report->timestamp = timestamp;
+  report->len       = (uint16_t) tu_min32(xferred_bytes, CFG_TUH_HID_RING_REPORT_SIZE);
+  memcpy(report->data, buffer, report->len);
+
+  ring->count++;
+  ring->stats.report_count++;
+  ring->stats.max_unread = tu_max8(ring->stats.max_unread, ring->count);
+}
+
+bool tuh_hid_ring_read(tuh_hid_ring_t* ring, tuh_hid_report_t* report)
+{
+  TU_VERIFY(ring->count);
+
+  tuh_hid_report_t const* oldest = &ring->report[ring->rd];
+
+  report->timestamp = oldest->timestamp;
+  report->len       = oldest->len;
+  memcpy(report->data, oldest->data, oldest->len);
+
+  ring->rd = (uint8_t) ((ring->rd + 1) % CFG_TUH_HID_RING_DEPTH);
+  ring->count--;
+
+  return true;
+}
+
+#endif
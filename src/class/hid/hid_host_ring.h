@@ -0,0 +1,136 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#ifndef _TUSB_HID_HOST_RING_H_
+#define _TUSB_HID_HOST_RING_H_
+
+#include "common/tusb_common.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** \addtogroup ClassDriver_HID
+ *  @{
+ * \defgroup HID_Host_Ring Host Report Ring
+ *  Keeps \ref CFG_TUH_HID_RING_ARMED transfers queued on interrupt IN endpoint so host controller still has one
+ *  while the completed transfer waits for tuh_task(). Each completed report is copied with its timestamp into a
+ *  ring of \ref CFG_TUH_HID_RING_DEPTH reports and the transfer buffer is queued again right away. When application
+ *  does not read in time, the oldest unread report is overwritten and counted as overrun: endpoint is never left
+ *  idle and application always gets the most recent reports.
+ *  @{ */
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Number of unread reports kept for each interface
+#ifndef CFG_TUH_HID_RING_DEPTH
+#define CFG_TUH_HID_RING_DEPTH        8
+#endif
+
+// Transfers queued on interrupt IN endpoint (CFG_TUH_HID_RING_ARMED in tusb_option.h) should cover polling
+// intervals elapsed until tuh_task() runs
+
+// Max report size, interface with larger endpoint is not mounted
+#ifndef CFG_TUH_HID_RING_REPORT_SIZE
+#define CFG_TUH_HID_RING_REPORT_SIZE  64
+#endif
+
+TU_VERIFY_STATIC(0 < CFG_TUH_HID_RING_DEPTH && CFG_TUH_HID_RING_DEPTH < 256, "depth must be between 1 and 255");
+TU_VERIFY_STATIC(0 < CFG_TUH_HID_RING_ARMED && CFG_TUH_HID_RING_ARMED < 256, "armed must be between 1 and 255");
+
+//--------------------------------------------------------------------+
+// Report Ring
+//--------------------------------------------------------------------+
+
+/// Report read from ring
+typedef struct
+{
+  uint32_t timestamp;  ///< hcd_frame_number() (ms) when completion is processed by tuh_task()
+  uint16_t len;
+  uint8_t  data[CFG_TUH_HID_RING_REPORT_SIZE];
+} tuh_hid_report_t;
+
+/// Ring statistics
+typedef struct
+{
+  uint32_t report_count;   ///< reports received
+  uint32_t overrun_count;  ///< unread reports overwritten by newer ones
+  uint32_t error_count;    ///< failed transfers
+  uint8_t  max_unread;     ///< max unread reports
+} tuh_hid_ring_stats_t;
+
+typedef struct
+{
+  tuh_hid_report_t report[CFG_TUH_HID_RING_DEPTH];
+  uint8_t rd;
+  uint8_t count;
+
+  // transfers queued on endpoint, completed in order
+  uint8_t xfer_rd;
+  uint8_t xfer_count;
+
+  tuh_hid_ring_stats_t stats;
+
+  // must be accessible by USB controller, see CFG_TUSB_MEM_SECTION
+  TU_ATTR_ALIGNED(4) uint8_t xfer_buf[CFG_TUH_HID_RING_ARMED][CFG_TUH_HID_RING_REPORT_SIZE];
+} tuh_hid_ring_t;
+
+/// Discard reports and transfers, statistics are cleared
+void tuh_hid_ring_init(tuh_hid_ring_t* ring);
+
+/// Buffer of next transfer to queue on endpoint, NULL if all transfer buffers are queued
+uint8_t* tuh_hid_ring_xfer_buffer(tuh_hid_ring_t* ring);
+
+/// Transfer with buffer returned by tuh_hid_ring_xfer_buffer() is queued
+void tuh_hid_ring_xfer_queued(tuh_hid_ring_t* ring);
+
+/// Oldest queued transfer is complete. Report is stored with timestamp, zero length or failed transfer is not
+void tuh_hid_ring_xfer_complete(tuh_hid_ring_t* ring, xfer_result_t result, uint32_t xferred_bytes, uint32_t timestamp);
+
+/// Copy oldest unread report, return false if there is none
+bool tuh_hid_ring_read(tuh_hid_ring_t* ring, tuh_hid_report_t* report);
+
+/// Number of unread reports
+static inline uint8_t tuh_hid_ring_count(tuh_hid_ring_t const* ring)
+{
+  return ring->count;
+}
+
+static inline tuh_hid_ring_stats_t const* tuh_hid_ring_get_stats(tuh_hid_ring_t const* ring)
+{
+  return &ring->stats;
+}
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_HID_HOST_RING_H_ */
+
+/// @}
+/// @}
@@ -40,6 +40,7 @@
 //--------------------------------------------------------------------+
 typedef struct
 {
+  uint8_t rhport;
   uint8_t itf_num;
   uint8_t ep_in;
   uint8_t ep_out;
@@ -158,12 +159,12 @@ static bool maybe_transmit(midid_interface_t* midi, uint8_t itf_index)
   (void) itf_index;
 
   // skip if previous transfer not complete
-  TU_VERIFY( !usbd_edpt_busy(TUD_OPT_RHPORT, midi->ep_in) );
+  TU_VERIFY( !usbd_edpt_busy(midi->rhport, midi->ep_in) );
 
   uint16_t count = tu_fifo_read_n(&midi->tx_ff, midi->epin_buf, CFG_TUD_MIDI_EPSIZE);
   if (count > 0)
   {
-    TU_ASSERT( usbd_edpt_xfer(TUD_OPT_RHPORT, midi->ep_in, midi->epin_buf, count) );
+    TU_ASSERT( usbd_edpt_xfer(midi->rhport, midi->ep_in, midi->epin_buf, count) );
   }
   return true;
 }
@@ -279,11 +280,13 @@ void midid_init(void)
 
 void midid_reset(uint8_t rhport)
 {
-  (void) rhport;
-
   for(uint8_t i=0; i<CFG_TUD_MIDI; i++)
   {
     midid_interface_t* midi = &_midid_itf[i];
+
+    // interface opened by other device port is not affected
+    if ( midi->rhport != rhport ) continue;
+
     tu_memclr(midi, ITF_MEM_RESET_SIZE);
     tu_fifo_clear(&midi->rx_ff);
     tu_fifo_clear(&midi->tx_ff);
@@ -326,6 +329,9 @@ uint16_t midid_open(uint8_t rhport, tusb_desc_interface_t const * desc_itf, uint
     }
   }
 
+  TU_ASSERT(p_midi, 0);
+
+  p_midi->rhport  = rhport;
   p_midi->itf_num = desc_midi->bInterfaceNumber;
 
   // next descriptor
@@ -395,7 +401,7 @@ bool midid_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32
   {
     if (itf >= TU_ARRAY_SIZE(_midid_itf)) return false;
 
-    if ( ep_addr == p_midi->ep_out ) break;
+    if ( rhport == p_midi->rhport && ep_addr == p_midi->ep_out ) break;
   }
 
   // receive new data
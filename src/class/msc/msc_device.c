@@ -49,6 +49,7 @@ typedef struct
   CFG_TUSB_MEM_ALIGN msc_cbw_t cbw;
   CFG_TUSB_MEM_ALIGN msc_csw_t csw;
 
+  uint8_t  rhport;
   uint8_t  itf_num;
   uint8_t  ep_in;
   uint8_t  ep_out;
@@ -152,8 +153,8 @@ void mscd_init(void)
 
 void mscd_reset(uint8_t rhport)
 {
-  (void) rhport;
-  tu_memclr(&_mscd_itf, sizeof(mscd_interface_t));
+  // interface opened by other device port is not affected
+  if ( _mscd_itf.rhport == rhport ) tu_memclr(&_mscd_itf, sizeof(mscd_interface_t));
 }
 
 uint16_t mscd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint16_t max_len)
@@ -170,6 +171,11 @@ uint16_t mscd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint1
   TU_ASSERT(max_len >= drv_len, 0);
 
   mscd_interface_t * p_msc = &_mscd_itf;
+
+  // single instance: already opened by other device port
+  TU_VERIFY(p_msc->ep_in == 0 || p_msc->rhport == rhport, 0);
+
+  p_msc->rhport  = rhport;
   p_msc->itf_num = itf_desc->bInterfaceNumber;
 
   // Open endpoint pair
@@ -419,6 +425,7 @@ bool mscd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t
                  xferred_bytes == sizeof(msc_cbw_t) && p_cbw->signature == MSC_CBW_SIGNATURE );
 
       TU_LOG2("  SCSI Command: %s\r\n", lookup_find(&_msc_scsi_cmd_table, p_cbw->command[0]));
+      TU_TRACE(TU_TRACE_MSC_CMD, p_cbw->command[0], p_cbw->total_bytes);
       // TU_LOG2_MEM(p_cbw, xferred_bytes, 2);
 
       p_csw->signature    = MSC_CSW_SIGNATURE;
@@ -492,6 +499,7 @@ bool mscd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t
 
     case MSC_STAGE_DATA:
       TU_LOG2("  SCSI Data\r\n");
+      TU_TRACE(TU_TRACE_MSC_DATA, ep_addr, xferred_bytes);
       //TU_LOG2_MEM(_mscd_buf, xferred_bytes, 2);
 
       // OUT transfer, invoke callback if needed
@@ -589,6 +597,7 @@ bool mscd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t
       if( (ep_addr == p_msc->ep_in) && (xferred_bytes == sizeof(msc_csw_t)) )
       {
         TU_LOG2("  SCSI Status: %u\r\n", p_csw->status);
+        TU_TRACE(TU_TRACE_MSC_STATUS, ep_addr, p_csw->status);
         // TU_LOG2_MEM(p_csw, xferred_bytes, 2);
 
         // Move to default CMD stage
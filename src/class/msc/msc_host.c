@@ -37,18 +37,32 @@
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
 //--------------------------------------------------------------------+
-CFG_TUSB_MEM_SECTION static msch_interface_t msch_data[CFG_TUSB_HOST_DEVICE_MAX];
 
-//------------- Initalization Data -------------//
-static osal_semaphore_def_t msch_sem_def;
-static osal_semaphore_t msch_sem_hdl;
+enum
+{
+  MSCH_STAGE_IDLE = 0,
+  MSCH_STAGE_CMD,
+  MSCH_STAGE_DATA,
+  MSCH_STAGE_STATUS
+};
 
-// buffer used to read scsi information when mounted, largest response data currently is inquiry
-CFG_TUSB_MEM_SECTION TU_ATTR_ALIGNED(4) static uint8_t msch_buffer[sizeof(scsi_inquiry_resp_t)];
+CFG_TUSB_MEM_SECTION static msch_interface_t msch_data[CFG_TUSB_HOST_DEVICE_MAX];
 
 //--------------------------------------------------------------------+
 // INTERNAL OBJECT & FUNCTION DECLARATION
 //--------------------------------------------------------------------+
+static inline msch_interface_t* get_itf(uint8_t dev_addr)
+{
+  return &msch_data[dev_addr-1];
+}
+
+static inline msch_cmd_t* cmd_get(msch_interface_t* p_msc, uint8_t idx)
+{
+  return &p_msc->cmd[idx & (CFG_TUH_MSC_CMD_QUEUE_SZ-1)];
+}
+
+static bool command_submit(uint8_t dev_addr, msc_cbw_t const* cbw, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx);
+static bool legacy_complete_cb(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx);
 
 //--------------------------------------------------------------------+
 // PUBLIC API
@@ -61,8 +75,8 @@ bool tuh_msc_is_mounted(uint8_t dev_addr)
 
 bool tuh_msc_is_busy(uint8_t dev_addr)
 {
-  return  msch_data[dev_addr-1].is_initialized &&
-          hcd_edpt_busy(dev_addr, msch_data[dev_addr-1].ep_in);
+  msch_interface_t* p_msc = get_itf(dev_addr);
+  return p_msc->is_initialized && (p_msc->cmd_active != p_msc->cmd_wr);
 }
 
 uint8_t const* tuh_msc_get_vendor_name(uint8_t dev_addr)
@@ -80,193 +94,468 @@ tusb_error_t tuh_msc_get_capacity(uint8_t dev_addr, uint32_t* p_last_lba, uint32
   if ( !msch_data[dev_addr-1].is_initialized )   return TUSB_ERROR_MSCH_DEVICE_NOT_MOUNTED;
   TU_ASSERT(p_last_lba != NULL && p_block_size != NULL, TUSB_ERROR_INVALID_PARA);
 
-  (*p_last_lba)   = msch_data[dev_addr-1].last_lba;
-  (*p_block_size) = (uint32_t) msch_data[dev_addr-1].block_size;
+  // saturated for device larger than 2^32 blocks, use tuh_msc_get_block_count() instead
+  (*p_last_lba)   = (uint32_t) TU_MIN(msch_data[dev_addr-1].last_lba, UINT32_MAX);
+  (*p_block_size) = msch_data[dev_addr-1].block_size;
 
   return TUSB_ERROR_NONE;
 }
 
-//--------------------------------------------------------------------+
-// PUBLIC API: SCSI COMMAND
-//--------------------------------------------------------------------+
-static inline void msc_cbw_add_signature(msc_cbw_t *p_cbw, uint8_t lun)
+uint64_t tuh_msc_get_block_count(uint8_t dev_addr)
 {
-  p_cbw->signature  = MSC_CBW_SIGNATURE;
-  p_cbw->tag        = 0xCAFECAFE;
-  p_cbw->lun        = lun;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+  return p_msc->is_initialized ? (p_msc->last_lba + 1) : 0;
 }
 
-static tusb_error_t msch_command_xfer(uint8_t dev_addr, msch_interface_t * p_msch, void* p_buffer)
+uint32_t tuh_msc_get_block_size(uint8_t dev_addr)
 {
-  if ( NULL != p_buffer)
-  { // there is data phase
-    if (p_msch->cbw.dir & TUSB_DIR_IN_MASK)
-    {
-      TU_ASSERT( hcd_pipe_xfer(dev_addr, p_msch->ep_out, (uint8_t*) &p_msch->cbw, sizeof(msc_cbw_t), false), TUSB_ERROR_FAILED );
-      TU_ASSERT( hcd_pipe_queue_xfer(dev_addr, p_msch->ep_in , p_buffer, p_msch->cbw.total_bytes), TUSB_ERROR_FAILED );
-    }else
-    {
-      TU_ASSERT( hcd_pipe_queue_xfer(dev_addr, p_msch->ep_out, (uint8_t*) &p_msch->cbw, sizeof(msc_cbw_t)), TUSB_ERROR_FAILED );
-      TU_ASSERT( hcd_pipe_xfer(dev_addr, p_msch->ep_out , p_buffer, p_msch->cbw.total_bytes, false), TUSB_ERROR_FAILED );
-    }
-  }
-
-  TU_ASSERT( hcd_pipe_xfer(dev_addr, p_msch->ep_in , (uint8_t*) &p_msch->csw, sizeof(msc_csw_t), true), TUSB_ERROR_FAILED);
-
-  return TUSB_ERROR_NONE;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+  return p_msc->is_initialized ? p_msc->block_size : 0;
 }
 
-tusb_error_t tusbh_msc_inquiry(uint8_t dev_addr, uint8_t lun, uint8_t *p_data)
+//--------------------------------------------------------------------+
+// PUBLIC API: SCSI COMMAND
+//--------------------------------------------------------------------+
+bool tuh_msc_scsi_command(uint8_t dev_addr, msc_cbw_t const* cbw, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
 {
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  TU_VERIFY(msch_data[dev_addr-1].is_initialized);
+  return command_submit(dev_addr, cbw, buffer, complete_cb, user_ctx);
+}
 
-  //------------- Command Block Wrapper -------------//
-  msc_cbw_add_signature(&p_msch->cbw, lun);
-  p_msch->cbw.total_bytes = sizeof(scsi_inquiry_resp_t);
-  p_msch->cbw.dir        = TUSB_DIR_IN_MASK;
-  p_msch->cbw.cmd_len    = sizeof(scsi_inquiry_t);
+static bool msch_inquiry(uint8_t dev_addr, uint8_t lun, void* buffer, tuh_msc_complete_cb_t complete_cb)
+{
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = sizeof(scsi_inquiry_resp_t);
+  cbw.dir         = TUSB_DIR_IN_MASK;
+  cbw.cmd_len     = sizeof(scsi_inquiry_t);
 
-  //------------- SCSI command -------------//
-  scsi_inquiry_t cmd_inquiry =
+  scsi_inquiry_t const cmd_inquiry =
   {
       .cmd_code     = SCSI_CMD_INQUIRY,
       .alloc_length = sizeof(scsi_inquiry_resp_t)
   };
 
-  memcpy(p_msch->cbw.command, &cmd_inquiry, p_msch->cbw.cmd_len);
+  memcpy(cbw.command, &cmd_inquiry, cbw.cmd_len);
 
-  TU_ASSERT_ERR ( msch_command_xfer(dev_addr, p_msch, p_data) );
-
-  return TUSB_ERROR_NONE;
+  return command_submit(dev_addr, &cbw, buffer, complete_cb, NULL);
 }
 
-tusb_error_t tusbh_msc_read_capacity10(uint8_t dev_addr, uint8_t lun, uint8_t *p_data)
+static bool msch_read_capacity10(uint8_t dev_addr, uint8_t lun, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
 {
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = sizeof(scsi_read_capacity10_resp_t);
+  cbw.dir         = TUSB_DIR_IN_MASK;
+  cbw.cmd_len     = sizeof(scsi_read_capacity10_t);
 
-  //------------- Command Block Wrapper -------------//
-  msc_cbw_add_signature(&p_msch->cbw, lun);
-  p_msch->cbw.total_bytes = sizeof(scsi_read_capacity10_resp_t);
-  p_msch->cbw.dir        = TUSB_DIR_IN_MASK;
-  p_msch->cbw.cmd_len    = sizeof(scsi_read_capacity10_t);
-
-  //------------- SCSI command -------------//
-  scsi_read_capacity10_t cmd_read_capacity10 =
+  scsi_read_capacity10_t const cmd_read_capacity10 =
   {
       .cmd_code                 = SCSI_CMD_READ_CAPACITY_10,
       .lba                      = 0,
       .partial_medium_indicator = 0
   };
 
-  memcpy(p_msch->cbw.command, &cmd_read_capacity10, p_msch->cbw.cmd_len);
-
-  TU_ASSERT_ERR ( msch_command_xfer(dev_addr, p_msch, p_data) );
+  memcpy(cbw.command, &cmd_read_capacity10, cbw.cmd_len);
 
-  return TUSB_ERROR_NONE;
+  return command_submit(dev_addr, &cbw, buffer, complete_cb, user_ctx);
 }
 
-tusb_error_t tuh_msc_request_sense(uint8_t dev_addr, uint8_t lun, uint8_t *p_data)
+static bool msch_read_capacity16(uint8_t dev_addr, uint8_t lun, void* buffer, tuh_msc_complete_cb_t complete_cb)
 {
-  (void) lun; // TODO [MSCH] multiple lun support
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = sizeof(scsi_read_capacity16_resp_t);
+  cbw.dir         = TUSB_DIR_IN_MASK;
+  cbw.cmd_len     = sizeof(scsi_read_capacity16_t);
 
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  scsi_read_capacity16_t const cmd_read_capacity16 =
+  {
+      .cmd_code       = SCSI_CMD_SERVICE_ACTION_IN_16,
+      .service_action = SCSI_SERVICE_ACTION_READ_CAPACITY_16,
+      .alloc_length   = tu_htonl(sizeof(scsi_read_capacity16_resp_t))
+  };
+
+  memcpy(cbw.command, &cmd_read_capacity16, cbw.cmd_len);
+
+  return command_submit(dev_addr, &cbw, buffer, complete_cb, NULL);
+}
 
-  //------------- Command Block Wrapper -------------//
-  p_msch->cbw.total_bytes = 18;
-  p_msch->cbw.dir        = TUSB_DIR_IN_MASK;
-  p_msch->cbw.cmd_len    = sizeof(scsi_request_sense_t);
+static bool msch_request_sense(uint8_t dev_addr, uint8_t lun, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
+{
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = 18;
+  cbw.dir         = TUSB_DIR_IN_MASK;
+  cbw.cmd_len     = sizeof(scsi_request_sense_t);
 
-  //------------- SCSI command -------------//
-  scsi_request_sense_t cmd_request_sense =
+  scsi_request_sense_t const cmd_request_sense =
   {
       .cmd_code     = SCSI_CMD_REQUEST_SENSE,
       .alloc_length = 18
   };
 
-  memcpy(p_msch->cbw.command, &cmd_request_sense, p_msch->cbw.cmd_len);
+  memcpy(cbw.command, &cmd_request_sense, cbw.cmd_len);
 
-  TU_ASSERT_ERR ( msch_command_xfer(dev_addr, p_msch, p_data) );
+  return command_submit(dev_addr, &cbw, buffer, complete_cb, user_ctx);
+}
 
-  return TUSB_ERROR_NONE;
+// READ/WRITE (10) is used if possible since some devices do not support the 16-byte variant
+static bool msch_rdwr_blocks(uint8_t dev_addr, uint8_t lun, void* buffer, uint64_t lba, uint32_t block_count, bool is_read,
+                             tuh_msc_complete_cb_t complete_cb, void* user_ctx)
+{
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  uint64_t const total_bytes = ((uint64_t) p_msc->block_size)*block_count;
+  TU_ASSERT(total_bytes <= UINT32_MAX);
+
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = (uint32_t) total_bytes;
+  cbw.dir         = is_read ? TUSB_DIR_IN_MASK : TUSB_DIR_OUT;
+
+  if ( (lba + block_count) <= (((uint64_t) UINT32_MAX) + 1) && block_count <= UINT16_MAX )
+  {
+    scsi_read10_t const cmd_rdwr10 =
+    {
+        .cmd_code    = is_read ? SCSI_CMD_READ_10 : SCSI_CMD_WRITE_10,
+        .lba         = tu_htonl((uint32_t) lba),
+        .block_count = tu_htons((uint16_t) block_count)
+    };
+
+    cbw.cmd_len = sizeof(scsi_read10_t);
+    memcpy(cbw.command, &cmd_rdwr10, cbw.cmd_len);
+  }
+  else
+  {
+    scsi_read16_t const cmd_rdwr16 =
+    {
+        .cmd_code    = is_read ? SCSI_CMD_READ_16 : SCSI_CMD_WRITE_16,
+        .lba         = tu_htonll(lba),
+        .block_count = tu_htonl(block_count)
+    };
+
+    cbw.cmd_len = sizeof(scsi_read16_t);
+    memcpy(cbw.command, &cmd_rdwr16, cbw.cmd_len);
+  }
+
+  return command_submit(dev_addr, &cbw, buffer, complete_cb, user_ctx);
 }
 
-tusb_error_t tuh_msc_test_unit_ready(uint8_t dev_addr, uint8_t lun,  msc_csw_t * p_csw)
+bool tuh_msc_read_blocks(uint8_t dev_addr, uint8_t lun, void * buffer, uint64_t lba, uint32_t block_count, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
 {
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  TU_VERIFY(msch_data[dev_addr-1].is_initialized);
+  return msch_rdwr_blocks(dev_addr, lun, buffer, lba, block_count, true, complete_cb, user_ctx);
+}
 
-  //------------- Command Block Wrapper -------------//
-  msc_cbw_add_signature(&p_msch->cbw, lun);
+bool tuh_msc_write_blocks(uint8_t dev_addr, uint8_t lun, void const * buffer, uint64_t lba, uint32_t block_count, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
+{
+  TU_VERIFY(msch_data[dev_addr-1].is_initialized);
+  return msch_rdwr_blocks(dev_addr, lun, (void*) buffer, lba, block_count, false, complete_cb, user_ctx);
+}
 
-  p_msch->cbw.total_bytes = 0; // Number of bytes
-  p_msch->cbw.dir        = TUSB_DIR_OUT;
-  p_msch->cbw.cmd_len    = sizeof(scsi_test_unit_ready_t);
+//------------- Legacy API, result is reported by tuh_msc_isr() -------------//
+tusb_error_t tuh_msc_request_sense(uint8_t dev_addr, uint8_t lun, uint8_t *p_data)
+{
+  TU_ASSERT( msch_request_sense(dev_addr, lun, p_data, legacy_complete_cb, NULL), TUSB_ERROR_FAILED );
+  return TUSB_ERROR_NONE;
+}
+
+tusb_error_t tuh_msc_test_unit_ready(uint8_t dev_addr, uint8_t lun, msc_csw_t * p_csw)
+{
+  msc_cbw_t cbw = { 0 };
+  cbw.lun         = lun;
+  cbw.total_bytes = 0; // Number of bytes
+  cbw.dir         = TUSB_DIR_OUT;
+  cbw.cmd_len     = sizeof(scsi_test_unit_ready_t);
 
-  //------------- SCSI command -------------//
-  scsi_test_unit_ready_t cmd_test_unit_ready =
+  scsi_test_unit_ready_t const cmd_test_unit_ready =
   {
       .cmd_code = SCSI_CMD_TEST_UNIT_READY,
       .lun      = lun // according to wiki
   };
 
-  memcpy(p_msch->cbw.command, &cmd_test_unit_ready, p_msch->cbw.cmd_len);
+  memcpy(cbw.command, &cmd_test_unit_ready, cbw.cmd_len);
 
-  // TODO MSCH refractor test uinit ready
-  TU_ASSERT( hcd_pipe_xfer(dev_addr, p_msch->ep_out, (uint8_t*) &p_msch->cbw, sizeof(msc_cbw_t), false), TUSB_ERROR_FAILED );
-  TU_ASSERT( hcd_pipe_xfer(dev_addr, p_msch->ep_in , (uint8_t*) p_csw, sizeof(msc_csw_t), true), TUSB_ERROR_FAILED );
+  // CSW is copied to p_csw when complete
+  TU_ASSERT( command_submit(dev_addr, &cbw, NULL, legacy_complete_cb, p_csw), TUSB_ERROR_FAILED );
 
   return TUSB_ERROR_NONE;
 }
 
 tusb_error_t  tuh_msc_read10(uint8_t dev_addr, uint8_t lun, void * p_buffer, uint32_t lba, uint16_t block_count)
 {
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  TU_ASSERT( msch_rdwr_blocks(dev_addr, lun, p_buffer, lba, block_count, true, legacy_complete_cb, NULL), TUSB_ERROR_FAILED );
+  return TUSB_ERROR_NONE;
+}
 
-  //------------- Command Block Wrapper -------------//
-  msc_cbw_add_signature(&p_msch->cbw, lun);
+tusb_error_t tuh_msc_write10(uint8_t dev_addr, uint8_t lun, void const * p_buffer, uint32_t lba, uint16_t block_count)
+{
+  TU_ASSERT( msch_rdwr_blocks(dev_addr, lun, (void*) p_buffer, lba, block_count, false, legacy_complete_cb, NULL), TUSB_ERROR_FAILED );
+  return TUSB_ERROR_NONE;
+}
 
-  p_msch->cbw.total_bytes = p_msch->block_size*block_count; // Number of bytes
-  p_msch->cbw.dir        = TUSB_DIR_IN_MASK;
-  p_msch->cbw.cmd_len    = sizeof(scsi_read10_t);
+static bool legacy_complete_cb(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  if ( user_ctx ) memcpy(user_ctx, csw, sizeof(msc_csw_t));
 
-  //------------- SCSI command -------------//
-  scsi_read10_t cmd_read10 =
+  if ( tuh_msc_isr )
   {
-      .cmd_code    = SCSI_CMD_READ_10,
-      .lba         = tu_htonl(lba),
-      .block_count = tu_htons(block_count)
-  };
+    uint32_t const residue = tu_min32(csw->data_residue, cbw->total_bytes);
+    tuh_msc_isr(dev_addr, (csw->status == MSC_CSW_STATUS_PASSED) ? XFER_RESULT_SUCCESS : XFER_RESULT_FAILED, cbw->total_bytes - residue);
+  }
+
+  return true;
+}
 
-  memcpy(p_msch->cbw.command, &cmd_read10, p_msch->cbw.cmd_len);
+//--------------------------------------------------------------------+
+// Command Queue
+// A command is CBW, optional DATA and CSW stage each submitted with interrupt on complete. Next stage and next
+// command are submitted in ISR (xfer_isr fast path) so that queued commands run back to back on the bus,
+// only completion callbacks and stall recovery are deferred to tuh_task().
+//--------------------------------------------------------------------+
+static bool xfer_command(uint8_t dev_addr, msch_interface_t* p_msc, msch_cmd_t* cmd)
+{
+  p_msc->stage          = MSCH_STAGE_CMD;
+  p_msc->status_retried = false;
+  return hcd_pipe_xfer(dev_addr, p_msc->ep_out, (uint8_t*) &cmd->cbw, sizeof(msc_cbw_t), true);
+}
 
-  TU_ASSERT_ERR ( msch_command_xfer(dev_addr, p_msch, p_buffer));
+static inline uint32_t data_chunk_len(msc_cbw_t const* cbw, uint32_t xferred_bytes)
+{
+  return tu_min32(cbw->total_bytes - xferred_bytes, CFG_TUH_MSC_XFER_CHUNK_SIZE);
+}
 
-  return TUSB_ERROR_NONE;
+static bool xfer_data(uint8_t dev_addr, msch_interface_t* p_msc, msch_cmd_t* cmd)
+{
+  uint8_t const ep_addr = (cmd->cbw.dir & TUSB_DIR_IN_MASK) ? p_msc->ep_in : p_msc->ep_out;
+
+  p_msc->stage = MSCH_STAGE_DATA;
+  return hcd_pipe_xfer(dev_addr, ep_addr, cmd->buffer + cmd->xferred_bytes, data_chunk_len(&cmd->cbw, cmd->xferred_bytes), true);
 }
 
-tusb_error_t tuh_msc_write10(uint8_t dev_addr, uint8_t lun, void const * p_buffer, uint32_t lba, uint16_t block_count)
+static bool xfer_status(uint8_t dev_addr, msch_interface_t* p_msc, msch_cmd_t* cmd)
 {
-  msch_interface_t* p_msch = &msch_data[dev_addr-1];
+  p_msc->stage = MSCH_STAGE_STATUS;
+  return hcd_pipe_xfer(dev_addr, p_msc->ep_in, (uint8_t*) &cmd->csw, sizeof(msc_csw_t), true);
+}
 
-  //------------- Command Block Wrapper -------------//
-  msc_cbw_add_signature(&p_msch->cbw, lun);
+// Complete active command and start the next queued one. Commands failed to start are completed with phase error.
+static void command_done(uint8_t dev_addr, msch_interface_t* p_msc, bool transport_error)
+{
+  if ( transport_error ) cmd_get(p_msc, p_msc->cmd_active)->csw.status = MSC_CSW_STATUS_PHASE_ERROR;
 
-  p_msch->cbw.total_bytes = p_msch->block_size*block_count; // Number of bytes
-  p_msch->cbw.dir        = TUSB_DIR_OUT;
-  p_msch->cbw.cmd_len    = sizeof(scsi_write10_t);
+  p_msc->stage = MSCH_STAGE_IDLE;
+  p_msc->cmd_active++;
 
-  //------------- SCSI command -------------//
-  scsi_write10_t cmd_write10 =
+  while ( p_msc->cmd_active != p_msc->cmd_wr )
+  {
+    if ( xfer_command(dev_addr, p_msc, cmd_get(p_msc, p_msc->cmd_active)) ) return;
+
+    cmd_get(p_msc, p_msc->cmd_active)->csw.status = MSC_CSW_STATUS_PHASE_ERROR;
+    p_msc->stage = MSCH_STAGE_IDLE;
+    p_msc->cmd_active++;
+  }
+}
+
+static bool command_submit(uint8_t dev_addr, msc_cbw_t const* cbw, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx)
+{
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  // queue is full
+  TU_VERIFY( (uint8_t) (p_msc->cmd_wr - p_msc->cmd_rd) < CFG_TUH_MSC_CMD_QUEUE_SZ );
+  TU_ASSERT( cbw->total_bytes == 0 || buffer != NULL );
+
+  msch_cmd_t* cmd = cmd_get(p_msc, p_msc->cmd_wr);
+
+  cmd->cbw           = *cbw;
+  cmd->cbw.signature = MSC_CBW_SIGNATURE;
+  cmd->cbw.tag       = ++p_msc->tag;
+  cmd->buffer        = (uint8_t*) buffer;
+  cmd->xferred_bytes = 0;
+  cmd->complete_cb   = complete_cb;
+  cmd->user_ctx      = user_ctx;
+  tu_memclr(&cmd->csw, sizeof(msc_csw_t));
+
+  // ISR also starts next command when active one is done
+  hcd_int_disable(p_msc->rhport);
+  bool const is_idle = (p_msc->cmd_active == p_msc->cmd_wr);
+  p_msc->cmd_wr++;
+  hcd_int_enable(p_msc->rhport);
+
+  // No command in flight, ISR does not touch the queue until this one is started
+  if ( is_idle && !xfer_command(dev_addr, p_msc, cmd) )
+  {
+    p_msc->stage = MSCH_STAGE_IDLE;
+    p_msc->cmd_wr--;
+    return false;
+  }
+
+  return true;
+}
+
+// Invoke callback of complete commands in order
+static void command_report(uint8_t dev_addr, msch_interface_t* p_msc)
+{
+  while ( p_msc->cmd_rd != p_msc->cmd_active )
   {
-      .cmd_code    = SCSI_CMD_WRITE_10,
-      .lba         = tu_htonl(lba),
-      .block_count = tu_htons(block_count)
+    // slot is released before invoking callback so that it can queue another command
+    msch_cmd_t const cmd = *cmd_get(p_msc, p_msc->cmd_rd);
+    p_msc->cmd_rd++;
+
+    if ( cmd.complete_cb ) cmd.complete_cb(dev_addr, &cmd.cbw, &cmd.csw, cmd.user_ctx);
+
+    // interface is closed by callback
+    if ( !p_msc->ep_in ) return;
+  }
+}
+
+// Invoked when CLEAR_FEATURE(ENDPOINT_HALT) is complete. BOT: stalled data stage is followed by CSW,
+// stalled CSW is retried once.
+static bool clear_halt_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  msch_interface_t* p_msc = get_itf(dev_addr);
+  msch_cmd_t* cmd = cmd_get(p_msc, p_msc->cmd_active);
+
+  hcd_edpt_clear_stall(dev_addr, (uint8_t) request->wIndex);
+  p_msc->halted_ep = 0;
+
+  bool ok = false;
+
+  if ( XFER_RESULT_SUCCESS == result )
+  {
+    if ( p_msc->stage == MSCH_STAGE_DATA )
+    {
+      ok = xfer_status(dev_addr, p_msc, cmd);
+    }
+    else if ( p_msc->stage == MSCH_STAGE_STATUS && !p_msc->status_retried )
+    {
+      p_msc->status_retried = true;
+      ok = xfer_status(dev_addr, p_msc, cmd);
+    }
+  }
+
+  if ( !ok )
+  {
+    command_done(dev_addr, p_msc, true);
+    command_report(dev_addr, p_msc);
+  }
+
+  return true;
+}
+
+static void clear_halt(uint8_t dev_addr, msch_interface_t* p_msc)
+{
+  tusb_control_request_t const request =
+  {
+    .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_ENDPOINT, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
+    .bRequest = TUSB_REQ_CLEAR_FEATURE,
+    .wValue   = TUSB_REQ_FEATURE_EDPT_HALT,
+    .wIndex   = p_msc->halted_ep,
+    .wLength  = 0
   };
 
-  memcpy(p_msch->cbw.command, &cmd_write10, p_msch->cbw.cmd_len);
+  if ( !tuh_control_xfer_async(dev_addr, &request, NULL, clear_halt_complete, NULL) )
+  {
+    // control pipe is busy, give up the command
+    TU_LOG2("MSC failed to clear halt EP %02X\r\n", p_msc->halted_ep);
+    hcd_edpt_clear_stall(dev_addr, p_msc->halted_ep);
+    p_msc->halted_ep = 0;
+    command_done(dev_addr, p_msc, true);
+  }
+}
 
-  TU_ASSERT_ERR ( msch_command_xfer(dev_addr, p_msch, (void*) p_buffer));
+//--------------------------------------------------------------------+
+// Enumeration: Get Max LUN -> Inquiry -> Read Capacity (10) -> Read Capacity (16) if needed
+//--------------------------------------------------------------------+
+static bool config_read_capacity10_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx);
 
-  return TUSB_ERROR_NONE;
+static void config_mounted(uint8_t dev_addr, msch_interface_t* p_msc)
+{
+  p_msc->is_initialized = true;
+  tuh_msc_mounted_cb(dev_addr);
+}
+
+static bool config_read_capacity16_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  (void) cbw; (void) user_ctx;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  TU_ASSERT(csw->status == MSC_CSW_STATUS_PASSED);
+
+  scsi_read_capacity16_resp_t const* resp = (scsi_read_capacity16_resp_t const*) p_msc->buffer;
+  p_msc->last_lba   = tu_ntohll(resp->last_lba);
+  p_msc->block_size = tu_ntohl(resp->block_size);
+
+  config_mounted(dev_addr, p_msc);
+  return true;
+}
+
+// NOTE: my toshiba thumb-drive stall the first Read Capacity and require the sequence
+// Read Capacity --> Stalled --> Clear Stall --> Request Sense --> Read Capacity (2) to work
+static bool config_request_sense_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  (void) cbw; (void) csw; (void) user_ctx;
+  TU_ASSERT( msch_read_capacity10(dev_addr, 0, get_itf(dev_addr)->buffer, config_read_capacity10_complete, get_itf(dev_addr)) );
+  return true;
+}
+
+static bool config_read_capacity10_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  (void) cbw;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  if ( csw->status != MSC_CSW_STATUS_PASSED )
+  {
+    // user_ctx is set for the retry
+    TU_ASSERT(user_ctx == NULL);
+    TU_ASSERT( msch_request_sense(dev_addr, 0, p_msc->buffer, config_request_sense_complete, NULL) );
+    return true;
+  }
+
+  scsi_read_capacity10_resp_t const* resp = (scsi_read_capacity10_resp_t const*) p_msc->buffer;
+  p_msc->last_lba   = tu_ntohl(resp->last_lba);
+  p_msc->block_size = tu_ntohl(resp->block_size);
+
+  // device has more than 2^32 blocks
+  if ( p_msc->last_lba == UINT32_MAX )
+  {
+    TU_ASSERT( msch_read_capacity16(dev_addr, 0, p_msc->buffer, config_read_capacity16_complete) );
+    return true;
+  }
+
+  config_mounted(dev_addr, p_msc);
+  return true;
+}
+
+static bool config_inquiry_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  (void) cbw; (void) user_ctx;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  TU_ASSERT(csw->status == MSC_CSW_STATUS_PASSED);
+
+  memcpy(p_msc->vendor_id , ((scsi_inquiry_resp_t*) p_msc->buffer)->vendor_id , 8);
+  memcpy(p_msc->product_id, ((scsi_inquiry_resp_t*) p_msc->buffer)->product_id, 16);
+
+  TU_ASSERT( msch_read_capacity10(dev_addr, 0, p_msc->buffer, config_read_capacity10_complete, NULL) );
+  return true;
+}
+
+static bool config_get_maxlun_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request; (void) user_ctx;
+  (void) xferred_bytes;
+  msch_interface_t* p_msc = get_itf(dev_addr);
+
+  // STALL means device does not support multiple LUN
+  p_msc->max_lun = (XFER_RESULT_SUCCESS == result) ? p_msc->buffer[0] : 0;
+
+  TU_ASSERT( msch_inquiry(dev_addr, 0, p_msc->buffer, config_inquiry_complete) );
+  return true;
 }
 
 //--------------------------------------------------------------------+
@@ -275,7 +564,6 @@ tusb_error_t tuh_msc_write10(uint8_t dev_addr, uint8_t lun, void const * p_buffe
 void msch_init(void)
 {
   tu_memclr(msch_data, sizeof(msch_interface_t)*CFG_TUSB_HOST_DEVICE_MAX);
-  msch_sem_hdl = osal_semaphore_create(&msch_sem_def);
 }
 
 bool msch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length)
@@ -283,7 +571,7 @@ bool msch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *it
   TU_VERIFY (MSC_SUBCLASS_SCSI == itf_desc->bInterfaceSubClass &&
              MSC_PROTOCOL_BOT  == itf_desc->bInterfaceProtocol);
 
-  msch_interface_t* p_msc = &msch_data[dev_addr-1];
+  msch_interface_t* p_msc = get_itf(dev_addr);
 
   //------------- Open Data Pipe -------------//
   tusb_desc_endpoint_t const * ep_desc = (tusb_desc_endpoint_t const *) tu_desc_next(itf_desc);
@@ -306,101 +594,110 @@ bool msch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *it
     ep_desc = (tusb_desc_endpoint_t const *) tu_desc_next(ep_desc);
   }
 
+  p_msc->rhport   = rhport;
   p_msc->itf_numr = itf_desc->bInterfaceNumber;
   (*p_length) += sizeof(tusb_desc_interface_t) + 2*sizeof(tusb_desc_endpoint_t);
 
   //------------- Get Max Lun -------------//
-  tusb_control_request_t request = {
+  // SCSI commands are chained from its completion, interface is mounted when capacity is read
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
         .bRequest = MSC_REQ_GET_MAX_LUN,
         .wValue = 0,
         .wIndex = p_msc->itf_numr,
         .wLength = 1
   };
-  // TODO STALL means zero
-  TU_ASSERT( usbh_control_xfer( dev_addr, &request, msch_buffer ) );
-  p_msc->max_lun = msch_buffer[0];
-
-#if 0
-  //------------- Reset -------------//
-  request = (tusb_control_request_t) {
-        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
-        .bRequest = MSC_REQ_RESET,
-        .wValue = 0,
-        .wIndex = p_msc->itf_numr,
-        .wLength = 0
-  };
-  TU_ASSERT( usbh_control_xfer( dev_addr, &request, NULL ) );
-#endif
+  TU_ASSERT( tuh_control_xfer_async(dev_addr, &request, p_msc->buffer, config_get_maxlun_complete, NULL) );
 
-  enum { SCSI_XFER_TIMEOUT = 2000 };
-  //------------- SCSI Inquiry -------------//
-  tusbh_msc_inquiry(dev_addr, 0, msch_buffer);
-  TU_ASSERT( osal_semaphore_wait(msch_sem_hdl, SCSI_XFER_TIMEOUT) );
+  return true;
+}
 
-  memcpy(p_msc->vendor_id , ((scsi_inquiry_resp_t*) msch_buffer)->vendor_id , 8);
-  memcpy(p_msc->product_id, ((scsi_inquiry_resp_t*) msch_buffer)->product_id, 16);
+// Fast path in ISR: advance stage of active command and start the next command.
+// Return false to report completion or recover from stall in tuh_task()
+bool msch_xfer_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+{
+  msch_interface_t* p_msc = get_itf(dev_addr);
+  msch_cmd_t* cmd = cmd_get(p_msc, p_msc->cmd_active);
 
-  //------------- SCSI Read Capacity 10 -------------//
-  tusbh_msc_read_capacity10(dev_addr, 0, msch_buffer);
-  TU_ASSERT( osal_semaphore_wait(msch_sem_hdl, SCSI_XFER_TIMEOUT));
+  // spurious e.g completion of aborted stage
+  if ( p_msc->stage == MSCH_STAGE_IDLE || p_msc->halted_ep ) return true;
 
-  // NOTE: my toshiba thumb-drive stall the first Read Capacity and require the sequence
-  // Read Capacity --> Stalled --> Clear Stall --> Request Sense --> Read Capacity (2) to work
-  if ( hcd_edpt_stalled(dev_addr, p_msc->ep_in) )
+  // CBW is never stalled by a valid device, reset recovery is not supported
+  if ( XFER_RESULT_STALLED == event && p_msc->stage != MSCH_STAGE_CMD )
   {
-    // clear stall TODO abstract clear stall function
-    request = (tusb_control_request_t) {
-      .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_ENDPOINT, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
-          .bRequest = TUSB_REQ_CLEAR_FEATURE,
-          .wValue = 0,
-          .wIndex = p_msc->ep_in,
-          .wLength = 0
-    };
+    p_msc->halted_ep = ep_addr;
+    return false;
+  }
 
-    TU_ASSERT(usbh_control_xfer( dev_addr, &request, NULL ));
+  if ( XFER_RESULT_SUCCESS != event )
+  {
+    command_done(dev_addr, p_msc, true);
+    return false;
+  }
 
-    hcd_edpt_clear_stall(dev_addr, p_msc->ep_in);
-    TU_ASSERT( osal_semaphore_wait(msch_sem_hdl, SCSI_XFER_TIMEOUT) ); // wait for SCSI status
+  switch ( p_msc->stage )
+  {
+    case MSCH_STAGE_CMD:
+      if ( cmd->cbw.total_bytes )
+      {
+        if ( !xfer_data(dev_addr, p_msc, cmd) ) break;
+      }
+      else
+      {
+        if ( !xfer_status(dev_addr, p_msc, cmd) ) break;
+      }
+    return true;
+
+    case MSCH_STAGE_DATA:
+    {
+      uint32_t const expected = data_chunk_len(&cmd->cbw, cmd->xferred_bytes);
+      cmd->xferred_bytes += xferred_bytes;
+
+      // more data unless short packet
+      if ( xferred_bytes == expected && cmd->xferred_bytes < cmd->cbw.total_bytes )
+      {
+        if ( !xfer_data(dev_addr, p_msc, cmd) ) break;
+      }
+      else
+      {
+        if ( !xfer_status(dev_addr, p_msc, cmd) ) break;
+      }
+    }
+    return true;
 
-    //------------- SCSI Request Sense -------------//
-    (void) tuh_msc_request_sense(dev_addr, 0, msch_buffer);
-    TU_ASSERT(osal_semaphore_wait(msch_sem_hdl, SCSI_XFER_TIMEOUT));
+    case MSCH_STAGE_STATUS:
+    {
+      bool const valid_csw = (xferred_bytes == sizeof(msc_csw_t)) && (cmd->csw.signature == MSC_CSW_SIGNATURE) &&
+                             (cmd->csw.tag == cmd->cbw.tag);
+      command_done(dev_addr, p_msc, !valid_csw);
+    }
+    return false;
 
-    //------------- Re-read SCSI Read Capactity -------------//
-    tusbh_msc_read_capacity10(dev_addr, 0, msch_buffer);
-    TU_ASSERT(osal_semaphore_wait(msch_sem_hdl, SCSI_XFER_TIMEOUT));
+    default: return true;
   }
 
-  p_msc->last_lba   = tu_ntohl( ((scsi_read_capacity10_resp_t*)msch_buffer)->last_lba );
-  p_msc->block_size = (uint16_t) tu_ntohl( ((scsi_read_capacity10_resp_t*)msch_buffer)->block_size );
+  // failed to submit next stage
+  command_done(dev_addr, p_msc, true);
+  return false;
+}
+
+void msch_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+{
+  (void) ep_addr; (void) event; (void) xferred_bytes;
 
-  p_msc->is_initialized = true;
+  msch_interface_t* p_msc = get_itf(dev_addr);
 
-  tuh_msc_mounted_cb(dev_addr);
+  command_report(dev_addr, p_msc);
 
-  return true;
-}
+  if ( p_msc->ep_in && p_msc->halted_ep ) clear_halt(dev_addr, p_msc);
 
-void msch_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
-{
-  msch_interface_t* p_msc = &msch_data[dev_addr-1];
-  if ( ep_addr == p_msc->ep_in )
-  {
-    if (p_msc->is_initialized)
-    {
-      tuh_msc_isr(dev_addr, event, xferred_bytes);
-    }else
-    { // still initializing under open subtask
-      osal_semaphore_post(msch_sem_hdl, true);
-    }
-  }
+  // command is given up if halt cannot be cleared
+  command_report(dev_addr, p_msc);
 }
 
 void msch_close(uint8_t dev_addr)
 {
   tu_memclr(&msch_data[dev_addr-1], sizeof(msch_interface_t));
-  osal_semaphore_reset(msch_sem_hdl);
 
   tuh_msc_unmounted_cb(dev_addr); // invoke Application Callback
 }
@@ -35,6 +35,26 @@
  extern "C" {
 #endif
 
+//--------------------------------------------------------------------+
+// Class Driver Configuration
+//--------------------------------------------------------------------+
+
+// Number of SCSI commands can be queued per device, must be power of 2
+#ifndef CFG_TUH_MSC_CMD_QUEUE_SZ
+#define CFG_TUH_MSC_CMD_QUEUE_SZ    4
+#endif
+
+TU_VERIFY_STATIC( (CFG_TUH_MSC_CMD_QUEUE_SZ & (CFG_TUH_MSC_CMD_QUEUE_SZ-1)) == 0, "CFG_TUH_MSC_CMD_QUEUE_SZ must be power of 2");
+
+/** \brief      Callback invoked in tuh_task() when a queued SCSI command is complete
+ * \param[in]   dev_addr  Address of device
+ * \param[in]   cbw       Command Block Wrapper of the command
+ * \param[in]   csw       Command Status Wrapper received from device. Status is \ref MSC_CSW_STATUS_PHASE_ERROR
+ *                        if the command could not be transported (transaction error, invalid CSW)
+ * \param[in]   user_ctx  user_ctx passed when the command is queued
+ */
+typedef bool (*tuh_msc_complete_cb_t)(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx);
+
 /** \addtogroup ClassDriver_MSC
  *  @{
  * \defgroup MSC_Host Host
@@ -52,11 +72,10 @@ bool          tuh_msc_is_mounted(uint8_t dev_addr);
 
 /** \brief      Check if the interface is currently busy or not
  * \param[in]   dev_addr device address
- * \retval      true if the interface is busy meaning the stack is still transferring/waiting data from/to device
- * \retval      false if the interface is not busy meaning the stack successfully transferred data from/to device
- * \note        This function is used to check if previous transfer is complete (success or error), so that the next transfer
- *              can be scheduled. User needs to make sure the corresponding interface is mounted (by \ref tuh_msc_is_mounted)
- *              before calling this function
+ * \retval      true if the interface is busy meaning there is queued command still transferring data from/to device
+ * \retval      false if all queued commands are complete (success or error)
+ * \note        More commands can be queued while interface is busy, up to \ref CFG_TUH_MSC_CMD_QUEUE_SZ. User needs to make sure
+ *              the corresponding interface is mounted (by \ref tuh_msc_is_mounted) before calling this function
  */
 bool          tuh_msc_is_busy(uint8_t dev_addr);
 
@@ -89,6 +108,50 @@ uint8_t const* tuh_msc_get_product_name(uint8_t dev_addr);
  */
 tusb_error_t tuh_msc_get_capacity(uint8_t dev_addr, uint32_t* p_last_lba, uint32_t* p_block_size);
 
+/// Get number of blocks of MassStorage device, retrieved with READ CAPACITY 16 if device is larger than 2^32 blocks
+uint64_t tuh_msc_get_block_count(uint8_t dev_addr);
+
+/// Get block size in bytes of MassStorage device
+uint32_t tuh_msc_get_block_size(uint8_t dev_addr);
+
+/** \brief      Queue a SCSI command to MassStorage device
+ * \param[in]   dev_addr    device address
+ * \param[in]   cbw         Command Block Wrapper, signature and tag are filled by the stack
+ * \param[in]   buffer      Buffer for data stage of cbw->total_bytes bytes. Must be accessible by USB controller (see \ref CFG_TUSB_MEM_SECTION)
+ * \param[in]   complete_cb Callback invoked in tuh_task() when the command is complete
+ * \param[in]   user_ctx    Passed to complete_cb
+ * \retval      false if command queue is full
+ * \note        Queued commands are sent back to back: CBW of the next command is submitted in the interrupt of the previous CSW.
+ *              Data stage is split into multiple transfers internally, so that cbw->total_bytes can be up to 4 GB.
+ */
+bool tuh_msc_scsi_command(uint8_t dev_addr, msc_cbw_t const* cbw, void* buffer, tuh_msc_complete_cb_t complete_cb, void* user_ctx);
+
+/** \brief      Queue read of blocks from MassStorage device
+ * \param[in]   dev_addr    device address
+ * \param[in]   lun         Targeted Logical Unit
+ * \param[out]  buffer      Buffer to store data. Must be accessible by USB controller (see \ref CFG_TUSB_MEM_SECTION)
+ * \param[in]   lba         Starting Logical Block Address to be read
+ * \param[in]   block_count Number of Block to be read, total bytes must not exceed 4 GB
+ * \param[in]   complete_cb Callback invoked in tuh_task() when the command is complete
+ * \param[in]   user_ctx    Passed to complete_cb
+ * \retval      false if interface is not mounted or command queue is full
+ * \note        READ (10) is used when possible, READ (16) for LBA above 2^32 or more than 65535 blocks
+ */
+bool tuh_msc_read_blocks (uint8_t dev_addr, uint8_t lun, void * buffer, uint64_t lba, uint32_t block_count, tuh_msc_complete_cb_t complete_cb, void* user_ctx);
+
+/** \brief      Queue write of blocks to MassStorage device
+ * \param[in]   dev_addr    device address
+ * \param[in]   lun         Targeted Logical Unit
+ * \param[in]   buffer      Buffer containing data. Must be accessible by USB controller (see \ref CFG_TUSB_MEM_SECTION)
+ * \param[in]   lba         Starting Logical Block Address to be written
+ * \param[in]   block_count Number of Block to be written, total bytes must not exceed 4 GB
+ * \param[in]   complete_cb Callback invoked in tuh_task() when the command is complete
+ * \param[in]   user_ctx    Passed to complete_cb
+ * \retval      false if interface is not mounted or command queue is full
+ * \note        WRITE (10) is used when possible, WRITE (16) for LBA above 2^32 or more than 65535 blocks
+ */
+bool tuh_msc_write_blocks(uint8_t dev_addr, uint8_t lun, void const * buffer, uint64_t lba, uint32_t block_count, tuh_msc_complete_cb_t complete_cb, void* user_ctx);
+
 /** \brief 			Perform SCSI READ 10 command to read data from MassStorage device
  * \param[in]		dev_addr	device address
  * \param[in]		lun       Targeted Logical Unit
@@ -99,7 +162,7 @@ tusb_error_t tuh_msc_get_capacity(uint8_t dev_addr, uint32_t* p_last_lba, uint32
  * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
  * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
  * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the interface's callback function
+ * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by \ref tuh_msc_isr
  */
 tusb_error_t tuh_msc_read10 (uint8_t dev_addr, uint8_t lun, void * p_buffer, uint32_t lba, uint16_t block_count);
 
@@ -113,7 +176,7 @@ tusb_error_t tuh_msc_read10 (uint8_t dev_addr, uint8_t lun, void * p_buffer, uin
  * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
  * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
  * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the interface's callback function
+ * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by \ref tuh_msc_isr
  */
 tusb_error_t tuh_msc_write10(uint8_t dev_addr, uint8_t lun, void const * p_buffer, uint32_t lba, uint16_t block_count);
 
@@ -125,7 +188,7 @@ tusb_error_t tuh_msc_write10(uint8_t dev_addr, uint8_t lun, void const * p_buffe
  * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
  * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
  * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the interface's callback function
+ * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by \ref tuh_msc_isr
  */
 tusb_error_t tuh_msc_request_sense(uint8_t dev_addr, uint8_t lun, uint8_t *p_data);
 
@@ -136,14 +199,10 @@ tusb_error_t tuh_msc_request_sense(uint8_t dev_addr, uint8_t lun, uint8_t *p_dat
  * \retval      TUSB_ERROR_INTERFACE_IS_BUSY if the interface is already transferring data with device
  * \retval      TUSB_ERROR_DEVICE_NOT_READY if device is not yet configured (by SET CONFIGURED request)
  * \retval      TUSB_ERROR_INVALID_PARA if input parameters are not correct
- * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by the interface's callback function
+ * \note        This function is non-blocking and returns immediately. The result of USB transfer will be reported by \ref tuh_msc_isr
  */
 tusb_error_t tuh_msc_test_unit_ready(uint8_t dev_addr, uint8_t lun, msc_csw_t * p_csw); // TODO to be refractor
 
-//tusb_error_t  tusbh_msc_scsi_send(uint8_t dev_addr, uint8_t lun, bool is_direction_in,
-//                                  uint8_t const * p_command, uint8_t cmd_len,
-//                                  uint8_t * p_response, uint32_t resp_len);
-
 //------------- Application Callback -------------//
 /** \brief 			Callback function that will be invoked when a device with MassStorage interface is mounted
  * \param[in]	  dev_addr Address of newly mounted device
@@ -157,17 +216,18 @@ void tuh_msc_mounted_cb(uint8_t dev_addr);
  */
 void tuh_msc_unmounted_cb(uint8_t dev_addr);
 
-/** \brief      Callback function that is invoked when an transferring event occurred
+/** \brief      Callback function that is invoked in tuh_task() when a command queued without complete callback
+ *              (tuh_msc_read10, tuh_msc_write10 etc ...) is complete
  * \param[in]		dev_addr	Address of device
  * \param[in]   event an value from \ref xfer_result_t
- * \param[in]   xferred_bytes Number of bytes transferred via USB bus
+ * \param[in]   xferred_bytes Number of bytes transferred in data stage
  * \note        event can be one of following
  *              - XFER_RESULT_SUCCESS : previously scheduled transfer completes successfully.
  *              - XFER_RESULT_FAILED   : previously scheduled transfer encountered a transaction error.
  *              - XFER_RESULT_STALLED : previously scheduled transfer is stalled by device.
  * \note
  */
-void tuh_msc_isr(uint8_t dev_addr, xfer_result_t event, uint32_t xferred_bytes);
+TU_ATTR_WEAK void tuh_msc_isr(uint8_t dev_addr, xfer_result_t event, uint32_t xferred_bytes);
 
 
 //--------------------------------------------------------------------+
@@ -175,25 +235,51 @@ void tuh_msc_isr(uint8_t dev_addr, xfer_result_t event, uint32_t xferred_bytes);
 //--------------------------------------------------------------------+
 typedef struct
 {
+  msc_cbw_t cbw;
+  msc_csw_t csw;
+
+  uint8_t* buffer;
+  uint32_t xferred_bytes; // data stage
+
+  tuh_msc_complete_cb_t complete_cb;
+  void* user_ctx;
+}msch_cmd_t;
+
+typedef struct
+{
+  uint8_t rhport;
   uint8_t itf_numr;
   uint8_t  ep_in;
   uint8_t  ep_out;
 
   uint8_t  max_lun;
-  uint16_t block_size;
-  uint32_t last_lba; // last logical block address
+  uint32_t block_size;
+  uint64_t last_lba; // last logical block address
 
   volatile bool is_initialized;
   uint8_t vendor_id[8];
   uint8_t product_id[16];
 
-  msc_cbw_t cbw;
-  msc_csw_t csw;
+  //------------- Command Queue -------------//
+  // Commands [cmd_rd, cmd_active) are complete and waiting to be reported in tuh_task(),
+  // [cmd_active, cmd_wr) are on the bus. cmd_active and stage are advanced in ISR.
+  msch_cmd_t cmd[CFG_TUH_MSC_CMD_QUEUE_SZ];
+  uint8_t cmd_rd;
+  volatile uint8_t cmd_active;
+  volatile uint8_t cmd_wr;
+  volatile uint8_t stage;
+  volatile uint8_t halted_ep; // stalled endpoint of active command, cleared in tuh_task()
+  bool     status_retried;
+  uint32_t tag;
+
+  // response of SCSI commands sent when mounted, largest is inquiry
+  TU_ATTR_ALIGNED(4) uint8_t buffer[sizeof(scsi_inquiry_resp_t)];
 }msch_interface_t;
 
 void msch_init(void);
 bool msch_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length);
-void msch_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
+bool msch_xfer_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
+void msch_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
 void msch_close(uint8_t dev_addr);
 
 #ifdef __cplusplus
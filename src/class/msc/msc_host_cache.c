@@ -0,0 +1,414 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_MSC_CACHE
+
+#include "common/tusb_common.h"
+#include "msc_host_cache.h"
+
+#if TUSB_OPT_HOST_ENABLED && CFG_TUH_MSC
+#include "host/usbh.h"
+#include "msc_host.h"
+#endif
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+enum { BLOCK_SIZE = CFG_TUH_MSC_CACHE_BLOCK_SIZE };
+
+enum { LINE_NONE = 0xff };
+
+TU_VERIFY_STATIC(CFG_TUH_MSC_CACHE_SECTORS < LINE_NONE, "too many cache sectors");
+
+//--------------------------------------------------------------------+
+// INTERNAL HELPER
+//--------------------------------------------------------------------+
+static uint8_t line_find(tuh_msc_cache_t const* cache, uint64_t lba)
+{
+  for(uint8_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    if ( cache->line_stamp[i] && cache->line_lba[i] == lba ) return i;
+  }
+  return LINE_NONE;
+}
+
+static inline void line_touch(tuh_msc_cache_t* cache, uint8_t idx)
+{
+  cache->line_stamp[idx] = ++cache->clock;
+}
+
+static inline bool ra_contains(tuh_msc_cache_t const* cache, uint64_t lba)
+{
+  return cache->ra_count && (lba >= cache->ra_lba) && (lba < cache->ra_lba + cache->ra_count);
+}
+
+// data written to device makes read-ahead copy of the same sectors stale
+static void ra_invalidate(tuh_msc_cache_t* cache, uint64_t lba, uint32_t count)
+{
+  if ( cache->ra_count && (lba < cache->ra_lba + cache->ra_count) && (cache->ra_lba < lba + count) )
+  {
+    cache->ra_count = 0;
+  }
+}
+
+static bool device_read(tuh_msc_cache_t* cache, uint64_t lba, uint8_t* buffer, uint32_t count)
+{
+  cache->stats.device_reads++;
+  return cache->backend->read(cache->ctx, lba, buffer, count);
+}
+
+static bool device_write(tuh_msc_cache_t* cache, uint64_t lba, uint8_t const* buffer, uint32_t count)
+{
+  ra_invalidate(cache, lba, count);
+
+  cache->stats.device_writes++;
+  cache->stats.device_write_sectors += count;
+  return cache->backend->write(cache->ctx, lba, buffer, count);
+}
+
+// Write back dirty line together with adjacent dirty lines in one command, burst buffer is used for staging
+static bool line_flush(tuh_msc_cache_t* cache, uint8_t idx)
+{
+  uint64_t start = cache->line_lba[idx];
+  uint32_t count = 1;
+
+  // extend backward then forward
+  while ( count < CFG_TUH_MSC_CACHE_BURST && start > 0 )
+  {
+    uint8_t const prev = line_find(cache, start-1);
+    if ( prev == LINE_NONE || !cache->line_dirty[prev] ) break;
+    start--;
+    count++;
+  }
+
+  while ( count < CFG_TUH_MSC_CACHE_BURST )
+  {
+    uint8_t const next = line_find(cache, start+count);
+    if ( next == LINE_NONE || !cache->line_dirty[next] ) break;
+    count++;
+  }
+
+  if ( count == 1 )
+  {
+    TU_VERIFY( device_write(cache, start, cache->line_data[idx], 1) );
+  }
+  else
+  {
+    cache->ra_count = 0;
+
+    for(uint32_t i=0; i<count; i++)
+    {
+      memcpy(cache->burst[i], cache->line_data[line_find(cache, start+i)], BLOCK_SIZE);
+    }
+
+    TU_VERIFY( device_write(cache, start, cache->burst[0], count) );
+  }
+
+  for(uint32_t i=0; i<count; i++)
+  {
+    cache->line_dirty[line_find(cache, start+i)] = false;
+  }
+
+  return true;
+}
+
+// Get a line for lba: invalid one or least recently used, dirty victim is written back first
+static uint8_t line_alloc(tuh_msc_cache_t* cache, uint64_t lba)
+{
+  uint8_t victim = 0;
+
+  for(uint8_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    if ( cache->line_stamp[i] == 0 )
+    {
+      victim = i;
+      break;
+    }
+
+    if ( cache->line_stamp[i] < cache->line_stamp[victim] ) victim = i;
+  }
+
+  if ( cache->line_stamp[victim] && cache->line_dirty[victim] )
+  {
+    TU_VERIFY( line_flush(cache, victim), LINE_NONE );
+  }
+
+  cache->line_lba[victim]   = lba;
+  cache->line_dirty[victim] = false;
+  line_touch(cache, victim);
+
+  return victim;
+}
+
+static bool read_single(tuh_msc_cache_t* cache, uint64_t lba, uint8_t* buffer)
+{
+  uint8_t idx = line_find(cache, lba);
+
+  if ( idx != LINE_NONE )
+  {
+    cache->stats.read_hits++;
+    line_touch(cache, idx);
+    memcpy(buffer, cache->line_data[idx], BLOCK_SIZE);
+    return true;
+  }
+
+  // streamed data is served from read-ahead buffer without taking cache line from e.g FAT/directory sectors
+  if ( ra_contains(cache, lba) )
+  {
+    cache->stats.read_hits++;
+    cache->stats.readahead_hits++;
+    memcpy(buffer, cache->burst[lba - cache->ra_lba], BLOCK_SIZE);
+    return true;
+  }
+
+  cache->stats.read_misses++;
+
+  // second consecutive sector read or read right after read-ahead window (interleaved with e.g FAT access)
+  // starts read-ahead, which also includes requested sector
+  bool const sequential = cache->sequential || (cache->ra_count && lba == cache->ra_lba + cache->ra_count);
+
+  uint32_t count = sequential ? CFG_TUH_MSC_CACHE_BURST : 1;
+  if ( cache->block_count && lba < cache->block_count ) count = (uint32_t) TU_MIN(count, cache->block_count - lba);
+
+  if ( count > 1 )
+  {
+    cache->ra_count = 0;
+    TU_VERIFY( device_read(cache, lba, cache->burst[0], count) );
+
+    cache->ra_lba   = lba;
+    cache->ra_count = count;
+    memcpy(buffer, cache->burst[0], BLOCK_SIZE);
+    return true;
+  }
+
+  idx = line_alloc(cache, lba);
+  TU_VERIFY(idx != LINE_NONE);
+
+  if ( !device_read(cache, lba, cache->line_data[idx], 1) )
+  {
+    cache->line_stamp[idx] = 0;
+    return false;
+  }
+
+  memcpy(buffer, cache->line_data[idx], BLOCK_SIZE);
+  return true;
+}
+
+//--------------------------------------------------------------------+
+// APPLICATION API
+//--------------------------------------------------------------------+
+void tuh_msc_cache_init(tuh_msc_cache_t* cache, tuh_msc_cache_backend_t const* backend, void* ctx, uint64_t block_count)
+{
+  tu_memclr(cache, offsetof(tuh_msc_cache_t, line_data));
+
+  cache->backend     = backend;
+  cache->ctx         = ctx;
+  cache->block_count = block_count;
+}
+
+bool tuh_msc_cache_read(tuh_msc_cache_t* cache, uint64_t lba, void* buffer, uint32_t count)
+{
+  uint8_t* buf8 = (uint8_t*) buffer;
+
+  cache->sequential = (lba == cache->next_lba);
+  cache->next_lba   = lba + count;
+
+  if ( count == 1 ) return read_single(cache, lba, buf8);
+
+  // multiple sectors bypass cache lines, dirty lines are newer than device
+  cache->stats.read_misses += count;
+  TU_VERIFY( device_read(cache, lba, buf8, count) );
+
+  for(uint8_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    if ( cache->line_stamp[i] && cache->line_dirty[i] && cache->line_lba[i] >= lba && cache->line_lba[i] < lba + count )
+    {
+      memcpy(buf8 + (cache->line_lba[i] - lba)*BLOCK_SIZE, cache->line_data[i], BLOCK_SIZE);
+    }
+  }
+
+  return true;
+}
+
+bool tuh_msc_cache_write(tuh_msc_cache_t* cache, uint64_t lba, void const* buffer, uint32_t count)
+{
+  uint8_t const* buf8 = (uint8_t const*) buffer;
+
+  if ( count == 1 )
+  {
+    uint8_t idx = line_find(cache, lba);
+
+    if ( idx == LINE_NONE )
+    {
+      idx = line_alloc(cache, lba);
+      TU_VERIFY(idx != LINE_NONE);
+    }
+    else
+    {
+      line_touch(cache, idx);
+    }
+
+    cache->stats.write_hits++;
+    memcpy(cache->line_data[idx], buf8, BLOCK_SIZE);
+    cache->line_dirty[idx] = true;
+
+    // sequential writes: full burst of dirty sectors is written back right away and its lines are released,
+    // so that streamed data does not evict e.g FAT/directory sectors
+    uint32_t run = 1;
+    while ( run < CFG_TUH_MSC_CACHE_BURST && lba >= run )
+    {
+      uint8_t const prev = line_find(cache, lba-run);
+      if ( prev == LINE_NONE || !cache->line_dirty[prev] ) break;
+      run++;
+    }
+
+    if ( run == CFG_TUH_MSC_CACHE_BURST && CFG_TUH_MSC_CACHE_BURST > 1 )
+    {
+      TU_VERIFY( line_flush(cache, idx) );
+      for(uint32_t i=0; i<run; i++) cache->line_stamp[line_find(cache, lba-i)] = 0;
+    }
+
+    return true;
+  }
+
+  cache->stats.write_through += count;
+  TU_VERIFY( device_write(cache, lba, buf8, count) );
+
+  // cached copy of written sectors is up to date and clean
+  for(uint8_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    if ( cache->line_stamp[i] && cache->line_lba[i] >= lba && cache->line_lba[i] < lba + count )
+    {
+      memcpy(cache->line_data[i], buf8 + (cache->line_lba[i] - lba)*BLOCK_SIZE, BLOCK_SIZE);
+      cache->line_dirty[i] = false;
+    }
+  }
+
+  return true;
+}
+
+bool tuh_msc_cache_sync(tuh_msc_cache_t* cache)
+{
+  for(uint8_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    if ( cache->line_stamp[i] && cache->line_dirty[i] )
+    {
+      TU_VERIFY( line_flush(cache, i) );
+    }
+  }
+
+  return true;
+}
+
+void tuh_msc_cache_invalidate(tuh_msc_cache_t* cache)
+{
+  tu_memclr(cache->line_stamp, sizeof(cache->line_stamp));
+  tu_memclr(cache->line_dirty, sizeof(cache->line_dirty));
+  cache->ra_count = 0;
+}
+
+uint8_t tuh_msc_cache_hit_rate(tuh_msc_cache_t const* cache)
+{
+  uint32_t const total = cache->stats.read_hits + cache->stats.read_misses;
+  return total ? (uint8_t) ((100ULL*cache->stats.read_hits) / total) : 0;
+}
+
+//--------------------------------------------------------------------+
+// MassStorage backend
+//--------------------------------------------------------------------+
+#if TUSB_OPT_HOST_ENABLED && CFG_TUH_MSC
+
+typedef struct
+{
+  volatile bool done;
+  bool passed;
+} msc_io_t;
+
+static bool msc_io_complete(uint8_t dev_addr, msc_cbw_t const* cbw, msc_csw_t const* csw, void* user_ctx)
+{
+  (void) dev_addr; (void) cbw;
+
+  msc_io_t* io = (msc_io_t*) user_ctx;
+  io->passed = (csw->status == MSC_CSW_STATUS_PASSED);
+  io->done   = true;
+
+  return true;
+}
+
+static bool msc_io_wait(uint8_t dev_addr, msc_io_t* io)
+{
+  while ( !io->done )
+  {
+    // unplugged
+    TU_VERIFY( tuh_msc_is_mounted(dev_addr) );
+
+#if CFG_TUSB_OS == OPT_OS_NONE
+    tuh_task(); // completion callback is invoked by tuh_task()
+#else
+    osal_task_delay(1);
+#endif
+  }
+
+  return io->passed;
+}
+
+static bool msc_read(void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count)
+{
+  uint8_t const dev_addr = (uint8_t) (uintptr_t) ctx;
+  msc_io_t io = { .done = false, .passed = false };
+
+  TU_VERIFY( tuh_msc_read_blocks(dev_addr, 0, buffer, lba, count, msc_io_complete, &io) );
+  return msc_io_wait(dev_addr, &io);
+}
+
+static bool msc_write(void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count)
+{
+  uint8_t const dev_addr = (uint8_t) (uintptr_t) ctx;
+  msc_io_t io = { .done = false, .passed = false };
+
+  TU_VERIFY( tuh_msc_write_blocks(dev_addr, 0, buffer, lba, count, msc_io_complete, &io) );
+  return msc_io_wait(dev_addr, &io);
+}
+
+static tuh_msc_cache_backend_t const _msc_backend =
+{
+  .read  = msc_read,
+  .write = msc_write
+};
+
+bool tuh_msc_cache_mount(tuh_msc_cache_t* cache, uint8_t dev_addr)
+{
+  TU_VERIFY( tuh_msc_is_mounted(dev_addr) && tuh_msc_get_block_size(dev_addr) == BLOCK_SIZE );
+
+  tuh_msc_cache_init(cache, &_msc_backend, (void*) (uintptr_t) dev_addr, tuh_msc_get_block_count(dev_addr));
+  return true;
+}
+
+#endif
+
+#endif
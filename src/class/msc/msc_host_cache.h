@@ -0,0 +1,158 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#ifndef _TUSB_MSC_HOST_CACHE_H_
+#define _TUSB_MSC_HOST_CACHE_H_
+
+#include "common/tusb_common.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** \addtogroup ClassDriver_MSC
+ *  @{
+ * \defgroup MSC_Host_Cache Host Block Cache
+ *  Write-back sector cache between file system (e.g FatFs diskio) and MassStorage device. Single sector accesses
+ *  (FAT, directory) are served from LRU cache lines, sequential single sector reads trigger read-ahead of
+ *  \ref CFG_TUH_MSC_CACHE_BURST sectors in one command, and adjacent dirty sectors are written back with one command.
+ *  Multiple sector accesses bypass the cache lines since they are already efficient on the bus.
+ *  @{ */
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Number of cached sectors
+#ifndef CFG_TUH_MSC_CACHE_SECTORS
+#define CFG_TUH_MSC_CACHE_SECTORS     16
+#endif
+
+// Sector size, device with different block size cannot be cached
+#ifndef CFG_TUH_MSC_CACHE_BLOCK_SIZE
+#define CFG_TUH_MSC_CACHE_BLOCK_SIZE  512
+#endif
+
+// Max sectors of a read-ahead or coalesced write-back command
+#ifndef CFG_TUH_MSC_CACHE_BURST
+#define CFG_TUH_MSC_CACHE_BURST       8
+#endif
+
+//--------------------------------------------------------------------+
+// Cache
+//--------------------------------------------------------------------+
+
+/// Blocking block device accessed by cache
+typedef struct
+{
+  bool (* read ) (void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count);
+  bool (* write) (void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count);
+} tuh_msc_cache_backend_t;
+
+/// Cache statistics, counted in sectors unless noted
+typedef struct
+{
+  uint32_t read_hits;        ///< sectors read without device access, including read-ahead
+  uint32_t read_misses;      ///< sectors read from device
+  uint32_t readahead_hits;   ///< sectors served by read-ahead buffer
+  uint32_t write_hits;       ///< single sector writes absorbed by cache line
+  uint32_t write_through;    ///< sectors of multiple sector writes sent directly to device
+
+  uint32_t device_reads;     ///< number of read commands sent to device
+  uint32_t device_writes;    ///< number of write commands sent to device
+  uint32_t device_write_sectors; ///< sectors written to device
+} tuh_msc_cache_stats_t;
+
+typedef struct
+{
+  tuh_msc_cache_backend_t const* backend;
+  void*    ctx;
+  uint64_t block_count; // 0 if unknown
+
+  // cache lines
+  uint64_t line_lba  [CFG_TUH_MSC_CACHE_SECTORS];
+  uint32_t line_stamp[CFG_TUH_MSC_CACHE_SECTORS]; // LRU, 0 means invalid
+  bool     line_dirty[CFG_TUH_MSC_CACHE_SECTORS];
+  uint32_t clock;
+
+  // sequential detection and read-ahead window in burst buffer
+  uint64_t next_lba;
+  uint64_t ra_lba;
+  uint32_t ra_count;
+  bool     sequential;
+
+  tuh_msc_cache_stats_t stats;
+
+  // must be accessible by USB controller, see CFG_TUSB_MEM_SECTION
+  TU_ATTR_ALIGNED(4) uint8_t line_data[CFG_TUH_MSC_CACHE_SECTORS][CFG_TUH_MSC_CACHE_BLOCK_SIZE];
+  TU_ATTR_ALIGNED(4) uint8_t burst[CFG_TUH_MSC_CACHE_BURST][CFG_TUH_MSC_CACHE_BLOCK_SIZE];
+} tuh_msc_cache_t;
+
+/** \brief      Initialize cache on top of a block device
+ * \param[in]   cache       Cache object, should be placed in \ref CFG_TUSB_MEM_SECTION
+ * \param[in]   backend     Block device functions, invoked in caller context
+ * \param[in]   ctx         Passed to backend functions
+ * \param[in]   block_count Number of blocks of device used to limit read-ahead, 0 if unknown
+ */
+void tuh_msc_cache_init(tuh_msc_cache_t* cache, tuh_msc_cache_backend_t const* backend, void* ctx, uint64_t block_count);
+
+bool tuh_msc_cache_read (tuh_msc_cache_t* cache, uint64_t lba, void* buffer, uint32_t count);
+bool tuh_msc_cache_write(tuh_msc_cache_t* cache, uint64_t lba, void const* buffer, uint32_t count);
+
+/// Write back all dirty sectors, e.g FatFs CTRL_SYNC
+bool tuh_msc_cache_sync(tuh_msc_cache_t* cache);
+
+/// Drop all cached data without writing back, e.g device is unplugged
+void tuh_msc_cache_invalidate(tuh_msc_cache_t* cache);
+
+static inline tuh_msc_cache_stats_t const* tuh_msc_cache_get_stats(tuh_msc_cache_t const* cache)
+{
+  return &cache->stats;
+}
+
+static inline void tuh_msc_cache_reset_stats(tuh_msc_cache_t* cache)
+{
+  tu_memclr(&cache->stats, sizeof(tuh_msc_cache_stats_t));
+}
+
+/// Percentage of sectors read without device access
+uint8_t tuh_msc_cache_hit_rate(tuh_msc_cache_t const* cache);
+
+/** \brief      Initialize cache on LUN 0 of mounted MassStorage device
+ * \note        Backend blocks until command is complete, under OS NONE it runs tuh_task() while waiting,
+ *              therefore cache must not be accessed from tuh_task() callbacks.
+ * \retval      false if device is not mounted or block size is not \ref CFG_TUH_MSC_CACHE_BLOCK_SIZE
+ */
+bool tuh_msc_cache_mount(tuh_msc_cache_t* cache, uint8_t dev_addr);
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_MSC_HOST_CACHE_H_ */
+
+/// @}
+/// @}
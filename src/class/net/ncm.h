@@ -0,0 +1,113 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+/** \ingroup ClassDriver_CDC Communication Device Class (CDC)
+ * \defgroup CDC_NCM Network Control Model (NCM)
+ *  @{
+ *  \defgroup CDC_NCM_Common Common Definitions
+ *  @{ */
+
+#ifndef _TUSB_NCM_H_
+#define _TUSB_NCM_H_
+
+#include "common/tusb_common.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+// Signatures of 16-bit NTB structures, in little endian
+#define NCM_NTH16_SIGNATURE       0x484D434EUL ///< "NCMH"
+#define NCM_NDP16_SIGNATURE_NCM0  0x304D434EUL ///< "NCM0", datagrams without CRC
+#define NCM_NDP16_SIGNATURE_NCM1  0x314D434EUL ///< "NCM1", datagrams with CRC
+
+// Minimum NTB size that every function and host must support
+#define NCM_NTB_MIN_IN_SIZE       2048
+
+/// bmNtbFormatsSupported of \ref ncm_ntb_parameters_t
+enum
+{
+  NCM_NTB_FORMAT_16BIT = TU_BIT(0),
+  NCM_NTB_FORMAT_32BIT = TU_BIT(1),
+};
+
+/// Response of \ref CDC_REQUEST_GET_NTB_PARAMETERS
+typedef struct TU_ATTR_PACKED
+{
+  uint16_t wLength                 ; ///< Size of this structure, must be 0x1C
+  uint16_t bmNtbFormatsSupported   ; ///< Bitmap of supported NTB formats
+  uint32_t dwNtbInMaxSize          ; ///< Max size of IN NTB in bytes
+  uint16_t wNdpInDivisor           ; ///< Divisor used for IN NTB datagram payload alignment
+  uint16_t wNdpInPayloadRemainder  ; ///< Remainder used to align input datagram payload within the NTB
+  uint16_t wNdpInAlignment         ; ///< NDP alignment modulus for NTBs on the IN pipe
+  uint16_t wReserved               ;
+  uint32_t dwNtbOutMaxSize         ; ///< Max size of OUT NTB in bytes
+  uint16_t wNdpOutDivisor          ; ///< Divisor used for OUT NTB datagram payload alignment
+  uint16_t wNdpOutPayloadRemainder ; ///< Remainder used to align output datagram payload offsets within the NTB
+  uint16_t wNdpOutAlignment        ; ///< NDP alignment modulus for use in NTBs on the OUT pipe
+  uint16_t wNtbOutMaxDatagrams     ; ///< Max number of datagrams in an OUT NTB, 0 means no limit
+} ncm_ntb_parameters_t;
+
+TU_VERIFY_STATIC(sizeof(ncm_ntb_parameters_t) == 28, "size is not correct");
+
+/// NTB Header (16-bit)
+typedef struct TU_ATTR_PACKED
+{
+  uint32_t dwSignature   ; ///< must be \ref NCM_NTH16_SIGNATURE
+  uint16_t wHeaderLength ; ///< Size of this header, must be 12
+  uint16_t wSequence     ; ///< Sequence number of this NTB
+  uint16_t wBlockLength  ; ///< Size of this NTB in bytes
+  uint16_t wNdpIndex     ; ///< Offset of the first NDP from start of NTB
+} ncm_nth16_t;
+
+TU_VERIFY_STATIC(sizeof(ncm_nth16_t) == 12, "size is not correct");
+
+/// Datagram pointer entry of NDP (16-bit), terminated by an entry of zero index and length
+typedef struct TU_ATTR_PACKED
+{
+  uint16_t wDatagramIndex  ; ///< Offset of datagram from start of NTB
+  uint16_t wDatagramLength ; ///< Length of datagram in bytes
+} ncm_datagram16_t;
+
+/// NTB Datagram Pointer Table (16-bit)
+typedef struct TU_ATTR_PACKED
+{
+  uint32_t dwSignature     ; ///< \ref NCM_NDP16_SIGNATURE_NCM0 or \ref NCM_NDP16_SIGNATURE_NCM1
+  uint16_t wLength         ; ///< Size of this NDP including datagram pointers, multiple of 4 and at least 16
+  uint16_t wNextNdpIndex   ; ///< Offset of next NDP from start of NTB, 0 if this is the last one
+  ncm_datagram16_t datagram[]; ///< Datagram pointers
+} ncm_ndp16_t;
+
+TU_VERIFY_STATIC(sizeof(ncm_ndp16_t) == 8, "Make sure flexible array member does not affect layout");
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_NCM_H_ */
+
+/** @} */
+/** @} */
@@ -40,6 +40,7 @@ void rndis_class_set_handler(uint8_t *data, int size); /* found in ./misc/networ
 //--------------------------------------------------------------------+
 typedef struct
 {
+  uint8_t rhport;       // Device port that opened the interface
   uint8_t itf_num;      // Index number of Management Interface, +1 for Data Interface
   uint8_t itf_data_alt; // Alternate setting of Data Interface. 0 : inactive, 1 : active
 
@@ -106,18 +107,18 @@ static bool can_xmit;
 
 void tud_network_recv_renew(void)
 {
-  usbd_edpt_xfer(TUD_OPT_RHPORT, _netd_itf.ep_out, received, sizeof(received));
+  usbd_edpt_xfer(_netd_itf.rhport, _netd_itf.ep_out, received, sizeof(received));
 }
 
 static void do_in_xfer(uint8_t *buf, uint16_t len)
 {
   can_xmit = false;
-  usbd_edpt_xfer(TUD_OPT_RHPORT, _netd_itf.ep_in, buf, len);
+  usbd_edpt_xfer(_netd_itf.rhport, _netd_itf.ep_in, buf, len);
 }
 
 void netd_report(uint8_t *buf, uint16_t len)
 {
-  usbd_edpt_xfer(TUD_OPT_RHPORT, _netd_itf.ep_notif, buf, len);
+  usbd_edpt_xfer(_netd_itf.rhport, _netd_itf.ep_notif, buf, len);
 }
 
 //--------------------------------------------------------------------+
@@ -130,9 +131,8 @@ void netd_init(void)
 
 void netd_reset(uint8_t rhport)
 {
-  (void) rhport;
-
-  netd_init();
+  // interface opened by other device port is not affected
+  if ( _netd_itf.rhport == rhport ) netd_init();
 }
 
 uint16_t netd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint16_t max_len)
@@ -147,9 +147,11 @@ uint16_t netd_open(uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint1
 
   TU_VERIFY(is_rndis || is_ecm, 0);
 
-  // confirm interface hasn't already been allocated
+  // confirm interface hasn't already been allocated (on either device port)
   TU_ASSERT(0 == _netd_itf.ep_notif, 0);
 
+  _netd_itf.rhport = rhport;
+
   // sanity check the descriptor
   _netd_itf.ecm_mode = is_ecm;
 
@@ -0,0 +1,834 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if (TUSB_OPT_HOST_ENABLED && CFG_TUH_NET)
+
+#include "net_host.h"
+#include "ncm.h"
+#include "class/cdc/cdc_rndis.h"
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+
+// Configuration is a chain of asynchronous control transfers started by open.
+// RNDIS command is followed by RESPONSE_AVAILABLE on notification endpoint, then its response is read.
+enum
+{
+  CONFIG_NONE = 0,
+
+  // CDC-ECM and CDC-NCM
+  CONFIG_GET_MAC_STRING,
+  CONFIG_NCM_GET_NTB_PARAMETERS,
+  CONFIG_NCM_SET_NTB_INPUT_SIZE,
+  CONFIG_SET_INTERFACE,
+  CONFIG_SET_PACKET_FILTER,
+
+  // RNDIS
+  CONFIG_RNDIS_INITIALIZE,
+  CONFIG_RNDIS_QUERY_MAC,
+  CONFIG_RNDIS_SET_FILTER,
+
+  CONFIG_COMPLETE
+};
+
+enum
+{
+  CTRL_BUFSIZE  = 128, // RNDIS response, MAC address string and NTB parameters
+  NOTIF_BUFSIZE = 16
+};
+
+typedef struct
+{
+  uint8_t dev_addr;
+  uint8_t protocol;
+  uint8_t config;
+
+  uint8_t itf_num;
+  uint8_t itf_data;
+  uint8_t itf_data_alt;  // alternate setting of data interface having endpoints
+  uint8_t mac_string;    // CDC-ECM, CDC-NCM: string index of MAC address
+
+  uint8_t ep_notif;
+  uint8_t ep_in;
+  uint8_t ep_out;
+  uint8_t notif_len;
+
+  uint16_t ep_out_size;
+  uint16_t rx_xfer_len;  // IN transfer length, multiple of endpoint size
+  uint16_t tx_no_zlp;    // CDC-NCM: NTB of dwNtbOutMaxSize is not followed by zero length packet
+
+  uint32_t rndis_request_id;
+
+  uint8_t mac[6];
+  bool    link_up;
+
+  // RX ring: rx_count buffers from rx_rd are received, the rx_armed ones after them are queued on IN endpoint
+  bool     rx_hold;      // frame refused by application, wait for tuh_network_recv_renew()
+  bool     rx_stopped;   // transfer failed e.g stalled, wait for tuh_network_recv_renew()
+  uint8_t  rx_rd;
+  uint8_t  rx_count;
+  uint8_t  rx_armed;
+  uint16_t rx_len[CFG_TUH_NET_RX_BUFS];
+  neth_rx_cursor_t rx_cursor;
+
+  // TX ring: tx_count buffers from tx_rd hold frames, the first tx_inflight ones are queued on OUT endpoint.
+  // Frames are added to the last buffer as long as it is not queued and has room.
+  uint8_t  tx_rd;
+  uint8_t  tx_count;
+  uint8_t  tx_inflight;
+  uint16_t tx_sequence;
+  bool     tx_zlp[CFG_TUH_NET_TX_BUFS]; // zero length packet is queued after transfer of buffer
+  neth_tx_param_t tx_param;
+  neth_tx_block_t tx_block[CFG_TUH_NET_TX_BUFS];
+
+  /*------------- From this point, data is not cleared by close -------------*/
+  CFG_TUSB_MEM_ALIGN union
+  {
+    uint8_t                      raw[CTRL_BUFSIZE];
+    rndis_msg_initialize_t       rndis_init;
+    rndis_msg_initialize_cmplt_t rndis_init_cmplt;
+    rndis_msg_query_t            rndis_query;
+    rndis_msg_query_cmplt_t      rndis_query_cmplt;
+    rndis_msg_set_cmplt_t        rndis_set_cmplt;
+    rndis_msg_indicate_status_t  rndis_status;
+    ncm_ntb_parameters_t         ntb_params;
+    uint32_t                     ntb_input_size;
+  } ctrl;
+
+  CFG_TUSB_MEM_ALIGN uint8_t notif_buf[NOTIF_BUFSIZE];
+
+  CFG_TUSB_MEM_ALIGN uint8_t rx_buf[CFG_TUH_NET_RX_BUFS][CFG_TUH_NET_RX_BUFSIZE];
+  CFG_TUSB_MEM_ALIGN uint8_t tx_buf[CFG_TUH_NET_TX_BUFS][CFG_TUH_NET_TX_BUFSIZE];
+} neth_interface_t;
+
+#define ITF_MEM_RESET_SIZE   offsetof(neth_interface_t, ctrl)
+
+TU_VERIFY_STATIC(CFG_TUH_NET_RX_BUFSIZE % 4 == 0 && CFG_TUH_NET_TX_BUFSIZE % 4 == 0, "buffers must be word aligned");
+
+//--------------------------------------------------------------------+
+// INTERNAL OBJECT & FUNCTION DECLARATION
+//--------------------------------------------------------------------+
+CFG_TUSB_MEM_SECTION static neth_interface_t _neth_itf;
+
+static bool config_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+
+static inline neth_interface_t* get_itf(uint8_t dev_addr)
+{
+  return (dev_addr && dev_addr == _neth_itf.dev_addr) ? &_neth_itf : NULL;
+}
+
+static inline bool itf_ready(neth_interface_t const* itf)
+{
+  return itf && (CONFIG_COMPLETE == itf->config);
+}
+
+static void set_link(neth_interface_t* itf, bool up)
+{
+  if ( itf->link_up == up ) return;
+
+  itf->link_up = up;
+  if ( tuh_network_link_cb ) tuh_network_link_cb(itf->dev_addr, up);
+}
+
+//--------------------------------------------------------------------+
+// RX
+//--------------------------------------------------------------------+
+
+// Arm IN endpoint with all free buffers of ring, device keeps sending while received ones are processed
+static void prep_in_transfer(neth_interface_t* itf)
+{
+  if ( !itf_ready(itf) || itf->rx_stopped ) return;
+
+  while ( itf->rx_count + itf->rx_armed < CFG_TUH_NET_RX_BUFS )
+  {
+    uint8_t const idx = (uint8_t) ((itf->rx_rd + itf->rx_count + itf->rx_armed) % CFG_TUH_NET_RX_BUFS);
+
+    if ( !hcd_pipe_xfer(itf->dev_addr, itf->ep_in, itf->rx_buf[idx], itf->rx_xfer_len, true) ) return;
+    itf->rx_armed++;
+  }
+}
+
+// Hand received frames to application in order, buffer is freed once all of its frames are taken
+static void rx_deliver(neth_interface_t* itf)
+{
+  while ( itf->rx_count && !itf->rx_hold )
+  {
+    uint8_t const idx = itf->rx_rd;
+    neth_rx_cursor_t cursor = itf->rx_cursor;
+    uint8_t const* frame;
+    uint16_t frame_len;
+
+    if ( !neth_rx_frame_next(itf->protocol, itf->rx_buf[idx], itf->rx_len[idx], &cursor, &frame, &frame_len) )
+    {
+      tu_varclr(&itf->rx_cursor);
+      itf->rx_rd = (uint8_t) ((idx + 1) % CFG_TUH_NET_RX_BUFS);
+      itf->rx_count--;
+
+      prep_in_transfer(itf);
+      continue;
+    }
+
+    // frame is dropped if there is no pbuf for it
+    struct pbuf* p = frame_len ? pbuf_alloc(PBUF_RAW, frame_len, PBUF_POOL) : NULL;
+
+    if ( p )
+    {
+      pbuf_take(p, frame, frame_len);
+
+      if ( !tuh_network_recv_cb(itf->dev_addr, p) )
+      {
+        // offered again after renew
+        pbuf_free(p);
+        itf->rx_hold = true;
+        return;
+      }
+    }
+
+    itf->rx_cursor = cursor;
+  }
+}
+
+//--------------------------------------------------------------------+
+// TX
+//--------------------------------------------------------------------+
+
+// Last buffer of ring if frames can still be added to it
+static neth_tx_block_t* tx_fill_block(neth_interface_t* itf, uint8_t* idx)
+{
+  if ( itf->tx_inflight == itf->tx_count ) return NULL;
+
+  *idx = (uint8_t) ((itf->tx_rd + itf->tx_count - 1) % CFG_TUH_NET_TX_BUFS);
+  return &itf->tx_block[*idx];
+}
+
+// Queue buffers on OUT endpoint in order. A buffer is sent once it is full or no transfer is in flight,
+// otherwise the last one keeps collecting frames while previous transfers are on the bus.
+static void tx_submit(neth_interface_t* itf)
+{
+  while ( itf->tx_inflight < itf->tx_count )
+  {
+    uint8_t const idx = (uint8_t) ((itf->tx_rd + itf->tx_inflight) % CFG_TUH_NET_TX_BUFS);
+    neth_tx_block_t* block = &itf->tx_block[idx];
+
+    if ( itf->tx_inflight && (itf->tx_inflight + 1 == itf->tx_count) &&
+         neth_tx_block_fits(&itf->tx_param, block, CFG_TUH_NET_MTU) ) return;
+
+    uint16_t const len = neth_tx_block_finalize(&itf->tx_param, block, itf->tx_buf[idx], itf->tx_sequence++);
+    if ( !hcd_pipe_xfer(itf->dev_addr, itf->ep_out, itf->tx_buf[idx], len, true) ) return;
+    itf->tx_inflight++;
+
+    // transfer ending with a full packet needs a zero length packet, queued right behind it
+    itf->tx_zlp[idx] = (0 == (len % itf->ep_out_size)) && (len != itf->tx_no_zlp) &&
+                       hcd_pipe_xfer(itf->dev_addr, itf->ep_out, NULL, 0, true);
+  }
+}
+
+static void tx_complete(neth_interface_t* itf)
+{
+  if ( 0 == itf->tx_inflight ) return;
+
+  uint8_t const idx = itf->tx_rd;
+
+  // data of buffer is sent, wait for its zero length packet
+  if ( itf->tx_zlp[idx] )
+  {
+    itf->tx_zlp[idx] = false;
+    return;
+  }
+
+  // buffer is released even if transfer failed, frames are lost as on any network
+  itf->tx_rd = (uint8_t) ((idx + 1) % CFG_TUH_NET_TX_BUFS);
+  itf->tx_count--;
+  itf->tx_inflight--;
+
+  // frames added meanwhile are sent together
+  tx_submit(itf);
+}
+
+//--------------------------------------------------------------------+
+// APPLICATION API
+//--------------------------------------------------------------------+
+bool tuh_network_mounted(uint8_t dev_addr)
+{
+  return itf_ready(get_itf(dev_addr));
+}
+
+bool tuh_network_get_mac(uint8_t dev_addr, uint8_t mac[6])
+{
+  neth_interface_t const* itf = get_itf(dev_addr);
+  TU_VERIFY(itf_ready(itf));
+
+  memcpy(mac, itf->mac, 6);
+  return true;
+}
+
+bool tuh_network_link_up(uint8_t dev_addr)
+{
+  neth_interface_t const* itf = get_itf(dev_addr);
+  return itf_ready(itf) && itf->link_up;
+}
+
+void tuh_network_recv_renew(uint8_t dev_addr)
+{
+  neth_interface_t* itf = get_itf(dev_addr);
+  if ( !itf_ready(itf) ) return;
+
+  itf->rx_hold    = false;
+  itf->rx_stopped = false;
+  rx_deliver(itf);
+
+  // also restart reception stopped by error
+  prep_in_transfer(itf);
+}
+
+bool tuh_network_can_xmit(uint8_t dev_addr)
+{
+  neth_interface_t* itf = get_itf(dev_addr);
+  TU_VERIFY(itf_ready(itf));
+
+  if ( itf->tx_count < CFG_TUH_NET_TX_BUFS ) return true;
+
+  uint8_t idx;
+  neth_tx_block_t const* block = tx_fill_block(itf, &idx);
+  return block && neth_tx_block_fits(&itf->tx_param, block, CFG_TUH_NET_MTU);
+}
+
+bool tuh_network_xmit(uint8_t dev_addr, struct pbuf *p)
+{
+  neth_interface_t* itf = get_itf(dev_addr);
+  TU_VERIFY(itf_ready(itf) && p->tot_len);
+
+  uint8_t  idx;
+  uint8_t* frame = NULL;
+
+  // aggregate with frames waiting for the transfer in progress
+  neth_tx_block_t* block = tx_fill_block(itf, &idx);
+  if ( block ) frame = neth_tx_block_add(&itf->tx_param, block, itf->tx_buf[idx], p->tot_len);
+
+  if ( !frame && itf->tx_count < CFG_TUH_NET_TX_BUFS )
+  {
+    idx   = (uint8_t) ((itf->tx_rd + itf->tx_count) % CFG_TUH_NET_TX_BUFS);
+    block = &itf->tx_block[idx];
+
+    neth_tx_block_init(&itf->tx_param, block, itf->tx_buf[idx]);
+    frame = neth_tx_block_add(&itf->tx_param, block, itf->tx_buf[idx], p->tot_len);
+    if ( frame ) itf->tx_count++;
+  }
+
+  TU_VERIFY(frame);
+  pbuf_copy_partial(p, frame, p->tot_len, 0);
+
+  tx_submit(itf);
+  return true;
+}
+
+//--------------------------------------------------------------------+
+// CONFIGURATION
+//--------------------------------------------------------------------+
+static bool class_request(neth_interface_t* itf, uint8_t config, uint8_t direction, uint8_t request, uint16_t value,
+                          uint16_t length)
+{
+  tusb_control_request_t const req =
+  {
+    .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = direction },
+    .bRequest = request,
+    .wValue   = value,
+    .wIndex   = itf->itf_num,
+    .wLength  = length
+  };
+
+  itf->config = config;
+  return tuh_control_xfer_async(itf->dev_addr, &req, length ? itf->ctrl.raw : NULL, config_complete, NULL);
+}
+
+static bool get_mac_string(neth_interface_t* itf)
+{
+  tusb_control_request_t const req =
+  {
+    .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+    .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+    .wValue   = (TUSB_DESC_STRING << 8) | itf->mac_string,
+    .wIndex   = 0x0409, // English
+    .wLength  = 2 + 12*2
+  };
+
+  itf->config = CONFIG_GET_MAC_STRING;
+  return tuh_control_xfer_async(itf->dev_addr, &req, itf->ctrl.raw, config_complete, NULL);
+}
+
+static bool set_data_interface(neth_interface_t* itf)
+{
+  tusb_control_request_t const req =
+  {
+    .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
+    .bRequest = TUSB_REQ_SET_INTERFACE,
+    .wValue   = itf->itf_data_alt,
+    .wIndex   = itf->itf_data,
+    .wLength  = 0
+  };
+
+  itf->config = CONFIG_SET_INTERFACE;
+  return tuh_control_xfer_async(itf->dev_addr, &req, NULL, config_complete, NULL);
+}
+
+// MAC address string is 12 hexadecimal digits in UTF-16
+static bool parse_mac_string(neth_interface_t* itf)
+{
+  uint8_t const* desc = itf->ctrl.raw;
+  TU_VERIFY(desc[0] >= 2 + 12*2 && TUSB_DESC_STRING == desc[1]);
+
+  for(uint8_t i=0; i<12; i++)
+  {
+    uint8_t const c = desc[2 + 2*i];
+    uint8_t nibble;
+
+    if      ( '0' <= c && c <= '9' ) nibble = (uint8_t) (c - '0');
+    else if ( 'A' <= c && c <= 'F' ) nibble = (uint8_t) (c - 'A' + 10);
+    else if ( 'a' <= c && c <= 'f' ) nibble = (uint8_t) (c - 'a' + 10);
+    else return false;
+
+    itf->mac[i/2] = (uint8_t) ((i & 1) ? (itf->mac[i/2] | nibble) : (nibble << 4));
+  }
+
+  return true;
+}
+
+static bool ncm_apply_ntb_parameters(neth_interface_t* itf)
+{
+  ncm_ntb_parameters_t const* params = &itf->ctrl.ntb_params;
+  TU_ASSERT(params->bmNtbFormatsSupported & NCM_NTB_FORMAT_16BIT);
+  TU_ASSERT(params->dwNtbInMaxSize >= NCM_NTB_MIN_IN_SIZE);
+
+  neth_tx_param_t* tx = &itf->tx_param;
+  tx->max_len       = (uint16_t) tu_min32(CFG_TUH_NET_TX_BUFSIZE, params->dwNtbOutMaxSize);
+  tx->max_count     = params->wNtbOutMaxDatagrams ? (uint8_t) tu_min16(CFG_TUH_NET_TX_FRAMES, params->wNtbOutMaxDatagrams) : CFG_TUH_NET_TX_FRAMES;
+  tx->divisor       = params->wNdpOutDivisor;
+  tx->remainder     = params->wNdpOutDivisor ? (uint16_t) (params->wNdpOutPayloadRemainder % params->wNdpOutDivisor) : 0;
+  tx->ndp_alignment = params->wNdpOutAlignment;
+
+  // NTB of max size is the only one not terminated by short packet
+  itf->tx_no_zlp = (tx->max_len == params->dwNtbOutMaxSize) ? tx->max_len : 0;
+
+  // device must not send NTB larger than an IN transfer
+  itf->rx_xfer_len = (uint16_t) tu_min32(itf->rx_xfer_len, params->dwNtbInMaxSize);
+
+  return true;
+}
+
+// Send RNDIS message already built in control buffer
+static bool rndis_command(neth_interface_t* itf, uint8_t config, uint32_t type, uint32_t length)
+{
+  rndis_msg_initialize_t* msg = &itf->ctrl.rndis_init;
+  msg->type       = type;
+  msg->length     = length;
+  msg->request_id = ++itf->rndis_request_id;
+
+  return class_request(itf, config, TUSB_DIR_OUT, CDC_REQUEST_SEND_ENCAPSULATED_COMMAND, 0, (uint16_t) length);
+}
+
+static bool rndis_oid_request(neth_interface_t* itf, uint8_t config, uint32_t type, uint32_t oid, void const* data, uint8_t len)
+{
+  rndis_msg_query_t* msg = &itf->ctrl.rndis_query;
+  tu_memclr(msg, sizeof(rndis_msg_query_t));
+
+  msg->oid           = oid;
+  msg->buffer_length = len;
+  msg->buffer_offset = len ? sizeof(rndis_msg_query_t) - offsetof(rndis_msg_query_t, request_id) : 0;
+  if ( len ) memcpy(msg->oid_buffer, data, len);
+
+  return rndis_command(itf, config, type, sizeof(rndis_msg_query_t) + len);
+}
+
+// Validate response of the command last sent
+static bool rndis_response_valid(neth_interface_t const* itf, uint32_t type)
+{
+  rndis_msg_set_cmplt_t const* cmplt = &itf->ctrl.rndis_set_cmplt;
+
+  TU_VERIFY(cmplt->type == type && cmplt->request_id == itf->rndis_request_id);
+  TU_VERIFY(cmplt->length >= sizeof(rndis_msg_set_cmplt_t) && cmplt->length <= CTRL_BUFSIZE);
+  return cmplt->status == RNDIS_STATUS_SUCCESS;
+}
+
+static bool rndis_apply_init_cmplt(neth_interface_t* itf)
+{
+  rndis_msg_initialize_cmplt_t const* cmplt = &itf->ctrl.rndis_init_cmplt;
+  TU_ASSERT(rndis_response_valid(itf, RNDIS_MSG_INITIALIZE_CMPLT) && cmplt->max_packet_per_xfer);
+
+  neth_tx_param_t* tx = &itf->tx_param;
+  tx->max_len   = (uint16_t) tu_min32(CFG_TUH_NET_TX_BUFSIZE, cmplt->max_xfer_size);
+  tx->max_count = (uint8_t) tu_min32(CFG_TUH_NET_TX_FRAMES, cmplt->max_packet_per_xfer);
+  tx->divisor   = (uint16_t) (1u << tu_min32(cmplt->packet_alignment_factor, 8));
+
+  return true;
+}
+
+static bool rndis_apply_mac(neth_interface_t* itf)
+{
+  rndis_msg_query_cmplt_t const* cmplt = &itf->ctrl.rndis_query_cmplt;
+  TU_ASSERT(rndis_response_valid(itf, RNDIS_MSG_QUERY_CMPLT));
+
+  uint32_t const offset = offsetof(rndis_msg_query_cmplt_t, request_id) + cmplt->buffer_offset;
+  TU_ASSERT(cmplt->buffer_length >= 6 && offset + 6 <= CTRL_BUFSIZE);
+
+  memcpy(itf->mac, itf->ctrl.raw + offset, 6);
+  return true;
+}
+
+// Status indicated by RNDIS device after configuration
+static void rndis_status(neth_interface_t* itf)
+{
+  rndis_msg_indicate_status_t const* msg = &itf->ctrl.rndis_status;
+  if ( RNDIS_MSG_INDICATE_STATUS != msg->type ) return;
+
+  if      ( RNDIS_STATUS_MEDIA_CONNECT    == msg->status ) set_link(itf, true);
+  else if ( RNDIS_STATUS_MEDIA_DISCONNECT == msg->status ) set_link(itf, false);
+}
+
+static void config_ready(neth_interface_t* itf)
+{
+  itf->config = CONFIG_COMPLETE;
+
+  TU_LOG2("NET mounted, protocol %u\r\n", itf->protocol);
+
+  prep_in_transfer(itf);
+  (void) hcd_pipe_xfer(itf->dev_addr, itf->ep_notif, itf->notif_buf, itf->notif_len, true);
+
+  if ( tuh_network_mount_cb ) tuh_network_mount_cb(itf->dev_addr);
+
+  // RNDIS only indicates medium changes, CDC-ECM and CDC-NCM report link state on notification endpoint
+  if ( NETH_PROTOCOL_RNDIS == itf->protocol ) set_link(itf, true);
+}
+
+static bool config_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  neth_interface_t* itf = get_itf(dev_addr);
+  TU_VERIFY(itf); // unplugged meanwhile
+
+  if ( CONFIG_COMPLETE == itf->config )
+  {
+    // response to RESPONSE_AVAILABLE after configuration
+    if ( XFER_RESULT_SUCCESS == result ) rndis_status(itf);
+    return true;
+  }
+
+  // packet filter is optional for some CDC-ECM/NCM adapters
+  TU_ASSERT(XFER_RESULT_SUCCESS == result || CONFIG_SET_PACKET_FILTER == itf->config);
+
+  // RNDIS command is sent, wait for its response to be available
+  if ( CDC_REQUEST_SEND_ENCAPSULATED_COMMAND == request->bRequest )
+  {
+    return hcd_pipe_xfer(dev_addr, itf->ep_notif, itf->notif_buf, itf->notif_len, true);
+  }
+
+  switch ( itf->config )
+  {
+    //------------- CDC-ECM and CDC-NCM -------------//
+    case CONFIG_GET_MAC_STRING:
+      TU_ASSERT( parse_mac_string(itf) );
+
+      if ( NETH_PROTOCOL_NCM == itf->protocol )
+      {
+        return class_request(itf, CONFIG_NCM_GET_NTB_PARAMETERS, TUSB_DIR_IN, CDC_REQUEST_GET_NTB_PARAMETERS, 0, sizeof(ncm_ntb_parameters_t));
+      }
+      return set_data_interface(itf);
+
+    case CONFIG_NCM_GET_NTB_PARAMETERS:
+      TU_ASSERT( ncm_apply_ntb_parameters(itf) );
+
+      // must be set while data interface is at alternate setting 0
+      itf->ctrl.ntb_input_size = itf->rx_xfer_len;
+      return class_request(itf, CONFIG_NCM_SET_NTB_INPUT_SIZE, TUSB_DIR_OUT, CDC_REQUEST_SET_NTB_INPUT_SIZE, 0, 4);
+
+    case CONFIG_NCM_SET_NTB_INPUT_SIZE:
+      return set_data_interface(itf);
+
+    case CONFIG_SET_INTERFACE:
+      return class_request(itf, CONFIG_SET_PACKET_FILTER, TUSB_DIR_OUT, CDC_REQUEST_SET_ETHERNET_PACKET_FILTER,
+                           CDC_PACKET_TYPE_DIRECTED | CDC_PACKET_TYPE_BROADCAST | CDC_PACKET_TYPE_ALL_MULTICAST, 0);
+
+    case CONFIG_SET_PACKET_FILTER:
+      config_ready(itf);
+    break;
+
+    //------------- RNDIS -------------//
+    case CONFIG_RNDIS_INITIALIZE:
+    {
+      TU_ASSERT( rndis_apply_init_cmplt(itf) );
+
+      return rndis_oid_request(itf, CONFIG_RNDIS_QUERY_MAC, RNDIS_MSG_QUERY, RNDIS_OID_802_3_PERMANENT_ADDRESS, NULL, 0);
+    }
+
+    case CONFIG_RNDIS_QUERY_MAC:
+    {
+      TU_ASSERT( rndis_apply_mac(itf) );
+
+      uint32_t const filter = RNDIS_PACKET_TYPE_DIRECTED | RNDIS_PACKET_TYPE_ALL_MULTICAST | RNDIS_PACKET_TYPE_BROADCAST;
+      return rndis_oid_request(itf, CONFIG_RNDIS_SET_FILTER, RNDIS_MSG_SET, RNDIS_OID_GEN_CURRENT_PACKET_FILTER, &filter, 4);
+    }
+
+    case CONFIG_RNDIS_SET_FILTER:
+      TU_ASSERT( rndis_response_valid(itf, RNDIS_MSG_SET_CMPLT) );
+      config_ready(itf);
+    break;
+
+    default: break;
+  }
+
+  return true;
+}
+
+// Handle notification, RNDIS uses its own RESPONSE_AVAILABLE format
+static void notification(neth_interface_t* itf, uint32_t len)
+{
+  uint8_t const* notif = itf->notif_buf;
+
+  if ( NETH_PROTOCOL_RNDIS == itf->protocol )
+  {
+    if ( len < 4 || 0x01 != notif[0] ) return;
+
+    tusb_control_request_t const req =
+    {
+      .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_INTERFACE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
+      .bRequest = CDC_REQUEST_GET_ENCAPSULATED_RESPONSE,
+      .wValue   = 0,
+      .wIndex   = itf->itf_num,
+      .wLength  = CTRL_BUFSIZE
+    };
+
+    tu_memclr(itf->ctrl.raw, CTRL_BUFSIZE);
+    (void) tuh_control_xfer_async(itf->dev_addr, &req, itf->ctrl.raw, config_complete, NULL);
+  }
+  else if ( len >= 8 && 0xA1 == notif[0] && NETWORK_CONNECTION == notif[1] )
+  {
+    set_link(itf, 0 != notif[2]);
+  }
+}
+
+//--------------------------------------------------------------------+
+// USBH-CLASS DRIVER API
+//--------------------------------------------------------------------+
+void neth_init(void)
+{
+  tu_memclr(&_neth_itf, ITF_MEM_RESET_SIZE);
+}
+
+bool neth_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length)
+{
+  uint8_t protocol;
+
+  if ( TUSB_CLASS_WIRELESS_CONTROLLER == itf_desc->bInterfaceClass &&
+       0x01 == itf_desc->bInterfaceSubClass && 0x03 == itf_desc->bInterfaceProtocol )
+  {
+    protocol = NETH_PROTOCOL_RNDIS;
+  }
+  else if ( TUSB_CLASS_CDC == itf_desc->bInterfaceClass &&
+            CDC_COMM_SUBCLASS_ABSTRACT_CONTROL_MODEL == itf_desc->bInterfaceSubClass && 0xFF == itf_desc->bInterfaceProtocol )
+  {
+    // RNDIS with CDC class code
+    protocol = NETH_PROTOCOL_RNDIS;
+  }
+  else if ( TUSB_CLASS_CDC == itf_desc->bInterfaceClass &&
+            CDC_COMM_SUBCLASS_ETHERNET_NETWORKING_CONTROL_MODEL == itf_desc->bInterfaceSubClass )
+  {
+    protocol = NETH_PROTOCOL_ECM;
+  }
+  else if ( TUSB_CLASS_CDC == itf_desc->bInterfaceClass &&
+            CDC_COMM_SUBCLASS_NETWORK_CONTROL_MODEL == itf_desc->bInterfaceSubClass )
+  {
+    protocol = NETH_PROTOCOL_NCM;
+  }
+  else
+  {
+    return false;
+  }
+
+  // Only one adapter at a time
+  TU_VERIFY(0 == _neth_itf.dev_addr);
+
+  neth_interface_t* itf = &_neth_itf;
+  tu_memclr(itf, ITF_MEM_RESET_SIZE);
+
+  itf->protocol = protocol;
+  itf->itf_num  = itf_desc->bInterfaceNumber;
+
+  //------------- Communication Interface -------------//
+  uint8_t const* p_desc = tu_desc_next(itf_desc);
+  uint16_t len = sizeof(tusb_desc_interface_t);
+
+  // Communication Functional Descriptors
+  while( TUSB_DESC_CS_INTERFACE == tu_desc_type(p_desc) )
+  {
+    if ( CDC_FUNC_DESC_ETHERNET_NETWORKING == cdc_functional_desc_typeof(p_desc) )
+    {
+      itf->mac_string = ((cdc_desc_func_ethernet_t const *) p_desc)->iMACAddress;
+    }
+
+    len += tu_desc_len(p_desc);
+    p_desc = tu_desc_next(p_desc);
+  }
+
+  // Notification endpoint
+  tusb_desc_endpoint_t const * ep_desc = (tusb_desc_endpoint_t const *) p_desc;
+  TU_ASSERT(TUSB_DESC_ENDPOINT == ep_desc->bDescriptorType && TUSB_XFER_INTERRUPT == ep_desc->bmAttributes.xfer);
+  TU_ASSERT(hcd_edpt_open(rhport, dev_addr, ep_desc));
+
+  itf->ep_notif  = ep_desc->bEndpointAddress;
+  itf->notif_len = (uint8_t) tu_min16(ep_desc->wMaxPacketSize.size, NOTIF_BUFSIZE);
+
+  len += tu_desc_len(p_desc);
+  p_desc = tu_desc_next(p_desc);
+
+  //------------- Data Interface -------------//
+  // CDC-ECM/NCM have alternate setting 0 without endpoints, data is transferred at alternate setting 1
+  while ( TUSB_DESC_INTERFACE == tu_desc_type(p_desc) &&
+          TUSB_CLASS_CDC_DATA == ((tusb_desc_interface_t const *) p_desc)->bInterfaceClass )
+  {
+    tusb_desc_interface_t const* data_desc = (tusb_desc_interface_t const*) p_desc;
+
+    itf->itf_data = data_desc->bInterfaceNumber;
+    len += tu_desc_len(p_desc);
+    p_desc = tu_desc_next(p_desc);
+
+    for(uint8_t i=0; i<data_desc->bNumEndpoints; i++)
+    {
+      ep_desc = (tusb_desc_endpoint_t const *) p_desc;
+      TU_ASSERT(TUSB_DESC_ENDPOINT == ep_desc->bDescriptorType && TUSB_XFER_BULK == ep_desc->bmAttributes.xfer);
+
+      uint16_t const ep_size = ep_desc->wMaxPacketSize.size;
+      TU_ASSERT(ep_size);
+      TU_ASSERT(hcd_edpt_open(rhport, dev_addr, ep_desc));
+
+      if ( TUSB_DIR_IN == tu_edpt_dir(ep_desc->bEndpointAddress) )
+      {
+        itf->ep_in       = ep_desc->bEndpointAddress;
+        itf->rx_xfer_len = (uint16_t) (CFG_TUH_NET_RX_BUFSIZE - (CFG_TUH_NET_RX_BUFSIZE % ep_size));
+      }else
+      {
+        itf->ep_out      = ep_desc->bEndpointAddress;
+        itf->ep_out_size = ep_size;
+      }
+
+      len += tu_desc_len(p_desc);
+      p_desc = tu_desc_next(p_desc);
+    }
+
+    if ( data_desc->bNumEndpoints ) itf->itf_data_alt = data_desc->bAlternateSetting;
+  }
+
+  TU_ASSERT(itf->ep_in && itf->ep_out);
+  TU_ASSERT(NETH_PROTOCOL_RNDIS == protocol || itf->mac_string);
+  TU_ASSERT(NETH_PROTOCOL_NCM != protocol || itf->rx_xfer_len >= NCM_NTB_MIN_IN_SIZE);
+
+  *p_length = len;
+
+  //------------- Start configuration -------------//
+  itf->dev_addr = dev_addr;
+
+  bool started;
+
+  if ( NETH_PROTOCOL_RNDIS == protocol )
+  {
+    itf->tx_param.protocol = NETH_PROTOCOL_RNDIS;
+
+    rndis_msg_initialize_t* msg = &itf->ctrl.rndis_init;
+    msg->major_version = 1;
+    msg->minor_version = 0;
+    msg->max_xfer_size = itf->rx_xfer_len;
+
+    started = rndis_command(itf, CONFIG_RNDIS_INITIALIZE, RNDIS_MSG_INITIALIZE, sizeof(rndis_msg_initialize_t));
+  }
+  else
+  {
+    // frame is sent as it is unless NTB parameters are read
+    itf->tx_param = (neth_tx_param_t) { .max_len = CFG_TUH_NET_TX_BUFSIZE, .max_count = 1, .protocol = protocol };
+
+    started = get_mac_string(itf);
+  }
+
+  // don't hold adapter slot if configuration cannot be started
+  if ( !started ) itf->dev_addr = 0;
+  TU_ASSERT(started);
+
+  return true;
+}
+
+void neth_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+{
+  neth_interface_t* itf = get_itf(dev_addr);
+  if ( !itf ) return;
+
+  if ( ep_addr == itf->ep_in )
+  {
+    if ( 0 == itf->rx_armed ) return;
+
+    // transfers complete in order, failed or zero length one leaves an empty buffer freed by rx_deliver()
+    uint8_t const idx = (uint8_t) ((itf->rx_rd + itf->rx_count) % CFG_TUH_NET_RX_BUFS);
+    itf->rx_len[idx] = (XFER_RESULT_SUCCESS == event) ? (uint16_t) xferred_bytes : 0;
+    itf->rx_count++;
+    itf->rx_armed--;
+
+    // endpoint is not re-armed after error e.g stalled, until tuh_network_recv_renew()
+    if ( XFER_RESULT_SUCCESS != event ) itf->rx_stopped = true;
+
+    prep_in_transfer(itf);
+    rx_deliver(itf);
+  }
+  else if ( ep_addr == itf->ep_out )
+  {
+    tx_complete(itf);
+  }
+  else if ( ep_addr == itf->ep_notif )
+  {
+    if ( XFER_RESULT_SUCCESS != event ) return;
+
+    notification(itf, xferred_bytes);
+
+    // notification endpoint is only armed on demand while RNDIS device is being configured
+    if ( CONFIG_COMPLETE == itf->config )
+    {
+      (void) hcd_pipe_xfer(dev_addr, itf->ep_notif, itf->notif_buf, itf->notif_len, true);
+    }
+  }
+}
+
+void neth_close(uint8_t dev_addr)
+{
+  neth_interface_t* itf = get_itf(dev_addr);
+  if ( !itf ) return;
+
+  bool const mounted = itf_ready(itf);
+  tu_memclr(itf, ITF_MEM_RESET_SIZE);
+
+  if ( mounted && tuh_network_umount_cb ) tuh_network_umount_cb(dev_addr);
+}
+
+#endif
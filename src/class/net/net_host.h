@@ -0,0 +1,117 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#ifndef _TUSB_NET_HOST_H_
+#define _TUSB_NET_HOST_H_
+
+#include "common/tusb_common.h"
+#include "host/usbh.h"
+#include "class/cdc/cdc.h"
+#include "net_host_frame.h"
+
+// TODO should not include external files
+#include "lwip/pbuf.h"
+#include "netif/ethernet.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+//--------------------------------------------------------------------+
+// Class Driver Configuration
+//--------------------------------------------------------------------+
+
+// Maximum Transmission Unit (in bytes) of the network, including Ethernet header
+#ifndef CFG_TUH_NET_MTU
+#define CFG_TUH_NET_MTU           (1500 + SIZEOF_ETH_HDR)
+#endif
+
+// Number and size of receive and transmit buffers are in tusb_option.h since they size host controller pools:
+// CFG_TUH_NET_RX_BUFS, CFG_TUH_NET_RX_BUFSIZE, CFG_TUH_NET_TX_BUFS, CFG_TUH_NET_TX_BUFSIZE
+
+TU_VERIFY_STATIC(CFG_TUH_NET_RX_BUFS >= 2 && CFG_TUH_NET_TX_BUFS >= 2, "at least 2 buffers are needed to overlap transfer and processing");
+TU_VERIFY_STATIC(CFG_TUH_NET_TX_BUFSIZE >= CFG_TUH_NET_MTU + 44 && CFG_TUH_NET_RX_BUFSIZE >= CFG_TUH_NET_MTU + 44, "buffer must hold a frame with RNDIS header");
+
+//--------------------------------------------------------------------+
+// Application API
+//--------------------------------------------------------------------+
+/** \addtogroup ClassDriver_Net
+ *  @{
+ * \defgroup Net_Host Host
+ *  Ethernet adapter (CDC-ECM, CDC-NCM or RNDIS), only one adapter is supported at a time.
+ *  @{ */
+
+// Check if an adapter is mounted and configured
+bool tuh_network_mounted(uint8_t dev_addr);
+
+// Get MAC address of adapter
+bool tuh_network_get_mac(uint8_t dev_addr, uint8_t mac[6]);
+
+// Link state reported by adapter
+bool tuh_network_link_up(uint8_t dev_addr);
+
+// indicate to network driver that client is ready for frames refused by tuh_network_recv_cb()
+void tuh_network_recv_renew(uint8_t dev_addr);
+
+// poll network driver for its ability to accept another frame to transmit
+bool tuh_network_can_xmit(uint8_t dev_addr);
+
+// if tuh_network_can_xmit() returns true, tuh_network_xmit() can be called once. Frame is copied, pbuf is not freed
+bool tuh_network_xmit(uint8_t dev_addr, struct pbuf *p);
+
+//--------------------------------------------------------------------+
+// Application Callbacks
+//--------------------------------------------------------------------+
+
+// client must provide this: return false if the frame was not accepted, it is offered again after
+// tuh_network_recv_renew(). Remaining frames received from device wait for it, pbuf is owned by client if accepted
+bool tuh_network_recv_cb(uint8_t dev_addr, struct pbuf *p);
+
+// Invoked when adapter is configured and ready to transfer frames
+TU_ATTR_WEAK void tuh_network_mount_cb(uint8_t dev_addr);
+
+// Invoked when adapter is unplugged
+TU_ATTR_WEAK void tuh_network_umount_cb(uint8_t dev_addr);
+
+// Invoked when adapter reports link change
+TU_ATTR_WEAK void tuh_network_link_cb(uint8_t dev_addr, bool up);
+
+/** @} */
+/** @} */
+
+//--------------------------------------------------------------------+
+// Internal Class Driver API
+//--------------------------------------------------------------------+
+void neth_init    (void);
+bool neth_open    (uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length);
+void neth_xfer_cb (uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
+void neth_close   (uint8_t dev_addr);
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_NET_HOST_H_ */
@@ -0,0 +1,291 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_NET
+
+#include "net_host_frame.h"
+#include "ncm.h"
+#include "class/cdc/cdc_rndis.h"
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+enum
+{
+  RNDIS_PACKET_HEADER_SIZE = sizeof(rndis_msg_packet_t),
+  RNDIS_MSG_HEADER_SIZE    = 8, // type and length, common to all messages
+  RNDIS_DATA_OFFSET_BASE   = offsetof(rndis_msg_packet_t, data_offset)
+};
+
+// RNDIS messages are little endian and may be at any alignment within received transfer
+static inline uint32_t get_u32(uint8_t const* p)
+{
+  return tu_u32(p[3], p[2], p[1], p[0]);
+}
+
+static inline void put_u32(uint8_t* p, uint32_t value)
+{
+  p[0] = (uint8_t) value;
+  p[1] = (uint8_t) (value >> 8);
+  p[2] = (uint8_t) (value >> 16);
+  p[3] = (uint8_t) (value >> 24);
+}
+
+// Smallest offset not less than value having offset % divisor == remainder
+static uint32_t align_offset(uint32_t value, uint16_t divisor, uint16_t remainder)
+{
+  if ( divisor <= 1 ) return value;
+  return value + (uint32_t) (divisor + remainder - (value % divisor)) % divisor;
+}
+
+// NCM header is followed by datagram pointer table sized for max_count datagrams and terminator
+static uint16_t ncm_ndp_offset(neth_tx_param_t const* param)
+{
+  return (uint16_t) align_offset(sizeof(ncm_nth16_t), tu_max16(param->ndp_alignment, 4), 0);
+}
+
+//--------------------------------------------------------------------+
+// Transfer towards device
+//--------------------------------------------------------------------+
+void neth_tx_block_init(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer)
+{
+  (void) buffer;
+
+  block->count = 0;
+  block->len   = 0;
+  block->last  = 0;
+
+  if ( NETH_PROTOCOL_NCM == param->protocol )
+  {
+    block->len = (uint16_t) (ncm_ndp_offset(param) + sizeof(ncm_ndp16_t) + (param->max_count+1)*sizeof(ncm_datagram16_t));
+  }
+}
+
+// Offset where frame (ECM, NCM) or packet message (RNDIS) of len bytes is placed, false if it does not fit
+static bool block_offset(neth_tx_param_t const* param, neth_tx_block_t const* block, uint16_t len, uint32_t* offset)
+{
+  TU_VERIFY(block->count < param->max_count);
+
+  switch ( param->protocol )
+  {
+    case NETH_PROTOCOL_NCM:
+      *offset = align_offset(block->len, param->divisor, param->remainder);
+      return *offset + len <= param->max_len;
+
+    case NETH_PROTOCOL_RNDIS:
+      // message header is written with word access
+      *offset = align_offset(block->len, tu_max16(param->divisor, 4), 0);
+      return *offset + RNDIS_PACKET_HEADER_SIZE + len <= param->max_len;
+
+    case NETH_PROTOCOL_ECM:
+    default:
+      *offset = 0;
+      return len <= param->max_len;
+  }
+}
+
+bool neth_tx_block_fits(neth_tx_param_t const* param, neth_tx_block_t const* block, uint16_t len)
+{
+  uint32_t offset;
+  return block_offset(param, block, len, &offset);
+}
+
+uint8_t* neth_tx_block_add(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer, uint16_t len)
+{
+  uint32_t offset;
+  TU_VERIFY( block_offset(param, block, len, &offset), NULL );
+
+  uint8_t* frame = buffer + offset;
+
+  if ( NETH_PROTOCOL_NCM == param->protocol )
+  {
+    ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + ncm_ndp_offset(param));
+    ndp->datagram[block->count].wDatagramIndex  = (uint16_t) offset;
+    ndp->datagram[block->count].wDatagramLength = len;
+  }
+  else if ( NETH_PROTOCOL_RNDIS == param->protocol )
+  {
+    // receiver finds next message by length of previous one
+    if ( block->count ) put_u32(buffer + block->last + offsetof(rndis_msg_packet_t, length), offset - block->last);
+    block->last = (uint16_t) offset;
+
+    tu_memclr(frame, RNDIS_PACKET_HEADER_SIZE);
+    put_u32(frame + offsetof(rndis_msg_packet_t, type)       , RNDIS_MSG_PACKET);
+    put_u32(frame + offsetof(rndis_msg_packet_t, length)     , RNDIS_PACKET_HEADER_SIZE + len);
+    put_u32(frame + offsetof(rndis_msg_packet_t, data_offset), RNDIS_PACKET_HEADER_SIZE - RNDIS_DATA_OFFSET_BASE);
+    put_u32(frame + offsetof(rndis_msg_packet_t, data_length), len);
+
+    frame += RNDIS_PACKET_HEADER_SIZE;
+  }
+
+  block->count++;
+  block->len = (uint16_t) (frame + len - buffer);
+
+  return frame;
+}
+
+uint16_t neth_tx_block_finalize(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer, uint16_t sequence)
+{
+  if ( NETH_PROTOCOL_NCM == param->protocol )
+  {
+    uint16_t const ndp_offset = ncm_ndp_offset(param);
+
+    ncm_nth16_t* nth = (ncm_nth16_t*) buffer;
+    nth->dwSignature   = NCM_NTH16_SIGNATURE;
+    nth->wHeaderLength = sizeof(ncm_nth16_t);
+    nth->wSequence     = sequence;
+    nth->wBlockLength  = block->len;
+    nth->wNdpIndex     = ndp_offset;
+
+    // unused pointers of table are left after terminator
+    ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + ndp_offset);
+    ndp->dwSignature   = NCM_NDP16_SIGNATURE_NCM0;
+    ndp->wLength       = (uint16_t) (sizeof(ncm_ndp16_t) + (block->count+1)*sizeof(ncm_datagram16_t));
+    ndp->wNextNdpIndex = 0;
+    ndp->datagram[block->count].wDatagramIndex  = 0;
+    ndp->datagram[block->count].wDatagramLength = 0;
+  }
+
+  return block->len;
+}
+
+//--------------------------------------------------------------------+
+// Transfer from device
+//--------------------------------------------------------------------+
+
+// Enter datagram pointer table at offset of NTB
+static bool ncm_ndp_enter(uint8_t const* buffer, uint16_t block_len, uint16_t offset, neth_rx_cursor_t* cursor)
+{
+  // tables are only followed forward so that a malformed chain cannot loop
+  TU_VERIFY(offset >= sizeof(ncm_nth16_t) && offset > cursor->ndp);
+  TU_VERIFY((uint32_t) offset + sizeof(ncm_ndp16_t) <= block_len);
+
+  ncm_ndp16_t const* ndp = (ncm_ndp16_t const*) (buffer + offset);
+  TU_VERIFY(ndp->dwSignature == NCM_NDP16_SIGNATURE_NCM0 || ndp->dwSignature == NCM_NDP16_SIGNATURE_NCM1);
+  TU_VERIFY(ndp->wLength >= sizeof(ncm_ndp16_t) && (uint32_t) offset + ndp->wLength <= block_len);
+
+  cursor->ndp  = offset;
+  cursor->next = (uint16_t) (offset + sizeof(ncm_ndp16_t));
+  return true;
+}
+
+static bool ncm_frame_next(uint8_t const* buffer, uint16_t len, neth_rx_cursor_t* cursor, uint8_t const** frame, uint16_t* frame_len)
+{
+  TU_VERIFY(len >= sizeof(ncm_nth16_t));
+
+  ncm_nth16_t const* nth = (ncm_nth16_t const*) buffer;
+  TU_VERIFY(nth->dwSignature == NCM_NTH16_SIGNATURE && nth->wHeaderLength == sizeof(ncm_nth16_t));
+
+  // zero block length means NTB is terminated by short packet
+  uint16_t const block_len = nth->wBlockLength ? nth->wBlockLength : len;
+  TU_VERIFY(block_len <= len);
+
+  if ( 0 == cursor->next ) TU_VERIFY( ncm_ndp_enter(buffer, block_len, nth->wNdpIndex, cursor) );
+
+  while (1)
+  {
+    ncm_ndp16_t const* ndp = (ncm_ndp16_t const*) (buffer + cursor->ndp);
+    ncm_datagram16_t const* dgram = (ncm_datagram16_t const*) (buffer + cursor->next);
+
+    bool const table_end = (cursor->next + sizeof(ncm_datagram16_t) > cursor->ndp + ndp->wLength) ||
+                           (0 == dgram->wDatagramIndex) || (0 == dgram->wDatagramLength);
+    if ( table_end )
+    {
+      TU_VERIFY(ndp->wNextNdpIndex);
+      TU_VERIFY( ncm_ndp_enter(buffer, block_len, ndp->wNextNdpIndex, cursor) );
+      continue;
+    }
+
+    cursor->next += sizeof(ncm_datagram16_t);
+
+    uint16_t dgram_len = dgram->wDatagramLength;
+    if ( ndp->dwSignature == NCM_NDP16_SIGNATURE_NCM1 )
+    {
+      // CRC is included in length
+      if ( dgram_len <= 4 ) continue;
+      dgram_len -= 4;
+    }
+
+    // skip datagram outside of NTB
+    if ( (uint32_t) dgram->wDatagramIndex + dgram->wDatagramLength > block_len ) continue;
+
+    *frame     = buffer + dgram->wDatagramIndex;
+    *frame_len = dgram_len;
+    return true;
+  }
+}
+
+static bool rndis_frame_next(uint8_t const* buffer, uint16_t len, neth_rx_cursor_t* cursor, uint8_t const** frame, uint16_t* frame_len)
+{
+  // device may pad transfer with a single byte to avoid zero length packet
+  while ( (uint32_t) cursor->next + RNDIS_MSG_HEADER_SIZE <= len )
+  {
+    uint8_t const* msg = buffer + cursor->next;
+    uint32_t const type    = get_u32(msg + offsetof(rndis_msg_packet_t, type));
+    uint32_t const msg_len = get_u32(msg + offsetof(rndis_msg_packet_t, length));
+
+    TU_VERIFY(msg_len >= RNDIS_MSG_HEADER_SIZE && msg_len <= (uint32_t) (len - cursor->next));
+    cursor->next = (uint16_t) (cursor->next + msg_len);
+
+    // skip anything not a complete packet message
+    if ( RNDIS_MSG_PACKET != type || msg_len < RNDIS_PACKET_HEADER_SIZE ) continue;
+
+    uint32_t const data_offset = RNDIS_DATA_OFFSET_BASE + get_u32(msg + offsetof(rndis_msg_packet_t, data_offset));
+    uint32_t const data_len    = get_u32(msg + offsetof(rndis_msg_packet_t, data_length));
+
+    if ( data_offset > msg_len || data_len > msg_len - data_offset ) continue;
+
+    *frame     = msg + data_offset;
+    *frame_len = (uint16_t) data_len;
+    return true;
+  }
+
+  return false;
+}
+
+bool neth_rx_frame_next(uint8_t protocol, uint8_t const* buffer, uint16_t len, neth_rx_cursor_t* cursor,
+                        uint8_t const** frame, uint16_t* frame_len)
+{
+  switch ( protocol )
+  {
+    case NETH_PROTOCOL_NCM  : return ncm_frame_next(buffer, len, cursor, frame, frame_len);
+    case NETH_PROTOCOL_RNDIS: return rndis_frame_next(buffer, len, cursor, frame, frame_len);
+
+    case NETH_PROTOCOL_ECM:
+    default:
+      // whole transfer is a frame
+      TU_VERIFY(0 == cursor->next && len);
+      cursor->next = len;
+
+      *frame     = buffer;
+      *frame_len = len;
+      return true;
+  }
+}
+
+#endif
@@ -0,0 +1,115 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#ifndef _TUSB_NET_HOST_FRAME_H_
+#define _TUSB_NET_HOST_FRAME_H_
+
+#include "common/tusb_common.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** \addtogroup ClassDriver_Net
+ *  @{
+ * \defgroup Net_Host_Frame Host Framing
+ *  Packing of Ethernet frames into bulk transfers of network adapters and back. A CDC-ECM transfer is a single
+ *  frame, RNDIS concatenates packet messages and CDC-NCM wraps datagrams in an NTB. Transfers towards the device
+ *  are built in place: NCM reserves header and datagram pointer table at start of the buffer so that each frame
+ *  is copied only once, from the network stack to its final position.
+ *  Only touches the buffers it is given, so that it is testable without host stack.
+ *  @{ */
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Max frames aggregated in a transfer towards device, device limit applies as well
+#ifndef CFG_TUH_NET_TX_FRAMES
+#define CFG_TUH_NET_TX_FRAMES   8
+#endif
+
+//--------------------------------------------------------------------+
+// Framing
+//--------------------------------------------------------------------+
+typedef enum
+{
+  NETH_PROTOCOL_ECM = 0,
+  NETH_PROTOCOL_NCM,
+  NETH_PROTOCOL_RNDIS
+} neth_protocol_t;
+
+/// Framing of transfers towards device, negotiated while device is configured
+typedef struct
+{
+  uint16_t max_len;       ///< max bytes of a transfer
+  uint8_t  max_count;     ///< max frames of a transfer, at most CFG_TUH_NET_TX_FRAMES
+  uint8_t  protocol;
+
+  uint16_t divisor;       ///< frame (NCM) or message (RNDIS) starts at offset where offset % divisor == remainder
+  uint16_t remainder;
+  uint16_t ndp_alignment; ///< NCM: alignment of datagram pointer table
+} neth_tx_param_t;
+
+/// Transfer being built
+typedef struct
+{
+  uint16_t len;
+  uint16_t last;          ///< RNDIS: offset of last packet message, its length covers padding before next one
+  uint8_t  count;
+} neth_tx_block_t;
+
+/// Position within a received transfer, zero initialized for the first frame
+typedef struct
+{
+  uint16_t next;          ///< offset of next message (RNDIS) or datagram pointer (NCM)
+  uint16_t ndp;           ///< NCM: offset of current datagram pointer table
+} neth_rx_cursor_t;
+
+/// Start an empty transfer in buffer
+void neth_tx_block_init(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer);
+
+/// Check if a frame of len bytes can be added to transfer
+bool neth_tx_block_fits(neth_tx_param_t const* param, neth_tx_block_t const* block, uint16_t len);
+
+/// Reserve space for a frame of len bytes, return where the frame is to be copied or NULL if it does not fit
+uint8_t* neth_tx_block_add(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer, uint16_t len);
+
+/// Complete headers of a transfer having at least one frame, return its length
+uint16_t neth_tx_block_finalize(neth_tx_param_t const* param, neth_tx_block_t* block, uint8_t* buffer, uint16_t sequence);
+
+/// Get next frame of a received transfer, return false if there is no more valid frame
+bool neth_rx_frame_next(uint8_t protocol, uint8_t const* buffer, uint16_t len, neth_rx_cursor_t* cursor,
+                        uint8_t const** frame, uint16_t* frame_len);
+
+/** @} */
+/** @} */
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_NET_HOST_FRAME_H_ */
@@ -372,7 +372,9 @@ bool tud_usbtmc_start_bus_read()
 
 void usbtmcd_reset_cb(uint8_t rhport)
 {
-  (void)rhport;
+  // interface opened by other device port is not affected
+  if ( usbtmc_state.state != STATE_CLOSED && usbtmc_state.rhport != rhport ) return;
+
   usbtmc_capabilities_specific_t const * capabilities = tud_usbtmc_get_capabilities_cb();
 
   criticalEnter();
@@ -78,6 +78,7 @@
 
   #define TU_BSWAP16(u16) (__builtin_bswap16(u16))
   #define TU_BSWAP32(u32) (__builtin_bswap32(u32))
+  #define TU_BSWAP64(u64) (__builtin_bswap64(u64))
 
 #elif defined(__TI_COMPILER_VERSION__)
   #define TU_ATTR_ALIGNED(Bytes)        __attribute__ ((aligned(Bytes)))
@@ -98,6 +99,7 @@
 
   #define TU_BSWAP16(u16) (__builtin_bswap16(u16))
   #define TU_BSWAP32(u32) (__builtin_bswap32(u32))
+  #define TU_BSWAP64(u64) (__builtin_bswap64(u64))
 
 #elif defined(__ICCARM__)
   #define TU_ATTR_ALIGNED(Bytes)        __attribute__ ((aligned(Bytes)))
@@ -118,6 +120,7 @@
 
   #define TU_BSWAP16(u16) (__iar_builtin_REV16(u16))
   #define TU_BSWAP32(u32) (__iar_builtin_REV(u32))
+  #define TU_BSWAP64(u64) ((((uint64_t) __iar_builtin_REV((uint32_t) (u64))) << 32) | __iar_builtin_REV((uint32_t) ((u64) >> 32)))
 #else 
   #error "Compiler attribute porting is required"
 #endif
@@ -130,6 +133,9 @@
   #define tu_htonl(u32)  (TU_BSWAP32(u32))
   #define tu_ntohl(u32)  (TU_BSWAP32(u32))
 
+  #define tu_htonll(u64) (TU_BSWAP64(u64))
+  #define tu_ntohll(u64) (TU_BSWAP64(u64))
+
   #define tu_htole16(u16) (u16)
   #define tu_le16toh(u16) (u16)
 
@@ -144,6 +150,9 @@
   #define tu_htonl(u32)  (u32)
   #define tu_ntohl(u32)  (u32)
 
+  #define tu_htonll(u64) (u64)
+  #define tu_ntohll(u64) (u64)
+
   #define tu_htole16(u16) (tu_bswap16(u16))
   #define tu_le16toh(u16) (tu_bswap16(u16))
 
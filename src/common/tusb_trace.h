@@ -0,0 +1,166 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+/** \ingroup Group_Common
+ *  \defgroup Group_Trace Trace
+ *  \brief Binary event trace, a light-weight alternative to TU_LOG2 for timing sensitive debugging
+ *
+ *  Each trace point stores an 8-byte record (timestamp, event id, endpoint, length) into a
+ *  lock-free ring buffer. Records are fetched with tusb_trace_read() from the application
+ *  (e.g sent over SEGGER RTT) and decoded on the host with tools/trace_decode.py.
+ *  Trace points compile to nothing unless CFG_TUSB_TRACE is enabled.
+ *  @{ */
+
+#ifndef _TUSB_TRACE_H_
+#define _TUSB_TRACE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+// Trace event id, must be kept in sync with tools/trace_decode.py
+enum
+{
+  TU_TRACE_NONE               = 0x00, ///< record is not committed yet
+  TU_TRACE_OVERFLOW           = 0x01, ///< len: number of records dropped since last read
+
+  // Device stack: id is added with dcd_eventid_t. ep, len are endpoint and transferred bytes
+  // for DCD_EVENT_XFER_COMPLETE, bmRequestType and bRequest for DCD_EVENT_SETUP_RECEIVED.
+  TU_TRACE_DCD_EVENT          = 0x10, ///< event queued by DCD (usually in ISR)
+  TU_TRACE_USBD_EVENT         = 0x20, ///< event processed by tud_task()
+
+  TU_TRACE_USBD_XFER          = 0x30, ///< usbd_edpt_xfer() called. len: total bytes
+  TU_TRACE_USBD_XFER_FAILED   = 0x31, ///< usbd_edpt_xfer() failed. len: total bytes
+  TU_TRACE_USBD_STALL         = 0x32,
+  TU_TRACE_USBD_CLEAR_STALL   = 0x33,
+  TU_TRACE_USBD_OPEN          = 0x34, ///< len: max packet size
+  TU_TRACE_USBD_CLOSE         = 0x35,
+
+  // Control transfer
+  TU_TRACE_CTRL_DATA          = 0x40, ///< data stage packet queued. len: packet size
+  TU_TRACE_CTRL_STATUS        = 0x41, ///< status stage queued
+  TU_TRACE_CTRL_STALL         = 0x42, ///< request is not supported
+  TU_TRACE_CTRL_COMPLETE      = 0x43, ///< class driver control complete callback invoked. len: bRequest
+
+  // Class drivers
+  TU_TRACE_CDC_LINE_CODING    = 0x50, ///< ep: interface number, len: 1 for set, 0 for get
+  TU_TRACE_CDC_LINE_STATE     = 0x51, ///< ep: interface number, len: DTR (bit 0), RTS (bit 1)
+
+  TU_TRACE_MSC_CMD            = 0x58, ///< ep: SCSI opcode, len: data length (saturated)
+  TU_TRACE_MSC_DATA           = 0x59, ///< ep, len: transferred bytes
+  TU_TRACE_MSC_STATUS         = 0x5A, ///< ep, len: CSW status
+};
+
+typedef struct
+{
+  uint32_t timestamp; ///< CFG_TUSB_TRACE_TIMESTAMP() at trace point
+  uint8_t  id;        ///< TU_TRACE_*
+  uint8_t  ep_addr;   ///< endpoint address or event specific
+  uint16_t len;       ///< length or event specific
+} tusb_trace_record_t;
+
+TU_VERIFY_STATIC( sizeof(tusb_trace_record_t) == 8, "size is not correct");
+
+// Read and remove up to count records from trace buffer, return number of records read.
+// If records were dropped since last read, the first record is a TU_TRACE_OVERFLOW.
+// Must be called from a single context (e.g main loop).
+uint32_t tusb_trace_read(tusb_trace_record_t* records, uint32_t count);
+
+//--------------------------------------------------------------------+
+// Internal
+//--------------------------------------------------------------------+
+#if CFG_TUSB_TRACE
+
+TU_VERIFY_STATIC( (CFG_TUSB_TRACE_DEPTH & (CFG_TUSB_TRACE_DEPTH-1)) == 0, "CFG_TUSB_TRACE_DEPTH must be power of 2");
+
+typedef struct
+{
+  volatile uint32_t wr_idx;   // reserved by producers
+  volatile uint32_t rd_idx;   // released by consumer
+  volatile uint32_t dropped;
+
+  tusb_trace_record_t records[CFG_TUSB_TRACE_DEPTH];
+} tu_trace_ring_t;
+
+extern tu_trace_ring_t _tu_trace;
+
+// Producer can be any context including ISRs with different priorities. A slot is reserved
+// by advancing wr_idx atomically, then filled and committed by writing its id last. Consumer
+// stops at the first uncommitted slot and clears the id before releasing it.
+static inline void tu_trace(uint8_t id, uint8_t ep_addr, uint32_t len)
+{
+  uint32_t const timestamp = (uint32_t) (CFG_TUSB_TRACE_TIMESTAMP());
+  uint32_t wr_idx;
+
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+  wr_idx = __atomic_load_n(&_tu_trace.wr_idx, __ATOMIC_RELAXED);
+  do
+  {
+    if ( wr_idx - __atomic_load_n(&_tu_trace.rd_idx, __ATOMIC_ACQUIRE) >= CFG_TUSB_TRACE_DEPTH )
+    {
+      __atomic_fetch_add(&_tu_trace.dropped, 1, __ATOMIC_RELAXED);
+      return;
+    }
+  } while ( !__atomic_compare_exchange_n(&_tu_trace.wr_idx, &wr_idx, wr_idx+1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+#else
+  // No atomic read-modify-write (e.g Cortex M0): a record can be lost if an ISR traces
+  // between the load and store of wr_idx.
+  wr_idx = _tu_trace.wr_idx;
+  if ( wr_idx - _tu_trace.rd_idx >= CFG_TUSB_TRACE_DEPTH )
+  {
+    _tu_trace.dropped++;
+    return;
+  }
+  _tu_trace.wr_idx = wr_idx + 1;
+#endif
+
+  tusb_trace_record_t* rec = &_tu_trace.records[wr_idx & (CFG_TUSB_TRACE_DEPTH-1)];
+  rec->timestamp = timestamp;
+  rec->ep_addr   = ep_addr;
+  rec->len       = (uint16_t) TU_MIN(len, UINT16_MAX);
+
+#if defined(__GNUC__)
+  __atomic_store_n(&rec->id, id, __ATOMIC_RELEASE);
+#else
+  *((volatile uint8_t*) &rec->id) = id;
+#endif
+}
+
+#define TU_TRACE(_id, _ep_addr, _len)   tu_trace(_id, _ep_addr, _len)
+
+#else
+
+#define TU_TRACE(_id, _ep_addr, _len)
+
+#endif // CFG_TUSB_TRACE
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_TRACE_H_ */
+
+/** @} */
@@ -59,6 +59,7 @@ typedef struct TU_ATTR_ALIGNED(4)
 {
   uint8_t rhport;
   uint8_t event_id;
+  uint8_t bus_epoch; // set by usbd when queued, to detect transfer completed before a bus reset
 
   union
   {
@@ -83,6 +84,10 @@ typedef struct TU_ATTR_ALIGNED(4)
       void* param;
     }func_call;
   };
+
+#if CFG_TUD_STATS
+  uint32_t timestamp; // set by usbd when queued
+#endif
 } dcd_event_t;
 
 //TU_VERIFY_STATIC(sizeof(dcd_event_t) <= 12, "size is not correct");
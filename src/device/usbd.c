@@ -37,6 +37,11 @@
 #define CFG_TUD_TASK_QUEUE_SZ   16
 #endif
 
+// Queue for control and bus events, which are processed ahead of data events
+#ifndef CFG_TUD_TASK_CTRL_QUEUE_SZ
+#define CFG_TUD_TASK_CTRL_QUEUE_SZ   8
+#endif
+
 //--------------------------------------------------------------------+
 // Device Data
 //--------------------------------------------------------------------+
@@ -57,7 +62,7 @@ typedef struct
   uint8_t speed;
 
   uint8_t itf2drv[16];     // map interface number to driver (0xff is invalid)
-  uint8_t ep2drv[8][2];    // map endpoint to driver ( 0xff is invalid )
+  uint8_t ep2drv[CFG_TUD_ENDPOINT_MAX][2];    // map endpoint to driver ( 0xff is invalid )
 
   struct TU_ATTR_PACKED
   {
@@ -65,10 +70,30 @@ typedef struct
     volatile bool stalled : 1;
 
     // TODO merge ep2drv here, 4-bit should be sufficient
-  }ep_status[8][2];
+  }ep_status[CFG_TUD_ENDPOINT_MAX][2];
 }usbd_device_t;
 
-static usbd_device_t _usbd_dev;
+static usbd_device_t _usbd_dev[TUD_OPT_RHPORT_COUNT];
+
+static inline usbd_device_t* get_device(uint8_t rhport)
+{
+  return &_usbd_dev[TUD_RHPORT_INDEX(rhport)];
+}
+
+#if CFG_TUD_STATS
+static tud_stats_t _usbd_stats[TUD_OPT_RHPORT_COUNT];
+
+// Event queue depth is the difference of these counters, each one is only written by one context
+static struct
+{
+  volatile uint32_t isr_queued;
+  volatile uint32_t task_queued;
+  volatile uint32_t dequeued;
+} _usbd_q_count;
+
+#define STATS(_rhport)                _usbd_stats[TUD_RHPORT_INDEX(_rhport)]
+#define STATS_EDPT(_rhport, _ep_addr) STATS(_rhport).edpt[tu_edpt_number(_ep_addr)][tu_edpt_dir(_ep_addr)]
+#endif
 
 // Invalid driver ID in itf2drv[] ep2drv[][] mapping
 enum { DRVID_INVALID = 0xFFu };
@@ -151,6 +176,20 @@ static usbd_class_driver_t const _usbd_driver[] =
   },
   #endif
 
+  // before vendor driver, first vendor interface is bridged
+  #if CFG_TUD_VENDOR_BRIDGE && TUSB_OPT_HOST_ENABLED && CFG_TUH_VENDOR
+  {
+      DRIVER_NAME("VENDOR-BRIDGE")
+      .init             = vbridged_init,
+      .reset            = vbridged_reset,
+      .open             = vbridged_open,
+      .control_request  = vbridged_control_request,
+      .control_complete = vbridged_control_complete,
+      .xfer_cb          = vbridged_xfer_cb,
+      .sof              = NULL
+  },
+  #endif
+
   #if CFG_TUD_VENDOR
   {
       DRIVER_NAME("VENDOR")
@@ -223,22 +262,40 @@ enum { USBD_CLASS_DRIVER_COUNT = TU_ARRAY_SIZE(_usbd_driver) };
 // DCD Event
 //--------------------------------------------------------------------+
 
-// Event queue
+// Event queues with 2 priority lanes: control & bus events (SETUP, EP0 transfer, reset, suspend etc..)
+// are always processed before data events (transfer on other endpoints, deferred function call) so
+// that a SETUP is never stuck behind a burst of bulk transfers.
 // OPT_MODE_DEVICE is used by OS NONE for mutex (disable usb isr)
 OSAL_QUEUE_DEF(OPT_MODE_DEVICE, _usbd_qdef, CFG_TUD_TASK_QUEUE_SZ, dcd_event_t);
 static osal_queue_t _usbd_q;
 
+OSAL_QUEUE_DEF(OPT_MODE_DEVICE, _usbd_ctrl_qdef, CFG_TUD_TASK_CTRL_QUEUE_SZ, dcd_event_t);
+static osal_queue_t _usbd_ctrl_q;
+
+#if CFG_TUSB_OS != OPT_OS_NONE
+// Posted after an event is queued to either lane, tud_task() blocks on it while both queues are empty
+static osal_semaphore_def_t _usbd_sem_def;
+static osal_semaphore_t _usbd_sem;
+#endif
+
+// Incremented on bus reset and unplug of a port, its data events carrying an older value are stale
+static volatile uint8_t _usbd_bus_epoch[TUD_OPT_RHPORT_COUNT];
+static uint8_t _usbd_task_epoch[TUD_OPT_RHPORT_COUNT];
+
+// Roothub port of the event being processed by tud_task()
+static uint8_t _usbd_task_rhport = TUD_OPT_RHPORT;
+
 //--------------------------------------------------------------------+
 // Prototypes
 //--------------------------------------------------------------------+
-static void mark_interface_endpoint(uint8_t ep2drv[8][2], uint8_t const* p_desc, uint16_t desc_len, uint8_t driver_id);
+static void mark_interface_endpoint(uint8_t ep2drv[CFG_TUD_ENDPOINT_MAX][2], uint8_t const* p_desc, uint16_t desc_len, uint8_t driver_id);
 static bool process_control_request(uint8_t rhport, tusb_control_request_t const * p_request);
 static bool process_set_config(uint8_t rhport, uint8_t cfg_num);
 static bool process_get_descriptor(uint8_t rhport, tusb_control_request_t const * p_request);
 
-void usbd_control_reset(void);
-void usbd_control_set_request(tusb_control_request_t const *request);
-void usbd_control_set_complete_callback( bool (*fp) (uint8_t, tusb_control_request_t const * ) );
+void usbd_control_reset(uint8_t rhport);
+void usbd_control_set_request(uint8_t rhport, tusb_control_request_t const *request);
+void usbd_control_set_complete_callback(uint8_t rhport, bool (*fp) (uint8_t, tusb_control_request_t const * ) );
 bool usbd_control_xfer_cb (uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
 
 
@@ -291,27 +348,96 @@ void usbd_driver_print_control_complete_name(bool (*control_complete) (uint8_t,
 
 #endif
 
+#if CFG_TUSB_TRACE
+static void trace_event(uint8_t id, dcd_event_t const * event)
+{
+  switch (event->event_id)
+  {
+    case DCD_EVENT_SETUP_RECEIVED:
+      tu_trace(id + DCD_EVENT_SETUP_RECEIVED, event->setup_received.bmRequestType, event->setup_received.bRequest);
+    break;
+
+    case DCD_EVENT_XFER_COMPLETE:
+      tu_trace(id + DCD_EVENT_XFER_COMPLETE, event->xfer_complete.ep_addr, event->xfer_complete.len);
+    break;
+
+    default:
+      tu_trace(id + event->event_id, 0, 0);
+    break;
+  }
+}
+
+#define TRACE_EVENT(_id, _event)    trace_event(_id, _event)
+#else
+#define TRACE_EVENT(_id, _event)
+#endif
+
 //--------------------------------------------------------------------+
 // Application API
 //--------------------------------------------------------------------+
 bool tud_mounted(void)
 {
-  return _usbd_dev.configured;
+  return tud_rhport_mounted(TUD_OPT_RHPORT);
 }
 
 bool tud_suspended(void)
 {
-  return _usbd_dev.suspended;
+  return tud_rhport_suspended(TUD_OPT_RHPORT);
 }
 
 bool tud_remote_wakeup(void)
 {
+  return tud_rhport_remote_wakeup(TUD_OPT_RHPORT);
+}
+
+bool tud_rhport_mounted(uint8_t rhport)
+{
+  return get_device(rhport)->configured;
+}
+
+bool tud_rhport_suspended(uint8_t rhport)
+{
+  return get_device(rhport)->suspended;
+}
+
+bool tud_rhport_remote_wakeup(uint8_t rhport)
+{
+  usbd_device_t const* dev = get_device(rhport);
+
   // only wake up host if this feature is supported and enabled and we are suspended
-  TU_VERIFY (_usbd_dev.suspended && _usbd_dev.remote_wakeup_support && _usbd_dev.remote_wakeup_en );
-  dcd_remote_wakeup(TUD_OPT_RHPORT);
+  TU_VERIFY (dev->suspended && dev->remote_wakeup_support && dev->remote_wakeup_en );
+  dcd_remote_wakeup(rhport);
   return true;
 }
 
+uint8_t tud_task_rhport(void)
+{
+  return _usbd_task_rhport;
+}
+
+#if CFG_TUD_STATS
+tud_stats_t const* tud_stats(void)
+{
+  return tud_rhport_stats(TUD_OPT_RHPORT);
+}
+
+tud_stats_t const* tud_rhport_stats(uint8_t rhport)
+{
+  return &STATS(rhport);
+}
+
+tud_stats_edpt_t const* tud_stats_edpt(uint8_t ep_addr)
+{
+  TU_VERIFY(tu_edpt_number(ep_addr) < CFG_TUD_ENDPOINT_MAX, NULL);
+  return &STATS_EDPT(TUD_OPT_RHPORT, ep_addr);
+}
+
+void tud_stats_clear(void)
+{
+  tu_varclr(&_usbd_stats);
+}
+#endif
+
 //--------------------------------------------------------------------+
 // USBD Task
 //--------------------------------------------------------------------+
@@ -321,10 +447,18 @@ bool tud_init (void)
 
   tu_varclr(&_usbd_dev);
 
-  // Init device queue & task
+  // Init device queue & task, shared by all device ports
   _usbd_q = osal_queue_create(&_usbd_qdef);
   TU_ASSERT(_usbd_q != NULL);
 
+  _usbd_ctrl_q = osal_queue_create(&_usbd_ctrl_qdef);
+  TU_ASSERT(_usbd_ctrl_q != NULL);
+
+#if CFG_TUSB_OS != OPT_OS_NONE
+  _usbd_sem = osal_semaphore_create(&_usbd_sem_def);
+  TU_ASSERT(_usbd_sem != NULL);
+#endif
+
   // Init class drivers
   for (uint8_t i = 0; i < USBD_CLASS_DRIVER_COUNT; i++)
   {
@@ -332,22 +466,29 @@ bool tud_init (void)
     _usbd_driver[i].init();
   }
 
-  // Init device controller driver
-  dcd_init(TUD_OPT_RHPORT);
-  tud_connect();
-  dcd_int_enable(TUD_OPT_RHPORT);
+  // Init device controller driver of each device port
+  for (uint8_t rhport = 0; rhport < 2; rhport++)
+  {
+    if ( !(TUSB_OPT_RHPORT_MODE(rhport) & OPT_MODE_DEVICE) ) continue;
+
+    dcd_init(rhport);
+    tud_rhport_connect(rhport);
+    dcd_int_enable(rhport);
+  }
 
   return true;
 }
 
 static void usbd_reset(uint8_t rhport)
 {
-  tu_varclr(&_usbd_dev);
+  usbd_device_t* dev = get_device(rhport);
 
-  memset(_usbd_dev.itf2drv, DRVID_INVALID, sizeof(_usbd_dev.itf2drv)); // invalid mapping
-  memset(_usbd_dev.ep2drv , DRVID_INVALID, sizeof(_usbd_dev.ep2drv )); // invalid mapping
+  tu_varclr(dev);
 
-  usbd_control_reset();
+  memset(dev->itf2drv, DRVID_INVALID, sizeof(dev->itf2drv)); // invalid mapping
+  memset(dev->ep2drv , DRVID_INVALID, sizeof(dev->ep2drv )); // invalid mapping
+
+  usbd_control_reset(rhport);
 
   for (uint8_t i = 0; i < USBD_CLASS_DRIVER_COUNT; i++)
   {
@@ -360,9 +501,48 @@ bool tud_task_event_ready(void)
   // Skip if stack is not initialized
   if ( !tusb_inited() ) return false;
 
-  return !osal_queue_empty(_usbd_q);
+  return !(osal_queue_empty(_usbd_ctrl_q) && osal_queue_empty(_usbd_q));
 }
 
+// Time left of timeout_ms started at start_ms. Without tud_time_millis_cb() elapsed time is unknown,
+// the timeout is used up by the first wait.
+static uint32_t time_left(uint32_t timeout_ms, uint32_t start_ms)
+{
+  if ( timeout_ms == OSAL_TIMEOUT_WAIT_FOREVER ) return timeout_ms;
+  if ( !tud_time_millis_cb ) return 0;
+
+  uint32_t const elapsed_ms = tud_time_millis_cb() - start_ms;
+  return (elapsed_ms < timeout_ms) ? (timeout_ms - elapsed_ms) : 0;
+}
+
+#if CFG_TUSB_OS == OPT_OS_NONE
+// Wait for event up to timeout_ms, sleep with tud_idle_cb() while waiting.
+// Without tud_time_millis_cb() timeout is up to the next interrupt.
+static bool wait_event(uint32_t timeout_ms)
+{
+  if ( tud_task_event_ready() ) return true;
+  if ( timeout_ms == 0 ) return false;
+
+  uint32_t const start_ms = tud_time_millis_cb ? tud_time_millis_cb() : 0;
+  uint32_t remaining_ms = timeout_ms;
+
+  while (1)
+  {
+    if ( tud_idle_cb ) tud_idle_cb(remaining_ms);
+    if ( tud_task_event_ready() ) return true;
+
+    if ( timeout_ms != OSAL_TIMEOUT_WAIT_FOREVER )
+    {
+      if ( !tud_time_millis_cb ) return false;
+
+      uint32_t const elapsed_ms = tud_time_millis_cb() - start_ms;
+      if ( elapsed_ms >= timeout_ms ) return false;
+      remaining_ms = timeout_ms - elapsed_ms;
+    }
+  }
+}
+#endif
+
 /* USB Device Driver task
  * This top level thread manages all device controller event and delegates events to class-specific drivers.
  * This should be called periodically within the mainloop or rtos thread.
@@ -382,16 +562,50 @@ bool tud_task_event_ready(void)
     @endcode
  */
 void tud_task (void)
+{
+  tud_task_ext( (CFG_TUSB_OS == OPT_OS_NONE) ? OSAL_TIMEOUT_NOTIMEOUT : OSAL_TIMEOUT_WAIT_FOREVER );
+}
+
+void tud_task_ext(uint32_t timeout_ms)
 {
   // Skip if stack is not initialized
   if ( !tusb_inited() ) return;
 
+  // Deadline is kept across events: waiting again after an event only takes the time left
+  uint32_t const start_ms = (tud_time_millis_cb && timeout_ms) ? tud_time_millis_cb() : 0;
+  uint32_t wait_ms = timeout_ms;
+
   // Loop until there is no more events in the queue
   while (1)
   {
     dcd_event_t event;
 
-    if ( !osal_queue_receive(_usbd_q, &event) ) return;
+#if CFG_TUSB_OS == OPT_OS_NONE
+    if ( !wait_event(wait_ms) ) return;
+#else
+    if ( !tud_task_event_ready() && !osal_semaphore_wait(_usbd_sem, wait_ms) ) return;
+#endif
+
+    // Control lane is drained first, it is re-checked after every data event.
+    // Only the task receives so the queue is not empty when receiving and won't block.
+    bool const received = osal_queue_empty(_usbd_ctrl_q) ?
+                          osal_queue_receive(_usbd_q     , &event, OSAL_TIMEOUT_NOTIMEOUT) :
+                          osal_queue_receive(_usbd_ctrl_q, &event, OSAL_TIMEOUT_NOTIMEOUT);
+
+    if ( wait_ms ) wait_ms = time_left(timeout_ms, start_ms);
+
+    // semaphore is left posted by events already processed, wait again
+    if ( !received ) continue;
+
+    uint8_t const rhport = event.rhport;
+    usbd_device_t* dev = get_device(rhport);
+    _usbd_task_rhport = rhport;
+
+    TRACE_EVENT(TU_TRACE_USBD_EVENT, &event);
+
+#if CFG_TUD_STATS
+    _usbd_q_count.dequeued++;
+#endif
 
 #if CFG_TUSB_DEBUG >= 2
     if (event.event_id == DCD_EVENT_SETUP_RECEIVED) TU_LOG2("\r\n"); // extra line for setup
@@ -402,13 +616,15 @@ void tud_task (void)
     {
       case DCD_EVENT_BUS_RESET:
         TU_LOG2("\r\n");
-        usbd_reset(event.rhport);
-        _usbd_dev.speed = event.bus_reset.speed;
+        usbd_reset(rhport);
+        dev->speed = event.bus_reset.speed;
+        _usbd_task_epoch[TUD_RHPORT_INDEX(rhport)] = event.bus_epoch;
       break;
 
       case DCD_EVENT_UNPLUGGED:
         TU_LOG2("\r\n");
-        usbd_reset(event.rhport);
+        usbd_reset(rhport);
+        _usbd_task_epoch[TUD_RHPORT_INDEX(rhport)] = event.bus_epoch;
 
         // invoke callback
         if (tud_umount_cb) tud_umount_cb();
@@ -420,15 +636,22 @@ void tud_task (void)
 
         // Mark as connected after receiving 1st setup packet.
         // But it is easier to set it every time instead of wasting time to check then set
-        _usbd_dev.connected = 1;
+        dev->connected = 1;
 
         // Process control request
-        if ( !process_control_request(event.rhport, &event.setup_received) )
+        if ( !process_control_request(rhport, &event.setup_received) )
         {
           TU_LOG2("  Stall EP0\r\n");
+          TU_TRACE(TU_TRACE_CTRL_STALL, 0, 0);
+
+#if CFG_TUD_STATS
+          STATS(rhport).edpt[0][TUSB_DIR_OUT].stall_count++;
+          STATS(rhport).edpt[0][TUSB_DIR_IN].stall_count++;
+#endif
+
           // Failed -> stall both control endpoint IN and OUT
-          dcd_edpt_stall(event.rhport, 0);
-          dcd_edpt_stall(event.rhport, 0 | TUSB_DIR_IN_MASK);
+          dcd_edpt_stall(rhport, 0);
+          dcd_edpt_stall(rhport, 0 | TUSB_DIR_IN_MASK);
         }
       break;
 
@@ -441,26 +664,44 @@ void tud_task (void)
 
         TU_LOG2("on EP %02X with %u bytes\r\n", ep_addr, (unsigned int) event.xfer_complete.len);
 
-        _usbd_dev.ep_status[epnum][ep_dir].busy = false;
+        // Transfer is queued before a bus reset which is processed ahead of it, skip it
+        if ( event.bus_epoch != _usbd_task_epoch[TUD_RHPORT_INDEX(rhport)] )
+        {
+          TU_LOG2("  Stale transfer skipped\r\n");
+          break;
+        }
+
+        dev->ep_status[epnum][ep_dir].busy = false;
+
+#if CFG_TUD_STATS
+        tud_stats_edpt_t* stats = &STATS(rhport).edpt[epnum][ep_dir];
+        uint32_t const latency = (uint32_t) (CFG_TUD_STATS_TIMESTAMP()) - event.timestamp;
+
+        stats->xfer_count++;
+        stats->xfer_bytes  += event.xfer_complete.len;
+        stats->latency_sum += latency;
+        if ( latency > stats->latency_max ) stats->latency_max = latency;
+        if ( event.xfer_complete.result != XFER_RESULT_SUCCESS ) stats->error_count++;
+#endif
 
         if ( 0 == epnum )
         {
-          usbd_control_xfer_cb(event.rhport, ep_addr, (xfer_result_t)event.xfer_complete.result, event.xfer_complete.len);
+          usbd_control_xfer_cb(rhport, ep_addr, (xfer_result_t)event.xfer_complete.result, event.xfer_complete.len);
         }
         else
         {
-          uint8_t const drv_id = _usbd_dev.ep2drv[epnum][ep_dir];
+          uint8_t const drv_id = dev->ep2drv[epnum][ep_dir];
           TU_ASSERT(drv_id < USBD_CLASS_DRIVER_COUNT,);
 
           TU_LOG2("  %s xfer callback\r\n", _usbd_driver[drv_id].name);
-          _usbd_driver[drv_id].xfer_cb(event.rhport, ep_addr, (xfer_result_t)event.xfer_complete.result, event.xfer_complete.len);
+          _usbd_driver[drv_id].xfer_cb(rhport, ep_addr, (xfer_result_t)event.xfer_complete.result, event.xfer_complete.len);
         }
       }
       break;
 
       case DCD_EVENT_SUSPEND:
         TU_LOG2("\r\n");
-        if (tud_suspend_cb) tud_suspend_cb(_usbd_dev.remote_wakeup_en);
+        if (tud_suspend_cb) tud_suspend_cb(dev->remote_wakeup_en);
       break;
 
       case DCD_EVENT_RESUME:
@@ -474,7 +715,7 @@ void tud_task (void)
         {
           if ( _usbd_driver[i].sof )
           {
-            _usbd_driver[i].sof(event.rhport);
+            _usbd_driver[i].sof(rhport);
           }
         }
       break;
@@ -498,7 +739,7 @@ void tud_task (void)
 // Helper to invoke class driver control request handler
 static bool invoke_class_control(uint8_t rhport, uint8_t drvid, tusb_control_request_t const * request)
 {
-  usbd_control_set_complete_callback(_usbd_driver[drvid].control_complete);
+  usbd_control_set_complete_callback(rhport, _usbd_driver[drvid].control_complete);
   TU_LOG2("  %s control request\r\n", _usbd_driver[drvid].name);
   return _usbd_driver[drvid].control_request(rhport, request);
 }
@@ -507,16 +748,34 @@ static bool invoke_class_control(uint8_t rhport, uint8_t drvid, tusb_control_req
 // return false will cause its caller to stall control endpoint
 static bool process_control_request(uint8_t rhport, tusb_control_request_t const * p_request)
 {
-  usbd_control_set_complete_callback(NULL);
+  usbd_device_t* dev = get_device(rhport);
+
+  usbd_control_set_complete_callback(rhport, NULL);
 
   TU_ASSERT(p_request->bmRequestType_bit.type < TUSB_REQ_TYPE_INVALID);
 
+#if CFG_TUD_STATS && CFG_TUD_STATS_VENDOR_REQUEST
+  // Statistics request: IN to read, OUT to clear
+  if ( p_request->bmRequestType_bit.type      == TUSB_REQ_TYPE_VENDOR &&
+       p_request->bmRequestType_bit.recipient == TUSB_REQ_RCPT_DEVICE &&
+       p_request->bRequest                    == CFG_TUD_STATS_VENDOR_REQUEST )
+  {
+    if ( p_request->bmRequestType_bit.direction == TUSB_DIR_IN )
+    {
+      return tud_control_xfer(rhport, p_request, &STATS(rhport), sizeof(tud_stats_t));
+    }
+
+    tu_varclr(&STATS(rhport));
+    return tud_control_status(rhport, p_request);
+  }
+#endif
+
   // Vendor request
   if ( p_request->bmRequestType_bit.type == TUSB_REQ_TYPE_VENDOR )
   {
     TU_VERIFY(tud_vendor_control_request_cb);
 
-    if (tud_vendor_control_complete_cb) usbd_control_set_complete_callback(tud_vendor_control_complete_cb);
+    if (tud_vendor_control_complete_cb) usbd_control_set_complete_callback(rhport, tud_vendor_control_complete_cb);
     return tud_vendor_control_request_cb(rhport, p_request);
   }
 
@@ -535,9 +794,9 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
       if ( TUSB_REQ_TYPE_CLASS == p_request->bmRequestType_bit.type )
       {
           uint8_t const itf = tu_u16_low(p_request->wIndex);
-          TU_VERIFY(itf < TU_ARRAY_SIZE(_usbd_dev.itf2drv));
+          TU_VERIFY(itf < TU_ARRAY_SIZE(dev->itf2drv));
 
-          uint8_t const drvid = _usbd_dev.itf2drv[itf];
+          uint8_t const drvid = dev->itf2drv[itf];
           TU_VERIFY(drvid < USBD_CLASS_DRIVER_COUNT);
 
           // forward to class driver: "non-STD request to Interface"
@@ -557,15 +816,15 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
           // Depending on mcu, status phase could be sent either before or after changing device address,
           // or even require stack to not response with status at all
           // Therefore DCD must take full responsibility to response and include zlp status packet if needed.
-          usbd_control_set_request(p_request); // set request since DCD has no access to tud_control_status() API
+          usbd_control_set_request(rhport, p_request); // set request since DCD has no access to tud_control_status() API
           dcd_set_address(rhport, (uint8_t) p_request->wValue);
           // skip tud_control_status()
-          _usbd_dev.addressed = 1;
+          dev->addressed = 1;
         break;
 
         case TUSB_REQ_GET_CONFIGURATION:
         {
-          uint8_t cfgnum = _usbd_dev.configured ? 1 : 0;
+          uint8_t cfgnum = dev->configured ? 1 : 0;
           tud_control_xfer(rhport, p_request, &cfgnum, 1);
         }
         break;
@@ -574,9 +833,9 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
         {
           uint8_t const cfg_num = (uint8_t) p_request->wValue;
 
-          if ( !_usbd_dev.configured && cfg_num ) TU_ASSERT( process_set_config(rhport, cfg_num) );
+          if ( !dev->configured && cfg_num ) TU_ASSERT( process_set_config(rhport, cfg_num) );
 
-          _usbd_dev.configured = cfg_num ? 1 : 0;
+          dev->configured = cfg_num ? 1 : 0;
 
           tud_control_status(rhport, p_request);
         }
@@ -591,7 +850,7 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
           TU_VERIFY(TUSB_REQ_FEATURE_REMOTE_WAKEUP == p_request->wValue);
 
           // Host may enable remote wake up before suspending especially HID device
-          _usbd_dev.remote_wakeup_en = true;
+          dev->remote_wakeup_en = true;
           tud_control_status(rhport, p_request);
         break;
 
@@ -600,7 +859,7 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
           TU_VERIFY(TUSB_REQ_FEATURE_REMOTE_WAKEUP == p_request->wValue);
 
           // Host may disable remote wake up after resuming
-          _usbd_dev.remote_wakeup_en = false;
+          dev->remote_wakeup_en = false;
           tud_control_status(rhport, p_request);
         break;
 
@@ -609,7 +868,7 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
           // Device status bit mask
           // - Bit 0: Self Powered
           // - Bit 1: Remote Wakeup enabled
-          uint16_t status = (_usbd_dev.self_powered ? 1 : 0) | (_usbd_dev.remote_wakeup_en ? 2 : 0);
+          uint16_t status = (dev->self_powered ? 1 : 0) | (dev->remote_wakeup_en ? 2 : 0);
           tud_control_xfer(rhport, p_request, &status, 2);
         }
         break;
@@ -623,9 +882,9 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
     case TUSB_REQ_RCPT_INTERFACE:
     {
       uint8_t const itf = tu_u16_low(p_request->wIndex);
-      TU_VERIFY(itf < TU_ARRAY_SIZE(_usbd_dev.itf2drv));
+      TU_VERIFY(itf < TU_ARRAY_SIZE(dev->itf2drv));
 
-      uint8_t const drvid = _usbd_dev.itf2drv[itf];
+      uint8_t const drvid = dev->itf2drv[itf];
       TU_VERIFY(drvid < USBD_CLASS_DRIVER_COUNT);
 
       // all requests to Interface (STD or Class) is forwarded to class driver.
@@ -650,9 +909,9 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
       uint8_t const ep_num  = tu_edpt_number(ep_addr);
       uint8_t const ep_dir  = tu_edpt_dir(ep_addr);
 
-      TU_ASSERT(ep_num < TU_ARRAY_SIZE(_usbd_dev.ep2drv) );
+      TU_ASSERT(ep_num < TU_ARRAY_SIZE(dev->ep2drv) );
 
-      uint8_t const drvid = _usbd_dev.ep2drv[ep_num][ep_dir];
+      uint8_t const drvid = dev->ep2drv[ep_num][ep_dir];
 
       bool ret = false;
 
@@ -707,7 +966,7 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
       if ( TUSB_REQ_TYPE_STANDARD == p_request->bmRequestType_bit.type )
       {
         // Set complete callback = NULL since it can also stall the request.
-        usbd_control_set_complete_callback(NULL);
+        usbd_control_set_complete_callback(rhport, NULL);
       }
 
       return ret;
@@ -725,12 +984,14 @@ static bool process_control_request(uint8_t rhport, tusb_control_request_t const
 // This function parse configuration descriptor & open drivers accordingly
 static bool process_set_config(uint8_t rhport, uint8_t cfg_num)
 {
+  usbd_device_t* dev = get_device(rhport);
+
   tusb_desc_configuration_t const * desc_cfg = (tusb_desc_configuration_t const *) tud_descriptor_configuration_cb(cfg_num-1); // index is cfg_num-1
   TU_ASSERT(desc_cfg != NULL && desc_cfg->bDescriptorType == TUSB_DESC_CONFIGURATION);
 
   // Parse configuration descriptor
-  _usbd_dev.remote_wakeup_support = (desc_cfg->bmAttributes & TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP) ? 1 : 0;
-  _usbd_dev.self_powered = (desc_cfg->bmAttributes & TUSB_DESC_CONFIG_ATT_SELF_POWERED) ? 1 : 0;
+  dev->remote_wakeup_support = (desc_cfg->bmAttributes & TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP) ? 1 : 0;
+  dev->self_powered = (desc_cfg->bmAttributes & TUSB_DESC_CONFIG_ATT_SELF_POWERED) ? 1 : 0;
 
   // Parse interface descriptor
   uint8_t const * p_desc   = ((uint8_t const*) desc_cfg) + sizeof(tusb_desc_configuration_t);
@@ -767,10 +1028,10 @@ static bool process_set_config(uint8_t rhport, uint8_t cfg_num)
         TU_ASSERT( sizeof(tusb_desc_interface_t) <= drv_len && drv_len <= remaining_len);
 
         // Interface number must not be used already
-        TU_ASSERT( DRVID_INVALID == _usbd_dev.itf2drv[desc_itf->bInterfaceNumber] );
+        TU_ASSERT( DRVID_INVALID == dev->itf2drv[desc_itf->bInterfaceNumber] );
 
         TU_LOG2("  %s opened\r\n", driver->name);
-        _usbd_dev.itf2drv[desc_itf->bInterfaceNumber] = drv_id;
+        dev->itf2drv[desc_itf->bInterfaceNumber] = drv_id;
 
         // If IAD exist, assign all interfaces to the same driver
         if (desc_itf_assoc)
@@ -781,7 +1042,7 @@ static bool process_set_config(uint8_t rhport, uint8_t cfg_num)
 
           for(uint8_t i=1; i<desc_itf_assoc->bInterfaceCount; i++)
           {
-            _usbd_dev.itf2drv[desc_itf->bInterfaceNumber+i] = drv_id;
+            dev->itf2drv[desc_itf->bInterfaceNumber+i] = drv_id;
           }
         }
 
@@ -792,7 +1053,7 @@ static bool process_set_config(uint8_t rhport, uint8_t cfg_num)
     // Failed if cannot find supported driver
     TU_ASSERT(drv_id < USBD_CLASS_DRIVER_COUNT);
 
-    mark_interface_endpoint(_usbd_dev.ep2drv, p_desc, drv_len, drv_id); // TODO refactor
+    mark_interface_endpoint(dev->ep2drv, p_desc, drv_len, drv_id); // TODO refactor
 
     p_desc += drv_len; // next interface
   }
@@ -804,7 +1065,7 @@ static bool process_set_config(uint8_t rhport, uint8_t cfg_num)
 }
 
 // Helper marking endpoint of interface belongs to class driver
-static void mark_interface_endpoint(uint8_t ep2drv[8][2], uint8_t const* p_desc, uint16_t desc_len, uint8_t driver_id)
+static void mark_interface_endpoint(uint8_t ep2drv[CFG_TUD_ENDPOINT_MAX][2], uint8_t const* p_desc, uint16_t desc_len, uint8_t driver_id)
 {
   uint16_t len = 0;
 
@@ -825,6 +1086,8 @@ static void mark_interface_endpoint(uint8_t ep2drv[8][2], uint8_t const* p_desc,
 // return descriptor's buffer and update desc_len
 static bool process_get_descriptor(uint8_t rhport, tusb_control_request_t const * p_request)
 {
+  usbd_device_t const* dev = get_device(rhport);
+
   tusb_desc_type_t const desc_type = (tusb_desc_type_t) tu_u16_high(p_request->wValue);
   uint8_t const desc_index = tu_u16_low( p_request->wValue );
 
@@ -838,7 +1101,7 @@ static bool process_get_descriptor(uint8_t rhport, tusb_control_request_t const
 
       // Only send up to EP0 Packet Size if not addressed
       // This only happens with the very first get device descriptor and EP0 size = 8 or 16.
-      if ((CFG_TUD_ENDPOINT0_SIZE < sizeof(tusb_desc_device_t)) && !_usbd_dev.addressed)
+      if ((CFG_TUD_ENDPOINT0_SIZE < sizeof(tusb_desc_device_t)) && !dev->addressed)
       {
         len = CFG_TUD_ENDPOINT0_SIZE;
 
@@ -935,16 +1198,78 @@ static bool process_get_descriptor(uint8_t rhport, tusb_control_request_t const
 //--------------------------------------------------------------------+
 // DCD Event Handler
 //--------------------------------------------------------------------+
+// Control and bus events are queued to the high priority lane
+static inline bool is_ctrl_lane_event(dcd_event_t const * event)
+{
+  switch (event->event_id)
+  {
+    case DCD_EVENT_XFER_COMPLETE: return 0 == tu_edpt_number(event->xfer_complete.ep_addr);
+    case USBD_EVENT_FUNC_CALL   : return false;
+    default                     : return true;
+  }
+}
+
+// Queue event for usbd task
+static void queue_event(dcd_event_t const * event, bool in_isr)
+{
+  TRACE_EVENT(TU_TRACE_DCD_EVENT, event);
+
+  bool const is_ctrl = is_ctrl_lane_event(event);
+
+  dcd_event_t ev = (*event);
+  ev.bus_epoch = _usbd_bus_epoch[TUD_RHPORT_INDEX(event->rhport)];
+
+#if CFG_TUD_STATS
+  // for ISR to callback latency
+  ev.timestamp = CFG_TUD_STATS_TIMESTAMP();
+#endif
+
+  bool const queued = osal_queue_send(is_ctrl ? _usbd_ctrl_q : _usbd_q, &ev, in_isr);
+
+#if CFG_TUSB_OS != OPT_OS_NONE
+  if ( queued ) osal_semaphore_post(_usbd_sem, in_isr);
+#endif
+
+#if CFG_TUD_STATS
+  if ( !queued )
+  {
+    STATS(event->rhport).queue_overflow++;
+    return;
+  }
+
+  if (in_isr)
+  {
+    _usbd_q_count.isr_queued++;
+  }else
+  {
+    _usbd_q_count.task_queued++;
+  }
+
+  uint32_t const depth = _usbd_q_count.isr_queued + _usbd_q_count.task_queued - _usbd_q_count.dequeued;
+  if ( depth > STATS(event->rhport).queue_hwm ) STATS(event->rhport).queue_hwm = (uint16_t) depth;
+#else
+  (void) queued;
+#endif
+}
+
 void dcd_event_handler(dcd_event_t const * event, bool in_isr)
 {
+  usbd_device_t* dev = get_device(event->rhport);
+
   switch (event->event_id)
   {
+    case DCD_EVENT_BUS_RESET:
+      _usbd_bus_epoch[TUD_RHPORT_INDEX(event->rhport)]++;
+      queue_event(event, in_isr);
+    break;
+
     case DCD_EVENT_UNPLUGGED:
-      _usbd_dev.connected  = 0;
-      _usbd_dev.addressed  = 0;
-      _usbd_dev.configured = 0;
-      _usbd_dev.suspended  = 0;
-      osal_queue_send(_usbd_q, event, in_isr);
+      dev->connected  = 0;
+      dev->addressed  = 0;
+      dev->configured = 0;
+      dev->suspended  = 0;
+      _usbd_bus_epoch[TUD_RHPORT_INDEX(event->rhport)]++;
+      queue_event(event, in_isr);
     break;
 
     case DCD_EVENT_SOF:
@@ -955,24 +1280,24 @@ void dcd_event_handler(dcd_event_t const * event, bool in_isr)
       // NOTE: When plugging/unplugging device, the D+/D- state are unstable and can accidentally meet the
       // SUSPEND condition ( Idle for 3ms ). Some MCUs such as SAMD doesn't distinguish suspend vs disconnect as well.
       // We will skip handling SUSPEND/RESUME event if not currently connected
-      if ( _usbd_dev.connected )
+      if ( dev->connected )
       {
-        _usbd_dev.suspended = 1;
-        osal_queue_send(_usbd_q, event, in_isr);
+        dev->suspended = 1;
+        queue_event(event, in_isr);
       }
     break;
 
     case DCD_EVENT_RESUME:
       // skip event if not connected (especially required for SAMD)
-      if ( _usbd_dev.connected )
+      if ( dev->connected )
       {
-        _usbd_dev.suspended = 0;
-        osal_queue_send(_usbd_q, event, in_isr);
+        dev->suspended = 0;
+        queue_event(event, in_isr);
       }
     break;
 
     default:
-      osal_queue_send(_usbd_q, event, in_isr);
+      queue_event(event, in_isr);
     break;
   }
 }
@@ -1059,12 +1384,15 @@ void usbd_defer_func(osal_task_func_t func, void* param, bool in_isr)
 bool usbd_edpt_open(uint8_t rhport, tusb_desc_endpoint_t const * desc_ep)
 {
   TU_LOG2("  Open EP %02X with Size = %u\r\n", desc_ep->bEndpointAddress, desc_ep->wMaxPacketSize.size);
+  TU_TRACE(TU_TRACE_USBD_OPEN, desc_ep->bEndpointAddress, desc_ep->wMaxPacketSize.size);
 
   return dcd_edpt_open(rhport, desc_ep);
 }
 
 bool usbd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t total_bytes)
 {
+  usbd_device_t* dev = get_device(rhport);
+
   uint8_t const epnum = tu_edpt_number(ep_addr);
   uint8_t const dir   = tu_edpt_dir(ep_addr);
 
@@ -1072,7 +1400,10 @@ bool usbd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t
 
   // Set busy first since the actual transfer can be complete before dcd_edpt_xfer() could return
   // and usbd task can preempt and clear the busy
-  _usbd_dev.ep_status[epnum][dir].busy = true;
+  dev->ep_status[epnum][dir].busy = true;
+
+  // traced before queuing since transfer can complete within dcd_edpt_xfer()
+  TU_TRACE(TU_TRACE_USBD_XFER, ep_addr, total_bytes);
 
   if ( dcd_edpt_xfer(rhport, ep_addr, buffer, total_bytes) )
   {
@@ -1080,8 +1411,12 @@ bool usbd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t
     return true;
   }else
   {
-    _usbd_dev.ep_status[epnum][dir].busy = false;
+    dev->ep_status[epnum][dir].busy = false;
     TU_LOG2("failed\r\n");
+    TU_TRACE(TU_TRACE_USBD_XFER_FAILED, ep_addr, total_bytes);
+#if CFG_TUD_STATS
+    STATS_EDPT(rhport, ep_addr).xfer_reject_count++;
+#endif
     TU_BREAKPOINT();
     return false;
   }
@@ -1089,42 +1424,53 @@ bool usbd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t
 
 bool usbd_edpt_busy(uint8_t rhport, uint8_t ep_addr)
 {
-  (void) rhport;
+  usbd_device_t const* dev = get_device(rhport);
 
   uint8_t const epnum = tu_edpt_number(ep_addr);
   uint8_t const dir   = tu_edpt_dir(ep_addr);
 
-  return _usbd_dev.ep_status[epnum][dir].busy;
+  return dev->ep_status[epnum][dir].busy;
 }
 
 void usbd_edpt_stall(uint8_t rhport, uint8_t ep_addr)
 {
+  usbd_device_t* dev = get_device(rhport);
+
   uint8_t const epnum = tu_edpt_number(ep_addr);
   uint8_t const dir   = tu_edpt_dir(ep_addr);
 
+  TU_TRACE(TU_TRACE_USBD_STALL, ep_addr, 0);
+#if CFG_TUD_STATS
+  STATS_EDPT(rhport, ep_addr).stall_count++;
+#endif
+
   dcd_edpt_stall(rhport, ep_addr);
-  _usbd_dev.ep_status[epnum][dir].stalled = true;
-  _usbd_dev.ep_status[epnum][dir].busy = true;
+  dev->ep_status[epnum][dir].stalled = true;
+  dev->ep_status[epnum][dir].busy = true;
 }
 
 void usbd_edpt_clear_stall(uint8_t rhport, uint8_t ep_addr)
 {
+  usbd_device_t* dev = get_device(rhport);
+
   uint8_t const epnum = tu_edpt_number(ep_addr);
   uint8_t const dir   = tu_edpt_dir(ep_addr);
 
+  TU_TRACE(TU_TRACE_USBD_CLEAR_STALL, ep_addr, 0);
+
   dcd_edpt_clear_stall(rhport, ep_addr);
-  _usbd_dev.ep_status[epnum][dir].stalled = false;
-  _usbd_dev.ep_status[epnum][dir].busy = false;
+  dev->ep_status[epnum][dir].stalled = false;
+  dev->ep_status[epnum][dir].busy = false;
 }
 
 bool usbd_edpt_stalled(uint8_t rhport, uint8_t ep_addr)
 {
-  (void) rhport;
+  usbd_device_t const* dev = get_device(rhport);
 
   uint8_t const epnum = tu_edpt_number(ep_addr);
   uint8_t const dir   = tu_edpt_dir(ep_addr);
 
-  return _usbd_dev.ep_status[epnum][dir].stalled;
+  return dev->ep_status[epnum][dir].stalled;
 }
 
 /**
@@ -1137,6 +1483,7 @@ void usbd_edpt_close(uint8_t rhport, uint8_t ep_addr)
 {
   TU_ASSERT(dcd_edpt_close, /**/);
   TU_LOG2("  CLOSING Endpoint: 0x%02X\r\n", ep_addr);
+  TU_TRACE(TU_TRACE_USBD_CLOSE, ep_addr, 0);
 
   dcd_edpt_close(rhport, ep_addr);
 
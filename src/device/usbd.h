@@ -44,9 +44,15 @@
 // Init device stack
 bool tud_init (void);
 
-// Task function should be called in main/rtos loop
+// Task function should be called in main/rtos loop. With RTOS it blocks until there is an event,
+// with OS NONE it returns as soon as there is no more event.
 void tud_task (void);
 
+// Same as tud_task() but wait for event up to timeout_ms (UINT32_MAX for forever) before returning.
+// Timeout is counted from the call, not restarted by each event (needs tud_time_millis_cb()).
+// With OS NONE, MCU sleeps while waiting if tud_idle_cb() is implemented.
+void tud_task_ext(uint32_t timeout_ms);
+
 // Check if there is pending events need proccessing by tud_task()
 bool tud_task_event_ready(void);
 
@@ -70,22 +76,87 @@ bool tud_remote_wakeup(void);
 
 // Enable pull-up resistor on D+ D-
 // Return false on unsupported MCUs
-static inline bool tud_disconnect(void)
+static inline bool tud_rhport_disconnect(uint8_t rhport)
 {
   TU_VERIFY(dcd_disconnect);
-  dcd_disconnect(TUD_OPT_RHPORT);
+  dcd_disconnect(rhport);
   return true;
 }
 
 // Disable pull-up resistor on D+ D-
 // Return false on unsupported MCUs
-static inline bool tud_connect(void)
+static inline bool tud_rhport_connect(uint8_t rhport)
 {
   TU_VERIFY(dcd_connect);
-  dcd_connect(TUD_OPT_RHPORT);
+  dcd_connect(rhport);
   return true;
 }
 
+static inline bool tud_disconnect(void)
+{
+  return tud_rhport_disconnect(TUD_OPT_RHPORT);
+}
+
+static inline bool tud_connect(void)
+{
+  return tud_rhport_connect(TUD_OPT_RHPORT);
+}
+
+//------------- Multiple device ports -------------//
+// When both roothub ports are configured as device, each one enumerates as an independent device with its own
+// class instances, all served by tud_task(). API above without rhport applies to TUD_OPT_RHPORT.
+
+bool tud_rhport_mounted(uint8_t rhport);
+bool tud_rhport_suspended(uint8_t rhport);
+bool tud_rhport_remote_wakeup(uint8_t rhport);
+
+static inline bool tud_rhport_ready(uint8_t rhport)
+{
+  return tud_rhport_mounted(rhport) && !tud_rhport_suspended(rhport);
+}
+
+// Roothub port of the event being processed, callbacks without rhport parameter
+// e.g tud_mount_cb() or tud_descriptor_device_cb() use it to tell which port invoked them
+uint8_t tud_task_rhport(void);
+
+// Number of endpoint numbers tracked by device stack
+#ifndef CFG_TUD_ENDPOINT_MAX
+#define CFG_TUD_ENDPOINT_MAX  8
+#endif
+
+#if CFG_TUD_STATS
+typedef struct
+{
+  uint32_t xfer_count;        ///< completed transfers
+  uint32_t xfer_bytes;        ///< transferred bytes
+  uint32_t latency_sum;       ///< sum of ISR to callback latency, average is latency_sum/xfer_count
+  uint32_t latency_max;       ///< max ISR to callback latency
+  uint16_t stall_count;       ///< endpoint stalled by stack or class driver
+  uint16_t error_count;       ///< transfer completed with error
+  uint16_t xfer_reject_count; ///< usbd_edpt_xfer() rejected by controller
+  uint16_t reserved;
+} tud_stats_edpt_t;
+
+typedef struct
+{
+  uint16_t queue_hwm;          ///< event queue high-water mark
+  uint16_t queue_overflow;     ///< events dropped due to full queue
+  tud_stats_edpt_t edpt[CFG_TUD_ENDPOINT_MAX][2]; ///< indexed by endpoint number and direction
+} tud_stats_t;
+
+// Get statistics of event queue and all endpoints. Latency is in CFG_TUD_STATS_TIMESTAMP() unit
+tud_stats_t const* tud_stats(void);
+
+// Get statistics of a device port, event queue is shared and its counters are charged to the port of the event
+tud_stats_t const* tud_rhport_stats(uint8_t rhport);
+
+// Get statistics of an endpoint, NULL if endpoint number is out of range
+tud_stats_edpt_t const* tud_stats_edpt(uint8_t ep_addr);
+
+// Reset all statistics of all ports to zero
+void tud_stats_clear(void);
+#endif
+
 // Carry out Data and Status stage of control transfer
 // - If len = 0, it is equivalent to sending status only
 // - If len > wLength : it will be truncated
@@ -131,6 +202,16 @@ TU_ATTR_WEAK void tud_suspend_cb(bool remote_wakeup_en);
 // Invoked when usb bus is resumed
 TU_ATTR_WEAK void tud_resume_cb(void);
 
+// Invoked by tud_task_ext() with OS NONE when there is no event: put MCU into sleep until an interrupt
+// occurs or timeout_ms (UINT32_MAX for forever) is elapsed. Sleep only if tud_task_event_ready()
+// is false after interrupts are globally disabled, or an event queued right before sleeping will be
+// missed, e.g for ARM Cortex-M (WFI still wakes up on pending interrupt with PRIMASK set):
+//   __disable_irq(); if ( !tud_task_event_ready() ) __WFI(); __enable_irq();
+TU_ATTR_WEAK void tud_idle_cb(uint32_t timeout_ms);
+
+// Invoked by tud_task_ext() to get current time in milliseconds for timeout
+TU_ATTR_WEAK uint32_t tud_time_millis_cb(void);
+
 // Invoked when received control request with VENDOR TYPE
 TU_ATTR_WEAK bool tud_vendor_control_request_cb(uint8_t rhport, tusb_control_request_t const * request);
 
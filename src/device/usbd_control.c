@@ -53,10 +53,10 @@ typedef struct
   bool (*complete_cb) (uint8_t, tusb_control_request_t const *);
 } usbd_control_xfer_t;
 
-static usbd_control_xfer_t _ctrl_xfer;
+static usbd_control_xfer_t _ctrl_xfer[TUD_OPT_RHPORT_COUNT];
 
 CFG_TUSB_MEM_SECTION CFG_TUSB_MEM_ALIGN
-static uint8_t _usbd_ctrl_buf[CFG_TUD_ENDPOINT0_SIZE];
+static uint8_t _usbd_ctrl_buf[TUD_OPT_RHPORT_COUNT][CFG_TUD_ENDPOINT0_SIZE];
 
 //--------------------------------------------------------------------+
 // Application API
@@ -69,6 +69,7 @@ static inline bool _status_stage_xact(uint8_t rhport, tusb_control_request_t con
   uint8_t const ep_addr = request->bmRequestType_bit.direction ? EDPT_CTRL_OUT : EDPT_CTRL_IN;
 
   TU_LOG2("  Queue EP %02X with zlp Status\r\n", ep_addr);
+  TU_TRACE(TU_TRACE_CTRL_STATUS, ep_addr, 0);
 
   // status direction is reversed to one in the setup packet
   // Note: Status must always be DATA1
@@ -78,10 +79,12 @@ static inline bool _status_stage_xact(uint8_t rhport, tusb_control_request_t con
 // Status phase
 bool tud_control_status(uint8_t rhport, tusb_control_request_t const * request)
 {
-  _ctrl_xfer.request       = (*request);
-  _ctrl_xfer.buffer        = NULL;
-  _ctrl_xfer.total_xferred = 0;
-  _ctrl_xfer.data_len      = 0;
+  usbd_control_xfer_t* ctrl = &_ctrl_xfer[TUD_RHPORT_INDEX(rhport)];
+
+  ctrl->request       = (*request);
+  ctrl->buffer        = NULL;
+  ctrl->total_xferred = 0;
+  ctrl->data_len      = 0;
 
   return _status_stage_xact(rhport, request);
 }
@@ -91,38 +94,44 @@ bool tud_control_status(uint8_t rhport, tusb_control_request_t const * request)
 // This function can also transfer an zero-length packet
 static bool _data_stage_xact(uint8_t rhport)
 {
-  uint16_t const xact_len = tu_min16(_ctrl_xfer.data_len - _ctrl_xfer.total_xferred, CFG_TUD_ENDPOINT0_SIZE);
+  usbd_control_xfer_t* ctrl = &_ctrl_xfer[TUD_RHPORT_INDEX(rhport)];
+  uint8_t* ctrl_buf = _usbd_ctrl_buf[TUD_RHPORT_INDEX(rhport)];
+
+  uint16_t const xact_len = tu_min16(ctrl->data_len - ctrl->total_xferred, CFG_TUD_ENDPOINT0_SIZE);
 
   uint8_t ep_addr = EDPT_CTRL_OUT;
 
-  if ( _ctrl_xfer.request.bmRequestType_bit.direction == TUSB_DIR_IN )
+  if ( ctrl->request.bmRequestType_bit.direction == TUSB_DIR_IN )
   {
     ep_addr = EDPT_CTRL_IN;
-    if ( xact_len ) memcpy(_usbd_ctrl_buf, _ctrl_xfer.buffer, xact_len);
+    if ( xact_len ) memcpy(ctrl_buf, ctrl->buffer, xact_len);
   }
 
   TU_LOG2("  Queue EP %02X with %u bytes\r\n", ep_addr, xact_len);
+  TU_TRACE(TU_TRACE_CTRL_DATA, ep_addr, xact_len);
 
-  return dcd_edpt_xfer(rhport, ep_addr, xact_len ? _usbd_ctrl_buf : NULL, xact_len);
+  return dcd_edpt_xfer(rhport, ep_addr, xact_len ? ctrl_buf : NULL, xact_len);
 }
 
 // Transmit data to/from the control endpoint.
 // If the request's wLength is zero, a status packet is sent instead.
 bool tud_control_xfer(uint8_t rhport, tusb_control_request_t const * request, void* buffer, uint16_t len)
 {
-  _ctrl_xfer.request       = (*request);
-  _ctrl_xfer.buffer        = (uint8_t*) buffer;
-  _ctrl_xfer.total_xferred = 0U;
-  _ctrl_xfer.data_len      = tu_min16(len, request->wLength);
+  usbd_control_xfer_t* ctrl = &_ctrl_xfer[TUD_RHPORT_INDEX(rhport)];
+
+  ctrl->request       = (*request);
+  ctrl->buffer        = (uint8_t*) buffer;
+  ctrl->total_xferred = 0U;
+  ctrl->data_len      = tu_min16(len, request->wLength);
   
   if (request->wLength > 0U)
   {
-    if(_ctrl_xfer.data_len > 0U)
+    if(ctrl->data_len > 0U)
     {
       TU_ASSERT(buffer);
     }
 
-//    TU_LOG2("  Control total data length is %u bytes\r\n", _ctrl_xfer.data_len);
+//    TU_LOG2("  Control total data length is %u bytes\r\n", ctrl->data_len);
 
     // Data stage
     TU_ASSERT( _data_stage_xact(rhport) );
@@ -140,24 +149,26 @@ bool tud_control_xfer(uint8_t rhport, tusb_control_request_t const * request, vo
 // USBD API
 //--------------------------------------------------------------------+
 
-void usbd_control_reset(void)
+void usbd_control_reset(uint8_t rhport)
 {
-  tu_varclr(&_ctrl_xfer);
+  tu_varclr(&_ctrl_xfer[TUD_RHPORT_INDEX(rhport)]);
 }
 
 // TODO may find a better way
-void usbd_control_set_complete_callback( bool (*fp) (uint8_t, tusb_control_request_t const * ) )
+void usbd_control_set_complete_callback(uint8_t rhport, bool (*fp) (uint8_t, tusb_control_request_t const * ) )
 {
-  _ctrl_xfer.complete_cb = fp;
+  _ctrl_xfer[TUD_RHPORT_INDEX(rhport)].complete_cb = fp;
 }
 
 // useful for dcd_set_address where DCD is responsible for status response
-void usbd_control_set_request(tusb_control_request_t const *request)
+void usbd_control_set_request(uint8_t rhport, tusb_control_request_t const *request)
 {
-  _ctrl_xfer.request       = (*request);
-  _ctrl_xfer.buffer        = NULL;
-  _ctrl_xfer.total_xferred = 0;
-  _ctrl_xfer.data_len      = 0;
+  usbd_control_xfer_t* ctrl = &_ctrl_xfer[TUD_RHPORT_INDEX(rhport)];
+
+  ctrl->request       = (*request);
+  ctrl->buffer        = NULL;
+  ctrl->total_xferred = 0;
+  ctrl->data_len      = 0;
 }
 
 // callback when a transaction complete on
@@ -167,45 +178,48 @@ bool usbd_control_xfer_cb (uint8_t rhport, uint8_t ep_addr, xfer_result_t result
 {
   (void) result;
 
+  usbd_control_xfer_t* ctrl = &_ctrl_xfer[TUD_RHPORT_INDEX(rhport)];
+
   // Endpoint Address is opposite to direction bit, this is Status Stage complete event
-  if ( tu_edpt_dir(ep_addr) != _ctrl_xfer.request.bmRequestType_bit.direction )
+  if ( tu_edpt_dir(ep_addr) != ctrl->request.bmRequestType_bit.direction )
   {
     TU_ASSERT(0 == xferred_bytes);
-    if (dcd_edpt0_status_complete) dcd_edpt0_status_complete(rhport, &_ctrl_xfer.request);
+    if (dcd_edpt0_status_complete) dcd_edpt0_status_complete(rhport, &ctrl->request);
     return true;
   }
 
-  if ( _ctrl_xfer.request.bmRequestType_bit.direction == TUSB_DIR_OUT )
+  if ( ctrl->request.bmRequestType_bit.direction == TUSB_DIR_OUT )
   {
-    TU_VERIFY(_ctrl_xfer.buffer);
-    memcpy(_ctrl_xfer.buffer, _usbd_ctrl_buf, xferred_bytes);
+    TU_VERIFY(ctrl->buffer);
+    memcpy(ctrl->buffer, _usbd_ctrl_buf[TUD_RHPORT_INDEX(rhport)], xferred_bytes);
   }
 
-  _ctrl_xfer.total_xferred += xferred_bytes;
-  _ctrl_xfer.buffer += xferred_bytes;
+  ctrl->total_xferred += xferred_bytes;
+  ctrl->buffer += xferred_bytes;
 
   // Data Stage is complete when all request's length are transferred or
   // a short packet is sent including zero-length packet.
-  if ( (_ctrl_xfer.request.wLength == _ctrl_xfer.total_xferred) || (xferred_bytes < CFG_TUD_ENDPOINT0_SIZE) )
+  if ( (ctrl->request.wLength == ctrl->total_xferred) || (xferred_bytes < CFG_TUD_ENDPOINT0_SIZE) )
   {
     // DATA stage is complete
     bool is_ok = true;
 
     // invoke complete callback if set
     // callback can still stall control in status phase e.g out data does not make sense
-    if ( _ctrl_xfer.complete_cb )
+    if ( ctrl->complete_cb )
     {
       #if CFG_TUSB_DEBUG >= 2
-      usbd_driver_print_control_complete_name(_ctrl_xfer.complete_cb);
+      usbd_driver_print_control_complete_name(ctrl->complete_cb);
       #endif
+      TU_TRACE(TU_TRACE_CTRL_COMPLETE, 0, ctrl->request.bRequest);
 
-      is_ok = _ctrl_xfer.complete_cb(rhport, &_ctrl_xfer.request);
+      is_ok = ctrl->complete_cb(rhport, &ctrl->request);
     }
 
     if ( is_ok )
     {
       // Send status
-      TU_ASSERT( _status_stage_xact(rhport, &_ctrl_xfer.request) );
+      TU_ASSERT( _status_stage_xact(rhport, &ctrl->request) );
     }else
     {
       // Stall both IN and OUT control endpoint
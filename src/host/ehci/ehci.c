@@ -36,6 +36,10 @@
 #include "../usbh_hcd.h"
 #include "ehci.h"
 
+#if CFG_TUH_ISO
+#include "ehci_iso.h"
+#endif
+
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
 //--------------------------------------------------------------------+
@@ -52,12 +56,6 @@ uint32_t hcd_ehci_register_addr(uint8_t rhport);
 //--------------------------------------------------------------------+
 // PROTOTYPE
 //--------------------------------------------------------------------+
-static inline ehci_link_t* get_period_head(uint8_t rhport, uint8_t interval_ms)
-{
-  (void) rhport;
-  return (ehci_link_t*) &ehci_data.period_head_arr[ tu_log2( tu_min8(EHCI_FRAMELIST_SIZE, interval_ms) ) ];
-}
-
 static inline ehci_qhd_t* qhd_control(uint8_t dev_addr)
 {
   return &ehci_data.control[dev_addr].qhd;
@@ -76,8 +74,18 @@ static inline ehci_qtd_t* qtd_control(uint8_t dev_addr)
 
 
 static inline ehci_qhd_t* qhd_next (ehci_qhd_t const * p_qhd);
-static inline ehci_qhd_t* qhd_find_free (void);
+static inline ehci_qhd_t* qhd_alloc (void);
+static inline void qhd_free (ehci_qhd_t* p_qhd);
 static inline ehci_qhd_t* qhd_get_from_addr (uint8_t dev_addr, uint8_t ep_addr);
+static void qhd_xfer_error_isr (ehci_qhd_t * p_qhd);
+
+// Period in frames of interrupt queue head in schedule: interval rounded down to power of 2
+static inline uint8_t qhd_period(ehci_qhd_t const * p_qhd)
+{
+  if ( p_qhd->interval_ms == 0 ) return 1; // sub-frame interval, polled every frame
+
+  return (uint8_t) TU_MIN(1UL << tu_log2(p_qhd->interval_ms), EHCI_PERIOD_MAX_INTERVAL);
+}
 
 // determine if a queue head has bus-related error
 static inline bool qhd_has_xact_error (ehci_qhd_t * p_qhd)
@@ -88,15 +96,31 @@ static inline bool qhd_has_xact_error (ehci_qhd_t * p_qhd)
 
 static void qhd_init (ehci_qhd_t *p_qhd, uint8_t dev_addr, tusb_desc_endpoint_t const * ep_desc);
 
-static inline ehci_qtd_t* qtd_find_free (void);
+static inline ehci_qtd_t* qtd_alloc (void);
+static inline void qtd_free (ehci_qtd_t* p_qtd);
 static inline ehci_qtd_t* qtd_next (ehci_qtd_t const * p_qtd);
 static inline void qtd_insert_to_qhd (ehci_qhd_t *p_qhd, ehci_qtd_t *p_qtd_new);
 static inline void qtd_remove_1st_from_qhd (ehci_qhd_t *p_qhd);
+static bool qtd_retire_1st_from_qhd (ehci_qhd_t *p_qhd);
+static inline uint32_t qtd_max_bytes (uint32_t buffer);
+static inline uint32_t qtd_chain_len (uint32_t buffer, uint32_t remaining, uint16_t max_packet_size);
 static void qtd_init (ehci_qtd_t* p_qtd, void* buffer, uint16_t total_bytes);
 
 static inline void list_insert (ehci_link_t *current, ehci_link_t *new, uint8_t new_type);
 static inline ehci_link_t* list_next (ehci_link_t *p_link_pointer);
 
+static void period_load_update(uint8_t speed, uint16_t max_packet_size, uint8_t period, uint8_t phase, uint8_t uframes, bool reserve);
+static uint32_t period_load_score(uint8_t speed, uint16_t max_packet_size, uint8_t period, uint8_t phase, uint8_t uframes);
+static bool period_reserve (ehci_qhd_t* p_qhd);
+static void period_release (ehci_qhd_t* p_qhd);
+static void period_link    (ehci_qhd_t* p_qhd);
+static void period_unlink  (ehci_qhd_t* p_qhd);
+
+#if CFG_TUH_ISO
+static bool iso_open (uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const * ep_desc);
+static void iso_close (ehci_iso_stream_t* stream);
+#endif
+
 static bool ehci_init (uint8_t rhport);
 
 //--------------------------------------------------------------------+
@@ -105,6 +129,20 @@ static bool ehci_init (uint8_t rhport);
 bool hcd_init(void)
 {
   tu_memclr(&ehci_data, sizeof(ehci_data_t));
+
+  // all pool entries are free
+  for(uint8_t i=0; i<HCD_MAX_ENDPOINT; i++) ehci_data.free_list.qhd[i] = i;
+  for(uint8_t i=0; i<HCD_MAX_XFER; i++)     ehci_data.free_list.qtd[i] = i;
+  ehci_data.free_list.qhd_count = HCD_MAX_ENDPOINT;
+  ehci_data.free_list.qtd_count = HCD_MAX_XFER;
+
+  ehci_data.qtd_halt.next.terminate      = 1;
+  ehci_data.qtd_halt.alternate.terminate = 1;
+
+#if CFG_TUH_ISO
+  ehci_iso_init(ehci_data.period_framelist);
+#endif
+
   return ehci_init(TUH_OPT_RHPORT);
 }
 
@@ -130,6 +168,17 @@ tusb_speed_t hcd_port_speed_get(uint8_t rhport)
   return (tusb_speed_t) ehci_data.regs->portsc_bm.nxp_port_speed; // NXP specific port speed
 }
 
+uint32_t hcd_frame_number(uint8_t rhport)
+{
+  (void) rhport;
+
+  // FRINDEX is 14-bit micro frame counter, add the 11-bit frame elapsed since last read
+  uint32_t const frame = ehci_data.regs->frame_index >> 3;
+  ehci_data.frame_number += (frame - ehci_data.frame_number) & 0x7FFUL;
+
+  return ehci_data.frame_number;
+}
+
 static void list_remove_qhd_by_addr(ehci_link_t* list_head, uint8_t dev_addr)
 {
   for(ehci_link_t* prev = list_head;
@@ -146,16 +195,9 @@ static void list_remove_qhd_by_addr(ehci_link_t* list_head, uint8_t dev_addr)
       // EHCI 4.8.2 link the removed qhd to async head (which always reachable by Host Controller)
       qhd->next.address = ((uint32_t) list_head) | (EHCI_QTYPE_QHD << 1);
 
-      if ( qhd->int_smask )
-      {
-        // period list queue element is guarantee to be free in the next frame (1 ms)
-        qhd->used = 0;
-      }else
-      {
-        // async list use async advance handshake
-        // mark as removing, will completely re-usable when async advance isr occurs
-        qhd->removing = 1;
-      }
+      // async list use async advance handshake
+      // mark as removing, will completely re-usable when async advance isr occurs
+      qhd->removing = 1;
     }
   }
 }
@@ -166,15 +208,51 @@ void hcd_device_close(uint8_t rhport, uint8_t dev_addr)
   // skip dev0
   if (dev_addr == 0) return;
 
-  // Remove from async list
-  list_remove_qhd_by_addr( (ehci_link_t*) qhd_async_head(rhport), dev_addr );
+  hcd_int_disable(rhport);
+
+  uint32_t const frame = hcd_frame_number(rhport);
 
-  // Remove from all interval period list
-  for(uint8_t i = 0; i < TU_ARRAY_SIZE(ehci_data.period_head_arr); i++)
+  // Remove from periodic schedule, host controller may still use queue head until the end of current frame.
+  // It is released with its bandwidth by period_removed_isr() once frame list rollover reports a later frame
+  for(uint8_t i = 0; i < TU_ARRAY_SIZE(ehci_data.ep2qhd[0]); i++)
   {
-    list_remove_qhd_by_addr( (ehci_link_t*) &ehci_data.period_head_arr[i], dev_addr);
+    uint8_t const idx = ehci_data.ep2qhd[dev_addr-1][i];
+    if ( idx && ehci_data.qhd_pool[idx-1].int_smask )
+    {
+      ehci_qhd_t* p_qhd = &ehci_data.qhd_pool[idx-1];
+      period_unlink(p_qhd);
+      p_qhd->removing = 1;
+      ehci_data.period_removing = true;
+    }
   }
 
+#if CFG_TUH_ISO
+  for(uint8_t i = 0; i < CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    ehci_iso_stream_t* stream = ehci_iso_get(i);
+    if ( stream && stream->dev_addr == dev_addr && !stream->closing )
+    {
+      ehci_iso_stop(stream, frame);
+      stream->closing = 1;
+      ehci_data.period_removing = true;
+    }
+  }
+#endif
+
+  if ( ehci_data.period_removing )
+  {
+    ehci_data.period_removed_frame = frame;
+    ehci_data.regs->inten |= EHCI_INT_MASK_FRAMELIST_ROLLOVER;
+  }
+
+  // Endpoints cannot be looked up anymore, async queue heads are released after async advance
+  tu_memclr(ehci_data.ep2qhd[dev_addr-1], sizeof(ehci_data.ep2qhd[0]));
+
+  // Remove from async list
+  list_remove_qhd_by_addr( (ehci_link_t*) qhd_async_head(rhport), dev_addr );
+
+  hcd_int_enable(rhport);
+
   // Async doorbell (EHCI 4.8.2 for operational details)
   ehci_data.regs->command_bm.async_adv_doorbell = 1;
 }
@@ -207,41 +285,13 @@ static bool ehci_init(uint8_t rhport)
   regs->async_list_addr = (uint32_t) async_head;
 
   //------------- Periodic List -------------//
-  // Build the polling interval tree with 1 ms, 2 ms, 4 ms and 8 ms (framesize) only
-  for(uint32_t i=0; i<4; i++)
-  {
-    ehci_data.period_head_arr[i].int_smask    = 1; // queue head in period list must have smask non-zero
-    ehci_data.period_head_arr[i].qtd_overlay.halted = 1; // dummy node, always inactive
-  }
-
-  ehci_link_t * const framelist  = ehci_data.period_framelist;
-  ehci_link_t * const period_1ms = get_period_head(rhport, 1);
-  // all links --> period_head_arr[0] (1ms)
-  // 0, 2, 4, 6 etc --> period_head_arr[1] (2ms)
-  // 1, 5 --> period_head_arr[2] (4ms)
-  // 3 --> period_head_arr[3] (8ms)
-
-  // TODO EHCI_FRAMELIST_SIZE with other size than 8
+  // empty schedule, interrupt queue heads are linked when opened
+  ehci_link_t * const framelist = ehci_data.period_framelist;
   for(uint32_t i=0; i<EHCI_FRAMELIST_SIZE; i++)
   {
-    framelist[i].address = (uint32_t) period_1ms;
-    framelist[i].type    = EHCI_QTYPE_QHD;
-  }
-
-  for(uint32_t i=0; i<EHCI_FRAMELIST_SIZE; i+=2)
-  {
-    list_insert(framelist + i, get_period_head(rhport, 2), EHCI_QTYPE_QHD);
-  }
-
-  for(uint32_t i=1; i<EHCI_FRAMELIST_SIZE; i+=4)
-  {
-    list_insert(framelist + i, get_period_head(rhport, 4), EHCI_QTYPE_QHD);
+    framelist[i].terminate = 1;
   }
 
-  list_insert(framelist+3, get_period_head(rhport, 8), EHCI_QTYPE_QHD);
-
-  period_1ms->terminate    = 1;
-
   regs->periodic_list_base = (uint32_t) framelist;
 
   //------------- TT Control (NXP only) -------------//
@@ -289,6 +339,9 @@ bool hcd_edpt_xfer(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t *
     ehci_qhd_t* qhd = qhd_control(dev_addr);
     ehci_qtd_t* qtd = qtd_control(dev_addr);
 
+    // control data stage uses single TD
+    TU_ASSERT( buflen <= qtd_max_bytes((uint32_t) buffer) );
+
     qtd_init(qtd, buffer, buflen);
 
     // first first data toggle is always 1 (data & setup stage)
@@ -298,8 +351,9 @@ bool hcd_edpt_xfer(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t *
     qtd->next.terminate  = 1;
 
     // sw region
-    qhd->p_qtd_list_head = qtd;
-    qhd->p_qtd_list_tail = qtd;
+    qhd->p_qtd_list_head     = qtd;
+    qhd->p_qtd_list_tail     = qtd;
+    qhd->total_xferred_bytes = buflen;
 
     // attach TD
     qhd->qtd_overlay.next.address = (uint32_t) qtd;
@@ -321,8 +375,9 @@ bool hcd_setup_send(uint8_t rhport, uint8_t dev_addr, uint8_t const setup_packet
   td->next.terminate  = 1;
 
   // sw region
-  qhd->p_qtd_list_head = td;
-  qhd->p_qtd_list_tail = td;
+  qhd->p_qtd_list_head     = td;
+  qhd->p_qtd_list_tail     = td;
+  qhd->total_xferred_bytes = 8;
 
   // attach TD
   qhd->qtd_overlay.next.address = (uint32_t) td;
@@ -335,10 +390,11 @@ bool hcd_setup_send(uint8_t rhport, uint8_t dev_addr, uint8_t const setup_packet
 //--------------------------------------------------------------------+
 bool hcd_edpt_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const * ep_desc)
 {
-  (void) rhport;
-
-  // TODO not support ISO yet
+#if CFG_TUH_ISO
+  if ( ep_desc->bmAttributes.xfer == TUSB_XFER_ISOCHRONOUS ) return iso_open(rhport, dev_addr, ep_desc);
+#else
   TU_ASSERT (ep_desc->bmAttributes.xfer != TUSB_XFER_ISOCHRONOUS);
+#endif
 
   //------------- Prepare Queue Head -------------//
   ehci_qhd_t * p_qhd;
@@ -348,70 +404,147 @@ bool hcd_edpt_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const
     p_qhd = qhd_control(dev_addr);
   }else
   {
-    p_qhd = qhd_find_free();
+    // endpoint is already opened
+    TU_ASSERT( dev_addr != 0 && qhd_get_from_addr(dev_addr, ep_desc->bEndpointAddress) == NULL );
+
+    hcd_int_disable(rhport);
+    p_qhd = qhd_alloc();
+    hcd_int_enable(rhport);
   }
   TU_ASSERT(p_qhd);
 
   qhd_init(p_qhd, dev_addr, ep_desc);
 
+  if ( TUSB_XFER_INTERRUPT == ep_desc->bmAttributes.xfer )
+  {
+    // not enough periodic bandwidth left
+    bool const reserved = period_reserve(p_qhd);
+    if ( !reserved )
+    {
+      hcd_int_disable(rhport);
+      qhd_free(p_qhd);
+      hcd_int_enable(rhport);
+    }
+    TU_ASSERT(reserved);
+  }
+
+  if ( ep_desc->bEndpointAddress != 0 )
+  {
+    uint8_t const epnum = tu_edpt_number(ep_desc->bEndpointAddress);
+    uint8_t const dir   = tu_edpt_dir(ep_desc->bEndpointAddress);
+    ehci_data.ep2qhd[dev_addr-1][2*epnum + dir] = (uint8_t) (p_qhd - ehci_data.qhd_pool) + 1;
+  }
+
   // control of dev0 is always present as async head
   if ( dev_addr == 0 ) return true;
 
   // Insert to list
-  ehci_link_t * list_head;
-
   switch (ep_desc->bmAttributes.xfer)
   {
     case TUSB_XFER_CONTROL:
     case TUSB_XFER_BULK:
-      list_head = (ehci_link_t*) qhd_async_head(rhport);
+      // TODO might need to disable async list
+      list_insert( (ehci_link_t*) qhd_async_head(rhport), (ehci_link_t*) p_qhd, EHCI_QTYPE_QHD);
     break;
 
     case TUSB_XFER_INTERRUPT:
-      list_head = get_period_head(rhport, p_qhd->interval_ms);
-    break;
-
-    case TUSB_XFER_ISOCHRONOUS:
-      // TODO iso is not supported
+      // frame list is shared with isochronous descriptors re-armed in ISR
+      hcd_int_disable(rhport);
+      period_link(p_qhd);
+      hcd_int_enable(rhport);
     break;
 
     default: break;
   }
 
-  // TODO might need to disable async/period list
-  list_insert( list_head, (ehci_link_t*) p_qhd, EHCI_QTYPE_QHD);
-
   return true;
 }
 
-bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes)
+bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes)
 {
-  //------------- set up QTD -------------//
   ehci_qhd_t *p_qhd = qhd_get_from_addr(dev_addr, ep_addr);
-  ehci_qtd_t *p_qtd = qtd_find_free();
+  TU_ASSERT(p_qhd);
+
+  // number of TDs needed to cover the transfer
+  uint32_t td_count = 0;
+  uint32_t addr     = (uint32_t) buffer;
+  uint32_t remain   = total_bytes;
+  do
+  {
+    uint32_t const len = qtd_chain_len(addr, remain, p_qhd->max_packet_size);
+    addr   += len;
+    remain -= len;
+    td_count++;
+  } while (remain);
 
-  TU_ASSERT(p_qtd);
+  // Also called by class driver's xfer_isr to queue next transfer, masking USB interrupt is harmless there
+  hcd_int_disable(TUH_OPT_RHPORT);
 
-  qtd_init(p_qtd, buffer, total_bytes);
-  p_qtd->pid = p_qhd->pid;
+  bool const enough_td = (td_count <= ehci_data.free_list.qtd_count);
+  if ( enough_td )
+  {
+    //------------- set up QTD chain -------------//
+    addr   = (uint32_t) buffer;
+    remain = total_bytes;
+    do
+    {
+      uint32_t const len = qtd_chain_len(addr, remain, p_qhd->max_packet_size);
+      ehci_qtd_t *p_qtd  = qtd_alloc();
+
+      qtd_init(p_qtd, (void*) addr, (uint16_t) len);
+      p_qtd->pid = p_qhd->pid;
+      ehci_data.qtd_bytes[p_qtd - ehci_data.qtd_pool] = (uint16_t) len;
 
-  //------------- insert TD to TD list -------------//
-  qtd_insert_to_qhd(p_qhd, p_qtd);
+      addr   += len;
+      remain -= len;
+
+      // Short packet of IN stops at the halt TD instead of moving on to the rest of this transfer
+      if ( remain && p_qhd->pid == EHCI_PID_IN ) p_qtd->alternate.address = (uint32_t) &ehci_data.qtd_halt;
+
+      //------------- insert TD to TD list -------------//
+      qtd_insert_to_qhd(p_qhd, p_qtd);
+    } while (remain);
+  }
+
+  hcd_int_enable(TUH_OPT_RHPORT);
+
+  TU_ASSERT(enough_td);
 
   return true;
 }
 
-bool hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes, bool int_on_complete)
+bool hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes, bool int_on_complete)
 {
   TU_ASSERT ( hcd_pipe_queue_xfer(dev_addr, ep_addr, buffer, total_bytes) );
 
   ehci_qhd_t *p_qhd = qhd_get_from_addr(dev_addr, ep_addr);
 
+  hcd_int_disable(TUH_OPT_RHPORT);
+
   if ( int_on_complete )
   { // the just added qtd is pointed by list_tail
     p_qhd->p_qtd_list_tail->int_on_complete = 1;
   }
-  p_qhd->qtd_overlay.next.address = (uint32_t) p_qhd->p_qtd_list_head; // attach head QTD to QHD start transferring
+
+  // Host controller executing a TD reaches new TDs through next pointer of previous ones, unless it has already loaded
+  // the last one into overlay. Otherwise (also when idle or parked at halt TD) overlay is pointed to the first TD not
+  // executed yet, skipping the one in overlay.
+  if ( !p_qhd->qtd_overlay.active || p_qhd->qtd_overlay.next.terminate )
+  {
+    ehci_qtd_t* p_qtd = p_qhd->p_qtd_list_head;
+    while ( p_qtd != NULL && (!p_qtd->active || (p_qhd->qtd_overlay.active && p_qhd->qtd_addr == (uint32_t) p_qtd)) )
+    {
+      p_qtd = (p_qtd == p_qhd->p_qtd_list_tail) ? NULL : qtd_next(p_qtd);
+    }
+
+    if ( p_qtd != NULL )
+    {
+      p_qhd->qtd_overlay.alternate.terminate = 1; // may still point to halt TD if previous transfer ended with short packet
+      p_qhd->qtd_overlay.next.address = (uint32_t) p_qtd;
+    }
+  }
+
+  hcd_int_enable(TUH_OPT_RHPORT);
 
   return true;
 }
@@ -436,6 +569,64 @@ bool hcd_edpt_clear_stall(uint8_t dev_addr, uint8_t ep_addr)
   return true;
 }
 
+#if CFG_TUH_ISO
+//--------------------------------------------------------------------+
+// ISOCHRONOUS STREAM API
+//--------------------------------------------------------------------+
+// Stream is scheduled in every frame at fixed micro frames, only need to check budget
+static bool iso_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const * ep_desc)
+{
+  (void) rhport;
+
+  ehci_iso_stream_t* stream = ehci_iso_open(dev_addr, (tusb_speed_t) _usbh_devices[dev_addr].speed,
+                                            _usbh_devices[dev_addr].hub_addr, _usbh_devices[dev_addr].hub_port, ep_desc);
+  TU_ASSERT(stream);
+
+  uint8_t const speed   = stream->is_highspeed ? TUSB_SPEED_HIGH : TUSB_SPEED_FULL;
+  uint8_t const uframes = stream->smask | stream->cmask;
+
+  // not enough periodic bandwidth left
+  bool const fit = (period_load_score(speed, stream->xact_bytes, 1, 0, uframes) != UINT32_MAX);
+  if ( !fit ) ehci_iso_close(stream);
+  TU_ASSERT(fit);
+
+  period_load_update(speed, stream->xact_bytes, 1, 0, uframes, true);
+
+  return true;
+}
+
+static void iso_close(ehci_iso_stream_t* stream)
+{
+  uint8_t const speed = stream->is_highspeed ? TUSB_SPEED_HIGH : TUSB_SPEED_FULL;
+
+  ehci_iso_close(stream);
+  period_load_update(speed, stream->xact_bytes, 1, 0, stream->smask | stream->cmask, false);
+}
+
+bool hcd_iso_start(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t* buffer, uint16_t slot_size, hcd_iso_cb_t cb)
+{
+  ehci_iso_stream_t* stream = ehci_iso_find(dev_addr, ep_addr);
+  TU_ASSERT(stream);
+
+  hcd_int_disable(rhport);
+  bool const ret = ehci_iso_start(stream, buffer, slot_size, cb, hcd_frame_number(rhport));
+  hcd_int_enable(rhport);
+
+  return ret;
+}
+
+// Must not be called from stream callback
+void hcd_iso_stop(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr)
+{
+  ehci_iso_stream_t* stream = ehci_iso_find(dev_addr, ep_addr);
+  if ( stream == NULL ) return;
+
+  hcd_int_disable(rhport);
+  ehci_iso_stop(stream, hcd_frame_number(rhport));
+  hcd_int_enable(rhport);
+}
+#endif
+
 //--------------------------------------------------------------------+
 // EHCI Interrupt Handler
 //--------------------------------------------------------------------+
@@ -450,14 +641,43 @@ static void async_advance_isr(uint8_t rhport)
   ehci_qhd_t* qhd_pool = ehci_data.qhd_pool;
   for(uint32_t i = 0; i < HCD_MAX_ENDPOINT; i++)
   {
-    if ( qhd_pool[i].removing )
+    if ( qhd_pool[i].removing && !qhd_pool[i].int_smask )
     {
       qhd_pool[i].removing = 0;
-      qhd_pool[i].used     = 0;
+      qhd_free(&qhd_pool[i]);
     }
   }
 }
 
+// Periodic schedule has no handshake (EHCI 4.8.3): once frame list rollover reports that the frame in which devices
+// are closed is over, host controller cannot reach their queue heads and iso descriptors anymore
+static void period_removed_isr(uint8_t rhport)
+{
+  if ( (int32_t) (hcd_frame_number(rhport) - ehci_data.period_removed_frame) < 2 ) return;
+
+  ehci_qhd_t* qhd_pool = ehci_data.qhd_pool;
+  for(uint32_t i = 0; i < HCD_MAX_ENDPOINT; i++)
+  {
+    if ( qhd_pool[i].removing && qhd_pool[i].int_smask )
+    {
+      qhd_pool[i].removing = 0;
+      period_release(&qhd_pool[i]);
+      qhd_free(&qhd_pool[i]);
+    }
+  }
+
+#if CFG_TUH_ISO
+  for(uint8_t i = 0; i < CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    ehci_iso_stream_t* stream = ehci_iso_get(i);
+    if ( stream && stream->closing ) iso_close(stream);
+  }
+#endif
+
+  ehci_data.period_removing = false;
+  ehci_data.regs->inten &= ~EHCI_INT_MASK_FRAMELIST_ROLLOVER;
+}
+
 static void port_connect_status_change_isr(uint8_t hostid)
 {
   // NOTE There is an sequence plug->unplug->…..-> plug if device is powering with pre-plugged device
@@ -477,11 +697,21 @@ static void qhd_xfer_complete_isr(ehci_qhd_t * p_qhd)
   while(p_qhd->p_qtd_list_head != NULL && !p_qhd->p_qtd_list_head->active)
   {
     // TD need to be freed and removed from qhd, before invoking callback
-    bool is_ioc = (p_qhd->p_qtd_list_head->int_on_complete != 0);
-    p_qhd->total_xferred_bytes += p_qhd->p_qtd_list_head->expected_bytes - p_qhd->p_qtd_list_head->total_bytes;
+    bool const is_short = (p_qhd->p_qtd_list_head->total_bytes != 0);
+    bool is_ioc = qtd_retire_1st_from_qhd(p_qhd);
 
-    p_qhd->p_qtd_list_head->used = 0; // free QTD
-    qtd_remove_1st_from_qhd(p_qhd);
+    if ( is_short && !is_ioc )
+    {
+      // Short packet in the middle of chain: HC is parked at halt TD, remaining TDs of this transfer are never executed
+      while ( !is_ioc && p_qhd->p_qtd_list_head != NULL ) is_ioc = qtd_retire_1st_from_qhd(p_qhd);
+
+      // resume with the next queued transfer if any
+      if ( p_qhd->p_qtd_list_head != NULL )
+      {
+        p_qhd->qtd_overlay.alternate.terminate = 1;
+        p_qhd->qtd_overlay.next.address = (uint32_t) p_qhd->p_qtd_list_head;
+      }
+    }
 
     if (is_ioc)
     {
@@ -506,38 +736,39 @@ static void async_list_xfer_complete_isr(ehci_qhd_t * const async_head)
   }while(p_qhd != async_head); // async list traversal, stop if loop around
 }
 
-static void period_list_xfer_complete_isr(uint8_t hostid, uint8_t interval_ms)
+// Visit each queue head of periodic schedule once. Frame i's list holds queue heads sorted by decreasing interval,
+// one with interval <= i has been visited from its first frame already, and so are the rest of the list.
+static void period_list_xfer_isr(uint8_t rhport, bool is_error)
 {
-  uint8_t max_loop = 0;
-  uint32_t const period_1ms_addr = (uint32_t) get_period_head(hostid, 1);
-  ehci_link_t next_item = * get_period_head(hostid, interval_ms);
+  (void) rhport;
 
-  // TODO abstract max loop guard for period
-  while( !next_item.terminate &&
-      !(interval_ms > 1 && period_1ms_addr == tu_align32(next_item.address)) &&
-      max_loop < (HCD_MAX_ENDPOINT + EHCI_MAX_ITD + EHCI_MAX_SITD)*CFG_TUSB_HOST_DEVICE_MAX)
+  for(uint32_t i=0; i<EHCI_PERIOD_MAX_INTERVAL; i++)
   {
-    switch ( next_item.type )
+    ehci_link_t next_item = ehci_data.period_framelist[i];
+
+    while( !next_item.terminate )
     {
-      case EHCI_QTYPE_QHD:
+      // isochronous descriptors precede queue heads, they are handled by ehci_iso_isr()
+      if ( next_item.type != EHCI_QTYPE_QHD )
       {
-        ehci_qhd_t *p_qhd_int = (ehci_qhd_t *) tu_align32(next_item.address);
-        if ( !p_qhd_int->qtd_overlay.halted )
-        {
-          qhd_xfer_complete_isr(p_qhd_int);
-        }
+        next_item = *list_next(&next_item);
+        continue;
       }
-      break;
 
-      case EHCI_QTYPE_ITD: // TODO support hs/fs ISO
-      case EHCI_QTYPE_SITD:
-      case EHCI_QTYPE_FSTN:
-				
-      default: break;
-    }
+      ehci_qhd_t *p_qhd_int = (ehci_qhd_t *) tu_align32(next_item.address);
+      if ( qhd_period(p_qhd_int) <= i ) break;
 
-    next_item = *list_next(&next_item);
-    max_loop++;
+      if ( is_error )
+      {
+        qhd_xfer_error_isr(p_qhd_int);
+      }
+      else if ( !p_qhd_int->qtd_overlay.halted )
+      {
+        qhd_xfer_complete_isr(p_qhd_int);
+      }
+
+      next_item = p_qhd_int->next;
+    }
   }
 }
 
@@ -552,12 +783,9 @@ static void qhd_xfer_error_isr(ehci_qhd_t * p_qhd)
     // no error bits are set, endpoint is halted due to STALL
     error_event = qhd_has_xact_error(p_qhd) ? XFER_RESULT_FAILED : XFER_RESULT_STALLED;
 
-    p_qhd->total_xferred_bytes += p_qhd->p_qtd_list_head->expected_bytes - p_qhd->p_qtd_list_head->total_bytes;
-
 //    if ( XFER_RESULT_FAILED == error_event )    TU_BREAKPOINT(); // TODO skip unplugged device
 
-    p_qhd->p_qtd_list_head->used = 0; // free QTD
-    qtd_remove_1st_from_qhd(p_qhd);
+    bool is_ioc = qtd_retire_1st_from_qhd(p_qhd);
 
     if ( 0 == p_qhd->ep_number )
     {
@@ -568,9 +796,19 @@ static void qhd_xfer_error_isr(ehci_qhd_t * p_qhd)
       p_qhd->qtd_overlay.next.terminate      = 1;
       p_qhd->qtd_overlay.alternate.terminate = 1;
       p_qhd->qtd_overlay.halted              = 0;
+    }else
+    {
+      // drop the rest of failed transfer, endpoint resumes with next queued transfer once halt is cleared
+      while ( !is_ioc && p_qhd->p_qtd_list_head != NULL ) is_ioc = qtd_retire_1st_from_qhd(p_qhd);
 
-      ehci_qtd_t *p_setup = qtd_control(p_qhd->dev_addr);
-      p_setup->used = 0;
+      p_qhd->qtd_overlay.alternate.terminate = 1;
+      if ( p_qhd->p_qtd_list_head != NULL )
+      {
+        p_qhd->qtd_overlay.next.address = (uint32_t) p_qhd->p_qtd_list_head;
+      }else
+      {
+        p_qhd->qtd_overlay.next.terminate = 1;
+      }
     }
 
     // call USBH callback
@@ -591,35 +829,8 @@ static void xfer_error_isr(uint8_t hostid)
     p_qhd = qhd_next(p_qhd);
   }while(p_qhd != async_head); // async list traversal, stop if loop around
 
-  //------------- TODO refractor period list -------------//
-  uint32_t const period_1ms_addr = (uint32_t) get_period_head(hostid, 1);
-  for (uint8_t interval_ms=1; interval_ms <= EHCI_FRAMELIST_SIZE; interval_ms *= 2)
-  {
-    ehci_link_t next_item = * get_period_head(hostid, interval_ms);
-
-    // TODO abstract max loop guard for period
-    while( !next_item.terminate &&
-           !(interval_ms > 1 && period_1ms_addr == tu_align32(next_item.address)) )
-    {
-      switch ( next_item.type )
-      {
-        case EHCI_QTYPE_QHD:
-        {
-          ehci_qhd_t *p_qhd_int = (ehci_qhd_t *) tu_align32(next_item.address);
-          qhd_xfer_error_isr(p_qhd_int);
-        }
-        break;
-
-				// TODO support hs/fs ISO
-        case EHCI_QTYPE_ITD:
-        case EHCI_QTYPE_SITD:
-        case EHCI_QTYPE_FSTN:
-        default: break;
-      }
-
-      next_item = *list_next(&next_item);
-    }
-  }
+  //------------- period list -------------//
+  period_list_xfer_isr(hostid, true);
 }
 
 //------------- Host Controller Driver's Interrupt Handler -------------//
@@ -659,17 +870,27 @@ void hcd_isr(uint8_t rhport)
 
   if (int_status & EHCI_INT_MASK_NXP_PERIODIC)
   {
-    for (uint8_t i=1; i <= EHCI_FRAMELIST_SIZE; i *= 2)
-    {
-      period_list_xfer_complete_isr( rhport, i );
-    }
+    period_list_xfer_isr(rhport, false);
   }
 
+#if CFG_TUH_ISO
+  // iso descriptors are retired by frame number, frame with error is reported by error interrupt instead
+  if (int_status & (EHCI_INT_MASK_NXP_PERIODIC | EHCI_INT_MASK_ERROR))
+  {
+    ehci_iso_isr(hcd_frame_number(rhport));
+  }
+#endif
+
   //------------- There is some removed async previously -------------//
   if (int_status & EHCI_INT_MASK_ASYNC_ADVANCE) // need to place after EHCI_INT_MASK_NXP_ASYNC
   {
     async_advance_isr(rhport);
   }
+
+  if (int_status & EHCI_INT_MASK_FRAMELIST_ROLLOVER)
+  {
+    period_removed_isr(rhport);
+  }
 }
 
 //--------------------------------------------------------------------+
@@ -678,14 +899,24 @@ void hcd_isr(uint8_t rhport)
 
 
 //------------- queue head helper -------------//
-static inline ehci_qhd_t* qhd_find_free (void)
+// Pool allocation is not re-entrant: task context must mask USB interrupt, ISR frees directly
+static inline ehci_qhd_t* qhd_alloc(void)
 {
-  for (uint32_t i=0; i<HCD_MAX_ENDPOINT; i++)
+  if ( ehci_data.free_list.qhd_count == 0 ) return NULL;
+
+  return &ehci_data.qhd_pool[ ehci_data.free_list.qhd[--ehci_data.free_list.qhd_count] ];
+}
+
+// Release qhd and any TD left in its list (e.g device is unplugged during transfer)
+static inline void qhd_free(ehci_qhd_t* p_qhd)
+{
+  while ( p_qhd->p_qtd_list_head != NULL )
   {
-    if ( !ehci_data.qhd_pool[i].used ) return &ehci_data.qhd_pool[i];
+    qtd_free(p_qhd->p_qtd_list_head);
+    qtd_remove_1st_from_qhd(p_qhd);
   }
 
-  return NULL;
+  ehci_data.free_list.qhd[ehci_data.free_list.qhd_count++] = (uint8_t) (p_qhd - ehci_data.qhd_pool);
 }
 
 static inline ehci_qhd_t* qhd_next(ehci_qhd_t const * p_qhd)
@@ -695,29 +926,27 @@ static inline ehci_qhd_t* qhd_next(ehci_qhd_t const * p_qhd)
 
 static inline ehci_qhd_t* qhd_get_from_addr(uint8_t dev_addr, uint8_t ep_addr)
 {
-  ehci_qhd_t* qhd_pool = ehci_data.qhd_pool;
+  uint8_t const epnum = tu_edpt_number(ep_addr);
 
-  for(uint32_t i=0; i<HCD_MAX_ENDPOINT; i++)
-  {
-    if ( (qhd_pool[i].dev_addr == dev_addr) &&
-          ep_addr == tu_edpt_addr(qhd_pool[i].ep_number, qhd_pool[i].pid) )
-    {
-      return &qhd_pool[i];
-    }
-  }
+  if ( epnum == 0 ) return qhd_control(dev_addr);
+  if ( dev_addr == 0 ) return NULL;
 
-  return NULL;
+  uint8_t const idx = ehci_data.ep2qhd[dev_addr-1][2*epnum + tu_edpt_dir(ep_addr)];
+  return idx ? &ehci_data.qhd_pool[idx-1] : NULL;
 }
 
 //------------- TD helper -------------//
-static inline ehci_qtd_t* qtd_find_free(void)
+static inline ehci_qtd_t* qtd_alloc(void)
 {
-  for (uint32_t i=0; i<HCD_MAX_XFER; i++)
-  {
-    if ( !ehci_data.qtd_pool[i].used ) return &ehci_data.qtd_pool[i];
-  }
+  if ( ehci_data.free_list.qtd_count == 0 ) return NULL;
+  return &ehci_data.qtd_pool[ ehci_data.free_list.qtd[--ehci_data.free_list.qtd_count] ];
+}
 
-  return NULL;
+static inline void qtd_free(ehci_qtd_t* p_qtd)
+{
+  // control TD is statically owned by its device
+  uint32_t const idx = ((uint32_t) p_qtd - (uint32_t) ehci_data.qtd_pool) / sizeof(ehci_qtd_t);
+  if ( idx < HCD_MAX_XFER ) ehci_data.free_list.qtd[ehci_data.free_list.qtd_count++] = (uint8_t) idx;
 }
 
 static inline ehci_qtd_t* qtd_next(ehci_qtd_t const * p_qtd )
@@ -736,6 +965,24 @@ static inline void qtd_remove_1st_from_qhd(ehci_qhd_t *p_qhd)
   }
 }
 
+// Remove and free head TD, account its transferred bytes. Return true if it is the last TD of a transfer
+static bool qtd_retire_1st_from_qhd(ehci_qhd_t *p_qhd)
+{
+  ehci_qtd_t* p_qtd = p_qhd->p_qtd_list_head;
+  bool const is_ioc = (p_qtd->int_on_complete != 0);
+  uint32_t const idx = ((uint32_t) p_qtd - (uint32_t) ehci_data.qtd_pool) / sizeof(ehci_qtd_t);
+
+  // pool TDs may belong to several queued transfers, each of them reports its own bytes.
+  // Control TD is the only one of its transfer, whose length is set when it is queued
+  if ( idx < HCD_MAX_XFER ) p_qhd->total_xferred_bytes += ehci_data.qtd_bytes[idx] - p_qtd->total_bytes;
+  else                      p_qhd->total_xferred_bytes -= p_qtd->total_bytes;
+
+  qtd_remove_1st_from_qhd(p_qhd);
+  qtd_free(p_qtd);
+
+  return is_ioc;
+}
+
 static inline void qtd_insert_to_qhd(ehci_qhd_t *p_qhd, ehci_qtd_t *p_qtd_new)
 {
   if (p_qhd->p_qtd_list_head == NULL) // empty list
@@ -775,16 +1022,17 @@ static void qhd_init(ehci_qhd_t *p_qhd, uint8_t dev_addr, tusb_desc_endpoint_t c
   {
     if (TUSB_SPEED_HIGH == p_qhd->ep_speed)
     {
+      // micro frame masks are shifted to least loaded position by period_reserve()
       TU_ASSERT( interval <= 16, );
       if ( interval < 4) // sub milisecond interval
       {
         p_qhd->interval_ms = 0;
         p_qhd->int_smask   = (interval == 1) ? TU_BIN8(11111111) :
-                             (interval == 2) ? TU_BIN8(10101010) : TU_BIN8(01000100);
+                             (interval == 2) ? TU_BIN8(01010101) : TU_BIN8(00010001);
       }else
       {
         p_qhd->interval_ms = (uint8_t) tu_min16( 1 << (interval-4), 255 );
-        p_qhd->int_smask = TU_BIT(interval % 8);
+        p_qhd->int_smask = 0x01;
       }
     }else
     {
@@ -804,7 +1052,6 @@ static void qhd_init(ehci_qhd_t *p_qhd, uint8_t dev_addr, tusb_desc_endpoint_t c
   p_qhd->mult            = 1; // TODO not use high bandwidth/park mode yet
 
   //------------- HCD Management Data -------------//
-  p_qhd->used            = 1;
   p_qhd->removing        = 0;
   p_qhd->p_qtd_list_head = NULL;
   p_qhd->p_qtd_list_tail = NULL;
@@ -820,19 +1067,32 @@ static void qhd_init(ehci_qhd_t *p_qhd, uint8_t dev_addr, tusb_desc_endpoint_t c
   }
 }
 
+// A TD covers 5 pages starting from buffer offset in the first page
+static inline uint32_t qtd_max_bytes(uint32_t buffer)
+{
+  return 5*4096 - (buffer & 0xFFFUL);
+}
+
+// Length of next TD in chain. All but the last TD must end on packet boundary, otherwise
+// OUT sends short packet and IN stops in the middle of transfer
+static inline uint32_t qtd_chain_len(uint32_t buffer, uint32_t remaining, uint16_t max_packet_size)
+{
+  uint32_t const max_bytes = qtd_max_bytes(buffer);
+  if ( remaining <= max_bytes ) return remaining;
+
+  return max_bytes - (max_bytes % max_packet_size);
+}
+
 static void qtd_init(ehci_qtd_t* p_qtd, void* buffer, uint16_t total_bytes)
 {
   tu_memclr(p_qtd, sizeof(ehci_qtd_t));
 
-  p_qtd->used                = 1;
-
   p_qtd->next.terminate      = 1; // init to null
-  p_qtd->alternate.terminate = 1; // not used, always set to terminated
+  p_qtd->alternate.terminate = 1; // no short packet handling by default
   p_qtd->active              = 1;
   p_qtd->err_count           = 3; // TODO 3 consecutive errors tolerance
   p_qtd->data_toggle         = 0;
   p_qtd->total_bytes         = total_bytes;
-  p_qtd->expected_bytes      = total_bytes;
 
   p_qtd->buffer[0] = (uint32_t) buffer;
   for(uint8_t i=1; i<5; i++)
@@ -853,4 +1113,198 @@ static inline ehci_link_t* list_next(ehci_link_t *p_link_pointer)
   return (ehci_link_t*) tu_align32(p_link_pointer->address);
 }
 
+//------------- Periodic Schedule Helper -------------//
+
+// Worst case bus time in us of an interrupt transaction (USB 2.0 section 5.11.3), host delay is not included
+static uint16_t period_xact_us(uint8_t speed, uint16_t max_packet_size)
+{
+  uint32_t const bits = 3 + (7UL*8*max_packet_size)/6; // data with worst case bit stuffing
+  uint32_t ns;
+
+  switch (speed)
+  {
+    case TUSB_SPEED_HIGH: ns = (55UL*8*2083 + 2083UL*bits)/1000; break;
+    case TUSB_SPEED_FULL: ns = 9107  + (8354UL*bits)/100;        break;
+    default:              ns = 64107 + (67667UL*bits)/100;       break; // low speed
+  }
+
+  return (uint16_t) ((ns + 999)/1000);
+}
+
+// Add (or remove) bandwidth of endpoint polled every period frames from phase, in micro frames of uframes mask.
+// Split transaction takes a full/low speed slot of the frame plus high speed time of each start/complete split
+static void period_load_update(uint8_t speed, uint16_t max_packet_size, uint8_t period, uint8_t phase, uint8_t uframes, bool reserve)
+{
+  bool     const is_split = (speed != TUSB_SPEED_HIGH);
+  uint16_t const hs_us    = period_xact_us(TUSB_SPEED_HIGH, max_packet_size);
+  uint16_t const fs_us    = is_split ? period_xact_us(speed, max_packet_size) : 0;
+
+  for(uint32_t f = phase; f < EHCI_PERIOD_MAX_INTERVAL; f += period)
+  {
+    for(uint8_t u = 0; u < 8; u++)
+    {
+      if ( uframes & TU_BIT(u) )
+      {
+        ehci_data.period_hs_load[f][u] = (uint8_t) (reserve ? (ehci_data.period_hs_load[f][u] + hs_us) : (ehci_data.period_hs_load[f][u] - hs_us));
+      }
+    }
+
+    ehci_data.period_fs_load[f] = (uint16_t) (reserve ? (ehci_data.period_fs_load[f] + fs_us) : (ehci_data.period_fs_load[f] - fs_us));
+  }
+}
+
+// Load of the busiest frame/micro frame endpoint would use at phase with masks, lower is better.
+// UINT32_MAX if it does not fit in the budget
+static uint32_t period_load_score(uint8_t speed, uint16_t max_packet_size, uint8_t period, uint8_t phase, uint8_t uframes)
+{
+  bool     const is_split = (speed != TUSB_SPEED_HIGH);
+  uint16_t const hs_us    = period_xact_us(TUSB_SPEED_HIGH, max_packet_size);
+  uint16_t const fs_us    = is_split ? period_xact_us(speed, max_packet_size) : 0;
+
+  uint16_t hs_max    = 0; // busiest micro frame used by endpoint
+  uint16_t fs_max    = 0; // busiest full/low speed frame
+  uint16_t frame_max = 0; // busiest frame in total high speed time
+
+  for(uint32_t f = phase; f < EHCI_PERIOD_MAX_INTERVAL; f += period)
+  {
+    uint16_t frame_us = 0;
+    for(uint8_t u = 0; u < 8; u++)
+    {
+      frame_us += ehci_data.period_hs_load[f][u];
+      if ( uframes & TU_BIT(u) ) hs_max = tu_max16(hs_max, ehci_data.period_hs_load[f][u]);
+    }
+
+    frame_max = tu_max16(frame_max, frame_us);
+    if ( is_split ) fs_max = tu_max16(fs_max, ehci_data.period_fs_load[f]);
+  }
+
+  if ( (hs_max + hs_us > EHCI_PERIOD_HS_BUDGET) || (fs_max + fs_us > EHCI_PERIOD_FS_BUDGET) ) return UINT32_MAX;
+
+  // full/low speed frame time is the scarcer one for split transaction, then micro frame, then spread among frames
+  return (((uint32_t) fs_max) << 20) | (((uint32_t) hs_max) << 12) | frame_max;
+}
+
+// Pick the least loaded frame phase and micro frame masks for interrupt queue head, then reserve its bandwidth.
+// Masks prepared by qhd_init() start at micro frame 0 and are shifted here
+static bool period_reserve(ehci_qhd_t* p_qhd)
+{
+  uint8_t const smask = p_qhd->int_smask;
+  uint8_t const cmask = p_qhd->fl_int_cmask;
+
+  // split: start at micro frame 0-3 so that complete splits (+2 to +4) stay within frame.
+  // high speed: sub-frame pattern repeats every (8 / number of polls per frame) micro frames
+  uint8_t shift_count;
+  if ( p_qhd->ep_speed != TUSB_SPEED_HIGH )
+  {
+    shift_count = 4;
+  }else
+  {
+    uint8_t polls = 0;
+    for(uint8_t u = 0; u < 8; u++) polls += (smask >> u) & 1;
+    shift_count = 8 / polls;
+  }
+
+  uint32_t best_score = UINT32_MAX;
+  uint8_t  best_phase = 0;
+  uint8_t  best_shift = 0;
+
+  for(uint8_t phase = 0; phase < qhd_period(p_qhd); phase++)
+  {
+    for(uint8_t shift = 0; shift < shift_count; shift++)
+    {
+      uint32_t const score = period_load_score(p_qhd->ep_speed, p_qhd->max_packet_size, qhd_period(p_qhd), phase,
+                                               (uint8_t) ((smask | cmask) << shift));
+      if ( score < best_score )
+      {
+        best_score = score;
+        best_phase = phase;
+        best_shift = shift;
+      }
+    }
+  }
+
+  TU_VERIFY(best_score != UINT32_MAX);
+
+  p_qhd->period_phase = best_phase;
+  p_qhd->int_smask    = (uint8_t) (smask << best_shift);
+  p_qhd->fl_int_cmask = (uint8_t) (cmask << best_shift);
+
+  period_load_update(p_qhd->ep_speed, p_qhd->max_packet_size, qhd_period(p_qhd), p_qhd->period_phase,
+                     p_qhd->int_smask | p_qhd->fl_int_cmask, true);
+
+  return true;
+}
+
+static void period_release(ehci_qhd_t* p_qhd)
+{
+  period_load_update(p_qhd->ep_speed, p_qhd->max_packet_size, qhd_period(p_qhd), p_qhd->period_phase,
+                     p_qhd->int_smask | p_qhd->fl_int_cmask, false);
+}
+
+// Link queue head to every frame of its phase, before the first queue head with shorter interval.
+// Lists of shorter interval are shared with other frames, queue head is inserted only once there.
+static void period_link(ehci_qhd_t* p_qhd)
+{
+  uint8_t const period = qhd_period(p_qhd);
+
+  for(uint32_t i = p_qhd->period_phase; i < EHCI_FRAMELIST_SIZE; i += period)
+  {
+    ehci_link_t* prev = &ehci_data.period_framelist[i];
+
+    while ( !prev->terminate )
+    {
+      // skip isochronous descriptors at head of frame
+      if ( prev->type != EHCI_QTYPE_QHD )
+      {
+        prev = list_next(prev);
+        continue;
+      }
+
+      ehci_qhd_t* here = (ehci_qhd_t*) tu_align32(prev->address);
+      if ( (here == p_qhd) || (qhd_period(here) < period) ) break;
+      prev = &here->next;
+    }
+
+    // already linked by previous frame sharing this list
+    if ( !prev->terminate && (tu_align32(prev->address) == (uint32_t) p_qhd) ) continue;
+
+    // next pointer is set before queue head is reachable by host controller
+    list_insert(prev, (ehci_link_t*) p_qhd, EHCI_QTYPE_QHD);
+  }
+}
+
+// Unlink queue head from every frame of its phase. Its own next pointer is kept for host controller
+// that may still be processing it in the current frame
+static void period_unlink(ehci_qhd_t* p_qhd)
+{
+  uint8_t const period = qhd_period(p_qhd);
+
+  for(uint32_t i = p_qhd->period_phase; i < EHCI_FRAMELIST_SIZE; i += period)
+  {
+    ehci_link_t* prev = &ehci_data.period_framelist[i];
+
+    while ( !prev->terminate )
+    {
+      if ( prev->type != EHCI_QTYPE_QHD )
+      {
+        prev = list_next(prev);
+        continue;
+      }
+
+      ehci_qhd_t* here = (ehci_qhd_t*) tu_align32(prev->address);
+
+      if ( here == p_qhd )
+      {
+        prev->address = p_qhd->next.address;
+        break;
+      }
+
+      // already unlinked by previous frame sharing this list
+      if ( qhd_period(here) < period ) break;
+
+      prev = &here->next;
+    }
+  }
+}
+
 #endif
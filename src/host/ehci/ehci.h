@@ -54,13 +54,21 @@
 //--------------------------------------------------------------------+
 // EHCI CONFIGURATION & CONSTANTS
 //--------------------------------------------------------------------+
-#define	EHCI_CFG_FRAMELIST_SIZE_BITS			7			/// Framelist Size (NXP specific) (0:1024) - (1:512) - (2:256) - (3:128) - (4:64) - (5:32) - (6:16) - (7:8)
+/// Framelist Size (NXP specific) (0:1024) - (1:512) - (2:256) - (3:128) - (4:64) - (5:32) - (6:16) - (7:8)
+#ifndef EHCI_CFG_FRAMELIST_SIZE_BITS
+#define	EHCI_CFG_FRAMELIST_SIZE_BITS			5
+#endif
+
 #define EHCI_FRAMELIST_SIZE  (1024 >> EHCI_CFG_FRAMELIST_SIZE_BITS)
 
-// TODO merge OHCI with EHCI
+// Periodic bandwidth is balanced over this many frames. Endpoint with longer interval is polled at this interval,
+// which is allowed since bInterval is the maximum period.
+#define EHCI_PERIOD_MAX_INTERVAL  TU_MIN(EHCI_FRAMELIST_SIZE, 32)
+
+// Periodic bandwidth budget in us: 80% of micro frame for high speed, 90% of frame for full/low speed behind TT
 enum {
-  EHCI_MAX_ITD  = 4,
-  EHCI_MAX_SITD = 16
+  EHCI_PERIOD_HS_BUDGET = 100,
+  EHCI_PERIOD_FS_BUDGET = 900
 };
 
 //------------- Validation -------------//
@@ -101,16 +109,8 @@ typedef struct
 	// Word 0: Next QTD Pointer
 	ehci_link_t next;
 
-	// Word 1: Alternate Next QTD Pointer (not used)
-	union{
-	  ehci_link_t alternate;
-	  struct {
-	    uint32_t                : 5;
-	    uint32_t used           : 1;
-	    uint32_t                : 10;
-	    uint32_t expected_bytes : 16;
-	  };
-	};
+	// Word 1: Alternate Next QTD Pointer, followed on short packet
+	ehci_link_t alternate;
 
 	// Word 2: qTQ Token
 	volatile uint32_t ping_err             : 1  ; ///< For Highspeed: 0 Out, 1 Ping. Full/Slow used as error indicator
@@ -170,19 +170,19 @@ typedef struct TU_ATTR_ALIGNED(32)
   /// Due to the fact QHD is 32 bytes aligned but occupies only 48 bytes
 	/// thus there are 16 bytes padding free that we can make use of.
   //--------------------------------------------------------------------+
-	uint8_t used;
-	uint8_t removing; // removed from asyn list, waiting for async advance
+	uint8_t period_phase; // first frame of periodic schedule within polling interval
+	uint8_t removing; // removed from schedule, waiting for async advance (async) or end of frame (periodic)
 	uint8_t pid;
 	uint8_t interval_ms; // polling interval in frames (or milisecond)
 
-	uint16_t total_xferred_bytes; // number of bytes xferred until a qtd with ioc bit set
-	uint8_t reserved2[2];
+	uint32_t total_xferred_bytes; // bytes of retired TDs of the oldest transfer, reported when its TD with ioc bit set completes
 
 	ehci_qtd_t * volatile p_qtd_list_head;	// head of the scheduled TD list
 	ehci_qtd_t * volatile p_qtd_list_tail;	// tail of the scheduled TD list
 } ehci_qhd_t;
 
-TU_VERIFY_STATIC( sizeof(ehci_qhd_t) == 64, "size is not correct" );
+// software area holds pointers, layout only fits 32-bit target (host build of unit test uses wider pointers)
+TU_VERIFY_STATIC( sizeof(void*) != 4 || sizeof(ehci_qhd_t) == 64, "size is not correct" );
 
 /// Highspeed Isochronous Transfer Descriptor (section 3.3)
 typedef struct TU_ATTR_ALIGNED(32) {
@@ -427,13 +427,16 @@ typedef volatile struct
 //--------------------------------------------------------------------+
 // EHCI Data Organization
 //--------------------------------------------------------------------+
+#if TUSB_OPT_HOST_ENABLED
 typedef struct
 {
+  // Interrupt queue heads are linked as a tree: each frame list entry points to list of its endpoints sorted by
+  // decreasing interval, shorter interval lists are shared tails among frames
   ehci_link_t period_framelist[EHCI_FRAMELIST_SIZE];
 
-  // for NXP ECHI, only implement 1 ms & 2 ms & 4 ms, 8 ms (framelist)
-  // [0] : 1ms, [1] : 2ms, [2] : 4ms, [3] : 8 ms
-  ehci_qhd_t period_head_arr[4];
+  // Reserved periodic bandwidth in us of each micro frame (high speed) and frame (full/low speed)
+  uint8_t  period_hs_load[EHCI_PERIOD_MAX_INTERVAL][8];
+  uint16_t period_fs_load[EHCI_PERIOD_MAX_INTERVAL];
 
   // Note control qhd of dev0 is used as head of async list
   struct {
@@ -443,10 +446,35 @@ typedef struct
 
   ehci_qhd_t qhd_pool[HCD_MAX_ENDPOINT];
   ehci_qtd_t qtd_pool[HCD_MAX_XFER] TU_ATTR_ALIGNED(32);
+  uint16_t   qtd_bytes[HCD_MAX_XFER]; // bytes queued to pool TD, its total_bytes is decreased by host controller
+
+  // Never active, alternate of non-last IN TD of a chain so that short packet stops the queue head
+  ehci_qtd_t qtd_halt TU_ATTR_ALIGNED(32);
+
+  // Stack of free pool indexes, allocate and free in constant time
+  struct {
+    uint8_t qhd[HCD_MAX_ENDPOINT];
+    uint8_t qtd[HCD_MAX_XFER];
+    uint8_t qhd_count;
+    uint8_t qtd_count;
+  }free_list;
+
+  // qhd_pool index + 1 of opened endpoint (0 if not opened), indexed by [dev_addr-1][epnum*2 + dir]
+  uint8_t ep2qhd[CFG_TUSB_HOST_DEVICE_MAX][32];
 
   ehci_registers_t* regs;
+
+  uint32_t frame_number; // FRINDEX extended to 32-bit ms counter by hcd_frame_number()
+
+  // periodic queue heads and iso streams of closed devices are released once this frame is over
+  uint32_t period_removed_frame;
+  bool     period_removing;
 }ehci_data_t;
 
+// free list keeps pool index in uint8_t
+TU_VERIFY_STATIC( HCD_MAX_XFER <= 255, "qtd pool is too large" );
+#endif
+
 #ifdef __cplusplus
  }
 #endif
@@ -0,0 +1,435 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_ISO
+
+#include "common/tusb_common.h"
+#include "ehci_iso.h"
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+enum { FRAMES_AHEAD = CFG_TUH_ISO_FRAMES_AHEAD };
+
+// siTD transaction position of the first start split (section 3.4.3)
+enum {
+  SITD_TP_ALL   = 0,
+  SITD_TP_BEGIN = 1
+};
+
+CFG_TUSB_MEM_SECTION static ehci_iso_stream_t _iso_stream[CFG_TUH_ISO_STREAM_MAX];
+
+static ehci_link_t* _framelist;
+
+//--------------------------------------------------------------------+
+// INTERNAL HELPER
+//--------------------------------------------------------------------+
+static inline uint32_t iso_addr(void const* p)
+{
+  return (uint32_t) (uintptr_t) p;
+}
+
+static inline uint32_t frame_index(uint32_t frame)
+{
+  return frame & (EHCI_FRAMELIST_SIZE-1);
+}
+
+static inline uint8_t* slot_buffer(ehci_iso_stream_t const* stream, uint8_t slot)
+{
+  return stream->buffer + slot*stream->slot_size;
+}
+
+static inline ehci_link_t* slot_next(ehci_iso_stream_t* stream, uint8_t slot)
+{
+  return stream->is_highspeed ? &stream->itd[slot].next : &stream->sitd[slot].next;
+}
+
+// Iso descriptors of a frame are ordered by stream index, preceding link of stream's descriptor is
+// the one of the nearest lower stream queued in the same frame, or the frame list entry itself
+static ehci_link_t* frame_prev(ehci_iso_stream_t* stream, uint32_t idx)
+{
+  ehci_link_t* prev = &_framelist[idx];
+
+  for(ehci_iso_stream_t* other = _iso_stream; other < stream; other++)
+  {
+    if ( !other->running ) continue;
+
+    for(uint8_t k=0; k<FRAMES_AHEAD; k++)
+    {
+      if ( frame_index(other->frame[k]) == idx )
+      {
+        prev = slot_next(other, k);
+        break;
+      }
+    }
+  }
+
+  return prev;
+}
+
+// next pointer is set before descriptor is reachable by host controller
+static void slot_link(ehci_iso_stream_t* stream, uint8_t slot)
+{
+  ehci_link_t* prev = frame_prev(stream, frame_index(stream->frame[slot]));
+  void const* td    = stream->is_highspeed ? (void const*) &stream->itd[slot] : (void const*) &stream->sitd[slot];
+
+  slot_next(stream, slot)->address = prev->address;
+  prev->address = iso_addr(td) | ((stream->is_highspeed ? EHCI_QTYPE_ITD : EHCI_QTYPE_SITD) << 1);
+}
+
+static void slot_unlink(ehci_iso_stream_t* stream, uint8_t slot)
+{
+  frame_prev(stream, frame_index(stream->frame[slot]))->address = slot_next(stream, slot)->address;
+}
+
+static void slots_unlink(ehci_iso_stream_t* stream)
+{
+  for(uint8_t k=0; k<FRAMES_AHEAD; k++) slot_unlink(stream, k);
+  stream->running = 0;
+}
+
+//------------- iTD -------------//
+// Transactions of a frame take up to xact_bytes each from consecutive buffer position. Later micro frames are
+// left inactive once all bytes are queued, but at least one transaction (zero length) is made
+static void itd_arm(ehci_iso_stream_t const* stream, ehci_itd_t* itd, uint8_t const* buffer, uint16_t total_bytes)
+{
+  uint32_t const base = iso_addr(buffer);
+
+  ehci_link_t const next = itd->next;
+  tu_memclr(itd, sizeof(ehci_itd_t));
+  itd->next = next;
+
+  // page list of slot, endpoint characteristics are kept in low bits of the first 3 pages
+  for(uint8_t p=0; p<7; p++) itd->BufferPointer[p] = (base & ~0xFFFUL) + 4096UL*p;
+
+  itd->BufferPointer[0] |= (((uint32_t) tu_edpt_number(stream->ep_addr)) << 8) | stream->dev_addr;
+  itd->BufferPointer[1] |= (tu_edpt_dir(stream->ep_addr) ? TU_BIT(11) : 0) | stream->max_packet_size;
+  itd->BufferPointer[2] |= stream->mult;
+
+  uint16_t remaining = total_bytes;
+  uint8_t  count     = 0;
+  uint8_t  last      = 0;
+
+  for(uint8_t u=0; u<8; u++)
+  {
+    if ( !(stream->smask & TU_BIT(u)) ) continue;
+
+    uint16_t const xact_len = tu_min16(remaining, stream->xact_bytes);
+    if ( xact_len == 0 && count ) break;
+
+    uint32_t const addr = base + (total_bytes - remaining);
+
+    itd->xact[u].offset      = addr & 0xFFFUL;
+    itd->xact[u].page_select = (addr >> 12) - (base >> 12);
+    itd->xact[u].length      = xact_len;
+    itd->xact[u].active      = 1;
+
+    remaining -= xact_len;
+    count++;
+    last = u;
+  }
+
+  itd->xact[last].int_on_complete = 1;
+}
+
+// Walk transactions the same way as itd_arm(). Data of short IN packet is followed by a gap in buffer,
+// received data is moved to be contiguous
+static uint16_t itd_complete(ehci_iso_stream_t const* stream, ehci_itd_t* itd, uint8_t* buffer, uint16_t total_bytes, xfer_result_t* result)
+{
+  bool const is_in = tu_edpt_dir(stream->ep_addr);
+
+  uint16_t remaining = total_bytes;
+  uint16_t xferred   = 0;
+  uint8_t  count     = 0;
+
+  *result = XFER_RESULT_SUCCESS;
+
+  for(uint8_t u=0; u<8; u++)
+  {
+    if ( !(stream->smask & TU_BIT(u)) ) continue;
+
+    uint16_t const xact_len = tu_min16(remaining, stream->xact_bytes);
+    if ( xact_len == 0 && count ) break;
+
+    // transaction still active was missed by host controller
+    if ( itd->xact[u].active || itd->xact[u].error || itd->xact[u].babble_err || itd->xact[u].buffer_err )
+    {
+      *result = XFER_RESULT_FAILED;
+    }
+
+    uint16_t const offset = total_bytes - remaining;
+    uint16_t len = 0;
+
+    if ( !itd->xact[u].active ) len = is_in ? tu_min16(itd->xact[u].length, xact_len) : xact_len;
+
+    if ( is_in && len && (xferred != offset) ) memmove(buffer + xferred, buffer + offset, len);
+
+    xferred   += len;
+    remaining -= xact_len;
+    count++;
+  }
+
+  return xferred;
+}
+
+//------------- siTD -------------//
+static void sitd_arm(ehci_iso_stream_t const* stream, ehci_sitd_t* sitd, uint8_t const* buffer, uint16_t total_bytes)
+{
+  uint32_t const addr  = iso_addr(buffer);
+  bool     const is_in = tu_edpt_dir(stream->ep_addr);
+
+  ehci_link_t const next = sitd->next;
+  tu_memclr(sitd, sizeof(ehci_sitd_t));
+  sitd->next = next;
+
+  sitd->dev_addr     = stream->dev_addr;
+  sitd->ep_number    = tu_edpt_number(stream->ep_addr);
+  sitd->hub_addr     = stream->hub_addr;
+  sitd->port_number  = stream->hub_port;
+  sitd->direction    = is_in ? 1 : 0;
+
+  sitd->int_smask    = stream->smask;
+  sitd->fl_int_cmask = stream->cmask;
+
+  sitd->total_bytes     = total_bytes;
+  sitd->int_on_complete = 1;
+
+  sitd->buffer[0] = addr;
+  sitd->buffer[1] = (addr & ~0xFFFUL) + 4096;
+
+  // OUT data is split into start splits of up to 188 bytes
+  if ( !is_in )
+  {
+    uint8_t const tcount = (uint8_t) tu_max16(1, (total_bytes + EHCI_ISO_SPLIT_BYTES - 1) / EHCI_ISO_SPLIT_BYTES);
+    sitd->buffer[1] |= ((tcount > 1 ? SITD_TP_BEGIN : SITD_TP_ALL) << 3) | tcount;
+  }
+
+  sitd->back.terminate = 1;
+  sitd->active         = 1;
+}
+
+static uint16_t sitd_complete(ehci_sitd_t const* sitd, uint16_t total_bytes, xfer_result_t* result)
+{
+  bool const failed = sitd->active || sitd->error || sitd->babble_err || sitd->buffer_err ||
+                      sitd->xact_err || sitd->missed_uframe;
+
+  *result = failed ? XFER_RESULT_FAILED : XFER_RESULT_SUCCESS;
+
+  // host controller counts down total bytes as data is moved
+  return sitd->active ? 0 : (uint16_t) (total_bytes - sitd->total_bytes);
+}
+
+static void slot_arm(ehci_iso_stream_t* stream, uint8_t slot, uint16_t total_bytes)
+{
+  stream->length[slot] = total_bytes;
+
+  if ( stream->is_highspeed )
+  {
+    itd_arm(stream, &stream->itd[slot], slot_buffer(stream, slot), total_bytes);
+  }else
+  {
+    sitd_arm(stream, &stream->sitd[slot], slot_buffer(stream, slot), total_bytes);
+  }
+}
+
+//--------------------------------------------------------------------+
+// API
+//--------------------------------------------------------------------+
+void ehci_iso_init(ehci_link_t* framelist)
+{
+  tu_memclr(_iso_stream, sizeof(_iso_stream));
+  _framelist = framelist;
+}
+
+ehci_iso_stream_t* ehci_iso_open(uint8_t dev_addr, tusb_speed_t speed, uint8_t hub_addr, uint8_t hub_port, tusb_desc_endpoint_t const * ep_desc)
+{
+  TU_ASSERT(ep_desc->bmAttributes.xfer == TUSB_XFER_ISOCHRONOUS, NULL);
+  TU_ASSERT(ehci_iso_find(dev_addr, ep_desc->bEndpointAddress) == NULL, NULL);
+
+  ehci_iso_stream_t* stream = NULL;
+  for(uint8_t i=0; i<CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    if ( !_iso_stream[i].opened )
+    {
+      stream = &_iso_stream[i];
+      break;
+    }
+  }
+  TU_ASSERT(stream, NULL);
+
+  uint8_t  const interval = ep_desc->bInterval;
+  uint16_t const size     = ep_desc->wMaxPacketSize.size;
+
+  if ( speed == TUSB_SPEED_HIGH )
+  {
+    // longer interval than a frame would need descriptor per polled frame only, not supported
+    TU_ASSERT(1 <= interval && interval <= 4, NULL);
+    TU_ASSERT(ep_desc->wMaxPacketSize.hs_period_mult < 3, NULL);
+
+    tu_memclr(stream, sizeof(ehci_iso_stream_t));
+    stream->is_highspeed = 1;
+    stream->mult         = ep_desc->wMaxPacketSize.hs_period_mult + 1;
+    stream->xact_bytes   = size * stream->mult;
+    stream->smask        = (interval == 1) ? TU_BIN8(11111111) :
+                           (interval == 2) ? TU_BIN8(01010101) :
+                           (interval == 3) ? TU_BIN8(00010001) : TU_BIN8(00000001);
+  }else
+  {
+    TU_ASSERT(speed == TUSB_SPEED_FULL && interval == 1 && size <= 1023, NULL);
+
+    uint8_t const splits = (uint8_t) tu_max16(1, (size + EHCI_ISO_SPLIT_BYTES - 1) / EHCI_ISO_SPLIT_BYTES);
+
+    tu_memclr(stream, sizeof(ehci_iso_stream_t));
+    stream->mult       = 1;
+    stream->xact_bytes = size;
+
+    // section 4.12.3: OUT start splits in consecutive micro frames from 0. IN start split at 0 then complete
+    // splits from 2 until data is done plus one, must end within frame since back pointer is not used
+    if ( tu_edpt_dir(ep_desc->bEndpointAddress) )
+    {
+      TU_ASSERT(splits <= 4, NULL);
+      stream->smask = 0x01;
+      stream->cmask = (uint8_t) ((TU_BIT(splits+2) - 1) << 2);
+    }else
+    {
+      stream->smask = (uint8_t) (TU_BIT(splits) - 1);
+    }
+  }
+
+  stream->max_packet_size = size;
+  stream->dev_addr        = dev_addr;
+  stream->ep_addr         = ep_desc->bEndpointAddress;
+  stream->hub_addr        = hub_addr;
+  stream->hub_port        = hub_port;
+  stream->opened          = 1;
+
+  return stream;
+}
+
+void ehci_iso_close(ehci_iso_stream_t* stream)
+{
+  if ( stream->running ) slots_unlink(stream);
+  stream->opened = 0;
+}
+
+ehci_iso_stream_t* ehci_iso_find(uint8_t dev_addr, uint8_t ep_addr)
+{
+  for(uint8_t i=0; i<CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    ehci_iso_stream_t* stream = &_iso_stream[i];
+    if ( stream->opened && !stream->closing && stream->dev_addr == dev_addr && stream->ep_addr == ep_addr ) return stream;
+  }
+
+  return NULL;
+}
+
+ehci_iso_stream_t* ehci_iso_get(uint8_t idx)
+{
+  return (idx < CFG_TUH_ISO_STREAM_MAX && _iso_stream[idx].opened) ? &_iso_stream[idx] : NULL;
+}
+
+bool ehci_iso_start(ehci_iso_stream_t* stream, uint8_t* buffer, uint16_t slot_size, hcd_iso_cb_t cb, uint32_t frame_number)
+{
+  TU_ASSERT(stream->opened && !stream->closing && !stream->running && buffer && cb);
+  TU_VERIFY(ehci_iso_unlinked(stream, frame_number));
+
+  // one frame of high speed endpoint has transaction in each micro frame of smask
+  uint8_t xacts = 0;
+  for(uint8_t u=0; u<8; u++) xacts += (stream->smask >> u) & 1;
+
+  TU_ASSERT(slot_size <= (stream->is_highspeed ? xacts*stream->xact_bytes : stream->xact_bytes));
+
+  stream->buffer    = buffer;
+  stream->slot_size = slot_size;
+  stream->cb        = cb;
+  stream->head      = 0;
+
+  // current frame could be already under execution, start from the one after next
+  for(uint8_t k=0; k<FRAMES_AHEAD; k++) stream->frame[k] = frame_number + 2 + k;
+  stream->next_frame = frame_number + 2 + FRAMES_AHEAD;
+
+  for(uint8_t k=0; k<FRAMES_AHEAD; k++)
+  {
+    slot_arm(stream, k, slot_size);
+    slot_link(stream, k);
+  }
+
+  stream->running = 1;
+  stream->stopped = 0;
+
+  return true;
+}
+
+void ehci_iso_stop(ehci_iso_stream_t* stream, uint32_t frame_number)
+{
+  if ( !stream->running ) return;
+
+  slots_unlink(stream);
+
+  stream->stopped    = 1;
+  stream->stop_frame = frame_number;
+}
+
+void ehci_iso_isr(uint32_t frame_number)
+{
+  for(uint8_t i=0; i<CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    ehci_iso_stream_t* stream = &_iso_stream[i];
+    if ( !stream->running ) continue;
+
+    // slots are queued in order, frame passed means all its micro frames are done
+    while ( (int32_t) (frame_number - stream->frame[stream->head]) > 0 )
+    {
+      uint8_t  const slot   = stream->head;
+      uint8_t* const buffer = slot_buffer(stream, slot);
+
+      slot_unlink(stream, slot);
+
+      xfer_result_t result;
+      uint16_t const xferred = stream->is_highspeed ?
+          itd_complete(stream, &stream->itd[slot], buffer, stream->length[slot], &result) :
+          sitd_complete(&stream->sitd[slot], stream->length[slot], &result);
+
+      uint16_t const next_len = tu_min16(stream->cb(stream->dev_addr, stream->ep_addr, buffer, xferred, result), stream->slot_size);
+
+      // re-arm after the last queued frame, skip ahead if interrupt is serviced too late for it
+      uint32_t frame = stream->next_frame;
+      if ( (int32_t) (frame - frame_number) < 2 ) frame = frame_number + 2;
+
+      stream->next_frame  = frame + 1;
+      stream->frame[slot] = frame;
+
+      slot_arm(stream, slot, next_len);
+      slot_link(stream, slot);
+
+      stream->head = (uint8_t) ((slot + 1) % FRAMES_AHEAD);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+/** \ingroup Group_HCD
+ * @{
+ *  \defgroup EHCI_ISO
+ *  \brief Isochronous streams of EHCI periodic schedule. High speed endpoint uses iTD, full speed endpoint behind
+ *  a high speed hub uses siTD. Each stream owns a ring of CFG_TUH_ISO_FRAMES_AHEAD descriptors, one per frame,
+ *  linked at the head of frame list entries before interrupt queue heads. Completed descriptor is reported and
+ *  re-armed for the frame CFG_TUH_ISO_FRAMES_AHEAD later from the periodic interrupt.
+ *
+ *  Only touches frame list and its own descriptors, so that it is testable without host controller.
+ *  @{ */
+
+#ifndef _TUSB_EHCI_ISO_H_
+#define _TUSB_EHCI_ISO_H_
+
+#include "common/tusb_common.h"
+#include "ehci.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Max number of isochronous endpoints opened at the same time
+#ifndef CFG_TUH_ISO_STREAM_MAX
+#define CFG_TUH_ISO_STREAM_MAX      2
+#endif
+
+// Number of frames queued ahead for each stream, also number of buffer slots
+#ifndef CFG_TUH_ISO_FRAMES_AHEAD
+#define CFG_TUH_ISO_FRAMES_AHEAD    8
+#endif
+
+// queued frames plus re-arm margin must not wrap around frame list
+TU_VERIFY_STATIC(CFG_TUH_ISO_FRAMES_AHEAD + 4 <= EHCI_FRAMELIST_SIZE, "frame list is too small for iso frames ahead");
+
+// Full speed split transaction moves at most 188 bytes per micro frame (USB 2.0 section 11.18.4)
+enum { EHCI_ISO_SPLIT_BYTES = 188 };
+
+//--------------------------------------------------------------------+
+// Stream
+//--------------------------------------------------------------------+
+typedef struct TU_ATTR_ALIGNED(32)
+{
+  // one descriptor per slot, type depends on endpoint speed
+  union {
+    ehci_itd_t  itd [CFG_TUH_ISO_FRAMES_AHEAD];
+    ehci_sitd_t sitd[CFG_TUH_ISO_FRAMES_AHEAD];
+  };
+
+  uint32_t frame [CFG_TUH_ISO_FRAMES_AHEAD]; ///< frame number slot is queued for
+  uint16_t length[CFG_TUH_ISO_FRAMES_AHEAD]; ///< bytes queued for slot
+
+  uint8_t*     buffer;
+  hcd_iso_cb_t cb;
+  uint32_t     next_frame;  ///< frame number for the next slot to be armed
+  uint16_t     slot_size;
+
+  uint16_t max_packet_size;
+  uint16_t xact_bytes;      ///< max bytes of a micro frame: max packet size * mult (high speed), max packet size (split)
+  uint8_t  mult;            ///< high speed transactions per micro frame
+
+  uint8_t  dev_addr;
+  uint8_t  ep_addr;
+  uint8_t  hub_addr;
+  uint8_t  hub_port;
+  uint8_t  is_highspeed;
+
+  uint8_t  smask;           ///< micro frames having transaction (high speed) or start split
+  uint8_t  cmask;           ///< micro frames having complete split
+
+  uint8_t  head;            ///< slot completing next
+  uint8_t  opened;
+  uint8_t  running;
+  uint8_t  stopped;         ///< descriptors may still be executed by host controller in stop_frame
+  uint8_t  closing;         ///< device is closed, stream is released once stop_frame is over
+
+  uint32_t stop_frame;      ///< frame number in which slots are unlinked
+} ehci_iso_stream_t;
+
+//--------------------------------------------------------------------+
+// API
+//--------------------------------------------------------------------+
+void ehci_iso_init(ehci_link_t* framelist);
+
+/// Allocate stream for endpoint and compute its micro frame masks, bandwidth is reserved by caller.
+/// Supported interval: bInterval 1-4 (high speed) and 1 (full speed), transfer is done every frame
+ehci_iso_stream_t* ehci_iso_open(uint8_t dev_addr, tusb_speed_t speed, uint8_t hub_addr, uint8_t hub_port, tusb_desc_endpoint_t const * ep_desc);
+
+/// Release stream, its descriptors must not be used by host controller anymore (see ehci_iso_stop())
+void ehci_iso_close(ehci_iso_stream_t* stream);
+
+/// Opened stream of endpoint, NULL if not found or closing
+ehci_iso_stream_t* ehci_iso_find(uint8_t dev_addr, uint8_t ep_addr);
+
+/// Stream by index to iterate all streams, NULL if not opened
+ehci_iso_stream_t* ehci_iso_get(uint8_t idx);
+
+/// Queue all slots starting 2 frames after current frame. Return false if stream is stopped in this frame or
+/// the previous one since its descriptors may still be executed by host controller
+bool ehci_iso_start(ehci_iso_stream_t* stream, uint8_t* buffer, uint16_t slot_size, hcd_iso_cb_t cb, uint32_t frame_number);
+
+/// Unlink all slots in frame_number, descriptor of that frame may still be executed by host controller
+void ehci_iso_stop(ehci_iso_stream_t* stream, uint32_t frame_number);
+
+/// True if stream is not stopped or its descriptors are no longer reachable by host controller
+static inline bool ehci_iso_unlinked(ehci_iso_stream_t const* stream, uint32_t frame_number)
+{
+  // stop frame may be under execution, host controller fetches next frame from frame list
+  return !stream->stopped || (int32_t) (frame_number - stream->stop_frame) >= 2;
+}
+
+/// Report and re-arm all slots of frames already passed, called in periodic interrupt
+void ehci_iso_isr(uint32_t frame_number);
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_EHCI_ISO_H_ */
+
+/** @} */
+/** @} */
@@ -51,6 +51,7 @@ typedef struct
 {
   uint8_t rhport;
   uint8_t event_id;
+  uint8_t dev_addr;
 
   union
   {
@@ -70,17 +71,52 @@ typedef struct
 
 } hcd_event_t;
 
+// Isochronous stream frame completion, invoked in ISR with the frame's slot of stream buffer. Return number of bytes
+// of this slot for the frame it is re-armed for (OUT: data written into buffer, IN: bytes to receive, up to slot size)
+typedef uint16_t (*hcd_iso_cb_t)(uint8_t dev_addr, uint8_t ep_addr, uint8_t* buffer, uint16_t xferred_bytes, xfer_result_t result);
+
 #if TUSB_OPT_HOST_ENABLED
-// Max number of endpoints per device
+// Bytes a transfer descriptor covers at any buffer alignment, cut at packet boundary.
+// OHCI TD spans 2 pages from buffer offset, EHCI qTD spans 5 pages from buffer offset
+#if CFG_TUSB_MCU == OPT_MCU_LPC175X_6X || CFG_TUSB_MCU == OPT_MCU_LPC40XX
+  #define HCD_TD_MIN_BYTES   4096
+#else
+  #define HCD_TD_MIN_BYTES   16384
+#endif
+
+// Transfer descriptors chained for a transfer of _len bytes
+#define HCD_XFER_TD_COUNT(_len)   (((_len) + HCD_TD_MIN_BYTES - 1) / HCD_TD_MIN_BYTES)
+
+// Pools can be enlarged e.g for devices having several interfaces of a class
+#ifndef CFG_TUH_ENDPOINT_MAX
+  #define CFG_TUH_ENDPOINT_MAX   HCD_REQUIRED_ENDPOINT
+#endif
+
+#ifndef CFG_TUH_XFER_MAX
+  #define CFG_TUH_XFER_MAX       HCD_REQUIRED_XFER
+#endif
+
+// Endpoints and transfer descriptors queued at once by enabled class drivers. Network adapter is mounted one at a
+// time, other classes per device. Vendor transfers are counted as one descriptor each.
 enum {
-  HCD_MAX_ENDPOINT = CFG_TUSB_HOST_DEVICE_MAX*(CFG_TUH_HUB + CFG_TUH_HID_KEYBOARD + CFG_TUH_HID_MOUSE + CFG_TUSB_HOST_HID_GENERIC +
-                     CFG_TUH_MSC*2 + CFG_TUH_CDC*3),
+  HCD_HID_XFER_PER_EP = CFG_TUH_HID_RING ? CFG_TUH_HID_RING_ARMED : 1,
+  HCD_NET_XFER        = CFG_TUH_NET_RX_BUFS*HCD_XFER_TD_COUNT(CFG_TUH_NET_RX_BUFSIZE) +
+                        CFG_TUH_NET_TX_BUFS*(HCD_XFER_TD_COUNT(CFG_TUH_NET_TX_BUFSIZE) + 1) + 1, // data + ZLP, notification
+
+  HCD_REQUIRED_ENDPOINT = CFG_TUSB_HOST_DEVICE_MAX*(CFG_TUH_HUB + HOST_CLASS_HID + CFG_TUH_MSC*2 + CFG_TUH_CDC*3 +
+                                                    CFG_TUH_VENDOR*2) + CFG_TUH_NET*3,
 
-  HCD_MAX_XFER     = HCD_MAX_ENDPOINT*2,
+  HCD_REQUIRED_XFER     = CFG_TUSB_HOST_DEVICE_MAX*(CFG_TUH_HUB + HOST_CLASS_HID*HCD_HID_XFER_PER_EP +
+                                                    CFG_TUH_MSC*HCD_XFER_TD_COUNT(CFG_TUH_MSC_XFER_CHUNK_SIZE) +
+                                                    CFG_TUH_CDC*3 + CFG_TUH_VENDOR*CFG_TUH_VENDOR_XFER_MAX) +
+                          CFG_TUH_NET*HCD_NET_XFER,
+
+  HCD_MAX_ENDPOINT = CFG_TUH_ENDPOINT_MAX,
+  HCD_MAX_XFER     = CFG_TUH_XFER_MAX
 };
 
-//#define HCD_MAX_ENDPOINT 16
-//#define HCD_MAX_XFER 16
+TU_VERIFY_STATIC(CFG_TUH_ENDPOINT_MAX >= HCD_REQUIRED_ENDPOINT, "endpoint pool is too small for enabled classes");
+TU_VERIFY_STATIC(CFG_TUH_XFER_MAX     >= HCD_REQUIRED_XFER    , "transfer descriptor pool is too small for enabled classes");
 #endif
 
 //--------------------------------------------------------------------+
@@ -97,6 +133,10 @@ bool hcd_port_connect_status(uint8_t hostid);
 void hcd_port_reset(uint8_t hostid);
 tusb_speed_t hcd_port_speed_get(uint8_t hostid);
 
+// Get frame number (1ms), used by usbh to time port reset and other delays without blocking.
+// Must be called at least once per hardware counter rollover for the value to stay continuous
+uint32_t hcd_frame_number(uint8_t rhport);
+
 // HCD closes all opened endpoints belong to this device
 void hcd_device_close(uint8_t rhport, uint8_t dev_addr);
 
@@ -131,8 +171,17 @@ bool hcd_edpt_xfer(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t *
 // PIPE API
 //--------------------------------------------------------------------+
 // TODO control xfer should be used via usbh layer
-bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes); // only queue, not transferring yet
-bool hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes, bool int_on_complete);
+bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes); // only queue, not transferring yet
+bool hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes, bool int_on_complete);
+
+//--------------------------------------------------------------------+
+// ISOCHRONOUS STREAM API (CFG_TUH_ISO)
+//--------------------------------------------------------------------+
+// Endpoint is opened with hcd_edpt_open(). Buffer holds CFG_TUH_ISO_FRAMES_AHEAD slots of slot_size bytes, each slot
+// is queued for one frame (OUT: filled with slot_size bytes). Completed slot is reported by callback and re-armed.
+// Stream stopped less than 2 frames ago cannot be started yet since host controller may still use its descriptors
+bool hcd_iso_start(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t* buffer, uint16_t slot_size, hcd_iso_cb_t cb);
+void hcd_iso_stop (uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr);
 
 #if 0
 tusb_error_t hcd_pipe_cancel();
@@ -36,28 +36,47 @@
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
 //--------------------------------------------------------------------+
+// Port changes are driven by the status change endpoint: every port flagged in a report is queued in port_change
+// and handled one after another on the hub control pipe (get status, clear each change, act) before the status
+// endpoint is polled again. Port reset requested by enumeration takes priority and its completion is detected
+// from C_PORT_RESET reported by the same endpoint.
+enum { HUB_PORT_MAX = 31 }; // bit 0 of status change bitmap is the hub itself
+
 typedef struct
 {
   uint8_t itf_num;
   uint8_t ep_status;
-  uint8_t port_number;
-  uint8_t status_change; // data from status change interrupt endpoint
+  uint8_t port_count;
+
+  bool    busy;          // control pipe is used by configuration or port handling
+  bool    status_queued; // status endpoint transfer is pending
+  uint8_t reset_port;    // port to reset requested by enumeration, 0 if none
+  uint8_t port;          // port being handled, ports powered so far while configuring
+  uint8_t change_left;   // change bits of port being handled not acknowledged yet
+
+  uint32_t port_change;  // ports reported by status endpoint, not handled yet
+  uint32_t port_attach;  // ports connected, waiting for enumeration
+
+  uint8_t status_change[4]; // data from status change interrupt endpoint
+  hub_port_status_response_t port_status;
 }usbh_hub_t;
 
 CFG_TUSB_MEM_SECTION static usbh_hub_t hub_data[CFG_TUSB_HOST_DEVICE_MAX];
-TU_ATTR_ALIGNED(4) CFG_TUSB_MEM_SECTION static uint8_t hub_enum_buffer[sizeof(descriptor_hub_desc_t)];
+// hub descriptor read at mount, hubs of each roothub port may be mounted concurrently
+TU_ATTR_ALIGNED(4) CFG_TUSB_MEM_SECTION static uint8_t hub_enum_buffer[CFG_TUSB_HOST_DEVICE_MAX][sizeof(descriptor_hub_desc_t)];
 
-//OSAL_SEM_DEF(hub_enum_semaphore);
-//static osal_semaphore_handle_t hub_enum_sem_hdl;
+static void hub_next(uint8_t dev_addr);
+static bool config_get_hub_desc_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+static bool config_port_power_complete  (uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
 
 //--------------------------------------------------------------------+
 // HUB
 //--------------------------------------------------------------------+
-bool hub_port_clear_feature_subtask(uint8_t hub_addr, uint8_t hub_port, uint8_t feature)
+bool hub_port_clear_feature(uint8_t hub_addr, uint8_t hub_port, uint8_t feature, tuh_control_complete_cb_t complete_cb)
 {
   TU_ASSERT(HUB_FEATURE_PORT_CONNECTION_CHANGE <= feature && feature <= HUB_FEATURE_PORT_RESET_CHANGE);
 
-  tusb_control_request_t request = {
+  tusb_control_request_t const request = {
           .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
           .bRequest = HUB_REQUEST_CLEAR_FEATURE,
           .wValue = feature,
@@ -65,35 +84,12 @@ bool hub_port_clear_feature_subtask(uint8_t hub_addr, uint8_t hub_port, uint8_t
           .wLength = 0
   };
 
-  //------------- Clear Port Feature request -------------//
-  TU_ASSERT( usbh_control_xfer( hub_addr, &request, NULL ) );
-
-  //------------- Get Port Status to check if feature is cleared -------------//
-  request = (tusb_control_request_t ) {
-        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
-        .bRequest = HUB_REQUEST_GET_STATUS,
-        .wValue = 0,
-        .wIndex = hub_port,
-        .wLength = 4
-  };
-
-  TU_ASSERT( usbh_control_xfer( hub_addr, &request, hub_enum_buffer ) );
-
-  //------------- Check if feature is cleared -------------//
-  hub_port_status_response_t * p_port_status;
-  p_port_status = (hub_port_status_response_t *) hub_enum_buffer;
-
-  TU_ASSERT( !tu_bit_test(p_port_status->status_change.value, feature-16)  );
-
-  return true;
+  return tuh_control_xfer_async( hub_addr, &request, NULL, complete_cb, NULL );
 }
 
-bool hub_port_reset_subtask(uint8_t hub_addr, uint8_t hub_port)
+bool hub_port_reset(uint8_t hub_addr, uint8_t hub_port, tuh_control_complete_cb_t complete_cb)
 {
-  enum { RESET_DELAY = 200 }; // USB specs say only 50ms but many devices require much longer
-
-  //------------- Set Port Reset -------------//
-  tusb_control_request_t request = {
+  tusb_control_request_t const request = {
           .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
           .bRequest = HUB_REQUEST_SET_FEATURE,
           .wValue = HUB_FEATURE_PORT_RESET,
@@ -101,12 +97,13 @@ bool hub_port_reset_subtask(uint8_t hub_addr, uint8_t hub_port)
           .wLength = 0
   };
 
-  TU_ASSERT( usbh_control_xfer( hub_addr, &request, NULL ) );
-
-  osal_task_delay(RESET_DELAY); // TODO Hub wait for Status Endpoint on Reset Change
+  return tuh_control_xfer_async( hub_addr, &request, NULL, complete_cb, NULL );
+}
 
-  //------------- Get Port Status to check if port is enabled, powered and reset_change -------------//
-  request = (tusb_control_request_t ) {
+// resp must be able to hold hub_port_status_response_t and remain valid until complete_cb is invoked
+bool hub_port_get_status(uint8_t hub_addr, uint8_t hub_port, void* resp, tuh_control_complete_cb_t complete_cb)
+{
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
         .bRequest = HUB_REQUEST_GET_STATUS,
         .wValue = 0,
@@ -114,23 +111,13 @@ bool hub_port_reset_subtask(uint8_t hub_addr, uint8_t hub_port)
         .wLength = 4
   };
 
-  TU_ASSERT( usbh_control_xfer( hub_addr, &request, hub_enum_buffer ) );
-
-  hub_port_status_response_t * p_port_status;
-  p_port_status = (hub_port_status_response_t *) hub_enum_buffer;
-
-  TU_ASSERT ( p_port_status->status_change.reset && p_port_status->status_current.connect_status &&
-              p_port_status->status_current.port_power && p_port_status->status_current.port_enable);
-
-  return true;
+  return tuh_control_xfer_async( hub_addr, &request, resp, complete_cb, NULL );
 }
 
-// can only get the speed RIGHT AFTER hub_port_reset_subtask call
-tusb_speed_t hub_port_get_speed(void)
+tusb_speed_t hub_port_get_speed(hub_port_status_response_t const * port_status)
 {
-  hub_port_status_response_t * p_port_status = (hub_port_status_response_t *) hub_enum_buffer;
-  return (p_port_status->status_current.high_speed_device_attached) ? TUSB_SPEED_HIGH :
-         (p_port_status->status_current.low_speed_device_attached ) ? TUSB_SPEED_LOW  : TUSB_SPEED_FULL;
+  return (port_status->status_current.high_speed_device_attached) ? TUSB_SPEED_HIGH :
+         (port_status->status_current.low_speed_device_attached ) ? TUSB_SPEED_LOW  : TUSB_SPEED_FULL;
 }
 
 //--------------------------------------------------------------------+
@@ -139,7 +126,6 @@ tusb_speed_t hub_port_get_speed(void)
 void hub_init(void)
 {
   tu_memclr(hub_data, CFG_TUSB_HOST_DEVICE_MAX*sizeof(usbh_hub_t));
-//  hub_enum_sem_hdl = osal_semaphore_create( OSAL_SEM_REF(hub_enum_semaphore) );
 }
 
 bool hub_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf_desc, uint16_t *p_length)
@@ -162,7 +148,8 @@ bool hub_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf
   (*p_length) = sizeof(tusb_desc_interface_t) + sizeof(tusb_desc_endpoint_t);
 
   //------------- Get Hub Descriptor -------------//
-  tusb_control_request_t request = {
+  // ports are powered from its completion, control pipe is used until then
+  tusb_control_request_t const request = {
           .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
           .bRequest = HUB_REQUEST_GET_DESCRIPTOR,
           .wValue = 0,
@@ -170,81 +157,277 @@ bool hub_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const *itf
           .wLength = sizeof(descriptor_hub_desc_t)
   };
 
-  TU_ASSERT( usbh_control_xfer( dev_addr, &request, hub_enum_buffer ) );
+  TU_ASSERT( tuh_control_xfer_async( dev_addr, &request, hub_enum_buffer[dev_addr-1], config_get_hub_desc_complete, NULL ) );
+  hub_data[dev_addr-1].busy = true;
 
-  // only care about this field in hub descriptor
-  hub_data[dev_addr-1].port_number = ((descriptor_hub_desc_t*) hub_enum_buffer)->bNbrPorts;
+  return true;
+}
 
-  //------------- Set Port_Power on all ports -------------//
-  // TODO may only power port with attached
-  request = (tusb_control_request_t ) {
-          .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
-          .bRequest = HUB_REQUEST_SET_FEATURE,
-          .wValue = HUB_FEATURE_PORT_POWER,
-          .wIndex = 0,
-          .wLength = 0
-  };
+// Set Port_Power on ports one after another, status endpoint is polled once all of them are powered
+static bool config_port_power_next(uint8_t dev_addr)
+{
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
 
-  for(uint8_t i=1; i <= hub_data[dev_addr-1].port_number; i++)
+  if ( p_hub->port < p_hub->port_count )
   {
-    request.wIndex = i;
-    TU_ASSERT( usbh_control_xfer( dev_addr, &request, NULL ) );
+    // TODO may only power port with attached
+    tusb_control_request_t const request = {
+            .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_OUT },
+            .bRequest = HUB_REQUEST_SET_FEATURE,
+            .wValue = HUB_FEATURE_PORT_POWER,
+            .wIndex = (uint16_t) (p_hub->port + 1),
+            .wLength = 0
+    };
+
+    TU_ASSERT( tuh_control_xfer_async( dev_addr, &request, NULL, config_port_power_complete, NULL ) );
+    p_hub->port++;
+    return true;
   }
 
   //------------- Queue the initial Status endpoint transfer -------------//
-  TU_ASSERT( hcd_pipe_xfer(dev_addr, hub_data[dev_addr-1].ep_status, &hub_data[dev_addr-1].status_change, 1, true) );
+  p_hub->port = 0;
+  p_hub->busy = false;
+  hub_next(dev_addr);
 
   return true;
 }
 
+static bool config_get_hub_desc_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  // hub stays idle without ports
+  TU_ASSERT(XFER_RESULT_SUCCESS == result);
+
+  // only care about this field in hub descriptor, ports beyond status bitmap are not used
+  hub_data[dev_addr-1].port_count = tu_min8(((descriptor_hub_desc_t*) hub_enum_buffer[dev_addr-1])->bNbrPorts, HUB_PORT_MAX);
+  hub_data[dev_addr-1].port       = 0;
+
+  return config_port_power_next(dev_addr);
+}
+
+static bool config_port_power_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  TU_ASSERT(XFER_RESULT_SUCCESS == result);
+
+  return config_port_power_next(dev_addr);
+}
+
 // is the response of interrupt endpoint polling
 #include "usbh_hcd.h" // FIXME remove
-void hub_isr(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+void hub_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
 {
-  (void) xferred_bytes; // TODO can be more than 1 for hub with lots of ports
   (void) ep_addr;
 
   usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+  p_hub->status_queued = false;
 
   if ( event == XFER_RESULT_SUCCESS )
   {
-    for (uint8_t port=1; port <= p_hub->port_number; port++)
+    // queue all changed ports of the bitmap, they are handled in a single pass before next polling
+    // TODO HUB ignore bit0 hub_status_change
+    for (uint8_t port=1; port <= p_hub->port_count; port++)
     {
-      // TODO HUB ignore bit0 hub_status_change
-      if ( tu_bit_test(p_hub->status_change, port) )
+      if ( (port / 8u) < xferred_bytes && tu_bit_test(p_hub->status_change[port / 8u], port % 8u) )
       {
-        hcd_event_t event =
-        {
-          .rhport = _usbh_devices[dev_addr].rhport,
-          .event_id = HCD_EVENT_DEVICE_ATTACH
-        };
-
-        event.attach.hub_addr = dev_addr;
-        event.attach.hub_port = port;
-
-        hcd_event_handler(&event, true);
-        break; // handle one port at a time, next port if any will be handled in the next cycle
+        p_hub->port_change |= TU_BIT(port);
       }
     }
-    // NOTE: next status transfer is queued by usbh.c after handling this request
+
+    hub_next(dev_addr);
   }
   else
   {
     // TODO [HUB] check if hub is still plugged before polling status endpoint since failed usually mean hub unplugged
-//    TU_ASSERT ( hub_status_pipe_queue(dev_addr) );
   }
 }
 
 void hub_close(uint8_t dev_addr)
 {
   tu_memclr(&hub_data[dev_addr-1], sizeof(usbh_hub_t));
-//  osal_semaphore_reset(hub_enum_sem_hdl);
 }
 
 bool hub_status_pipe_queue(uint8_t dev_addr)
 {
-  return hcd_pipe_xfer(dev_addr, hub_data[dev_addr-1].ep_status, &hub_data[dev_addr-1].status_change, 1, true);
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+
+  // one bit per port plus bit 0 for hub
+  uint8_t const len = (uint8_t) (p_hub->port_count / 8u + 1u);
+  return hcd_pipe_xfer(dev_addr, p_hub->ep_status, p_hub->status_change, len, true);
+}
+
+//--------------------------------------------------------------------+
+// PORT HANDLING
+//--------------------------------------------------------------------+
+static bool port_status_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+static bool port_clear_complete (uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+static bool port_reset_complete (uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+
+// Start next pending work on hub control pipe: reset requested by enumeration, then changed ports.
+// Status endpoint is polled again when there is nothing left.
+static void hub_next(uint8_t dev_addr)
+{
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+
+  if ( p_hub->busy ) return;
+
+  if ( p_hub->reset_port )
+  {
+    p_hub->port       = p_hub->reset_port;
+    p_hub->reset_port = 0;
+    p_hub->busy       = hub_port_reset(dev_addr, p_hub->port, port_reset_complete);
+  }
+  else if ( p_hub->port_change )
+  {
+    uint8_t port = 1;
+    while ( !tu_bit_test(p_hub->port_change, port) ) port++;
+
+    p_hub->port         = port;
+    p_hub->port_change &= ~TU_BIT(port);
+    p_hub->busy         = hub_port_get_status(dev_addr, port, &p_hub->port_status, port_status_complete);
+  }
+  else if ( !p_hub->status_queued )
+  {
+    p_hub->status_queued = hub_status_pipe_queue(dev_addr);
+  }
 }
 
+// Act on port status once all its changes are acknowledged
+static void port_act(uint8_t dev_addr)
+{
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+  hub_port_status_response_t const * port_status = &p_hub->port_status;
+  uint8_t const port = p_hub->port;
+
+  if ( port_status->status_change.connect_status )
+  {
+    if ( port_status->status_current.connect_status )
+    {
+      // enumerated by usbh when it is idle, see hub_port_attach_next()
+      p_hub->port_attach |= TU_BIT(port);
+    }
+    else
+    {
+      p_hub->port_attach &= ~TU_BIT(port);
+
+      hcd_event_t event =
+      {
+        .rhport   = _usbh_devices[dev_addr].rhport,
+        .event_id = HCD_EVENT_DEVICE_REMOVE
+      };
+
+      event.attach.hub_addr = dev_addr;
+      event.attach.hub_port = port;
+
+      hcd_event_handler(&event, false);
+    }
+  }
+
+  if ( port_status->status_change.reset )
+  {
+    usbh_hub_port_reset_complete(dev_addr, port, hub_port_get_speed(port_status), port_status->status_current.port_enable);
+  }
+}
+
+// Acknowledge next change bit of the port, act on it when all are cleared
+static void port_clear_next(uint8_t dev_addr)
+{
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+
+  if ( p_hub->change_left )
+  {
+    uint8_t bit = 0;
+    while ( !tu_bit_test(p_hub->change_left, bit) ) bit++;
+    p_hub->change_left &= (uint8_t) ~TU_BIT(bit);
+
+    if ( hub_port_clear_feature(dev_addr, p_hub->port, HUB_FEATURE_PORT_CONNECTION_CHANGE + bit, port_clear_complete) ) return;
+  }
+  else
+  {
+    port_act(dev_addr);
+  }
+
+  p_hub->busy = false;
+  hub_next(dev_addr);
+}
+
+static bool port_status_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+
+  // C_PORT_CONNECTION to C_PORT_RESET
+  p_hub->change_left = (result == XFER_RESULT_SUCCESS) ? (uint8_t) (p_hub->port_status.status_change.value & 0x1Fu) : 0;
+  if ( result != XFER_RESULT_SUCCESS ) p_hub->port_status.status_change.value = 0;
+
+  port_clear_next(dev_addr);
+  return true;
+}
+
+static bool port_clear_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) result;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  port_clear_next(dev_addr);
+  return true;
+}
+
+static bool port_reset_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  usbh_hub_t * p_hub = &hub_data[dev_addr-1];
+  p_hub->busy = false;
+
+  // reset is signaled later by C_PORT_RESET on status endpoint
+  if ( result != XFER_RESULT_SUCCESS ) usbh_hub_port_reset_complete(dev_addr, p_hub->port, TUSB_SPEED_FULL, false);
+
+  hub_next(dev_addr);
+  return true;
+}
+
+bool hub_port_reset_start(uint8_t hub_addr, uint8_t hub_port)
+{
+  usbh_hub_t * p_hub = &hub_data[hub_addr-1];
+  TU_VERIFY(p_hub->ep_status && hub_port && hub_port <= p_hub->port_count);
+
+  p_hub->reset_port = hub_port;
+  hub_next(hub_addr);
+
+  return true;
+}
+
+bool hub_port_attach_next(uint8_t* hub_addr, uint8_t* hub_port)
+{
+  for (uint8_t addr = 1; addr <= CFG_TUSB_HOST_DEVICE_MAX; addr++)
+  {
+    usbh_hub_t * p_hub = &hub_data[addr-1];
+    if ( !p_hub->port_attach ) continue;
+
+    uint8_t port = 1;
+    while ( !tu_bit_test(p_hub->port_attach, port) ) port++;
+    p_hub->port_attach &= ~TU_BIT(port);
+
+    *hub_addr = addr;
+    *hub_port = port;
+    return true;
+  }
+
+  return false;
+}
 
 #endif
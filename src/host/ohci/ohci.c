@@ -137,6 +137,12 @@ static ohci_ed_t * const p_ed_head[] =
 static void ed_list_insert(ohci_ed_t * p_pre, ohci_ed_t * p_ed);
 static void ed_list_remove_by_addr(ohci_ed_t * p_head, uint8_t dev_addr);
 
+static inline ohci_ed_t* ed_alloc(void);
+static void ed_free(ohci_ed_t* p_ed);
+static inline ohci_gtd_t* gtd_alloc(void);
+static inline void gtd_free(ohci_gtd_t* p_gtd);
+static bool gtd_retire_1st_from_ed(ohci_ed_t* p_ed);
+
 //--------------------------------------------------------------------+
 // USBH-HCD API
 //--------------------------------------------------------------------+
@@ -145,6 +151,13 @@ bool hcd_init(void)
 {
   //------------- Data Structure init -------------//
   tu_memclr(&ohci_data, sizeof(ohci_data_t));
+
+  // all pool entries are free
+  for(uint8_t i=0; i<HCD_MAX_ENDPOINT; i++) ohci_data.free_list.ed[i]  = i;
+  for(uint8_t i=0; i<HCD_MAX_XFER; i++)     ohci_data.free_list.gtd[i] = i;
+  ohci_data.free_list.ed_count  = HCD_MAX_ENDPOINT;
+  ohci_data.free_list.gtd_count = HCD_MAX_XFER;
+
   for(uint8_t i=0; i<32; i++)
   { // assign all interrupt pointes to period head ed
     ohci_data.hcca.interrupt_table[i] = (uint32_t) &ohci_data.period_head_ed;
@@ -202,19 +215,32 @@ tusb_speed_t hcd_port_speed_get(uint8_t hostid)
   return OHCI_REG->rhport_status_bit[0].low_speed_device_attached ? TUSB_SPEED_LOW : TUSB_SPEED_FULL;
 }
 
-// endpoints are tied to an address, which only reclaim after a long delay when enumerating
-// thus there is no need to make sure ED is not in HC's cahed as it will not for sure
-void hcd_device_close(uint8_t rhport, uint8_t dev_addr)
+uint32_t hcd_frame_number(uint8_t rhport)
 {
-  // TODO OHCI
   (void) rhport;
 
+  // HcFmNumber is 16-bit, add the frame elapsed since last read
+  uint16_t const frame = (uint16_t) OHCI_REG->frame_number;
+  ohci_data.frame_number += (uint16_t) (frame - ohci_data.frame_number);
+
+  return ohci_data.frame_number;
+}
+
+// Removed EDs are skipped and unlinked, HC may still be processing them in current frame. They are freed with
+// their TDs on SOF of a later frame (5.2.7.1.2)
+void hcd_device_close(uint8_t rhport, uint8_t dev_addr)
+{
   // addr0 serves as static head --> only set skip bit
   if ( dev_addr == 0 )
   {
     ohci_data.control[0].ed.skip = 1;
   }else
   {
+    hcd_int_disable(rhport);
+
+    // Endpoints cannot be looked up anymore
+    tu_memclr(ohci_data.ep2ed[dev_addr-1], sizeof(ohci_data.ep2ed[0]));
+
     // remove control
     ed_list_remove_by_addr( p_ed_head[TUSB_XFER_CONTROL], dev_addr);
 
@@ -225,6 +251,14 @@ void hcd_device_close(uint8_t rhport, uint8_t dev_addr)
     ed_list_remove_by_addr(p_ed_head[TUSB_XFER_INTERRUPT], dev_addr);
 
     // TODO remove ISO
+
+    if ( ohci_data.ed_removing )
+    {
+      ohci_data.ed_removed_frame = hcd_frame_number(rhport);
+      OHCI_REG->interrupt_enable = OHCI_INT_SOF_MASK;
+    }
+
+    hcd_int_enable(rhport);
   }
 }
 
@@ -259,15 +293,28 @@ static void ed_init(ohci_ed_t *p_ed, uint8_t dev_addr, uint16_t max_packet_size,
   p_ed->is_iso            = (xfer_type == TUSB_XFER_ISOCHRONOUS) ? 1 : 0;
   p_ed->max_packet_size  = max_packet_size;
 
-  p_ed->used              = 1;
   p_ed->is_interrupt_xfer = (xfer_type == TUSB_XFER_INTERRUPT ? 1 : 0);
 }
 
+// TD buffer spans at most 2 pages (4.3.1.3.5), also limited by 13-bit expected_bytes
+static inline uint32_t gtd_max_bytes(uint32_t buffer)
+{
+  return TU_MIN(0x2000UL - tu_offset4k(buffer), 0x1FFFUL);
+}
+
+// Length of next TD in a chain, TD in the middle of a chain must end on packet boundary
+static inline uint32_t gtd_chain_len(uint32_t buffer, uint32_t remaining, uint16_t max_packet_size)
+{
+  uint32_t const max_bytes = gtd_max_bytes(buffer);
+  if ( remaining <= max_bytes ) return remaining;
+
+  return max_bytes - (max_bytes % max_packet_size);
+}
+
 static void gtd_init(ohci_gtd_t* p_td, void* data_ptr, uint16_t total_bytes)
 {
   tu_memclr(p_td, sizeof(ohci_gtd_t));
 
-  p_td->used                   = 1;
   p_td->expected_bytes         = total_bytes;
 
   p_td->buffer_rounding        = 1; // less than queued length is not a error
@@ -312,6 +359,9 @@ bool hcd_edpt_xfer(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t *
     ohci_ed_t* const p_ed = &ohci_data.control[dev_addr].ed;
     ohci_gtd_t *p_data  = &ohci_data.control[dev_addr].gtd;
 
+    // control data stage uses single TD
+    TU_ASSERT( buflen <= gtd_max_bytes((uint32_t) buffer) );
+
     gtd_init(p_data, buffer, buflen);
 
     p_data->index       = dev_addr;
@@ -332,32 +382,57 @@ bool hcd_edpt_xfer(uint8_t rhport, uint8_t dev_addr, uint8_t ep_addr, uint8_t *
 //--------------------------------------------------------------------+
 static inline ohci_ed_t * ed_from_addr(uint8_t dev_addr, uint8_t ep_addr)
 {
-  if ( tu_edpt_number(ep_addr) == 0 ) return &ohci_data.control[dev_addr].ed;
+  uint8_t const epnum = tu_edpt_number(ep_addr);
 
-  ohci_ed_t* ed_pool = ohci_data.ed_pool;
+  if ( epnum == 0 ) return &ohci_data.control[dev_addr].ed;
+  if ( dev_addr == 0 ) return NULL;
 
-  for(uint32_t i=0; i<HCD_MAX_ENDPOINT; i++)
-  {
-    if ( (ed_pool[i].dev_addr == dev_addr) &&
-          ep_addr == tu_edpt_addr(ed_pool[i].ep_number, ed_pool[i].pid == OHCI_PID_IN) )
-    {
-      return &ed_pool[i];
-    }
-  }
+  uint8_t const idx = ohci_data.ep2ed[dev_addr-1][2*epnum + tu_edpt_dir(ep_addr)];
+  return idx ? &ohci_data.ed_pool[idx-1] : NULL;
+}
 
-  return NULL;
+static inline bool ed_is_pool(ohci_ed_t const * const p_ed)
+{
+  return (ohci_data.ed_pool <= p_ed) && (p_ed < ohci_data.ed_pool + HCD_MAX_ENDPOINT);
 }
 
-static inline ohci_ed_t * ed_find_free(void)
+// Endpoint also takes a dummy TD as tail of its TD list, see td_insert_to_ed()
+static inline ohci_ed_t* ed_alloc(void)
 {
-  ohci_ed_t* ed_pool = ohci_data.ed_pool;
+  if ( ohci_data.free_list.ed_count == 0 || ohci_data.free_list.gtd_count == 0 ) return NULL;
+
+  uint8_t const idx = ohci_data.free_list.ed[--ohci_data.free_list.ed_count];
 
-  for(uint8_t i = 0; i < HCD_MAX_ENDPOINT; i++)
+  ohci_gtd_t* p_dummy = gtd_alloc();
+  gtd_init(p_dummy, NULL, 0);
+  p_dummy->index = idx;
+
+  ohci_data.ed_sw[idx].td_tail       = p_dummy;
+  ohci_data.ed_sw[idx].td_count      = 1;
+  ohci_data.ed_sw[idx].xferred_bytes = 0;
+
+  return &ohci_data.ed_pool[idx];
+}
+
+// Release TDs left in list of removed ED (e.g device is unplugged during transfer), HC must not be processing it
+// anymore. TDs already retired by HC are freed by done_queue_isr(), ED returns to pool after the last one.
+static void ed_free(ohci_ed_t* p_ed)
+{
+  uint8_t const idx = (uint8_t) (p_ed - ohci_data.ed_pool);
+  ohci_gtd_t** const p_td_tail = &ohci_data.ed_sw[idx].td_tail;
+
+  if ( *p_td_tail )
   {
-    if ( !ed_pool[i].used ) return &ed_pool[i];
+    while ( tu_align16(p_ed->td_head.address) != (uint32_t) *p_td_tail ) gtd_retire_1st_from_ed(p_ed);
+    gtd_free(*p_td_tail);
+    *p_td_tail = NULL;
   }
 
-  return NULL;
+  if ( ohci_data.ed_sw[idx].td_count == 0 )
+  {
+    p_ed->is_removing = 0;
+    ohci_data.free_list.ed[ohci_data.free_list.ed_count++] = idx;
+  }
 }
 
 static void ed_list_insert(ohci_ed_t * p_pre, ohci_ed_t * p_ed)
@@ -376,23 +451,26 @@ static void ed_list_remove_by_addr(ohci_ed_t * p_head, uint8_t dev_addr)
 
     if (ed->dev_addr == dev_addr)
     {
-      // unlink ed
+      // unlink ed, its next pointer is kept so that HC currently on it can still move on
+      ed->skip = 1;
       p_prev->next = ed->next;
 
-      // point the removed ED's next pointer to list head to make sure HC can always safely move away from this ED
-      ed->next = (uint32_t) p_head;
-      ed->used = 0;
+      // control ED is statically owned by its device
+      if ( ed_is_pool(ed) )
+      {
+        ed->is_removing = 1;
+        ohci_data.ed_removing = true;
+      }
+    }else
+    {
+      // only advance when not removed, the new next ED may also belong to this device
+      p_prev = ed;
     }
-
-    // check next valid since we could remove it
-    if (p_prev->next) p_prev = (ohci_ed_t*) p_prev->next;
   }
 }
 
 bool hcd_edpt_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const * ep_desc)
 {
-  (void) rhport; 
-
   // TODO iso support
   TU_ASSERT(ep_desc->bmAttributes.xfer != TUSB_XFER_ISOCHRONOUS);
 
@@ -404,13 +482,30 @@ bool hcd_edpt_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const
     p_ed = &ohci_data.control[dev_addr].ed;
   }else
   {
-    p_ed = ed_find_free();
+    // endpoint is already opened
+    TU_ASSERT( dev_addr != 0 && ed_from_addr(dev_addr, ep_desc->bEndpointAddress) == NULL );
+
+    hcd_int_disable(rhport);
+    p_ed = ed_alloc();
+    hcd_int_enable(rhport);
   }
   TU_ASSERT(p_ed);
 
   ed_init( p_ed, dev_addr, ep_desc->wMaxPacketSize.size, ep_desc->bEndpointAddress,
             ep_desc->bmAttributes.xfer, ep_desc->bInterval );
 
+  if ( ep_desc->bEndpointAddress != 0 )
+  {
+    uint8_t const epnum = tu_edpt_number(ep_desc->bEndpointAddress);
+    uint8_t const dir   = tu_edpt_dir(ep_desc->bEndpointAddress);
+    ohci_data.ep2ed[dev_addr-1][2*epnum + dir] = (uint8_t) (p_ed - ohci_data.ed_pool) + 1;
+
+    // empty TD list: head and tail are the dummy TD
+    uint32_t const dummy = (uint32_t) ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail;
+    p_ed->td_head.address = dummy;
+    p_ed->td_tail         = dummy;
+  }
+
   // control of dev0 is used as static async head
   if ( dev_addr == 0 )
   {
@@ -423,55 +518,130 @@ bool hcd_edpt_open(uint8_t rhport, uint8_t dev_addr, tusb_desc_endpoint_t const
   return true;
 }
 
-static ohci_gtd_t * gtd_find_free(void)
+static inline ohci_gtd_t* gtd_alloc(void)
+{
+  if ( ohci_data.free_list.gtd_count == 0 ) return NULL;
+
+  return &ohci_data.gtd_pool[ ohci_data.free_list.gtd[--ohci_data.free_list.gtd_count] ];
+}
+
+static inline void gtd_free(ohci_gtd_t* p_gtd)
 {
-  for(uint8_t i=0; i < HCD_MAX_XFER; i++)
+  // control TD is statically owned by its device
+  uint32_t const idx = ((uint32_t) p_gtd - (uint32_t) ohci_data.gtd_pool) / sizeof(ohci_gtd_t);
+  if ( idx < HCD_MAX_XFER )
   {
-    if ( !ohci_data.gtd_pool[i].used ) return &ohci_data.gtd_pool[i];
+    ohci_data.free_list.gtd[ohci_data.free_list.gtd_count++] = (uint8_t) idx;
+    ohci_data.ed_sw[p_gtd->index].td_count--;
   }
+}
 
-  return NULL;
+// TD list of ED is not empty, dummy tail TD is never processed by HC
+static inline bool gtd_queued(ohci_ed_t const * const p_ed)
+{
+  return tu_align16(p_ed->td_head.address) != (uint32_t) ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail;
 }
 
-static void td_insert_to_ed(ohci_ed_t* p_ed, ohci_gtd_t * p_gtd)
+// Remove and free head TD of a halted (or unlinked) ED. Return true if it is the last TD of a transfer
+static bool gtd_retire_1st_from_ed(ohci_ed_t* p_ed)
 {
-  // tail is always NULL
-  if ( tu_align16(p_ed->td_head.address) == 0 )
-  { // TD queue is empty --> head = TD
-    p_ed->td_head.address |= (uint32_t) p_gtd;
-  }
-  else
-  { // TODO currently only support queue up to 2 TD each endpoint at a time
-    ((ohci_gtd_t*) tu_align16(p_ed->td_head.address))->next = (uint32_t) p_gtd;
-  }
+  ohci_gtd_t* const p_gtd = (ohci_gtd_t*) tu_align16(p_ed->td_head.address);
+  bool const is_ioc = (p_gtd->delay_interrupt == OHCI_INT_ON_COMPLETE_YES);
+
+  // keep halted and toggle carry bits
+  p_ed->td_head.address = (p_ed->td_head.address & 0x0Ful) | tu_align16(p_gtd->next);
+  gtd_free(p_gtd);
+
+  return is_ioc;
+}
+
+// TD chain is built on current dummy tail TD and ends with new dummy TD. HC ignores TD list until TailP moves
+// to the new dummy, then sees the whole chain at once (5.2.8.1)
+static void td_insert_to_ed(ohci_ed_t* p_ed, ohci_gtd_t * p_dummy)
+{
+  ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail = p_dummy;
+
+  // halted ED keeps its list marked as empty until halt is cleared, see done_queue_isr()
+  if ( !p_ed->td_head.halted ) p_ed->td_tail = (p_ed->td_tail & 0x0Ful) | (uint32_t) p_dummy;
 }
 
-static bool pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes, bool int_on_complete)
+static bool pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes, bool int_on_complete)
 {
   ohci_ed_t* const p_ed = ed_from_addr(dev_addr, ep_addr);
+  TU_ASSERT(p_ed);
 
   // not support ISO yet
   TU_VERIFY ( !p_ed->is_iso );
 
-  ohci_gtd_t * const p_gtd = gtd_find_free();
-  TU_ASSERT(p_gtd); // not enough gtd
+  // number of TDs needed to cover the transfer
+  uint32_t td_count = 0;
+  uint32_t addr     = (uint32_t) buffer;
+  uint32_t remain   = total_bytes;
+  do
+  {
+    uint32_t const len = gtd_chain_len(addr, remain, p_ed->max_packet_size);
+    addr   += len;
+    remain -= len;
+    td_count++;
+  } while (remain);
+
+  // Also called by class driver's xfer_isr to queue next transfer, masking USB interrupt is harmless there
+  hcd_int_disable(TUH_OPT_RHPORT);
+
+  // first TD of the chain is current dummy, one more TD is taken as new dummy
+  bool const enough_td = (td_count <= ohci_data.free_list.gtd_count);
+  if ( enough_td )
+  {
+    //------------- set up TD chain -------------//
+    ohci_gtd_t* p_prev = NULL;
+
+    addr   = (uint32_t) buffer;
+    remain = total_bytes;
+    do
+    {
+      uint32_t const len = gtd_chain_len(addr, remain, p_ed->max_packet_size);
+      ohci_gtd_t* p_gtd  = p_prev ? gtd_alloc() : ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail;
 
-  gtd_init(p_gtd, buffer, total_bytes);
-  p_gtd->index = p_ed-ohci_data.ed_pool;
+      gtd_init(p_gtd, (void*) addr, (uint16_t) len);
+      p_gtd->index = p_ed-ohci_data.ed_pool;
 
-  if ( int_on_complete )  p_gtd->delay_interrupt = OHCI_INT_ON_COMPLETE_YES;
+      addr   += len;
+      remain -= len;
 
-  td_insert_to_ed(p_ed, p_gtd);
+      // Short packet of IN halts the ED with data underrun instead of moving on to the rest of this transfer
+      if ( remain && p_ed->pid == OHCI_PID_IN ) p_gtd->buffer_rounding = 0;
+
+      // only last TD of the transfer raises interrupt
+      if ( remain == 0 && int_on_complete ) p_gtd->delay_interrupt = OHCI_INT_ON_COMPLETE_YES;
+
+      if ( p_prev ) p_prev->next = (uint32_t) p_gtd;
+      p_prev = p_gtd;
+    } while (remain);
+
+    ohci_gtd_t* p_dummy = gtd_alloc();
+    gtd_init(p_dummy, NULL, 0);
+    p_dummy->index = p_ed-ohci_data.ed_pool;
+    p_prev->next   = (uint32_t) p_dummy;
+
+    ohci_data.ed_sw[p_dummy->index].td_count += td_count;
+
+    // whole chain is attached at once
+    td_insert_to_ed(p_ed, p_dummy);
+  }
+
+  hcd_int_enable(TUH_OPT_RHPORT);
+
+  TU_ASSERT(enough_td);
 
   return true;
 }
 
-bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes)
+bool hcd_pipe_queue_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes)
 {
   return pipe_queue_xfer(dev_addr, ep_addr, buffer, total_bytes, false);
 }
 
-bool  hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint16_t total_bytes, bool int_on_complete)
+bool  hcd_pipe_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t buffer[], uint32_t total_bytes, bool int_on_complete)
 {
   (void) int_on_complete;
   TU_ASSERT( pipe_queue_xfer(dev_addr, ep_addr, buffer, total_bytes, true) );
@@ -500,7 +670,10 @@ bool hcd_edpt_clear_stall(uint8_t dev_addr, uint8_t ep_addr)
   ohci_ed_t * const p_ed = ed_from_addr(dev_addr, ep_addr);
 
   p_ed->is_stalled = 0;
-  p_ed->td_tail    &= 0x0Ful; // set tail pointer back to NULL
+
+  // set tail pointer back to dummy TD (NULL for control ED), see done_queue_isr()
+  p_ed->td_tail &= 0x0Ful;
+  if ( ed_is_pool(p_ed) ) p_ed->td_tail |= (uint32_t) ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail;
 
   p_ed->td_head.toggle = 0; // reset data toggle
   p_ed->td_head.halted = 0;
@@ -554,6 +727,29 @@ static inline uint32_t gtd_xfer_byte_left(uint32_t buffer_end, uint32_t current_
       tu_offset4k(buffer_end) - tu_offset4k(current_buffer) + 1;
 }
 
+// Current buffer pointer of retired TD is zero if all bytes are transferred
+static inline uint32_t gtd_xferred_bytes(ohci_gtd_t const * const p_qtd)
+{
+  if ( p_qtd->current_buffer_pointer == NULL ) return p_qtd->expected_bytes;
+
+  return p_qtd->expected_bytes - gtd_xfer_byte_left((uint32_t) p_qtd->buffer_end, (uint32_t) p_qtd->current_buffer_pointer);
+}
+
+// HC is not processing EDs removed in an earlier frame anymore (5.2.7.1.2)
+static void ed_removed_isr(uint8_t hostid)
+{
+  if ( hcd_frame_number(hostid) == ohci_data.ed_removed_frame ) return;
+
+  for(uint8_t i=0; i<HCD_MAX_ENDPOINT; i++)
+  {
+    ohci_ed_t* const p_ed = &ohci_data.ed_pool[i];
+    if ( p_ed->is_removing && ohci_data.ed_sw[i].td_tail ) ed_free(p_ed);
+  }
+
+  ohci_data.ed_removing = false;
+  OHCI_REG->interrupt_disable = OHCI_INT_SOF_MASK;
+}
+
 static void done_queue_isr(uint8_t hostid)
 {
   (void) hostid;
@@ -561,28 +757,73 @@ static void done_queue_isr(uint8_t hostid)
   // done head is written in reversed order of completion --> need to reverse the done queue first
   ohci_td_item_t* td_head = list_reverse ( (ohci_td_item_t*) tu_align16(ohci_data.hcca.done_head) );
 
+  // Whole done queue is processed at once: TDs of a chained transfer only add up their bytes,
+  // the transfer is reported once with its last TD
   while( td_head != NULL )
   {
+    // TD can be re-submitted by callback e.g next stage of control transfer, get next done TD first
+    ohci_td_item_t* const td_next = (ohci_td_item_t*) td_head->next;
+
     // TODO check if td_head is iso td
     //------------- Non ISO transfer -------------//
     ohci_gtd_t * const p_qtd = (ohci_gtd_t *) td_head;
-    xfer_result_t const event = (p_qtd->condition_code == OHCI_CCODE_NO_ERROR) ? XFER_RESULT_SUCCESS :
-                                (p_qtd->condition_code == OHCI_CCODE_STALL) ? XFER_RESULT_STALLED : XFER_RESULT_FAILED;
+    ohci_ed_t  * const p_ed  = gtd_get_ed(p_qtd);
+    uint8_t const ccode = p_qtd->condition_code;
+
+    xfer_result_t event = (ccode == OHCI_CCODE_NO_ERROR) ? XFER_RESULT_SUCCESS :
+                          (ccode == OHCI_CCODE_STALL) ? XFER_RESULT_STALLED : XFER_RESULT_FAILED;
+    bool is_ioc = (p_qtd->delay_interrupt == OHCI_INT_ON_COMPLETE_YES);
+    uint32_t xferred_bytes = gtd_xferred_bytes(p_qtd);
+
+    if ( gtd_is_control(p_qtd) )
+    {
+      // control stage is always a single TD
+      is_ioc = is_ioc || (event != XFER_RESULT_SUCCESS);
+    }
+    else if ( p_ed->is_removing )
+    {
+      // endpoint is closed: TD retired before its removal is only freed, see ed_free()
+      gtd_free(p_qtd);
+      if ( ohci_data.ed_sw[p_ed - ohci_data.ed_pool].td_tail == NULL ) ed_free(p_ed);
 
-    p_qtd->used = 0; // free TD
-    if ( (p_qtd->delay_interrupt == OHCI_INT_ON_COMPLETE_YES) || (event != XFER_RESULT_SUCCESS) )
+      td_head = td_next;
+      continue;
+    }
+    else
     {
-      ohci_ed_t * const p_ed  = gtd_get_ed(p_qtd);
+      uint32_t* const ed_xferred = &ohci_data.ed_sw[p_qtd->index].xferred_bytes;
+
+      gtd_free(p_qtd);
+      xferred_bytes += *ed_xferred;
+
+      if ( ccode == OHCI_CCODE_DATA_UNDERRUN && !is_ioc )
+      {
+        // Short packet in the middle of chain: ED is halted, drop the rest of this transfer and resume with the next one
+        while ( !is_ioc && gtd_queued(p_ed) ) is_ioc = gtd_retire_1st_from_ed(p_ed);
+        p_ed->td_head.halted = 0;
 
-      uint32_t const xferred_bytes = p_qtd->expected_bytes - gtd_xfer_byte_left((uint32_t) p_qtd->buffer_end, (uint32_t) p_qtd->current_buffer_pointer);
+        event = XFER_RESULT_SUCCESS;
+        if ( TUSB_XFER_BULK == ed_get_xfer_type(p_ed) ) OHCI_REG->command_status_bit.bulk_list_filled = 1;
+      }
+      else if ( event != XFER_RESULT_SUCCESS )
+      {
+        // drop the rest of failed transfer, endpoint resumes with next queued transfer once halt is cleared
+        while ( !is_ioc && gtd_queued(p_ed) ) is_ioc = gtd_retire_1st_from_ed(p_ed);
+        is_ioc = true;
+      }
 
+      *ed_xferred = is_ioc ? 0 : xferred_bytes;
+    }
+
+    if ( is_ioc )
+    {
       // NOTE Assuming the current list is BULK and there is no other EDs in the list has queued TDs.
       // When there is a error resulting this ED is halted, and this EP still has other queued TD
       // --> the Bulk list only has this halted EP queueing TDs (remaining)
       // --> Bulk list will be considered as not empty by HC !!! while there is no attempt transaction on this list
       // --> HC will not process Control list (due to service ratio when Bulk list not empty)
       // To walk-around this, the halted ED will have TailP = HeadP (empty list condition), when clearing halt
-      // the TailP must be set back to NULL for processing remaining TDs
+      // the TailP must be set back to dummy TD for processing remaining TDs
       if ((event != XFER_RESULT_SUCCESS))
       {
         p_ed->td_tail &= 0x0Ful;
@@ -595,7 +836,7 @@ static void done_queue_isr(uint8_t hostid)
                               event, xferred_bytes);
     }
 
-    td_head = (ohci_td_item_t*) td_head->next;
+    td_head = td_next;
   }
 }
 
@@ -640,6 +881,12 @@ void hcd_isr(uint8_t hostid)
     done_queue_isr(hostid);
   }
 
+  //------------- Start of Frame, free removed EDs -------------//
+  if ( int_status & OHCI_INT_SOF_MASK )
+  {
+    ed_removed_isr(hostid);
+  }
+
   OHCI_REG->interrupt_status = int_status; // Acknowledge handled interrupt
 }
 //--------------------------------------------------------------------+
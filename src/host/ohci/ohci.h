@@ -79,8 +79,7 @@ typedef struct {
 typedef struct TU_ATTR_ALIGNED(16)
 {
 	// Word 0
-	uint32_t used                    : 1;
-	uint32_t index                   : 4;  // endpoint index the td belongs to, or device address in case of control xfer
+	uint32_t index                   : 5;  // endpoint index the td belongs to, or device address in case of control xfer
   uint32_t expected_bytes          : 13; // TODO available for hcd
 
   uint32_t buffer_rounding         : 1;
@@ -113,9 +112,9 @@ typedef struct TU_ATTR_ALIGNED(16)
 	uint32_t is_iso            : 1;
 	uint32_t max_packet_size   : 11;
 	      // HCD: make use of 5 reserved bits
-	uint32_t used              : 1;
 	uint32_t is_interrupt_xfer : 1;
 	uint32_t is_stalled        : 1;
+	uint32_t is_removing       : 1;
 	uint32_t                   : 2;
 
 	// Word 1
@@ -180,8 +179,34 @@ typedef struct TU_ATTR_ALIGNED(256)
   ohci_ed_t ed_pool[HCD_MAX_ENDPOINT];
   ohci_gtd_t gtd_pool[HCD_MAX_XFER];
 
+  // software state of ed_pool endpoints
+  struct {
+    ohci_gtd_t* td_tail;       // dummy TD ending TD list, NULL once removed endpoint has released its list
+    uint32_t    xferred_bytes; // bytes of retired TDs of the transfer in progress
+    uint8_t     td_count;      // TDs allocated to endpoint including dummy TD
+  }ed_sw[HCD_MAX_ENDPOINT];
+
+  // Stack of free pool indexes, allocate and free in constant time
+  struct {
+    uint8_t ed[HCD_MAX_ENDPOINT];
+    uint8_t gtd[HCD_MAX_XFER];
+    uint8_t ed_count;
+    uint8_t gtd_count;
+  }free_list;
+
+  // ed_pool index + 1 of opened endpoint (0 if not opened), indexed by [dev_addr-1][epnum*2 + dir]
+  uint8_t ep2ed[CFG_TUSB_HOST_DEVICE_MAX][32];
+
+  uint32_t frame_number; // HcFmNumber extended to 32-bit by hcd_frame_number()
+
+  uint32_t ed_removed_frame; // frame of latest ED removal, removed EDs are freed on SOF of a later frame
+  bool     ed_removing;
 } ohci_data_t;
 
+// TD index field is 5-bit wide, free list keeps pool index in uint8_t
+TU_VERIFY_STATIC( HCD_MAX_ENDPOINT <= 32 && CFG_TUSB_HOST_DEVICE_MAX < 32, "ed pool is too large" );
+TU_VERIFY_STATIC( HCD_MAX_XFER <= 255, "gtd pool is too large" );
+
 //--------------------------------------------------------------------+
 // OHCI Operational Register
 //--------------------------------------------------------------------+
@@ -32,6 +32,11 @@
 #define CFG_TUH_TASK_QUEUE_SZ   16
 #endif
 
+// Max number of events processed per tuh_task() call
+#ifndef CFG_TUH_TASK_EVENT_BATCH
+#define CFG_TUH_TASK_EVENT_BATCH   CFG_TUH_TASK_QUEUE_SZ
+#endif
+
 //--------------------------------------------------------------------+
 // INCLUDE
 //--------------------------------------------------------------------+
@@ -39,17 +44,40 @@
 #include "hub.h"
 #include "usbh_hcd.h"
 
+#if CFG_TUH_DESC_CACHE
+#include "usbh_desc_cache.h"
+#endif
+
 //--------------------------------------------------------------------+
 // MACRO CONSTANT TYPEDEF
 //--------------------------------------------------------------------+
+// Drivers of the same class code are tried in order until one of them opens the interface
 static host_class_driver_t const usbh_class_drivers[] =
 {
+  #if CFG_TUH_NET
+    {
+      .class_code = TUSB_CLASS_CDC,
+      .init       = neth_init,
+      .open       = neth_open,
+      .xfer_cb    = neth_xfer_cb,
+      .close      = neth_close
+    },
+    {
+      // RNDIS
+      .class_code = TUSB_CLASS_WIRELESS_CONTROLLER,
+      .init       = neth_init,
+      .open       = neth_open,
+      .xfer_cb    = neth_xfer_cb,
+      .close      = neth_close
+    },
+  #endif
+
   #if CFG_TUH_CDC
     {
       .class_code = TUSB_CLASS_CDC,
       .init       = cdch_init,
       .open       = cdch_open,
-      .isr        = cdch_isr,
+      .xfer_cb    = cdch_xfer_cb,
       .close      = cdch_close
     },
   #endif
@@ -59,8 +87,9 @@ static host_class_driver_t const usbh_class_drivers[] =
       .class_code = TUSB_CLASS_MSC,
       .init       = msch_init,
       .open       = msch_open,
-      .isr        = msch_isr,
-      .close      = msch_close
+      .xfer_cb    = msch_xfer_cb,
+      .close      = msch_close,
+      .xfer_isr   = msch_xfer_isr
     },
   #endif
 
@@ -68,8 +97,8 @@ static host_class_driver_t const usbh_class_drivers[] =
     {
       .class_code = TUSB_CLASS_HID,
       .init       = hidh_init,
-      .open       = hidh_open_subtask,
-      .isr        = hidh_isr,
+      .open       = hidh_open,
+      .xfer_cb    = hidh_xfer_cb,
       .close      = hidh_close
     },
   #endif
@@ -79,7 +108,7 @@ static host_class_driver_t const usbh_class_drivers[] =
       .class_code = TUSB_CLASS_HUB,
       .init       = hub_init,
       .open       = hub_open,
-      .isr        = hub_isr,
+      .xfer_cb    = hub_xfer_cb,
       .close      = hub_close
     },
   #endif
@@ -87,10 +116,10 @@ static host_class_driver_t const usbh_class_drivers[] =
   #if CFG_TUH_VENDOR
     {
       .class_code = TUSB_CLASS_VENDOR_SPECIFIC,
-      .init       = cush_init,
-      .open       = cush_open_subtask,
-      .isr        = cush_isr,
-      .close      = cush_close
+      .init       = vendorh_init,
+      .open       = vendorh_open,
+      .xfer_cb    = vendorh_xfer_cb,
+      .close      = vendorh_close
     }
   #endif
 };
@@ -109,7 +138,6 @@ CFG_TUSB_MEM_SECTION usbh_device_t _usbh_devices[CFG_TUSB_HOST_DEVICE_MAX+1];
 OSAL_QUEUE_DEF(OPT_MODE_HOST, _usbh_qdef, CFG_TUH_TASK_QUEUE_SZ, hcd_event_t);
 static osal_queue_t _usbh_q;
 
-CFG_TUSB_MEM_SECTION TU_ATTR_ALIGNED(4) static uint8_t _usbh_ctrl_buf[CFG_TUSB_HOST_ENUM_BUFFER_SIZE];
 
 //------------- Reporter Task Data -------------//
 
@@ -138,7 +166,7 @@ bool usbh_init(void)
   _usbh_q = osal_queue_create( &_usbh_qdef );
   TU_ASSERT(_usbh_q != NULL);
 
-  //------------- Semaphore, Mutex for Control Pipe -------------//
+  //------------- Semaphore, Mutex for blocking control xfer -------------//
   for(uint8_t i=0; i<CFG_TUSB_HOST_DEVICE_MAX+1; i++) // including address zero
   {
     usbh_device_t * const dev = &_usbh_devices[i];
@@ -163,43 +191,187 @@ bool usbh_init(void)
 }
 
 //------------- USBH control transfer -------------//
+// Data stage is received into buffer of bufsize bytes, the first skip bytes are dropped. Reading a descriptor
+// larger than buffer is done with several TDs, each is an even number of packets so that the next one starts
+// with DATA1 as HCD does for a single data TD.
+static bool control_xfer_submit(uint8_t dev_addr, tusb_control_request_t const* request, void* buffer, uint16_t bufsize,
+                                uint16_t skip, tuh_control_complete_cb_t complete_cb, void* user_ctx)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
+
+  // only one control transfer at a time per device
+  TU_VERIFY(dev->control.stage == USBH_CONTROL_STAGE_IDLE);
+
+  // OUT data stage is always a single TD
+  TU_ASSERT(request->wLength <= bufsize + skip && (skip == 0 || request->bmRequestType_bit.direction == TUSB_DIR_IN));
+
+  dev->control.request     = *request;
+  dev->control.buffer      = (uint8_t*) buffer;
+  dev->control.bufsize     = bufsize;
+  dev->control.skip        = skip;
+  dev->control.data_offset = 0;
+  dev->control.data_fill   = 0;
+  dev->control.complete_cb = complete_cb;
+  dev->control.user_ctx    = user_ctx;
+  dev->control.pipe_status = 0;
+  dev->control.stage       = USBH_CONTROL_STAGE_SETUP;
+
+  if ( !hcd_setup_send(dev->rhport, dev_addr, (uint8_t*) &dev->control.request) )
+  {
+    dev->control.stage = USBH_CONTROL_STAGE_IDLE;
+    return false;
+  }
+
+  return true;
+}
+
+bool tuh_control_xfer_async (uint8_t dev_addr, tusb_control_request_t const* request, void* buffer,
+                             tuh_control_complete_cb_t complete_cb, void* user_ctx)
+{
+  TU_ASSERT(dev_addr <= CFG_TUSB_HOST_DEVICE_MAX && complete_cb);
+  return control_xfer_submit(dev_addr, request, buffer, request->wLength, 0, complete_cb, user_ctx);
+}
+
+// Completion of blocking control transfer, invoked in tuh_task()
+static bool control_xfer_blocking_cb(uint8_t dev_addr, tusb_control_request_t const* request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) request;
+  (void) xferred_bytes;
+  (void) user_ctx;
+
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
+  dev->control.sem_result = result;
+  osal_semaphore_post(dev->control.sem_hdl, false);
+
+  return true;
+}
+
+// Blocking control transfer, wait for tuh_control_xfer_async() completion signaled from tuh_task()
 bool usbh_control_xfer (uint8_t dev_addr, tusb_control_request_t* request, uint8_t* data)
 {
+  TU_ASSERT(dev_addr <= CFG_TUSB_HOST_DEVICE_MAX);
   usbh_device_t* dev = &_usbh_devices[dev_addr];
-  const uint8_t rhport = dev->rhport;
 
   TU_ASSERT(osal_mutex_lock(dev->control.mutex_hdl, OSAL_TIMEOUT_NORMAL));
 
-  dev->control.request = *request;
-  dev->control.pipe_status = 0;
+  dev->control.sem_result = XFER_RESULT_FAILED;
+  bool ret = tuh_control_xfer_async(dev_addr, request, data, control_xfer_blocking_cb, NULL);
+
+  if ( ret ) ret = osal_semaphore_wait(dev->control.sem_hdl, OSAL_TIMEOUT_CONTROL_XFER);
+
+  osal_mutex_unlock(dev->control.mutex_hdl);
+
+  return ret && (XFER_RESULT_SUCCESS == dev->control.sem_result);
+}
+
+// Submit next data TD: received at buffer start until skip offset is passed, appended to kept data after that
+static void control_data_next(uint8_t dev_addr)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
+  tusb_control_request_t const * request = &dev->control.request;
+
+  uint16_t const left  = request->wLength - dev->control.data_offset;
+  uint16_t const space = dev->control.bufsize - dev->control.data_fill;
+  uint16_t const unit  = 2*dev->control.ep0_size;
+
+  // last TD can have any length
+  dev->control.data_len = (left <= space) ? left : (uint16_t) (space - space % unit);
+
+  hcd_edpt_xfer(dev->rhport, dev_addr, tu_edpt_addr(0, request->bmRequestType_bit.direction),
+                dev->control.buffer + dev->control.data_fill, dev->control.data_len);
+}
+
+// Invoked in ISR when a stage of control transfer is complete. Next stage is submitted right away,
+// completion is deferred to tuh_task() which invokes the callback (blocking transfer is signaled from there).
+static void control_xfer_isr(uint8_t dev_addr, xfer_result_t result, uint32_t xferred_bytes)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
+  tusb_control_request_t const * request = &dev->control.request;
+
+  // aborted e.g device is unplugged
+  if ( dev->control.stage == USBH_CONTROL_STAGE_IDLE ) return;
+
+  if ( XFER_RESULT_SUCCESS == result )
+  {
+    if ( dev->control.stage == USBH_CONTROL_STAGE_SETUP && request->wLength )
+    {
+      // Data stage : first data toggle is always 1
+      dev->control.stage = USBH_CONTROL_STAGE_DATA;
+      control_data_next(dev_addr);
+      return;
+    }
+
+    if ( dev->control.stage == USBH_CONTROL_STAGE_DATA )
+    {
+      uint16_t const offset = dev->control.data_offset;
+      uint16_t const len    = (uint16_t) xferred_bytes;
+      dev->control.data_offset += len;
+
+      // keep the part after skip offset
+      if ( dev->control.data_offset > dev->control.skip )
+      {
+        uint16_t const drop = (offset < dev->control.skip) ? (dev->control.skip - offset) : 0;
+        uint8_t* const dst  = dev->control.buffer + dev->control.data_fill;
+        if ( drop ) memmove(dst, dst + drop, len - drop);
+        dev->control.data_fill += len - drop;
+      }
+
+      // short packet ends data stage
+      if ( len == dev->control.data_len && dev->control.data_offset < request->wLength )
+      {
+        control_data_next(dev_addr);
+        return;
+      }
+    }
+
+    if ( dev->control.stage != USBH_CONTROL_STAGE_STATUS )
+    {
+      // Status : data toggle is always 1
+      dev->control.stage = USBH_CONTROL_STAGE_STATUS;
+      hcd_edpt_xfer(dev->rhport, dev_addr, tu_edpt_addr(0, 1-request->bmRequestType_bit.direction), NULL, 0);
+      return;
+    }
+  }
 
-  // Setup Stage
-  hcd_setup_send(rhport, dev_addr, (uint8_t*) &dev->control.request);
-  TU_VERIFY(osal_semaphore_wait(dev->control.sem_hdl, OSAL_TIMEOUT_NORMAL));
+  dev->control.pipe_status = result;
 
-  // Data stage : first data toggle is always 1
-  if ( request->wLength )
+  if ( dev->control.complete_cb )
   {
-    hcd_edpt_xfer(rhport, dev_addr, tu_edpt_addr(0, request->bmRequestType_bit.direction), data, request->wLength);
-    TU_VERIFY(osal_semaphore_wait(dev->control.sem_hdl, OSAL_TIMEOUT_NORMAL));
+    hcd_event_t event =
+    {
+      .rhport   = dev->rhport,
+      .event_id = HCD_EVENT_XFER_COMPLETE,
+      .dev_addr = dev_addr,
+    };
+
+    event.xfer_complete.ep_addr = 0;
+    event.xfer_complete.result  = result;
+    event.xfer_complete.len     = xferred_bytes;
+
+    hcd_event_handler(&event, true);
   }
+}
 
-  // Status : data toggle is always 1
-  hcd_edpt_xfer(rhport, dev_addr, tu_edpt_addr(0, 1-request->bmRequestType_bit.direction), NULL, 0);
-  TU_VERIFY(osal_semaphore_wait(dev->control.sem_hdl, OSAL_TIMEOUT_NORMAL));
+// Invoke completion callback of asynchronous control transfer in tuh_task()
+static void control_xfer_complete(uint8_t dev_addr)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
 
-  osal_mutex_unlock(dev->control.mutex_hdl);
+  // aborted while the completion is queued
+  if ( dev->control.stage == USBH_CONTROL_STAGE_IDLE || dev->control.complete_cb == NULL ) return;
 
-  if ( XFER_RESULT_STALLED == dev->control.pipe_status ) return false;
-  if ( XFER_RESULT_FAILED == dev->control.pipe_status ) return false;
+  // pipe is released before invoking callback so that it can submit the next request
+  tuh_control_complete_cb_t const complete_cb = dev->control.complete_cb;
+  dev->control.complete_cb = NULL;
+  dev->control.stage       = USBH_CONTROL_STAGE_IDLE;
 
-  return true;
+  complete_cb(dev_addr, &dev->control.request, (xfer_result_t) dev->control.pipe_status, dev->control.data_fill, dev->control.user_ctx);
 }
 
 tusb_error_t usbh_pipe_control_open(uint8_t dev_addr, uint8_t max_packet_size)
 {
   osal_semaphore_reset( _usbh_devices[dev_addr].control.sem_hdl );
-  //osal_mutex_reset( usbh_devices[dev_addr].control.mutex_hdl );
+  _usbh_devices[dev_addr].control.ep0_size = max_packet_size;
       
   tusb_desc_endpoint_t ep0_desc =
   {
@@ -220,29 +392,55 @@ tusb_error_t usbh_pipe_control_open(uint8_t dev_addr, uint8_t max_packet_size)
 // USBH-HCD ISR/Callback API
 //--------------------------------------------------------------------+
 // interrupt caused by a TD (with IOC=1) in pipe of class class_code
-void hcd_event_xfer_complete(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+// Class completion is deferred to tuh_task() unless driver handles it with its xfer_isr() fast path
+void hcd_event_xfer_complete(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes)
 {
   usbh_device_t* dev = &_usbh_devices[ dev_addr ];
 
   if (0 == tu_edpt_number(ep_addr))
   {
-    dev->control.pipe_status   = event;
-//    usbh_devices[ pipe_hdl.dev_addr ].control.xferred_bytes = xferred_bytes; not yet neccessary
-    osal_semaphore_post( dev->control.sem_hdl, true );
+    control_xfer_isr(dev_addr, result, xferred_bytes);
   }
   else
   {
     uint8_t drv_id = dev->ep2drv[tu_edpt_number(ep_addr)][tu_edpt_dir(ep_addr)];
     TU_ASSERT(drv_id < USBH_CLASS_DRIVER_COUNT, );
 
-    if (usbh_class_drivers[drv_id].isr)
-    {
-      usbh_class_drivers[drv_id].isr(dev_addr, ep_addr, event, xferred_bytes);
-    }
-    else
+    host_class_driver_t const * driver = &usbh_class_drivers[drv_id];
+    if ( driver->xfer_isr && driver->xfer_isr(dev_addr, ep_addr, result, xferred_bytes) ) return;
+
+    hcd_event_t event =
     {
-      TU_BREAKPOINT(); // something wrong, no one claims the isr's source
-    }
+      .rhport   = dev->rhport,
+      .event_id = HCD_EVENT_XFER_COMPLETE,
+      .dev_addr = dev_addr,
+    };
+
+    event.xfer_complete.ep_addr = ep_addr;
+    event.xfer_complete.result  = result;
+    event.xfer_complete.len     = xferred_bytes;
+
+    hcd_event_handler(&event, true);
+  }
+}
+
+// Dispatch queued class transfer completion in tuh_task()
+static void class_xfer_complete(hcd_event_t const * event)
+{
+  uint8_t const dev_addr = event->dev_addr;
+  uint8_t const ep_addr  = event->xfer_complete.ep_addr;
+
+  // endpoint is closed while the completion is queued e.g device is unplugged
+  uint8_t drv_id = _usbh_devices[dev_addr].ep2drv[tu_edpt_number(ep_addr)][tu_edpt_dir(ep_addr)];
+  if ( drv_id >= USBH_CLASS_DRIVER_COUNT ) return;
+
+  if (usbh_class_drivers[drv_id].xfer_cb)
+  {
+    usbh_class_drivers[drv_id].xfer_cb(dev_addr, ep_addr, (xfer_result_t) event->xfer_complete.result, event->xfer_complete.len);
+  }
+  else
+  {
+    TU_BREAKPOINT(); // something wrong, no one claims the isr's source
   }
 }
 
@@ -285,6 +483,33 @@ void hcd_event_device_remove(uint8_t hostid)
 }
 
 
+// Close class drivers and endpoints of device
+static void usbh_device_close(uint8_t dev_addr)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
+
+  // drop control transfer in progress, its completion is not reported to closed driver.
+  // Blocking transfer is released with failure instead of waiting forever
+  if ( dev->control.stage != USBH_CONTROL_STAGE_IDLE && dev->control.complete_cb == control_xfer_blocking_cb )
+  {
+    dev->control.sem_result = XFER_RESULT_FAILED;
+    osal_semaphore_post(dev->control.sem_hdl, false);
+  }
+
+  dev->control.stage       = USBH_CONTROL_STAGE_IDLE;
+  dev->control.complete_cb = NULL;
+
+  // Close class driver
+  for (uint8_t drv_id = 0; drv_id < USBH_CLASS_DRIVER_COUNT; drv_id++) usbh_class_drivers[drv_id].close(dev_addr);
+
+  memset(dev->itf2drv, 0xff, sizeof(dev->itf2drv)); // invalid mapping
+  memset(dev->ep2drv , 0xff, sizeof(dev->ep2drv )); // invalid mapping
+
+  hcd_device_close(dev->rhport, dev_addr);
+
+  dev->state = TUSB_DEVICE_STATE_UNPLUG;
+}
+
 // a device unplugged on hostid, hub_addr, hub_port
 // return true if found and unmounted device, false if cannot find
 static void usbh_device_unplugged(uint8_t rhport, uint8_t hub_addr, uint8_t hub_port)
@@ -303,288 +528,786 @@ static void usbh_device_unplugged(uint8_t rhport, uint8_t hub_addr, uint8_t hub_
       // Invoke callback before close driver
       if (tuh_umount_cb) tuh_umount_cb(dev_addr);
 
-      // Close class driver
-      for (uint8_t drv_id = 0; drv_id < USBH_CLASS_DRIVER_COUNT; drv_id++) usbh_class_drivers[drv_id].close(dev_addr);
-
-      memset(dev->itf2drv, 0xff, sizeof(dev->itf2drv)); // invalid mapping
-      memset(dev->ep2drv , 0xff, sizeof(dev->ep2drv )); // invalid mapping
-
-      hcd_device_close(rhport, dev_addr);
-
-      dev->state = TUSB_DEVICE_STATE_UNPLUG;
+      usbh_device_close(dev_addr);
     }
   }
 }
 
 //--------------------------------------------------------------------+
-// ENUMERATION TASK
+// ENUMERATION
 //--------------------------------------------------------------------+
-
-bool enum_task(hcd_event_t* event)
-{
-  enum {
+// Enumeration is a state machine advanced in tuh_task() by control transfer completion and delay
+// expiry, so that tuh_task() never blocks. Each device being enumerated has a context with its own
+// buffer from a pool of CFG_TUH_ENUM_MAX, since all new devices respond at address 0 only one of them
+// can be in the stages before SET_ADDRESS. Ports of hubs are handled by hub driver, connected ones are
+// picked up by enum_hub_next() whenever address 0 is free.
+//
+// Configuration descriptor larger than the buffer is parsed in windows after SET_CONFIGURATION: each
+// window is a read of the descriptor prefix whose leading part is dropped by the control transfer, and
+// interfaces complete within the window are opened before the next window is read.
+//
+// Class drivers submit their requests from open() without waiting for them, the next interface is opened once
+// control pipe is idle again and device is mounted when all interfaces are opened.
+enum {
 #if 1
-    // FIXME ohci LPC1769 xpresso + debugging to have 1st control xfer to work, some kind of timing or ohci driver issue !!!
-    POWER_STABLE_DELAY = 100,
-    RESET_DELAY        = 500
+  // FIXME ohci LPC1769 xpresso + debugging to have 1st control xfer to work, some kind of timing or ohci driver issue !!!
+  POWER_STABLE_DELAY = 100,
+  RESET_DELAY        = 500,
 #else
-    POWER_STABLE_DELAY = 500,
-    RESET_DELAY        = 200, // USB specs say only 50ms but many devices require much longer
+  POWER_STABLE_DELAY = 500,
+  RESET_DELAY        = 200, // USB specs say only 50ms but many devices require much longer
 #endif
-  };
+  HUB_RESET_TIMEOUT  = 500, // C_PORT_RESET is reported on status endpoint, polled up to every 256 ms
+  HUB_RESET_RECOVERY = 10,  // USB 2.0 section 7.1.7.5 TRSTRCY
+  CONTROL_IDLE_POLL  = 1    // wait for requests of class drivers before opening next interface
+};
 
-  // for OSAL_NONE local variable won't retain value after blocking service sem_wait/queue_recv
-  static uint8_t configure_selected = 1; // TODO move
+typedef enum
+{
+  ENUM_IDLE = 0,
+
+  // connected directly to roothub
+  ENUM_RH_POWER_STABLE,        // delay
+  ENUM_RH_RESET,               // delay
+
+  // connected via hub
+  ENUM_HUB_RESET,              // delay as timeout, ended by usbh_hub_port_reset_complete()
+  ENUM_HUB_RESET_RECOVERY,     // delay
+
+  ENUM_GET_ADDR0_DEVICE_DESC,
+  ENUM_SET_ADDRESS,
+  ENUM_GET_DEVICE_DESC,
+  ENUM_GET_SERIAL_STRING,      // descriptor cache key
+  ENUM_GET_CONFIG_DESC_HEADER,
+  ENUM_GET_CONFIG_DESC,
+  ENUM_SET_CONFIG,
+  ENUM_CONFIG_PARSE_WAIT,      // delay
+
+  // configuration larger than buffer
+  ENUM_CONFIG_WINDOW_WAIT,     // delay
+  ENUM_CONFIG_WINDOW
+} enum_state_t;
+
+typedef struct
+{
+  uint8_t state;        // value from enum_state_t
+  bool    delaying;     // current state is a delay, ended by delay_expire
+  uint8_t ep0_size;     // bMaxPacketSize0, zero until first 8 bytes of device descriptor is received
+  uint8_t new_addr;
+  uint8_t config_num;
 
-  usbh_device_t* dev0 = &_usbh_devices[0];
-  tusb_control_request_t request;
+  // port of device
+  uint8_t rhport;
+  uint8_t hub_addr;
+  uint8_t hub_port;
 
-  dev0->rhport  = event->rhport; // TODO refractor integrate to device_pool
-  dev0->hub_addr = event->attach.hub_addr;
-  dev0->hub_port = event->attach.hub_port;
-  dev0->state    = TUSB_DEVICE_STATE_UNPLUG;
+  uint32_t delay_expire; // hcd_frame_number() when the delay ends
 
-  //------------- connected/disconnected directly with roothub -------------//
-  if ( dev0->hub_addr == 0)
-  {
-    if( hcd_port_connect_status(dev0->rhport) )
-    {
-      // connection event
-      osal_task_delay(POWER_STABLE_DELAY); // wait until device is stable. Increase this if the first 8 bytes is failed to get
+  uint16_t config_len;    // wTotalLength
+  uint16_t config_offset; // first interface not opened yet or start of next configuration window
 
-      // exit if device unplugged while delaying
-      if ( !hcd_port_connect_status(dev0->rhport) ) return true;
+#if CFG_TUH_DESC_CACHE
+  uint8_t cache;         // value from ENUM_CACHE_*
+  tuh_desc_cache_key_t cache_key;
+#endif
+} usbh_enum_t;
 
-      hcd_port_reset( dev0->rhport ); // port must be reset to have correct speed operation
-      osal_task_delay(RESET_DELAY);
+#if CFG_TUH_DESC_CACHE
+enum
+{
+  ENUM_CACHE_NONE = 0, // device is not cacheable e.g serial number cannot be read
+  ENUM_CACHE_MISS,     // configuration is read from device, added to cache when configured
+  ENUM_CACHE_HIT       // configuration is from cache, removed from cache if enumeration fails
+};
+#endif
 
-      dev0->speed = hcd_port_speed_get( dev0->rhport );
-    }
-    else
-    {
-      // disconnection event
-      usbh_device_unplugged(dev0->rhport, 0, 0);
-      return true; // restart task
-    }
-  }
-  #if CFG_TUH_HUB
-  //------------- connected/disconnected via hub -------------//
-  else
-  {
-    //------------- Get Port Status -------------//
-    request = (tusb_control_request_t ) {
-          .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_OTHER, .type = TUSB_REQ_TYPE_CLASS, .direction = TUSB_DIR_IN },
-          .bRequest = HUB_REQUEST_GET_STATUS,
-          .wValue = 0,
-          .wIndex = dev0->hub_port,
-          .wLength = 4
-    };
-    // TODO hub refractor
-    TU_VERIFY_HDLR( usbh_control_xfer( dev0->hub_addr, &request, _usbh_ctrl_buf ), hub_status_pipe_queue( dev0->hub_addr) );
+TU_VERIFY_STATIC(CFG_TUSB_HOST_ENUM_BUFFER_SIZE >= 2*64, "enumeration buffer must hold 2 packets of control endpoint");
 
-    // Acknowledge Port Connection Change
-    hub_port_clear_feature_subtask(dev0->hub_addr, dev0->hub_port, HUB_FEATURE_PORT_CONNECTION_CHANGE);
+static usbh_enum_t _enum[CFG_TUH_ENUM_MAX];
+static usbh_enum_t* _enum_addr0; // context using address 0, NULL if address 0 is free
 
-    hub_port_status_response_t * p_port_status;
-    p_port_status = ((hub_port_status_response_t *) _usbh_ctrl_buf);
+CFG_TUSB_MEM_SECTION TU_ATTR_ALIGNED(4) static uint8_t _usbh_enum_buf[CFG_TUH_ENUM_MAX][CFG_TUSB_HOST_ENUM_BUFFER_SIZE];
 
-    if ( ! p_port_status->status_change.connect_status )   return true; // only handle connection change
+static bool enum_advance(usbh_enum_t* en, xfer_result_t result);
 
-    if ( ! p_port_status->status_current.connect_status )
-    {
-      // Disconnection event
-      usbh_device_unplugged(dev0->rhport, dev0->hub_addr, dev0->hub_port);
+static inline uint8_t* enum_buf(usbh_enum_t const* en)
+{
+  return _usbh_enum_buf[en - _enum];
+}
 
-      (void) hub_status_pipe_queue( dev0->hub_addr ); // done with hub, waiting for next data on status pipe
-      return true; // restart task
-    }
-    else
-    {
-      // Connection Event
-      TU_VERIFY_HDLR(hub_port_reset_subtask(dev0->hub_addr, dev0->hub_port),
-                     hub_status_pipe_queue( dev0->hub_addr) ); // TODO hub refractor
+static usbh_enum_t* enum_alloc(void)
+{
+  for(uint8_t i=0; i<CFG_TUH_ENUM_MAX; i++)
+  {
+    if ( _enum[i].state == ENUM_IDLE ) return &_enum[i];
+  }
+  return NULL;
+}
 
-      dev0->speed = hub_port_get_speed();
+static void enum_delay(usbh_enum_t* en, uint8_t state, uint32_t msec)
+{
+  en->state        = state;
+  en->delaying     = true;
+  en->delay_expire = hcd_frame_number(en->rhport) + msec;
+}
 
-      // Acknowledge Port Reset Change
-      hub_port_clear_feature_subtask(dev0->hub_addr, dev0->hub_port, HUB_FEATURE_PORT_RESET_CHANGE);
-    }
+// Remaining time of the nearest delay, used as tuh_task() timeout
+static uint32_t enum_delay_remaining(void)
+{
+  uint32_t timeout = OSAL_TIMEOUT_WAIT_FOREVER;
+
+  for(uint8_t i=0; i<CFG_TUH_ENUM_MAX; i++)
+  {
+    usbh_enum_t const* en = &_enum[i];
+    if ( !en->delaying ) continue;
+
+    int32_t const remaining = (int32_t) (en->delay_expire - hcd_frame_number(en->rhport));
+    if ( remaining <= 0 ) return OSAL_TIMEOUT_NOTIMEOUT;
+
+    timeout = tu_min32(timeout, (uint32_t) remaining);
   }
-  #endif
 
-  TU_ASSERT_ERR( usbh_pipe_control_open(0, 8) );
+  return timeout;
+}
 
-  //------------- Get first 8 bytes of device descriptor to get Control Endpoint Size -------------//
-  request = (tusb_control_request_t ) {
-        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
-        .bRequest = TUSB_REQ_GET_DESCRIPTOR,
-        .wValue = TUSB_DESC_DEVICE << 8,
-        .wIndex = 0,
-        .wLength = 8
-  };
-  bool is_ok = usbh_control_xfer(0, &request, _usbh_ctrl_buf);
+static void enum_done(usbh_enum_t* en)
+{
+  en->state    = ENUM_IDLE;
+  en->delaying = false;
+
+#if CFG_TUH_DESC_CACHE
+  en->cache = ENUM_CACHE_NONE;
+#endif
+
+  if ( _enum_addr0 == en ) _enum_addr0 = NULL;
+}
+
+static void enum_abort(usbh_enum_t* en)
+{
+  TU_LOG2("Enumeration failed at state %u\r\n", en->state);
 
-  //------------- Reset device again before Set Address -------------//
-  if (dev0->hub_addr == 0)
+  if ( _enum_addr0 == en )
   {
-    // connected directly to roothub
-    TU_ASSERT(is_ok); // TODO some slow device is observed to fail the very fist controller xfer, can try more times
-    hcd_port_reset( dev0->rhport ); // reset port after 8 byte descriptor
-    osal_task_delay(RESET_DELAY);
+    usbh_device_t* dev0 = &_usbh_devices[0];
+
+    // drop asynchronous transfer if any, its completion is ignored
+    dev0->control.stage       = USBH_CONTROL_STAGE_IDLE;
+    dev0->control.complete_cb = NULL;
+
+    hcd_device_close(dev0->rhport, 0);
+    dev0->state = TUSB_DEVICE_STATE_UNPLUG;
   }
-  #if CFG_TUH_HUB
-  else
+
+#if CFG_TUH_DESC_CACHE
+  // cached configuration may not match the device anymore e.g firmware updated without changing bcdDevice
+  if ( en->cache == ENUM_CACHE_HIT ) tuh_desc_cache_invalidate(&en->cache_key);
+#endif
+
+  // address is already set but device is not mounted yet, close drivers opened so far
+  if ( en->new_addr ) usbh_device_close(en->new_addr);
+
+  enum_done(en);
+}
+
+// Abort enumeration of devices on the port, hub_addr = 0 means all devices of the roothub port
+static void enum_abort_port(uint8_t rhport, uint8_t hub_addr, uint8_t hub_port)
+{
+  for(uint8_t i=0; i<CFG_TUH_ENUM_MAX; i++)
   {
-    // connected via a hub
-    TU_VERIFY_HDLR(is_ok, hub_status_pipe_queue( dev0->hub_addr) ); // TODO hub refractor
+    usbh_enum_t* en = &_enum[i];
 
-    if ( hub_port_reset_subtask(dev0->hub_addr, dev0->hub_port) )
+    if ( en->state != ENUM_IDLE && en->rhport == rhport &&
+         (hub_addr == 0 || (en->hub_addr == hub_addr && en->hub_port == hub_port)) )
     {
-      // Acknowledge Port Reset Change if Reset Successful
-      hub_port_clear_feature_subtask(dev0->hub_addr, dev0->hub_port, HUB_FEATURE_PORT_RESET_CHANGE);
+      enum_abort(en);
     }
-
-    (void) hub_status_pipe_queue( dev0->hub_addr ); // done with hub, waiting for next data on status pipe
   }
-  #endif
+}
 
-  //------------- Set new address -------------//
-  uint8_t const new_addr = get_new_address();
-  TU_ASSERT(new_addr <= CFG_TUSB_HOST_DEVICE_MAX); // TODO notify application we reach max devices
+// Claim address 0 for a new device
+static void enum_start(usbh_enum_t* en, uint8_t rhport, uint8_t hub_addr, uint8_t hub_port)
+{
+  usbh_device_t* dev0 = &_usbh_devices[0];
 
-  request = (tusb_control_request_t ) {
-        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
-        .bRequest = TUSB_REQ_SET_ADDRESS,
-        .wValue = new_addr,
-        .wIndex = 0,
-        .wLength = 0
-  };
-  TU_ASSERT(usbh_control_xfer(0, &request, NULL));
+  en->rhport   = rhport;
+  en->hub_addr = hub_addr;
+  en->hub_port = hub_port;
+  en->ep0_size = 0;
+  en->new_addr = 0;
+
+  dev0->rhport   = rhport; // TODO refractor integrate to device_pool
+  dev0->hub_addr = hub_addr;
+  dev0->hub_port = hub_port;
+  dev0->state    = TUSB_DEVICE_STATE_UNPLUG;
 
-  //------------- update port info & close control pipe of addr0 -------------//
-  usbh_device_t* new_dev = &_usbh_devices[new_addr];
-  new_dev->rhport  = dev0->rhport;
-  new_dev->hub_addr = dev0->hub_addr;
-  new_dev->hub_port = dev0->hub_port;
-  new_dev->speed    = dev0->speed;
+  _enum_addr0 = en;
+}
+
+static void enum_process(usbh_enum_t* en, xfer_result_t result)
+{
+  if ( !enum_advance(en, result) ) enum_abort(en);
+}
+
+static bool enum_control_complete(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx)
+{
+  (void) dev_addr;
+  (void) request;
+  (void) xferred_bytes;
+
+  usbh_enum_t* en = (usbh_enum_t*) user_ctx;
 
-  hcd_device_close(dev0->rhport, 0); // close device 0
-  dev0->state = TUSB_DEVICE_STATE_UNPLUG;
+  // stale completion of aborted enumeration
+  if ( en->state == ENUM_IDLE || en->delaying ) return false;
+
+  enum_process(en, result);
+  return true;
+}
+
+static bool enum_request(usbh_enum_t* en, uint8_t state, uint8_t dev_addr, tusb_control_request_t const* request, uint8_t* data)
+{
+  en->state = state;
+  return tuh_control_xfer_async(dev_addr, request, data, enum_control_complete, en);
+}
 
-  // open control pipe for new address
-  TU_ASSERT_ERR ( usbh_pipe_control_open(new_addr, ((tusb_desc_device_t*) _usbh_ctrl_buf)->bMaxPacketSize0 ) );
+static bool enum_get_addr0_device_desc(usbh_enum_t* en)
+{
+  en->new_addr = 0;
+  TU_ASSERT_ERR( usbh_pipe_control_open(0, 8) );
 
-  //------------- Get full device descriptor -------------//
-  request = (tusb_control_request_t ) {
+  //------------- Get first 8 bytes of device descriptor to get Control Endpoint Size -------------//
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
         .bRequest = TUSB_REQ_GET_DESCRIPTOR,
         .wValue = TUSB_DESC_DEVICE << 8,
         .wIndex = 0,
-        .wLength = 18
+        .wLength = 8
   };
-  TU_ASSERT(usbh_control_xfer(new_addr, &request, _usbh_ctrl_buf));
 
-  // update device info  TODO alignment issue
-  new_dev->vendor_id       = ((tusb_desc_device_t*) _usbh_ctrl_buf)->idVendor;
-  new_dev->product_id      = ((tusb_desc_device_t*) _usbh_ctrl_buf)->idProduct;
-  new_dev->configure_count = ((tusb_desc_device_t*) _usbh_ctrl_buf)->bNumConfigurations;
+  return enum_request(en, ENUM_GET_ADDR0_DEVICE_DESC, 0, &request, enum_buf(en));
+}
+
+static bool enum_set_address(usbh_enum_t* en)
+{
+  en->new_addr = get_new_address();
+  TU_ASSERT(en->new_addr <= CFG_TUSB_HOST_DEVICE_MAX); // TODO notify application we reach max devices
+
+  tusb_control_request_t const request = {
+        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
+        .bRequest = TUSB_REQ_SET_ADDRESS,
+        .wValue = en->new_addr,
+        .wIndex = 0,
+        .wLength = 0
+  };
 
-  configure_selected = get_configure_number_for_device((tusb_desc_device_t*) _usbh_ctrl_buf);
-  TU_ASSERT(configure_selected <= new_dev->configure_count); // TODO notify application when invalid configuration
+  return enum_request(en, ENUM_SET_ADDRESS, 0, &request, NULL);
+}
 
+static bool enum_get_config_desc_header(usbh_enum_t* en)
+{
   //------------- Get 9 bytes of configuration descriptor -------------//
-  request = (tusb_control_request_t ) {
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
         .bRequest = TUSB_REQ_GET_DESCRIPTOR,
-        .wValue = (TUSB_DESC_CONFIGURATION << 8) | (configure_selected - 1),
+        .wValue = (TUSB_DESC_CONFIGURATION << 8) | (en->config_num - 1),
         .wIndex = 0,
         .wLength = 9
   };
-  TU_ASSERT( usbh_control_xfer(new_addr, &request, _usbh_ctrl_buf));
 
-  // TODO not enough buffer to hold configuration descriptor
-  TU_ASSERT( CFG_TUSB_HOST_ENUM_BUFFER_SIZE >= ((tusb_desc_configuration_t*)_usbh_ctrl_buf)->wTotalLength );
-
-  //------------- Get full configuration descriptor -------------//
-  request.wLength = ((tusb_desc_configuration_t*)_usbh_ctrl_buf)->wTotalLength; // full length
-  TU_ASSERT( usbh_control_xfer( new_addr, &request, _usbh_ctrl_buf ) );
+  return enum_request(en, ENUM_GET_CONFIG_DESC_HEADER, en->new_addr, &request, enum_buf(en));
+}
 
+// Configuration descriptor (at least its header) is in enumeration buffer
+static bool enum_set_config(usbh_enum_t* en)
+{
   // update configuration info
-  new_dev->interface_count = ((tusb_desc_configuration_t*) _usbh_ctrl_buf)->bNumInterfaces;
+  _usbh_devices[en->new_addr].interface_count = ((tusb_desc_configuration_t*) enum_buf(en))->bNumInterfaces;
 
   //------------- Set Configure -------------//
-  request = (tusb_control_request_t ) {
+  tusb_control_request_t const request = {
         .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_OUT },
         .bRequest = TUSB_REQ_SET_CONFIGURATION,
-        .wValue = configure_selected,
+        .wValue = en->config_num,
         .wIndex = 0,
         .wLength = 0
   };
-  TU_ASSERT(usbh_control_xfer( new_addr, &request, NULL ));
 
-  new_dev->state = TUSB_DEVICE_STATE_CONFIGURED;
+  return enum_request(en, ENUM_SET_CONFIG, en->new_addr, &request, NULL);
+}
+
+// Read next window of configuration descriptor once control pipe is released by class drivers
+static bool enum_config_window(usbh_enum_t* en)
+{
+  if ( _usbh_devices[en->new_addr].control.stage != USBH_CONTROL_STAGE_IDLE )
+  {
+    enum_delay(en, ENUM_CONFIG_WINDOW_WAIT, CONTROL_IDLE_POLL);
+    return true;
+  }
+
+  // prefix up to the end of window, bytes before config_offset are dropped
+  tusb_control_request_t const request = {
+        .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+        .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+        .wValue = (TUSB_DESC_CONFIGURATION << 8) | (en->config_num - 1),
+        .wIndex = 0,
+        .wLength = (uint16_t) tu_min32(en->config_len, (uint32_t) en->config_offset + CFG_TUSB_HOST_ENUM_BUFFER_SIZE)
+  };
+
+  en->state = ENUM_CONFIG_WINDOW;
+  return control_xfer_submit(en->new_addr, &request, enum_buf(en), CFG_TUSB_HOST_ENUM_BUFFER_SIZE, en->config_offset,
+                             enum_control_complete, en);
+}
+
+#if CFG_TUH_DESC_CACHE
+// Skip reading configuration descriptor if device is cached
+static bool enum_get_config_cached(usbh_enum_t* en)
+{
+  uint16_t const len = tuh_desc_cache_lookup(&en->cache_key, enum_buf(en), CFG_TUSB_HOST_ENUM_BUFFER_SIZE);
+
+  if ( len == 0 )
+  {
+    en->cache = ENUM_CACHE_MISS;
+    return enum_get_config_desc_header(en);
+  }
+
+  en->cache      = ENUM_CACHE_HIT;
+  en->config_len = len;
+  return enum_set_config(en);
+}
+
+static bool enum_serial_valid(usbh_enum_t const* en, xfer_result_t result)
+{
+  uint8_t const* buf = enum_buf(en);
+  uint8_t const len = buf[0];
+  return (result == XFER_RESULT_SUCCESS) && (buf[1] == TUSB_DESC_STRING) &&
+         (2 <= len) && (len <= tu_min16(255, CFG_TUSB_HOST_ENUM_BUFFER_SIZE));
+}
+#endif
+
+#if CFG_TUH_HUB
+// Reset is done by hub driver, wait for its completion with a timeout
+static bool enum_hub_port_reset(usbh_enum_t* en)
+{
+  TU_ASSERT( hub_port_reset_start(en->hub_addr, en->hub_port) );
+  enum_delay(en, ENUM_HUB_RESET, HUB_RESET_TIMEOUT);
+
+  return true;
+}
+
+void usbh_hub_port_reset_complete(uint8_t hub_addr, uint8_t hub_port, tusb_speed_t speed, bool enabled)
+{
+  usbh_enum_t* en = _enum_addr0;
+
+  // not the port being enumerated e.g aborted or reset by other means
+  if ( en == NULL || en->state != ENUM_HUB_RESET || en->hub_addr != hub_addr || en->hub_port != hub_port ) return;
+
+  en->delaying = false;
+
+  // device is unplugged during reset
+  if ( !enabled )
+  {
+    enum_abort(en);
+    return;
+  }
+
+  if ( en->ep0_size == 0 ) _usbh_devices[0].speed = speed;
+  enum_delay(en, ENUM_HUB_RESET_RECOVERY, HUB_RESET_RECOVERY);
+}
+#endif
 
-  //------------- TODO Get String Descriptors -------------//
+// True if the next two interfaces start within range, the first one may belong to the same function e.g CDC data
+static bool itf_lookahead(uint8_t const* p_desc, uint8_t const* desc_end)
+{
+  uint8_t count = 0;
 
-  //------------- parse configuration & install drivers -------------//
-  uint8_t const* p_desc = _usbh_ctrl_buf + sizeof(tusb_desc_configuration_t);
+  p_desc = tu_desc_next(p_desc);
+  while( p_desc + 2 <= desc_end && tu_desc_len(p_desc) )
+  {
+    // alternate settings belong to the interface before them, descriptor cut before bAlternateSetting counts as new one
+    if ( TUSB_DESC_INTERFACE == tu_desc_type(p_desc) &&
+         (p_desc + 4 > desc_end || 0 == ((tusb_desc_interface_t const*) p_desc)->bAlternateSetting) && ++count == 2 ) return true;
+    p_desc = tu_desc_next(p_desc);
+  }
+
+  return false;
+}
+
+// Open class drivers of interfaces within [p_desc, desc_end). Unless the range reaches the end of configuration,
+// interface is only opened when itf_lookahead() is satisfied. Parsing also stops while control pipe is used by
+// requests submitted by the driver of previous interface. Return where parsing stopped, NULL if failed
+static uint8_t const* enum_parse_interfaces(uint8_t dev_addr, uint8_t const* p_desc, uint8_t const* desc_end, bool is_last)
+{
+  usbh_device_t* dev = &_usbh_devices[dev_addr];
 
   // parse each interfaces
-  while( p_desc < _usbh_ctrl_buf + ((tusb_desc_configuration_t*)_usbh_ctrl_buf)->wTotalLength )
+  while( p_desc < desc_end )
   {
+    // descriptor is not complete in this window
+    if ( p_desc + 2 > desc_end || p_desc + tu_desc_len(p_desc) > desc_end ) break;
+    TU_ASSERT( tu_desc_len(p_desc), NULL );
+
     // skip until we see interface descriptor
     if ( TUSB_DESC_INTERFACE != tu_desc_type(p_desc) )
     {
       p_desc = tu_desc_next(p_desc); // skip the descriptor, increase by the descriptor's length
-    }else
+    }
+    else if ( !is_last && !itf_lookahead(p_desc, desc_end) )
     {
-      tusb_desc_interface_t* desc_itf = (tusb_desc_interface_t*) p_desc;
+      break;
+    }
+    else if ( dev->control.stage != USBH_CONTROL_STAGE_IDLE )
+    {
+      break;
+    }
+    else
+    {
+      tusb_desc_interface_t const* desc_itf = (tusb_desc_interface_t const*) p_desc;
+
+      // Interface number must not be used already TODO alternate interface
+      TU_ASSERT( dev->itf2drv[desc_itf->bInterfaceNumber] == 0xff, NULL );
 
-      // Check if class is supported
+      // Drivers of interface class are tried in order until one of them opens it
+      uint16_t itf_len = 0;
       uint8_t drv_id;
       for (drv_id = 0; drv_id < USBH_CLASS_DRIVER_COUNT; drv_id++)
       {
-        if ( usbh_class_drivers[drv_id].class_code == desc_itf->bInterfaceClass ) break;
+        host_class_driver_t const * driver = &usbh_class_drivers[drv_id];
+        if ( driver->class_code != desc_itf->bInterfaceClass ) continue;
+
+        // TODO Attach hub to Hub is not currently supported
+        if ( desc_itf->bInterfaceClass == TUSB_CLASS_HUB && dev->hub_addr != 0 ) continue;
+
+        itf_len = 0;
+        if ( driver->open(dev->rhport, dev_addr, desc_itf, &itf_len) ) break;
       }
-      
+
       if( drv_id >= USBH_CLASS_DRIVER_COUNT )
       {
-        // skip unsupported class
+        // skip unsupported interface, its other descriptors are skipped as well
         p_desc = tu_desc_next(p_desc);
       }
       else
       {
-        // Interface number must not be used already TODO alternate interface
-        TU_ASSERT( new_dev->itf2drv[desc_itf->bInterfaceNumber] == 0xff );
-        new_dev->itf2drv[desc_itf->bInterfaceNumber] = drv_id;
+        TU_ASSERT( itf_len >= sizeof(tusb_desc_interface_t), NULL );
 
-        if (desc_itf->bInterfaceClass == TUSB_CLASS_HUB && new_dev->hub_addr != 0)
-        {
-          // TODO Attach hub to Hub is not currently supported
-          // skip this interface
-          p_desc = tu_desc_next(p_desc);
-        }
-        else
-        {
-          uint16_t itf_len = 0;
-
-          if ( usbh_class_drivers[drv_id].open(new_dev->rhport, new_addr, desc_itf, &itf_len) )
-          {
-            mark_interface_endpoint(new_dev->ep2drv, p_desc, itf_len, drv_id);
-          }
+        dev->itf2drv[desc_itf->bInterfaceNumber] = drv_id;
+        mark_interface_endpoint(dev->ep2drv, p_desc, itf_len, drv_id);
 
-          TU_ASSERT( itf_len >= sizeof(tusb_desc_interface_t) );
-          p_desc += itf_len;
-        }
+        p_desc += itf_len;
       }
     }
   }
 
-  if (tuh_mount_cb) tuh_mount_cb(new_addr);
+  TU_ASSERT( p_desc <= desc_end, NULL );
+  return p_desc;
+}
+
+// Open interfaces of configuration descriptor in enumeration buffer from config_offset, one after another once
+// control pipe is released by class drivers. Device is mounted when all of them are opened
+static bool enum_config_parse(usbh_enum_t* en)
+{
+  uint8_t const dev_addr = en->new_addr;
+  uint8_t* const buf = enum_buf(en);
+
+  uint8_t const* p_stop = enum_parse_interfaces(dev_addr, buf + en->config_offset, buf + en->config_len, true);
+  TU_VERIFY(p_stop);
+
+  if ( p_stop < buf + en->config_len && _usbh_devices[dev_addr].control.stage != USBH_CONTROL_STAGE_IDLE )
+  {
+    en->config_offset = (uint16_t) (p_stop - buf);
+    enum_delay(en, ENUM_CONFIG_PARSE_WAIT, CONTROL_IDLE_POLL);
+    return true;
+  }
+
+#if CFG_TUH_DESC_CACHE
+  if ( en->cache == ENUM_CACHE_MISS ) tuh_desc_cache_store(&en->cache_key, buf);
+#endif
+
+  enum_done(en);
+
+  if (tuh_mount_cb) tuh_mount_cb(dev_addr);
+
+  return true;
+}
+
+// Handle the completion of current state (control transfer or delay) and start the next one.
+// Return false if enumeration failed
+static bool enum_advance(usbh_enum_t* en, xfer_result_t result)
+{
+  usbh_device_t* dev0 = &_usbh_devices[0];
+  usbh_device_t* new_dev = &_usbh_devices[en->new_addr];
+  uint8_t* const buf = enum_buf(en);
+  tusb_control_request_t request;
+
+#if CFG_TUH_DESC_CACHE
+  // device is still enumerated without cache if its serial number cannot be read
+  if ( en->state == ENUM_GET_SERIAL_STRING && !enum_serial_valid(en, result) )
+  {
+    en->cache = ENUM_CACHE_NONE;
+    return enum_get_config_desc_header(en);
+  }
+#endif
+
+  // all states are either delay which always succeeds or control transfer
+  TU_VERIFY(XFER_RESULT_SUCCESS == result);
+
+  switch (en->state)
+  {
+    //------------- connected directly to roothub -------------//
+    case ENUM_RH_POWER_STABLE:
+      // exit if device unplugged while delaying
+      TU_VERIFY( hcd_port_connect_status(dev0->rhport) );
+
+      hcd_port_reset( dev0->rhport ); // port must be reset to have correct speed operation
+      enum_delay(en, ENUM_RH_RESET, RESET_DELAY);
+    break;
+
+    case ENUM_RH_RESET:
+      if ( en->ep0_size == 0 )
+      {
+        dev0->speed = hcd_port_speed_get( dev0->rhport );
+        return enum_get_addr0_device_desc(en);
+      }
+
+      // second reset after 8 byte descriptor
+      return enum_set_address(en);
+
+    //------------- connected via hub -------------//
+  #if CFG_TUH_HUB
+    case ENUM_HUB_RESET:
+      // no C_PORT_RESET reported within timeout
+      return false;
+
+    case ENUM_HUB_RESET_RECOVERY:
+      return (en->ep0_size == 0) ? enum_get_addr0_device_desc(en) : enum_set_address(en);
+  #endif
+
+    //------------- Reset device again before Set Address -------------//
+    case ENUM_GET_ADDR0_DEVICE_DESC:
+      en->ep0_size = ((tusb_desc_device_t*) buf)->bMaxPacketSize0;
+
+      if (dev0->hub_addr == 0)
+      {
+        // connected directly to roothub
+        hcd_port_reset( dev0->rhport ); // reset port after 8 byte descriptor
+        enum_delay(en, ENUM_RH_RESET, RESET_DELAY);
+      }
+    #if CFG_TUH_HUB
+      else
+      {
+        // connected via a hub
+        return enum_hub_port_reset(en);
+      }
+    #endif
+    break;
+
+    //------------- update port info & close control pipe of addr0 -------------//
+    case ENUM_SET_ADDRESS:
+      new_dev->rhport   = en->rhport;
+      new_dev->hub_addr = en->hub_addr;
+      new_dev->hub_port = en->hub_port;
+      new_dev->speed    = dev0->speed;
+
+      hcd_device_close(dev0->rhport, 0); // close device 0
+      dev0->state = TUSB_DEVICE_STATE_UNPLUG;
+
+      // address 0 is free for next device
+      _enum_addr0 = NULL;
+
+      // open control pipe for new address
+      TU_ASSERT_ERR ( usbh_pipe_control_open(en->new_addr, en->ep0_size) );
+
+      //------------- Get full device descriptor -------------//
+      request = (tusb_control_request_t ) {
+            .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+            .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+            .wValue = TUSB_DESC_DEVICE << 8,
+            .wIndex = 0,
+            .wLength = 18
+      };
+      return enum_request(en, ENUM_GET_DEVICE_DESC, en->new_addr, &request, buf);
+
+    case ENUM_GET_DEVICE_DESC:
+      // update device info  TODO alignment issue
+      new_dev->vendor_id       = ((tusb_desc_device_t*) buf)->idVendor;
+      new_dev->product_id      = ((tusb_desc_device_t*) buf)->idProduct;
+      new_dev->configure_count = ((tusb_desc_device_t*) buf)->bNumConfigurations;
+
+      en->config_num = get_configure_number_for_device((tusb_desc_device_t*) buf);
+      TU_ASSERT(en->config_num <= new_dev->configure_count); // TODO notify application when invalid configuration
+
+    #if CFG_TUH_DESC_CACHE
+      memcpy(&en->cache_key.device, buf, sizeof(tusb_desc_device_t));
+      en->cache_key.serial_hash = 0;
+
+      if ( en->cache_key.device.iSerialNumber )
+      {
+        //------------- Get serial number, first language -------------//
+        request = (tusb_control_request_t ) {
+              .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+              .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+              .wValue = (TUSB_DESC_STRING << 8) | en->cache_key.device.iSerialNumber,
+              .wIndex = 0x0409,
+              .wLength = tu_min16(255, CFG_TUSB_HOST_ENUM_BUFFER_SIZE)
+        };
+        return enum_request(en, ENUM_GET_SERIAL_STRING, en->new_addr, &request, buf);
+      }
+
+      return enum_get_config_cached(en);
+
+    case ENUM_GET_SERIAL_STRING:
+      // string descriptor is validated by enum_serial_valid()
+      en->cache_key.serial_hash = tuh_desc_cache_serial_hash(buf);
+      return enum_get_config_cached(en);
+    #else
+      return enum_get_config_desc_header(en);
+    #endif
+
+    case ENUM_GET_CONFIG_DESC_HEADER:
+      en->config_len = ((tusb_desc_configuration_t*) buf)->wTotalLength;
+      TU_ASSERT( en->config_len >= sizeof(tusb_desc_configuration_t) );
+
+      // too large for buffer: configure with header, interfaces are parsed window by window
+      if ( en->config_len > CFG_TUSB_HOST_ENUM_BUFFER_SIZE ) return enum_set_config(en);
+
+      //------------- Get full configuration descriptor -------------//
+      request = (tusb_control_request_t ) {
+            .bmRequestType_bit = { .recipient = TUSB_REQ_RCPT_DEVICE, .type = TUSB_REQ_TYPE_STANDARD, .direction = TUSB_DIR_IN },
+            .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+            .wValue = (TUSB_DESC_CONFIGURATION << 8) | (en->config_num - 1),
+            .wIndex = 0,
+            .wLength = en->config_len // full length
+      };
+      return enum_request(en, ENUM_GET_CONFIG_DESC, en->new_addr, &request, buf);
+
+    case ENUM_GET_CONFIG_DESC:
+      return enum_set_config(en);
+
+    case ENUM_SET_CONFIG:
+      new_dev->state = TUSB_DEVICE_STATE_CONFIGURED;
+
+      //------------- TODO Get String Descriptors -------------//
+
+      //------------- parse configuration & install drivers -------------//
+      en->config_offset = sizeof(tusb_desc_configuration_t);
+      return (en->config_len > CFG_TUSB_HOST_ENUM_BUFFER_SIZE) ? enum_config_window(en) : enum_config_parse(en);
+
+    case ENUM_CONFIG_PARSE_WAIT:
+      return enum_config_parse(en);
+
+    case ENUM_CONFIG_WINDOW_WAIT:
+      return enum_config_window(en);
+
+    case ENUM_CONFIG_WINDOW:
+    {
+      uint8_t const dev_addr = en->new_addr;
+
+      // window ends early if device returns less than wTotalLength
+      uint16_t const len      = new_dev->control.data_fill;
+      uint16_t const expected = (uint16_t) (tu_min32(en->config_len, (uint32_t) en->config_offset + CFG_TUSB_HOST_ENUM_BUFFER_SIZE) - en->config_offset);
+      bool const     is_last  = (len < expected) || (en->config_offset + len >= en->config_len);
+
+      uint8_t const* p_stop = enum_parse_interfaces(dev_addr, buf, buf + len, is_last);
+      TU_VERIFY(p_stop);
+
+      // next window starts at the interface not opened yet while control pipe is in use
+      if ( !is_last || (p_stop < buf + len && new_dev->control.stage != USBH_CONTROL_STAGE_IDLE) )
+      {
+        // interface with its descriptors does not fit in buffer
+        TU_ASSERT(p_stop > buf);
+
+        en->config_offset += (uint16_t) (p_stop - buf);
+        return enum_config_window(en);
+      }
+
+      enum_done(en);
+
+      if (tuh_mount_cb) tuh_mount_cb(dev_addr);
+    }
+    break;
+
+    default: TU_BREAKPOINT(); return false;
+  }
 
   return true;
 }
 
+// Start enumeration on attach/remove event from roothub, remove event from hub
+static void enum_new_device(hcd_event_t const* event)
+{
+#if CFG_TUH_HUB
+  //------------- disconnected via hub -------------//
+  if ( event->attach.hub_addr != 0 )
+  {
+    // connected hub port is picked up by enum_hub_next()
+    if ( event->event_id != HCD_EVENT_DEVICE_REMOVE ) return;
+
+    // device being enumerated on the port is gone
+    enum_abort_port(event->rhport, event->attach.hub_addr, event->attach.hub_port);
+
+    usbh_device_unplugged(event->rhport, event->attach.hub_addr, event->attach.hub_port);
+    return;
+  }
+#endif
+
+  // roothub port changed, anything being enumerated on it is gone
+  enum_abort_port(event->rhport, 0, 0);
+
+  //------------- connected/disconnected directly with roothub -------------//
+  if( hcd_port_connect_status(event->rhport) )
+  {
+    usbh_enum_t* en = enum_alloc();
+    TU_VERIFY(en && !_enum_addr0, );
+
+    enum_start(en, event->rhport, 0, 0);
+
+    // connection event, wait until device is stable. Increase this if the first 8 bytes is failed to get
+    enum_delay(en, ENUM_RH_POWER_STABLE, POWER_STABLE_DELAY);
+  }
+  else
+  {
+    // disconnection event
+    usbh_device_unplugged(event->rhport, 0, 0);
+  }
+}
+
+#if CFG_TUH_HUB
+// Start enumeration of next connected hub port if address 0 and a context are free
+static void enum_hub_next(void)
+{
+  if ( _enum_addr0 ) return;
+
+  usbh_enum_t* en = enum_alloc();
+  if ( en == NULL ) return;
+
+  uint8_t hub_addr, hub_port;
+  if ( !hub_port_attach_next(&hub_addr, &hub_port) ) return;
+
+  uint8_t const rhport = _usbh_devices[hub_addr].rhport;
+
+  // device previously on the port is gone if it is re-connected without notice
+  enum_abort_port(rhport, hub_addr, hub_port);
+  usbh_device_unplugged(rhport, hub_addr, hub_port);
+
+  enum_start(en, rhport, hub_addr, hub_port);
+  if ( !enum_hub_port_reset(en) ) enum_abort(en);
+}
+#endif
+
+// Invoke enumeration when current delay is expired
+static void enum_delay_task(void)
+{
+  for(uint8_t i=0; i<CFG_TUH_ENUM_MAX; i++)
+  {
+    usbh_enum_t* en = &_enum[i];
+
+    if ( en->delaying && (int32_t) (en->delay_expire - hcd_frame_number(en->rhport)) <= 0 )
+    {
+      en->delaying = false;
+      enum_process(en, XFER_RESULT_SUCCESS);
+    }
+  }
+}
+
 /* USB Host Driver task
  * This top level thread manages all host controller event and delegates events to class-specific drivers.
  * This should be called periodically within the mainloop or rtos thread.
@@ -609,17 +1332,36 @@ void tuh_task(void)
   // Skip if stack is not initialized
   if ( !tusb_inited() ) return;
 
-  // Loop until there is no more events in the queue
-  while (1)
+  // Loop until there is no more events in the queue, at most CFG_TUH_TASK_EVENT_BATCH events are processed
+  // so that a burst of transfer completions does not starve the mainloop. The rest is handled by next call.
+  for (uint16_t count = 0; count < CFG_TUH_TASK_EVENT_BATCH; count++)
   {
+    enum_delay_task();
+
+  #if CFG_TUH_HUB
+    enum_hub_next();
+  #endif
+
+    // RTOS waits no longer than pending enumeration delay, tuh_task() is called again by its thread loop
     hcd_event_t event;
-    if ( !osal_queue_receive(_usbh_q, &event) ) return;
+    if ( !osal_queue_receive(_usbh_q, &event, enum_delay_remaining()) ) return;
 
     switch (event.event_id)
     {
       case HCD_EVENT_DEVICE_ATTACH:
       case HCD_EVENT_DEVICE_REMOVE:
-        enum_task(&event);
+        enum_new_device(&event);
+      break;
+
+      case HCD_EVENT_XFER_COMPLETE:
+        if ( 0 == tu_edpt_number(event.xfer_complete.ep_addr) )
+        {
+          control_xfer_complete(event.dev_addr);
+        }
+        else
+        {
+          class_xfer_complete(&event);
+        }
       break;
 
       default: break;
@@ -634,7 +1376,16 @@ static inline uint8_t get_new_address(void)
 {
   for (uint8_t addr=1; addr <= CFG_TUSB_HOST_DEVICE_MAX; addr++)
   {
-    if (_usbh_devices[addr].state == TUSB_DEVICE_STATE_UNPLUG) return addr;
+    if (_usbh_devices[addr].state != TUSB_DEVICE_STATE_UNPLUG) continue;
+
+    // not yet configured but being enumerated
+    bool in_use = false;
+    for(uint8_t i=0; i<CFG_TUH_ENUM_MAX; i++)
+    {
+      if ( _enum[i].state != ENUM_IDLE && _enum[i].new_addr == addr ) in_use = true;
+    }
+
+    if ( !in_use ) return addr;
   }
   return CFG_TUSB_HOST_DEVICE_MAX+1;
 }
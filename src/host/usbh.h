@@ -56,9 +56,18 @@ typedef struct {
 
   void (* const init) (void);
   bool (* const open)(uint8_t rhport, uint8_t dev_addr, tusb_desc_interface_t const * itf_desc, uint16_t* outlen);
-  void (* const isr) (uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t len);
+  void (* const xfer_cb) (uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t len);
   void (* const close) (uint8_t);
+
+  // Optional fast path invoked in ISR context before completion is queued for xfer_cb() in tuh_task().
+  // Return true if the completion is fully handled, should be kept short.
+  bool (* const xfer_isr) (uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t len);
 } host_class_driver_t;
+
+// Invoked in tuh_task() context when an asynchronous control transfer is complete or failed.
+// xferred_bytes is the length of data stage actually transferred, less than wLength if device ended it early
+typedef bool (*tuh_control_complete_cb_t)(uint8_t dev_addr, tusb_control_request_t const * request, xfer_result_t result, uint32_t xferred_bytes, void* user_ctx);
+
 //--------------------------------------------------------------------+
 // INTERNAL OBJECT & FUNCTION DECLARATION
 //--------------------------------------------------------------------+
@@ -77,6 +86,19 @@ static inline bool tuh_device_is_configured(uint8_t dev_addr)
   return tuh_device_get_state(dev_addr) == TUSB_DEVICE_STATE_CONFIGURED;
 }
 
+/** Submit a control transfer and return immediately.
+ * SETUP, DATA and STATUS stages are chained by the stack, complete_cb is invoked in tuh_task()
+ * when the transfer is complete or any stage failed. Only one control transfer can be in progress per
+ * device: return false if the control pipe is busy. buffer must remain valid until complete_cb is invoked. */
+bool tuh_control_xfer_async (uint8_t dev_addr, tusb_control_request_t const* request, void* buffer,
+                             tuh_control_complete_cb_t complete_cb, void* user_ctx);
+
+/** Blocking version of tuh_control_xfer_async(), wait until the transfer is complete or device is removed.
+ * Intended for application tasks of an RTOS while tuh_task() runs in its own task: the completion is signaled
+ * from tuh_task(), so it must NOT be called from tuh_task() or any callback (class driver, complete_cb) nor with
+ * OPT_OS_NONE. Return false if failed or a callback-based transfer is in progress on the same device. */
+bool usbh_control_xfer (uint8_t dev_addr, tusb_control_request_t* request, uint8_t* data);
+
 //--------------------------------------------------------------------+
 // APPLICATION CALLBACK
 //--------------------------------------------------------------------+
@@ -92,7 +114,9 @@ TU_ATTR_WEAK void tuh_umount_cb(uint8_t dev_addr);
 // CLASS-USBH & INTERNAL API
 //--------------------------------------------------------------------+
 bool usbh_init(void);
-bool usbh_control_xfer (uint8_t dev_addr, tusb_control_request_t* request, uint8_t* data);
+
+// Invoked by hub driver when C_PORT_RESET is reported (or reset request failed), enabled is false if device is gone
+void usbh_hub_port_reset_complete(uint8_t hub_addr, uint8_t hub_port, tusb_speed_t speed, bool enabled);
 
 #ifdef __cplusplus
  }
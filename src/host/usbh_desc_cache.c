@@ -0,0 +1,154 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if CFG_TUH_DESC_CACHE
+
+#include "common/tusb_common.h"
+#include "usbh_desc_cache.h"
+
+//--------------------------------------------------------------------+
+// MACRO CONSTANT TYPEDEF
+//--------------------------------------------------------------------+
+typedef struct
+{
+  tuh_desc_cache_key_t key;
+  uint32_t stamp; // LRU, 0 means invalid
+  uint16_t config_len;
+  uint8_t  config[CFG_TUH_DESC_CACHE_CONFIG_SIZE];
+} desc_cache_entry_t;
+
+static desc_cache_entry_t _cache[CFG_TUH_DESC_CACHE_ENTRIES];
+static uint32_t _clock;
+
+//--------------------------------------------------------------------+
+// INTERNAL HELPER
+//--------------------------------------------------------------------+
+static desc_cache_entry_t* entry_find(tuh_desc_cache_key_t const* key)
+{
+  for(uint8_t i=0; i<CFG_TUH_DESC_CACHE_ENTRIES; i++)
+  {
+    desc_cache_entry_t* entry = &_cache[i];
+    if ( entry->stamp && entry->key.serial_hash == key->serial_hash &&
+         0 == memcmp(&entry->key.device, &key->device, sizeof(tusb_desc_device_t)) ) return entry;
+  }
+  return NULL;
+}
+
+// invalid entry if any, least recently used otherwise
+static desc_cache_entry_t* entry_victim(void)
+{
+  desc_cache_entry_t* victim = &_cache[0];
+  for(uint8_t i=1; i<CFG_TUH_DESC_CACHE_ENTRIES && victim->stamp; i++)
+  {
+    if ( _cache[i].stamp < victim->stamp ) victim = &_cache[i];
+  }
+  return victim;
+}
+
+static desc_cache_entry_t* entry_put(tuh_desc_cache_key_t const* key, uint8_t const* config, uint16_t len)
+{
+  desc_cache_entry_t* entry = entry_find(key);
+  if ( !entry ) entry = entry_victim();
+
+  entry->key        = *key;
+  entry->stamp      = ++_clock;
+  entry->config_len = len;
+  memcpy(entry->config, config, len);
+
+  return entry;
+}
+
+static inline uint16_t config_total_length(uint8_t const* config)
+{
+  return tu_u16(config[3], config[2]);
+}
+
+//--------------------------------------------------------------------+
+// API
+//--------------------------------------------------------------------+
+uint32_t tuh_desc_cache_serial_hash(uint8_t const* str_desc)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for(uint8_t i=0; i<str_desc[0]; i++)
+  {
+    hash = (hash ^ str_desc[i]) * 16777619u;
+  }
+  return hash ? hash : 1;
+}
+
+uint16_t tuh_desc_cache_lookup(tuh_desc_cache_key_t const* key, uint8_t* config, uint16_t bufsize)
+{
+  desc_cache_entry_t* entry = entry_find(key);
+
+  if ( entry )
+  {
+    TU_VERIFY(entry->config_len <= bufsize, 0);
+
+    entry->stamp = ++_clock;
+    memcpy(config, entry->config, entry->config_len);
+    return entry->config_len;
+  }
+
+  //------------- Persistent backend -------------//
+  TU_VERIFY(tuh_desc_cache_load_cb, 0);
+
+  uint16_t const len = tuh_desc_cache_load_cb(key, config, bufsize);
+
+  // loaded data must be a whole configuration descriptor
+  TU_VERIFY(len >= sizeof(tusb_desc_configuration_t) && len <= bufsize, 0);
+  TU_VERIFY(config[1] == TUSB_DESC_CONFIGURATION && config_total_length(config) == len, 0);
+
+  if ( len <= CFG_TUH_DESC_CACHE_CONFIG_SIZE ) (void) entry_put(key, config, len);
+
+  return len;
+}
+
+void tuh_desc_cache_store(tuh_desc_cache_key_t const* key, uint8_t const* config)
+{
+  uint16_t const len = config_total_length(config);
+  if ( len > CFG_TUH_DESC_CACHE_CONFIG_SIZE ) return;
+
+  (void) entry_put(key, config, len);
+
+  if ( tuh_desc_cache_store_cb ) tuh_desc_cache_store_cb(key, config, len);
+}
+
+void tuh_desc_cache_invalidate(tuh_desc_cache_key_t const* key)
+{
+  desc_cache_entry_t* entry = entry_find(key);
+  if ( entry ) entry->stamp = 0;
+}
+
+void tuh_desc_cache_clear(void)
+{
+  tu_memclr(_cache, sizeof(_cache));
+  _clock = 0;
+}
+
+#endif
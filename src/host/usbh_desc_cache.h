@@ -0,0 +1,107 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+/** \ingroup group_usbh
+ *  @{
+ *  \defgroup usbh_desc_cache Descriptor Cache
+ *  \brief Device and configuration descriptors of recently enumerated devices, keyed by full device descriptor
+ *  (VID, PID, bcdDevice ...) and serial number. A re-attached device whose device descriptor and serial number
+ *  match an entry goes straight to SET_CONFIGURATION with the cached configuration descriptor.
+ *
+ *  Entries are kept in RAM with LRU replacement, an optional persistent backend (e.g flash) is plugged in
+ *  with tuh_desc_cache_load_cb() and tuh_desc_cache_store_cb().
+ *  @{ */
+
+#ifndef _TUSB_USBH_DESC_CACHE_H_
+#define _TUSB_USBH_DESC_CACHE_H_
+
+#include "common/tusb_common.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+//--------------------------------------------------------------------+
+// Configuration
+//--------------------------------------------------------------------+
+
+// Number of devices kept in RAM
+#ifndef CFG_TUH_DESC_CACHE_ENTRIES
+#define CFG_TUH_DESC_CACHE_ENTRIES       4
+#endif
+
+// Max configuration descriptor length of a cached device, longer ones are always read from device
+#ifndef CFG_TUH_DESC_CACHE_CONFIG_SIZE
+#define CFG_TUH_DESC_CACHE_CONFIG_SIZE   256
+#endif
+
+//--------------------------------------------------------------------+
+// Cache
+//--------------------------------------------------------------------+
+typedef struct
+{
+  tusb_desc_device_t device; ///< whole device descriptor must match
+  uint32_t serial_hash;      ///< hash of serial number string descriptor, 0 if device has no serial number
+} tuh_desc_cache_key_t;
+
+/// Hash of string descriptor (bLength bytes), never 0
+uint32_t tuh_desc_cache_serial_hash(uint8_t const* str_desc);
+
+/** \brief      Look up configuration descriptor of device, RAM entries first then persistent backend
+ * \param[in]   key     Device to look up
+ * \param[out]  config  Buffer for configuration descriptor
+ * \param[in]   bufsize Size of config
+ * \retval      wTotalLength of configuration descriptor copied to config, 0 if not cached
+ */
+uint16_t tuh_desc_cache_lookup(tuh_desc_cache_key_t const* key, uint8_t* config, uint16_t bufsize);
+
+/// Add or update device with its full configuration descriptor, skipped if longer than \ref CFG_TUH_DESC_CACHE_CONFIG_SIZE
+void tuh_desc_cache_store(tuh_desc_cache_key_t const* key, uint8_t const* config);
+
+/// Remove device from RAM entries e.g its cached configuration is rejected. Persistent backend is not notified.
+void tuh_desc_cache_invalidate(tuh_desc_cache_key_t const* key);
+
+/// Remove all RAM entries
+void tuh_desc_cache_clear(void);
+
+//--------------------------------------------------------------------+
+// Persistent backend (optional)
+//--------------------------------------------------------------------+
+
+/// Invoked on RAM miss, return wTotalLength of configuration descriptor copied to config or 0 if not found
+TU_ATTR_WEAK uint16_t tuh_desc_cache_load_cb(tuh_desc_cache_key_t const* key, uint8_t* config, uint16_t bufsize);
+
+/// Invoked when a newly enumerated device is added to cache
+TU_ATTR_WEAK void tuh_desc_cache_store_cb(tuh_desc_cache_key_t const* key, uint8_t const* config, uint16_t len);
+
+#ifdef __cplusplus
+ }
+#endif
+
+#endif /* _TUSB_USBH_DESC_CACHE_H_ */
+
+/** @} */
+/** @} */
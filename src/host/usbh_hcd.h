@@ -39,10 +39,19 @@
 //--------------------------------------------------------------------+
 #include "common/tusb_common.h"
 #include "osal/osal.h"
+#include "usbh.h"
 
 //--------------------------------------------------------------------+
 // USBH-HCD common data structure
 //--------------------------------------------------------------------+
+typedef enum
+{
+  USBH_CONTROL_STAGE_IDLE = 0,
+  USBH_CONTROL_STAGE_SETUP,
+  USBH_CONTROL_STAGE_DATA,
+  USBH_CONTROL_STAGE_STATUS
+} usbh_control_stage_t;
+
 typedef struct {
   //------------- port -------------//
   uint8_t rhport;
@@ -64,14 +73,26 @@ typedef struct {
   //------------- control pipe -------------//
   struct {
     volatile uint8_t pipe_status;
-//    uint8_t xferred_bytes; TODO not yet necessary
+    uint8_t stage;             // current stage, value from enum usbh_control_stage_t
     tusb_control_request_t request;
 
+    uint8_t* buffer;
+    uint16_t bufsize;          // data stage longer than buffer is received in multiple TDs
+    uint16_t skip;             // bytes at the start of data stage that are dropped
+    uint16_t data_offset;      // bytes of data stage transferred
+    uint16_t data_fill;        // bytes kept in buffer
+    uint16_t data_len;         // length of current data TD
+    uint8_t  ep0_size;
+
+    tuh_control_complete_cb_t complete_cb; // NULL if transfer is aborted
+    void* user_ctx;
+
     osal_semaphore_def_t sem_def;
-    osal_semaphore_t sem_hdl;  // used to synchronize with HCD when control xfer complete
+    osal_semaphore_t sem_hdl;  // posted when blocking control xfer is complete or aborted
+    volatile uint8_t sem_result; // result of blocking control xfer
 
     osal_mutex_def_t mutex_def;
-    osal_mutex_t mutex_hdl;    // used to exclusively occupy control pipe
+    osal_mutex_t mutex_hdl;    // serialize blocking control xfers of application tasks
   } control;
 
   uint8_t itf2drv[16];  // map interface number to driver (0xff is invalid)
@@ -148,7 +148,12 @@ static inline void _osal_q_lock(osal_queue_t qhdl)
   (void) qhdl;
 
 #if TUSB_OPT_DEVICE_ENABLED
-  if (qhdl->role == OPT_MODE_DEVICE) dcd_int_disable(TUD_OPT_RHPORT);
+  if (qhdl->role == OPT_MODE_DEVICE)
+  {
+    // device ports share the event queue
+    if (TUSB_OPT_RHPORT_MODE(0) & OPT_MODE_DEVICE) dcd_int_disable(0);
+    if (TUSB_OPT_RHPORT_MODE(1) & OPT_MODE_DEVICE) dcd_int_disable(1);
+  }
 #endif
 
 #if TUSB_OPT_HOST_ENABLED
@@ -162,7 +167,12 @@ static inline void _osal_q_unlock(osal_queue_t qhdl)
   (void) qhdl;
 
 #if TUSB_OPT_DEVICE_ENABLED
-  if (qhdl->role == OPT_MODE_DEVICE) dcd_int_enable(TUD_OPT_RHPORT);
+  if (qhdl->role == OPT_MODE_DEVICE)
+  {
+    // device ports share the event queue
+    if (TUSB_OPT_RHPORT_MODE(0) & OPT_MODE_DEVICE) dcd_int_enable(0);
+    if (TUSB_OPT_RHPORT_MODE(1) & OPT_MODE_DEVICE) dcd_int_enable(1);
+  }
 #endif
 
 #if TUSB_OPT_HOST_ENABLED
@@ -176,8 +186,11 @@ static inline osal_queue_t osal_queue_create(osal_queue_def_t* qdef)
   return (osal_queue_t) qdef;
 }
 
-static inline bool osal_queue_receive(osal_queue_t qhdl, void* data)
+// msec is not used, there is nothing to wait for without RTOS
+static inline bool osal_queue_receive(osal_queue_t qhdl, void* data, uint32_t msec)
 {
+  (void) msec;
+
   _osal_q_lock(qhdl);
   bool success = tu_fifo_read(&qhdl->ff, data);
   _osal_q_unlock(qhdl);
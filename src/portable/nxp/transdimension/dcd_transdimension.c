@@ -271,10 +271,15 @@ typedef struct {
   // Must be at 2K alignment
   dcd_qhd_t qhd[QHD_MAX] TU_ATTR_ALIGNED(64);
   dcd_qtd_t qtd[QHD_MAX] TU_ATTR_ALIGNED(32); // for portability, TinyUSB only queue 1 TD for each Qhd
-}dcd_data_t;
+} TU_ATTR_ALIGNED(2048) dcd_data_t;
 
-CFG_TUSB_MEM_SECTION TU_ATTR_ALIGNED(2048)
-static dcd_data_t _dcd_data;
+// One endpoint list per controller when both ports are used as device
+CFG_TUSB_MEM_SECTION static dcd_data_t _dcd_data[TUD_OPT_RHPORT_COUNT];
+
+static inline dcd_data_t* get_dcd_data(uint8_t rhport)
+{
+  return &_dcd_data[TUD_RHPORT_INDEX(rhport)];
+}
 
 //--------------------------------------------------------------------+
 // CONTROLLER API
@@ -284,6 +289,7 @@ static dcd_data_t _dcd_data;
 static void bus_reset(uint8_t rhport)
 {
   dcd_registers_t* dcd_reg = _dcd_controller[rhport].regs;
+  dcd_data_t* dcd_data = get_dcd_data(rhport);
 
   // The reset value for all endpoint types is the control endpoint. If one endpoint
   // direction is enabled and the paired endpoint of opposite direction is disabled, then the
@@ -309,19 +315,20 @@ static void bus_reset(uint8_t rhport)
   // read reset bit in portsc
 
   //------------- Queue Head & Queue TD -------------//
-  tu_memclr(&_dcd_data, sizeof(dcd_data_t));
+  tu_memclr(dcd_data, sizeof(dcd_data_t));
 
   //------------- Set up Control Endpoints (0 OUT, 1 IN) -------------//
-  _dcd_data.qhd[0].zero_length_termination = _dcd_data.qhd[1].zero_length_termination = 1;
-  _dcd_data.qhd[0].max_package_size = _dcd_data.qhd[1].max_package_size = CFG_TUD_ENDPOINT0_SIZE;
-  _dcd_data.qhd[0].qtd_overlay.next = _dcd_data.qhd[1].qtd_overlay.next = QTD_NEXT_INVALID;
+  dcd_data->qhd[0].zero_length_termination = dcd_data->qhd[1].zero_length_termination = 1;
+  dcd_data->qhd[0].max_package_size = dcd_data->qhd[1].max_package_size = CFG_TUD_ENDPOINT0_SIZE;
+  dcd_data->qhd[0].qtd_overlay.next = dcd_data->qhd[1].qtd_overlay.next = QTD_NEXT_INVALID;
 
-  _dcd_data.qhd[0].int_on_setup = 1; // OUT only
+  dcd_data->qhd[0].int_on_setup = 1; // OUT only
 }
 
 void dcd_init(uint8_t rhport)
 {
-  tu_memclr(&_dcd_data, sizeof(dcd_data_t));
+  dcd_data_t* dcd_data = get_dcd_data(rhport);
+  tu_memclr(dcd_data, sizeof(dcd_data_t));
 
   dcd_registers_t* dcd_reg = _dcd_controller[rhport].regs;
 
@@ -336,9 +343,9 @@ void dcd_init(uint8_t rhport)
   // TODO Force fullspeed on non-highspeed port
   // dcd_reg->PORTSC1 = PORTSC1_FORCE_FULL_SPEED;
 
-  CleanInvalidateDCache_by_Addr((uint32_t*) &_dcd_data, sizeof(dcd_data_t));
+  CleanInvalidateDCache_by_Addr((uint32_t*) dcd_data, sizeof(dcd_data_t));
 
-  dcd_reg->ENDPTLISTADDR = (uint32_t) _dcd_data.qhd; // Endpoint List Address has to be 2K alignment
+  dcd_reg->ENDPTLISTADDR = (uint32_t) dcd_data->qhd; // Endpoint List Address has to be 2K alignment
   dcd_reg->USBSTS  = dcd_reg->USBSTS;
   dcd_reg->USBINTR = INTR_USB | INTR_ERROR | INTR_PORT_CHANGE | INTR_RESET | INTR_SUSPEND /*| INTR_SOF*/;
 
@@ -444,14 +451,15 @@ bool dcd_edpt_open(uint8_t rhport, tusb_desc_endpoint_t const * p_endpoint_desc)
   TU_ASSERT( epnum < _dcd_controller[rhport].ep_count );
 
   //------------- Prepare Queue Head -------------//
-  dcd_qhd_t * p_qhd = &_dcd_data.qhd[ep_idx];
+  dcd_data_t* dcd_data = get_dcd_data(rhport);
+  dcd_qhd_t * p_qhd = &dcd_data->qhd[ep_idx];
   tu_memclr(p_qhd, sizeof(dcd_qhd_t));
 
   p_qhd->zero_length_termination = 1;
   p_qhd->max_package_size        = p_endpoint_desc->wMaxPacketSize.size;
   p_qhd->qtd_overlay.next        = QTD_NEXT_INVALID;
 
-  CleanInvalidateDCache_by_Addr((uint32_t*) &_dcd_data, sizeof(dcd_data_t));
+  CleanInvalidateDCache_by_Addr((uint32_t*) dcd_data, sizeof(dcd_data_t));
 
   // Enable EP Control
   dcd_registers_t* dcd_reg = _dcd_controller[rhport].regs;
@@ -474,8 +482,9 @@ bool dcd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t t
     while(dcd_reg->ENDPTSETUPSTAT & TU_BIT(0)) {}
   }
 
-  dcd_qhd_t * p_qhd = &_dcd_data.qhd[ep_idx];
-  dcd_qtd_t * p_qtd = &_dcd_data.qtd[ep_idx];
+  dcd_data_t* dcd_data = get_dcd_data(rhport);
+  dcd_qhd_t * p_qhd = &dcd_data->qhd[ep_idx];
+  dcd_qtd_t * p_qtd = &dcd_data->qtd[ep_idx];
 
   // Force the CPU to flush the buffer. We increase the size by 32 because the call aligns the
   // address to 32-byte boundaries.
@@ -487,7 +496,7 @@ bool dcd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t t
   p_qtd->int_on_complete = true;
   p_qhd->qtd_overlay.next = (uint32_t) p_qtd; // link qtd to qhd
 
-  CleanInvalidateDCache_by_Addr((uint32_t*) &_dcd_data, sizeof(dcd_data_t));
+  CleanInvalidateDCache_by_Addr((uint32_t*) dcd_data, sizeof(dcd_data_t));
 
   // start transfer
   dcd_reg->ENDPTPRIME = TU_BIT( ep_idx2bit(ep_idx) ) ;
@@ -501,6 +510,7 @@ bool dcd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t t
 void dcd_int_handler(uint8_t rhport)
 {
   dcd_registers_t* const dcd_reg = _dcd_controller[rhport].regs;
+  dcd_data_t* dcd_data = get_dcd_data(rhport);
 
   uint32_t const int_enable = dcd_reg->USBINTR;
   uint32_t const int_status = dcd_reg->USBSTS & int_enable;
@@ -528,7 +538,7 @@ void dcd_int_handler(uint8_t rhport)
   }
 
   // Make sure we read the latest version of _dcd_data.
-  CleanInvalidateDCache_by_Addr((uint32_t*) &_dcd_data, sizeof(dcd_data_t));
+  CleanInvalidateDCache_by_Addr((uint32_t*) dcd_data, sizeof(dcd_data_t));
 
   // TODO disconnection does not generate interrupt !!!!!!
 //	if (int_status & INTR_PORT_CHANGE)
@@ -551,7 +561,7 @@ void dcd_int_handler(uint8_t rhport)
       // 23.10.10.2 Operational model for setup transfers
       dcd_reg->ENDPTSETUPSTAT = dcd_reg->ENDPTSETUPSTAT;// acknowledge
 
-      dcd_event_setup_received(rhport, (uint8_t*) &_dcd_data.qhd[0].setup_request, true);
+      dcd_event_setup_received(rhport, (uint8_t*) &dcd_data->qhd[0].setup_request, true);
     }
 
     if ( edpt_complete )
@@ -561,7 +571,7 @@ void dcd_int_handler(uint8_t rhport)
         if ( tu_bit_test(edpt_complete, ep_idx2bit(ep_idx)) )
         {
           // 23.10.12.3 Failed QTD also get ENDPTCOMPLETE set
-          dcd_qtd_t * p_qtd = &_dcd_data.qtd[ep_idx];
+          dcd_qtd_t * p_qtd = &dcd_data->qtd[ep_idx];
 
           uint8_t result = p_qtd->halted  ? XFER_RESULT_STALLED :
               ( p_qtd->xact_err ||p_qtd->buffer_err ) ? XFER_RESULT_FAILED : XFER_RESULT_SUCCESS;
@@ -0,0 +1,1039 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020, Ha Thach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "tusb_option.h"
+
+#if TUSB_OPT_DEVICE_ENABLED && CFG_TUSB_MCU == OPT_MCU_USBIP
+
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include "device/dcd.h"
+#include "device/usbd.h" // descriptor callbacks are needed to answer DEVLIST/IMPORT
+
+/* USB/IP server port.
+ * The device controller is a TCP socket speaking the Linux USB/IP protocol. A background
+ * thread plays the role of the USB interrupt: it owns the socket, decodes URBs from the
+ * client (vhci-hcd or tools/usbip_client.py) and feeds the stack via dcd_event_*().
+ * dcd_int_disable()/dcd_int_enable() lock/unlock the mutex held by that thread while it
+ * runs, which gives OS NONE the same critical section semantics as a real MCU.
+ *
+ * Host URBs are queued per endpoint so the client can keep many transfers in flight,
+ * they are matched against the single transfer the stack queues with dcd_edpt_xfer()
+ * the same way a real bus would split them into packets.
+ *
+ * tud_idle_cb() is provided as WFI equivalent: main thread sleeps on a condition variable
+ * signaled each time the server thread has run.
+ */
+
+// TCP port to listen on, 3240 is the registered USB/IP port
+#ifndef CFG_TUD_USBIP_PORT
+#define CFG_TUD_USBIP_PORT    3240
+#endif
+
+// Bus ID exported to client e.g "usbip attach -r localhost -b 1-1"
+#ifndef CFG_TUD_USBIP_BUSID
+#define CFG_TUD_USBIP_BUSID   "1-1"
+#endif
+
+/*------------------------------------------------------------------*/
+/* MACRO TYPEDEF CONSTANT ENUM
+ *------------------------------------------------------------------*/
+enum
+{
+  USBIP_VERSION    = 0x0111,
+
+  // Operation (before import)
+  OP_REQ_IMPORT    = 0x8003,
+  OP_REP_IMPORT    = 0x0003,
+  OP_REQ_DEVLIST   = 0x8005,
+  OP_REP_DEVLIST   = 0x0005,
+
+  // URB command (after import)
+  USBIP_CMD_SUBMIT = 0x0001,
+  USBIP_CMD_UNLINK = 0x0002,
+  USBIP_RET_SUBMIT = 0x0003,
+  USBIP_RET_UNLINK = 0x0004,
+
+  USBIP_DIR_OUT    = 0,
+  USBIP_DIR_IN     = 1,
+};
+
+enum
+{
+  OP_HEADER_SIZE     = 8,   // version, code, status
+  OP_DEVICE_SIZE     = 312, // usbip_usb_device
+  OP_BUSID_SIZE      = 32,
+  OP_PATH_SIZE       = 256,
+  URB_HEADER_SIZE    = 48,  // usbip_header_basic + command specific part
+  ISO_DESC_SIZE      = 16,
+
+  URB_ZERO_PACKET    = 0x0040, // transfer flags
+  ISO_PACKETS_NONE   = 0xFFFFFFFFu,
+
+  // Linux usb_device_speed
+  USBIP_SPEED_FULL   = 2,
+  USBIP_SPEED_HIGH   = 3,
+
+  EP_MAX             = 16,
+  RX_CHUNK_SIZE      = 16*1024
+};
+
+// A host URB submitted by the client
+typedef struct usbip_urb
+{
+  struct usbip_urb* next;
+
+  uint32_t seqnum;
+  uint32_t flags;
+  uint32_t length;  // transfer_buffer_length
+  uint32_t actual;  // bytes moved to/from the device so far
+  uint8_t  setup[8];
+
+  uint8_t  buffer[];
+}usbip_urb_t;
+
+// Endpoint state: URBs queued by the client and the transfer queued by the stack
+typedef struct
+{
+  usbip_urb_t* head;
+  usbip_urb_t* tail;
+
+  uint8_t* buffer;
+  uint16_t total_len;
+  uint16_t actual_len;
+  uint16_t mps;
+
+  bool active;  // stack has a transfer queued
+  bool stalled;
+}usbip_edpt_t;
+
+typedef struct
+{
+  uint8_t* buf;
+  size_t   len;
+  size_t   size;
+}usbip_buf_t;
+
+static struct
+{
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  irq_cond;  // signaled after each run of server thread, for tud_idle_cb()
+  int             wake_fd[2];
+  int             listen_fd;
+  int             client_fd;
+
+  volatile bool   connected; // D+ pull-up, set by dcd_connect()
+  bool            imported;  // client has attached, URB phase
+
+  usbip_edpt_t    edpt[EP_MAX][2];
+  usbip_urb_t*    ctrl_urb;  // control URB whose setup is being handled by the stack
+
+  usbip_buf_t     rx;
+  usbip_buf_t     tx;
+}_usbip;
+
+//--------------------------------------------------------------------+
+// Buffer helpers, USB/IP is big endian on the wire
+//--------------------------------------------------------------------+
+static inline uint32_t get_u32(uint8_t const* p)
+{
+  return tu_u32(p[0], p[1], p[2], p[3]);
+}
+
+static inline uint16_t get_u16(uint8_t const* p)
+{
+  return tu_u16(p[0], p[1]);
+}
+
+static inline void put_u32(uint8_t* p, uint32_t value)
+{
+  p[0] = U32_B1_U8(value); p[1] = U32_B2_U8(value); p[2] = U32_B3_U8(value); p[3] = U32_B4_U8(value);
+}
+
+static inline void put_u16(uint8_t* p, uint16_t value)
+{
+  p[0] = tu_u16_high(value); p[1] = tu_u16_low(value);
+}
+
+// Reserve len bytes at the end of buffer, contents are zeroed
+static uint8_t* buf_reserve(usbip_buf_t* b, size_t len)
+{
+  if ( b->len + len > b->size )
+  {
+    size_t new_size = tu_max32(2*b->size, RX_CHUNK_SIZE);
+    while ( new_size < b->len + len ) new_size *= 2;
+
+    uint8_t* new_buf = (uint8_t*) realloc(b->buf, new_size);
+    if ( !new_buf ) abort();
+
+    b->buf  = new_buf;
+    b->size = new_size;
+  }
+
+  uint8_t* p = b->buf + b->len;
+  memset(p, 0, len);
+  b->len += len;
+
+  return p;
+}
+
+static inline void wake_thread(void)
+{
+  uint8_t const dummy = 0;
+  (void) !write(_usbip.wake_fd[1], &dummy, 1);
+}
+
+//--------------------------------------------------------------------+
+// Reply
+//--------------------------------------------------------------------+
+static void reply_submit(usbip_urb_t* urb, bool dir_in, int32_t status)
+{
+  uint32_t const data_len = (dir_in && status == 0) ? urb->actual : 0;
+  uint8_t* p = buf_reserve(&_usbip.tx, URB_HEADER_SIZE + data_len);
+
+  put_u32(p +  0, USBIP_RET_SUBMIT);
+  put_u32(p +  4, urb->seqnum);
+  // devid, direction, ep are zero in reply
+  put_u32(p + 20, (uint32_t) status);
+  put_u32(p + 24, urb->actual);
+  // start_frame, number_of_packets, error_count are zero for non-iso
+
+  if ( data_len ) memcpy(p + URB_HEADER_SIZE, urb->buffer, data_len);
+}
+
+static void reply_unlink(uint32_t seqnum, int32_t status)
+{
+  uint8_t* p = buf_reserve(&_usbip.tx, URB_HEADER_SIZE);
+
+  put_u32(p +  0, USBIP_RET_UNLINK);
+  put_u32(p +  4, seqnum);
+  put_u32(p + 20, (uint32_t) status);
+}
+
+// Complete URB back to client and free it
+static void urb_complete(usbip_urb_t* urb, bool dir_in, int32_t status)
+{
+  reply_submit(urb, dir_in, status);
+  free(urb);
+}
+
+static usbip_urb_t* urb_pop(usbip_edpt_t* ep)
+{
+  usbip_urb_t* urb = ep->head;
+  if ( urb )
+  {
+    ep->head = urb->next;
+    if ( !ep->head ) ep->tail = NULL;
+    urb->next = NULL;
+  }
+  return urb;
+}
+
+static void urb_push(usbip_edpt_t* ep, usbip_urb_t* urb)
+{
+  urb->next = NULL;
+  if ( ep->tail ) ep->tail->next = urb;
+  else            ep->head       = urb;
+  ep->tail = urb;
+}
+
+// Complete all queued URBs of an endpoint with status
+static void edpt_flush(usbip_edpt_t* ep, bool dir_in, int32_t status)
+{
+  usbip_urb_t* urb;
+  while ( (urb = urb_pop(ep)) != NULL ) urb_complete(urb, dir_in, status);
+}
+
+//--------------------------------------------------------------------+
+// Transfer matching
+//--------------------------------------------------------------------+
+static void xfer_complete(uint8_t ep_addr, usbip_edpt_t* ep, uint16_t len)
+{
+  ep->active = false;
+  dcd_event_xfer_complete(0, ep_addr, len, XFER_RESULT_SUCCESS, true);
+}
+
+// Deliver next control URB's setup packet to the stack if idle
+static void ctrl_service(void)
+{
+  if ( _usbip.ctrl_urb ) return;
+
+  usbip_urb_t* urb = urb_pop(&_usbip.edpt[0][TUSB_DIR_OUT]);
+  if ( !urb ) return;
+
+  _usbip.ctrl_urb = urb;
+  _usbip.edpt[0][0].active = _usbip.edpt[0][1].active = false;
+
+  dcd_event_setup_received(0, urb->setup, true);
+}
+
+// Control endpoint transfer (data or status stage) queued by the stack
+static void ctrl_xfer(uint8_t dir, uint8_t* buffer, uint16_t total_bytes)
+{
+  usbip_urb_t* urb = _usbip.ctrl_urb;
+  uint8_t const ep_addr = tu_edpt_addr(0, dir);
+  usbip_edpt_t* ep = &_usbip.edpt[0][dir];
+
+  // Stack is responding to a request that has been unlinked or reset
+  if ( !urb ) return;
+
+  uint8_t const setup_dir = (urb->setup[0] & TUSB_DIR_IN_MASK) ? TUSB_DIR_IN : TUSB_DIR_OUT;
+
+  if ( dir == setup_dir )
+  {
+    // Data stage
+    uint16_t const len = (uint16_t) tu_min32(total_bytes, urb->length - urb->actual);
+
+    if ( dir == TUSB_DIR_IN )
+    {
+      memcpy(urb->buffer + urb->actual, buffer, len);
+      urb->actual += len;
+
+      // report full length as sent, excess is simply not read by host
+      xfer_complete(ep_addr, ep, total_bytes);
+    }else
+    {
+      memcpy(buffer, urb->buffer + urb->actual, len);
+      urb->actual += len;
+
+      xfer_complete(ep_addr, ep, len);
+    }
+  }else
+  {
+    // Status stage: request is complete
+    xfer_complete(ep_addr, ep, 0);
+
+    _usbip.ctrl_urb = NULL;
+    urb_complete(urb, setup_dir == TUSB_DIR_IN, 0);
+
+    ctrl_service();
+  }
+}
+
+// Move data between queued host URBs and the stack's transfer of a non-control endpoint
+static void edpt_service(uint8_t epnum, uint8_t dir)
+{
+  usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+  uint8_t const ep_addr = tu_edpt_addr(epnum, dir);
+
+  while ( ep->active && ep->head && !ep->stalled )
+  {
+    usbip_urb_t* urb = ep->head;
+    uint32_t const len = tu_min32(urb->length - urb->actual, (uint32_t) (ep->total_len - ep->actual_len));
+
+    if ( dir == TUSB_DIR_OUT )
+    {
+      memcpy(ep->buffer + ep->actual_len, urb->buffer + urb->actual, len);
+      urb->actual    += len;
+      ep->actual_len += (uint16_t) len;
+
+      // Host URB ends with a short packet unless it is a multiple of packet size without ZLP flag
+      bool const urb_done  = (urb->actual == urb->length);
+      bool const short_pkt = urb_done && ( (urb->length % ep->mps) || (urb->length == 0) || (urb->flags & URB_ZERO_PACKET) );
+
+      if ( urb_done ) urb_complete(urb_pop(ep), false, 0);
+      if ( short_pkt || (ep->actual_len == ep->total_len) ) xfer_complete(ep_addr, ep, ep->actual_len);
+    }else
+    {
+      memcpy(urb->buffer + urb->actual, ep->buffer + ep->actual_len, len);
+      urb->actual    += len;
+      ep->actual_len += (uint16_t) len;
+
+      // Device transfer ends with a short packet unless it is a multiple of packet size
+      bool const xfer_done = (ep->actual_len == ep->total_len);
+      bool const short_pkt = xfer_done && ( (ep->total_len % ep->mps) || (ep->total_len == 0) );
+
+      if ( (urb->actual == urb->length) || short_pkt ) urb_complete(urb_pop(ep), true, 0);
+      if ( xfer_done ) xfer_complete(ep_addr, ep, ep->total_len);
+    }
+  }
+}
+
+//--------------------------------------------------------------------+
+// Connection
+//--------------------------------------------------------------------+
+
+// Reset all endpoints, outstanding URBs are dropped without reply
+static void edpt_reset_all(void)
+{
+  free(_usbip.ctrl_urb);
+  _usbip.ctrl_urb = NULL;
+
+  for(uint8_t epnum = 0; epnum < EP_MAX; epnum++)
+  {
+    for(uint8_t dir = 0; dir < 2; dir++)
+    {
+      usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+      usbip_urb_t* urb;
+      while ( (urb = urb_pop(ep)) != NULL ) free(urb);
+
+      tu_varclr(ep);
+    }
+  }
+
+  _usbip.edpt[0][0].mps = _usbip.edpt[0][1].mps = CFG_TUD_ENDPOINT0_SIZE;
+}
+
+static void client_close(void)
+{
+  if ( _usbip.client_fd < 0 ) return;
+
+  TU_LOG2("USBIP client disconnected\r\n");
+
+  close(_usbip.client_fd);
+  _usbip.client_fd = -1;
+
+  _usbip.rx.len = 0;
+  _usbip.tx.len = 0;
+
+  edpt_reset_all();
+
+  if ( _usbip.imported )
+  {
+    _usbip.imported = false;
+    dcd_event_bus_signal(0, DCD_EVENT_UNPLUGGED, true);
+  }
+}
+
+// Fill usbip_usb_device from descriptors, return number of interfaces
+static uint8_t fill_device_info(uint8_t* p)
+{
+  tusb_desc_device_t const* desc_dev = (tusb_desc_device_t const*) tud_descriptor_device_cb();
+  uint8_t const* desc_cfg = tud_descriptor_configuration_cb(0);
+
+  snprintf((char*) p, OP_PATH_SIZE, "/sys/devices/tinyusb/usbip/%s", CFG_TUD_USBIP_BUSID);
+  p += OP_PATH_SIZE;
+
+  snprintf((char*) p, OP_BUSID_SIZE, "%s", CFG_TUD_USBIP_BUSID);
+  p += OP_BUSID_SIZE;
+
+  put_u32(p, 1); p += 4; // busnum
+  put_u32(p, 1); p += 4; // devnum
+  put_u32(p, TUD_OPT_HIGH_SPEED ? USBIP_SPEED_HIGH : USBIP_SPEED_FULL); p += 4;
+
+  put_u16(p, desc_dev->idVendor ); p += 2;
+  put_u16(p, desc_dev->idProduct); p += 2;
+  put_u16(p, desc_dev->bcdDevice); p += 2;
+
+  *p++ = desc_dev->bDeviceClass;
+  *p++ = desc_dev->bDeviceSubClass;
+  *p++ = desc_dev->bDeviceProtocol;
+  *p++ = desc_cfg[5];  // bConfigurationValue, device is not configured until host selects it
+  *p++ = desc_dev->bNumConfigurations;
+  *p++ = desc_cfg[4];  // bNumInterfaces
+
+  return desc_cfg[4];
+}
+
+static void op_reply_devlist(void)
+{
+  uint8_t const* desc_cfg = tud_descriptor_configuration_cb(0);
+  uint16_t const total_len = tu_u16(desc_cfg[3], desc_cfg[2]);
+
+  uint8_t* p = buf_reserve(&_usbip.tx, OP_HEADER_SIZE + 4 + OP_DEVICE_SIZE);
+  put_u16(p, USBIP_VERSION);
+  put_u16(p+2, OP_REP_DEVLIST);
+  put_u32(p+8, 1); // one exported device
+
+  fill_device_info(p + OP_HEADER_SIZE + 4);
+
+  // Interface list: class, subclass, protocol, padding for each alternate 0
+  uint8_t const* desc = desc_cfg;
+  uint8_t const* desc_end = desc_cfg + total_len;
+
+  while ( desc < desc_end )
+  {
+    if ( tu_desc_type(desc) == TUSB_DESC_INTERFACE && ((tusb_desc_interface_t const*) desc)->bAlternateSetting == 0 )
+    {
+      tusb_desc_interface_t const* desc_itf = (tusb_desc_interface_t const*) desc;
+      uint8_t* itf = buf_reserve(&_usbip.tx, 4);
+
+      itf[0] = desc_itf->bInterfaceClass;
+      itf[1] = desc_itf->bInterfaceSubClass;
+      itf[2] = desc_itf->bInterfaceProtocol;
+    }
+
+    desc = tu_desc_next(desc);
+  }
+}
+
+// return true if device is imported
+static bool op_reply_import(uint8_t const* busid)
+{
+  bool const ok = _usbip.connected && (0 == strncmp((char const*) busid, CFG_TUD_USBIP_BUSID, OP_BUSID_SIZE));
+
+  uint8_t* p = buf_reserve(&_usbip.tx, OP_HEADER_SIZE + (ok ? OP_DEVICE_SIZE : 0));
+  put_u16(p, USBIP_VERSION);
+  put_u16(p+2, OP_REP_IMPORT);
+  put_u32(p+4, ok ? 0 : 1);
+
+  if ( ok ) fill_device_info(p + OP_HEADER_SIZE);
+
+  return ok;
+}
+
+//--------------------------------------------------------------------+
+// Command parser
+//--------------------------------------------------------------------+
+
+// Parse one CMD_SUBMIT, return number of bytes consumed or 0 if incomplete
+static size_t cmd_submit(uint8_t const* p, size_t avail)
+{
+  uint32_t const seqnum      = get_u32(p +  4);
+  uint32_t const direction   = get_u32(p + 12);
+  uint32_t const epnum       = get_u32(p + 16);
+  uint32_t const flags       = get_u32(p + 20);
+  uint32_t const length      = get_u32(p + 24);
+  uint32_t const num_packets = get_u32(p + 32);
+
+  bool const is_iso = (num_packets != 0) && (num_packets != ISO_PACKETS_NONE);
+
+  size_t total = URB_HEADER_SIZE;
+  if ( direction == USBIP_DIR_OUT ) total += length;
+  if ( is_iso ) total += (size_t) num_packets * ISO_DESC_SIZE;
+
+  if ( avail < total ) return 0;
+
+  usbip_urb_t* urb = (usbip_urb_t*) malloc(sizeof(usbip_urb_t) + length);
+  if ( !urb ) abort();
+
+  urb->next   = NULL;
+  urb->seqnum = seqnum;
+  urb->flags  = flags;
+  urb->length = length;
+  urb->actual = 0;
+  memcpy(urb->setup, p + 40, 8);
+  if ( direction == USBIP_DIR_OUT ) memcpy(urb->buffer, p + URB_HEADER_SIZE, length);
+
+  uint8_t const dir = (direction == USBIP_DIR_IN) ? TUSB_DIR_IN : TUSB_DIR_OUT;
+
+  if ( is_iso || epnum >= EP_MAX )
+  {
+    // Isochronous is not supported
+    urb_complete(urb, dir == TUSB_DIR_IN, -EINVAL);
+  }
+  else if ( epnum == 0 )
+  {
+    // All control URBs share one queue regardless of direction
+    urb_push(&_usbip.edpt[0][TUSB_DIR_OUT], urb);
+    ctrl_service();
+  }
+  else
+  {
+    usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+
+    if ( ep->stalled )
+    {
+      urb_complete(urb, dir == TUSB_DIR_IN, -EPIPE);
+    }else
+    {
+      urb_push(ep, urb);
+      edpt_service((uint8_t) epnum, dir);
+    }
+  }
+
+  return total;
+}
+
+static void cmd_unlink(uint8_t const* p)
+{
+  uint32_t const seqnum        = get_u32(p + 4);
+  uint32_t const unlink_seqnum = get_u32(p + 20);
+
+  for(uint8_t epnum = 0; epnum < EP_MAX; epnum++)
+  {
+    for(uint8_t dir = 0; dir < 2; dir++)
+    {
+      usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+      usbip_urb_t* prev = NULL;
+
+      for(usbip_urb_t* urb = ep->head; urb; prev = urb, urb = urb->next)
+      {
+        if ( urb->seqnum != unlink_seqnum ) continue;
+
+        if ( prev ) prev->next = urb->next;
+        else        ep->head   = urb->next;
+        if ( ep->tail == urb ) ep->tail = prev;
+
+        free(urb);
+        reply_unlink(seqnum, -ECONNRESET);
+        return;
+      }
+    }
+  }
+
+  // Not found: already completed (or in progress on control endpoint)
+  reply_unlink(seqnum, 0);
+}
+
+// Process all complete commands in rx buffer
+static void process_rx(void)
+{
+  size_t pos = 0;
+
+  while ( _usbip.client_fd >= 0 )
+  {
+    uint8_t const* p = _usbip.rx.buf + pos;
+    size_t const avail = _usbip.rx.len - pos;
+
+    if ( !_usbip.imported )
+    {
+      if ( avail < OP_HEADER_SIZE ) break;
+
+      uint16_t const code = get_u16(p+2);
+
+      if ( code == OP_REQ_DEVLIST )
+      {
+        pos += OP_HEADER_SIZE;
+        op_reply_devlist();
+      }
+      else if ( code == OP_REQ_IMPORT )
+      {
+        if ( avail < OP_HEADER_SIZE + OP_BUSID_SIZE ) break;
+        pos += OP_HEADER_SIZE + OP_BUSID_SIZE;
+
+        if ( op_reply_import(p + OP_HEADER_SIZE) )
+        {
+          TU_LOG2("USBIP device imported\r\n");
+          _usbip.imported = true;
+          edpt_reset_all();
+          dcd_event_bus_reset(0, TUD_OPT_HIGH_SPEED ? TUSB_SPEED_HIGH : TUSB_SPEED_FULL, true);
+        }
+      }
+      else
+      {
+        TU_LOG1("USBIP unknown operation %04X\r\n", code);
+        client_close();
+      }
+    }
+    else
+    {
+      if ( avail < URB_HEADER_SIZE ) break;
+
+      uint32_t const command = get_u32(p);
+
+      if ( command == USBIP_CMD_SUBMIT )
+      {
+        size_t const consumed = cmd_submit(p, avail);
+        if ( consumed == 0 ) break;
+        pos += consumed;
+      }
+      else if ( command == USBIP_CMD_UNLINK )
+      {
+        cmd_unlink(p);
+        pos += URB_HEADER_SIZE;
+      }
+      else
+      {
+        TU_LOG1("USBIP unknown command %lu\r\n", (unsigned long) command);
+        client_close();
+      }
+    }
+  }
+
+  if ( _usbip.client_fd < 0 ) return;
+
+  // keep partial command for next read
+  _usbip.rx.len -= pos;
+  if ( _usbip.rx.len ) memmove(_usbip.rx.buf, _usbip.rx.buf + pos, _usbip.rx.len);
+}
+
+// Write out all pending replies
+static void flush_tx(void)
+{
+  size_t sent = 0;
+
+  while ( (_usbip.client_fd >= 0) && (sent < _usbip.tx.len) )
+  {
+    ssize_t const count = send(_usbip.client_fd, _usbip.tx.buf + sent, _usbip.tx.len - sent, MSG_NOSIGNAL);
+
+    if ( count > 0 )
+    {
+      sent += (size_t) count;
+    }
+    else if ( count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) )
+    {
+      struct pollfd pfd = { .fd = _usbip.client_fd, .events = POLLOUT };
+      poll(&pfd, 1, -1);
+    }
+    else
+    {
+      client_close();
+    }
+  }
+
+  _usbip.tx.len = 0;
+}
+
+static void read_client(void)
+{
+  while (1)
+  {
+    uint8_t* p = buf_reserve(&_usbip.rx, RX_CHUNK_SIZE);
+    _usbip.rx.len -= RX_CHUNK_SIZE;
+
+    ssize_t const count = recv(_usbip.client_fd, p, RX_CHUNK_SIZE, 0);
+
+    if ( count > 0 )
+    {
+      _usbip.rx.len += (size_t) count;
+    }
+    else
+    {
+      if ( count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) ) client_close();
+      break;
+    }
+  }
+}
+
+static void accept_client(void)
+{
+  int const fd = accept(_usbip.listen_fd, NULL, NULL);
+  if ( fd < 0 ) return;
+
+  // one client at a time
+  if ( _usbip.client_fd >= 0 )
+  {
+    close(fd);
+    return;
+  }
+
+  int const one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+  TU_LOG2("USBIP client connected\r\n");
+  _usbip.client_fd = fd;
+}
+
+// Server thread, act as USB interrupt
+static void* usbip_thread(void* param)
+{
+  (void) param;
+
+  while (1)
+  {
+    struct pollfd pfd[3] =
+    {
+      { .fd = _usbip.wake_fd[0], .events = POLLIN },
+      { .fd = _usbip.listen_fd , .events = POLLIN },
+      { .fd = _usbip.client_fd , .events = POLLIN },
+    };
+
+    if ( poll(pfd, _usbip.client_fd >= 0 ? 3 : 2, -1) < 0 ) continue;
+
+    if ( pfd[0].revents & POLLIN )
+    {
+      uint8_t dummy[64];
+      (void) !read(_usbip.wake_fd[0], dummy, sizeof(dummy));
+    }
+
+    pthread_mutex_lock(&_usbip.mutex);
+
+    if ( pfd[1].revents & POLLIN ) accept_client();
+
+    if ( (_usbip.client_fd >= 0) && (pfd[2].revents & (POLLIN | POLLHUP | POLLERR)) )
+    {
+      read_client();
+      if ( _usbip.client_fd >= 0 ) process_rx();
+    }
+
+    // Reply in one batch
+    flush_tx();
+
+    pthread_cond_broadcast(&_usbip.irq_cond);
+    pthread_mutex_unlock(&_usbip.mutex);
+  }
+
+  return NULL;
+}
+
+/*------------------------------------------------------------------*/
+/* Device API
+ *------------------------------------------------------------------*/
+
+// Initialize controller to device mode
+void dcd_init (uint8_t rhport)
+{
+  (void) rhport;
+
+  tu_varclr(&_usbip);
+  _usbip.client_fd = -1;
+  edpt_reset_all();
+
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&_usbip.mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+
+  pthread_condattr_t cond_attr;
+  pthread_condattr_init(&cond_attr);
+  pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&_usbip.irq_cond, &cond_attr);
+  pthread_condattr_destroy(&cond_attr);
+
+  TU_ASSERT(0 == pipe(_usbip.wake_fd), );
+  fcntl(_usbip.wake_fd[0], F_SETFL, fcntl(_usbip.wake_fd[0], F_GETFL) | O_NONBLOCK);
+  fcntl(_usbip.wake_fd[1], F_SETFL, fcntl(_usbip.wake_fd[1], F_GETFL) | O_NONBLOCK);
+
+  _usbip.listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  TU_ASSERT(_usbip.listen_fd >= 0, );
+
+  int const one = 1;
+  setsockopt(_usbip.listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  struct sockaddr_in addr =
+  {
+    .sin_family      = AF_INET,
+    .sin_port        = htons(CFG_TUD_USBIP_PORT),
+    .sin_addr.s_addr = htonl(INADDR_ANY)
+  };
+
+  TU_ASSERT(0 == bind(_usbip.listen_fd, (struct sockaddr*) &addr, sizeof(addr)), );
+  TU_ASSERT(0 == listen(_usbip.listen_fd, 1), );
+
+  TU_LOG2("USBIP listening on port %u\r\n", CFG_TUD_USBIP_PORT);
+
+  pthread_create(&_usbip.thread, NULL, usbip_thread, NULL);
+}
+
+// Enable device interrupt
+void dcd_int_enable (uint8_t rhport)
+{
+  (void) rhport;
+  pthread_mutex_unlock(&_usbip.mutex);
+}
+
+// Disable device interrupt
+void dcd_int_disable (uint8_t rhport)
+{
+  (void) rhport;
+  pthread_mutex_lock(&_usbip.mutex);
+}
+
+// Idle hook of tud_task_ext(), weak so that application can still provide its own.
+// Event is checked with "interrupt" disabled (mutex held), pthread_cond_wait() releases it
+// atomically when sleeping so that an event queued in between is not missed.
+TU_ATTR_WEAK void tud_idle_cb(uint32_t timeout_ms)
+{
+  pthread_mutex_lock(&_usbip.mutex);
+
+  if ( !tud_task_event_ready() )
+  {
+    if ( timeout_ms == UINT32_MAX )
+    {
+      pthread_cond_wait(&_usbip.irq_cond, &_usbip.mutex);
+    }else
+    {
+      struct timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      ts.tv_sec  += timeout_ms / 1000;
+      ts.tv_nsec += (long) (timeout_ms % 1000) * 1000000L;
+      if ( ts.tv_nsec >= 1000000000L )
+      {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+      }
+
+      pthread_cond_timedwait(&_usbip.irq_cond, &_usbip.mutex, &ts);
+    }
+  }
+
+  pthread_mutex_unlock(&_usbip.mutex);
+}
+
+// Receive Set Address request, mcu port must also include status IN response
+void dcd_set_address (uint8_t rhport, uint8_t dev_addr)
+{
+  (void) dev_addr;
+
+  // vhci-hcd normally handles SET_ADDRESS itself, respond with status in case a client forwards it
+  dcd_edpt_xfer(rhport, tu_edpt_addr(0, TUSB_DIR_IN), NULL, 0);
+}
+
+// Wake up host
+void dcd_remote_wakeup (uint8_t rhport)
+{
+  (void) rhport;
+}
+
+// Connect by enabling internal pull-up resistor on D+/D-
+void dcd_connect(uint8_t rhport)
+{
+  (void) rhport;
+  _usbip.connected = true;
+}
+
+// Disconnect by disabling internal pull-up resistor on D+/D-
+void dcd_disconnect(uint8_t rhport)
+{
+  (void) rhport;
+
+  pthread_mutex_lock(&_usbip.mutex);
+  _usbip.connected = false;
+  client_close();
+  pthread_mutex_unlock(&_usbip.mutex);
+}
+
+//--------------------------------------------------------------------+
+// Endpoint API
+//--------------------------------------------------------------------+
+
+// Configure endpoint's registers according to descriptor
+bool dcd_edpt_open (uint8_t rhport, tusb_desc_endpoint_t const * ep_desc)
+{
+  (void) rhport;
+
+  uint8_t const epnum = tu_edpt_number(ep_desc->bEndpointAddress);
+  uint8_t const dir   = tu_edpt_dir(ep_desc->bEndpointAddress);
+
+  TU_ASSERT(epnum < EP_MAX);
+
+  // Isochronous is not supported
+  TU_VERIFY(ep_desc->bmAttributes.xfer != TUSB_XFER_ISOCHRONOUS);
+
+  pthread_mutex_lock(&_usbip.mutex);
+
+  usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+  ep->mps     = ep_desc->wMaxPacketSize.size;
+  ep->active  = false;
+  ep->stalled = false;
+
+  pthread_mutex_unlock(&_usbip.mutex);
+
+  return true;
+}
+
+void dcd_edpt_close (uint8_t rhport, uint8_t ep_addr)
+{
+  (void) rhport;
+
+  uint8_t const epnum = tu_edpt_number(ep_addr);
+  uint8_t const dir   = tu_edpt_dir(ep_addr);
+
+  pthread_mutex_lock(&_usbip.mutex);
+  _usbip.edpt[epnum][dir].active = false;
+  pthread_mutex_unlock(&_usbip.mutex);
+}
+
+// Submit a transfer, When complete dcd_event_xfer_complete() is invoked to notify the stack
+bool dcd_edpt_xfer (uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t total_bytes)
+{
+  (void) rhport;
+
+  uint8_t const epnum = tu_edpt_number(ep_addr);
+  uint8_t const dir   = tu_edpt_dir(ep_addr);
+
+  TU_ASSERT(epnum < EP_MAX);
+
+  pthread_mutex_lock(&_usbip.mutex);
+
+  usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+  ep->buffer     = buffer;
+  ep->total_len  = total_bytes;
+  ep->actual_len = 0;
+  ep->active     = true;
+
+  if ( epnum == 0 )
+  {
+    ctrl_xfer(dir, buffer, total_bytes);
+  }else
+  {
+    edpt_service(epnum, dir);
+  }
+
+  // completed URBs are sent by server thread
+  bool const has_reply = (_usbip.tx.len > 0);
+
+  pthread_mutex_unlock(&_usbip.mutex);
+
+  if ( has_reply ) wake_thread();
+
+  return true;
+}
+
+// Stall endpoint
+void dcd_edpt_stall (uint8_t rhport, uint8_t ep_addr)
+{
+  (void) rhport;
+
+  uint8_t const epnum = tu_edpt_number(ep_addr);
+  uint8_t const dir   = tu_edpt_dir(ep_addr);
+
+  pthread_mutex_lock(&_usbip.mutex);
+
+  if ( epnum == 0 )
+  {
+    // Control stall only affects current request
+    usbip_urb_t* urb = _usbip.ctrl_urb;
+    if ( urb )
+    {
+      _usbip.ctrl_urb = NULL;
+      urb_complete(urb, urb->setup[0] & TUSB_DIR_IN_MASK, -EPIPE);
+      ctrl_service();
+    }
+  }else
+  {
+    usbip_edpt_t* ep = &_usbip.edpt[epnum][dir];
+    ep->stalled = true;
+    edpt_flush(ep, dir == TUSB_DIR_IN, -EPIPE);
+  }
+
+  bool const has_reply = (_usbip.tx.len > 0);
+
+  pthread_mutex_unlock(&_usbip.mutex);
+
+  if ( has_reply ) wake_thread();
+}
+
+// clear stall, data toggle is also reset to DATA0
+void dcd_edpt_clear_stall (uint8_t rhport, uint8_t ep_addr)
+{
+  (void) rhport;
+
+  uint8_t const epnum = tu_edpt_number(ep_addr);
+  uint8_t const dir   = tu_edpt_dir(ep_addr);
+
+  pthread_mutex_lock(&_usbip.mutex);
+
+  _usbip.edpt[epnum][dir].stalled = false;
+  if ( epnum ) edpt_service(epnum, dir);
+
+  pthread_mutex_unlock(&_usbip.mutex);
+}
+
+#endif
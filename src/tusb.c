@@ -60,6 +60,71 @@ bool tusb_inited(void)
   return _initialized;
 }
 
+/*------------------------------------------------------------------*/
+/* Trace
+ *------------------------------------------------------------------*/
+#if CFG_TUSB_TRACE
+
+tu_trace_ring_t _tu_trace;
+
+uint32_t tusb_trace_read(tusb_trace_record_t* records, uint32_t count)
+{
+  uint32_t n = 0;
+
+  // report dropped records first so that host knows where the gap is
+  uint32_t const dropped = _tu_trace.dropped;
+  if ( dropped && count )
+  {
+    records[n].timestamp = (uint32_t) (CFG_TUSB_TRACE_TIMESTAMP());
+    records[n].id        = TU_TRACE_OVERFLOW;
+    records[n].ep_addr   = 0;
+    records[n].len       = (uint16_t) TU_MIN(dropped, UINT16_MAX);
+    n++;
+
+    // producers may have dropped more since the load
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+    __atomic_fetch_sub(&_tu_trace.dropped, dropped, __ATOMIC_RELAXED);
+#else
+    _tu_trace.dropped -= dropped;
+#endif
+  }
+
+  uint32_t rd_idx = _tu_trace.rd_idx;
+  while ( n < count )
+  {
+    tusb_trace_record_t* rec = &_tu_trace.records[rd_idx & (CFG_TUSB_TRACE_DEPTH-1)];
+
+    // stop at reserved but not yet committed slot
+#if defined(__GNUC__)
+    if ( __atomic_load_n(&rec->id, __ATOMIC_ACQUIRE) == TU_TRACE_NONE ) break;
+#else
+    if ( *((volatile uint8_t*) &rec->id) == TU_TRACE_NONE ) break;
+#endif
+
+    records[n++] = *rec;
+    rec->id = TU_TRACE_NONE;
+    rd_idx++;
+  }
+
+#if defined(__GNUC__)
+  __atomic_store_n(&_tu_trace.rd_idx, rd_idx, __ATOMIC_RELEASE);
+#else
+  _tu_trace.rd_idx = rd_idx;
+#endif
+
+  return n;
+}
+
+#else
+
+uint32_t tusb_trace_read(tusb_trace_record_t* records, uint32_t count)
+{
+  (void) records; (void) count;
+  return 0;
+}
+
+#endif
+
 /*------------------------------------------------------------------*/
 /* Debug
  *------------------------------------------------------------------*/
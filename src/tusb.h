@@ -54,6 +54,10 @@
     #include "class/cdc/cdc_host.h"
   #endif
 
+  #if CFG_TUH_NET
+    #include "class/net/net_host.h"
+  #endif
+
   #if CFG_TUH_VENDOR
     #include "class/vendor/vendor_host.h"
   #endif
@@ -84,6 +88,10 @@
     #include "class/vendor/vendor_device.h"
   #endif
 
+  #if CFG_TUD_VENDOR_BRIDGE
+    #include "class/vendor/vendor_bridge.h"
+  #endif
+
   #if CFG_TUD_USBTMC
     #include "class/usbtmc/usbtmc_device.h"
   #endif
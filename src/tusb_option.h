@@ -96,6 +96,9 @@
 // Dialog
 #define OPT_MCU_DA1469X          1000 ///< Dialog Semiconductor DA1469x
 
+// Simulation
+#define OPT_MCU_USBIP            1100 ///< USB/IP server on a POSIX host
+
 /** @} */
 
 /** \defgroup group_supported_os Supported RTOS
@@ -144,18 +147,26 @@
   #define CFG_TUSB_RHPORT1_MODE OPT_MODE_NONE
 #endif
 
-#if ((CFG_TUSB_RHPORT0_MODE & OPT_MODE_HOST  ) && (CFG_TUSB_RHPORT1_MODE & OPT_MODE_HOST  )) || \
-    ((CFG_TUSB_RHPORT0_MODE & OPT_MODE_DEVICE) && (CFG_TUSB_RHPORT1_MODE & OPT_MODE_DEVICE))
-  #error "TinyUSB currently does not support same modes on more than 1 roothub port"
+// Mode of a roothub port
+#define TUSB_OPT_RHPORT_MODE(_rhport)   ( (_rhport) ? CFG_TUSB_RHPORT1_MODE : CFG_TUSB_RHPORT0_MODE )
+
+#if (CFG_TUSB_RHPORT0_MODE & OPT_MODE_HOST) && (CFG_TUSB_RHPORT1_MODE & OPT_MODE_HOST)
+  #error "TinyUSB currently does not support host mode on more than 1 roothub port"
 #endif
 
 // Which roothub port is configured as host
 #define TUH_OPT_RHPORT          ( (CFG_TUSB_RHPORT0_MODE & OPT_MODE_HOST) ? 0 : ((CFG_TUSB_RHPORT1_MODE & OPT_MODE_HOST) ? 1 : -1) )
 #define TUSB_OPT_HOST_ENABLED   ( TUH_OPT_RHPORT >= 0 )
 
-// Which roothub port is configured as device
+// Which roothub port is configured as device, first one if both are
 #define TUD_OPT_RHPORT          ( (CFG_TUSB_RHPORT0_MODE & OPT_MODE_DEVICE) ? 0 : ((CFG_TUSB_RHPORT1_MODE & OPT_MODE_DEVICE) ? 1 : -1) )
 
+// Number of roothub ports configured as device, each one is an independent device served by tud_task()
+#define TUD_OPT_RHPORT_COUNT    ( ((CFG_TUSB_RHPORT0_MODE & OPT_MODE_DEVICE) ? 1 : 0) + ((CFG_TUSB_RHPORT1_MODE & OPT_MODE_DEVICE) ? 1 : 0) )
+
+// Index of per-port device data, there is only one entry unless both ports are device
+#define TUD_RHPORT_INDEX(_rhport)   ( (TUD_OPT_RHPORT_COUNT > 1) ? (_rhport) : 0 )
+
 #if TUD_OPT_RHPORT == 0
 #define TUD_OPT_HIGH_SPEED      ( CFG_TUSB_RHPORT0_MODE & OPT_MODE_HIGH_SPEED )
 #else
@@ -173,6 +184,21 @@
   #define CFG_TUSB_DEBUG 0
 #endif
 
+// Binary event trace, see common/tusb_trace.h
+#ifndef CFG_TUSB_TRACE
+  #define CFG_TUSB_TRACE 0
+#endif
+
+// Number of trace records (8 bytes each), must be power of 2
+#ifndef CFG_TUSB_TRACE_DEPTH
+  #define CFG_TUSB_TRACE_DEPTH 256
+#endif
+
+// Timestamp for trace record e.g cycle counter (DWT->CYCCNT) or a free running timer
+#ifndef CFG_TUSB_TRACE_TIMESTAMP
+  #define CFG_TUSB_TRACE_TIMESTAMP() 0
+#endif
+
 // place data in accessible RAM for usb controller
 #ifndef CFG_TUSB_MEM_SECTION
   #define CFG_TUSB_MEM_SECTION
@@ -194,6 +220,21 @@
   #define CFG_TUD_ENDPOINT0_SIZE  64
 #endif
 
+// Per endpoint runtime statistics, see tud_stats_*() in device/usbd.h
+#ifndef CFG_TUD_STATS
+  #define CFG_TUD_STATS 0
+#endif
+
+// Timestamp for ISR to callback latency, same as trace by default
+#ifndef CFG_TUD_STATS_TIMESTAMP
+  #define CFG_TUD_STATS_TIMESTAMP() CFG_TUSB_TRACE_TIMESTAMP()
+#endif
+
+// Vendor request (bRequest) to read (IN) or clear (OUT) statistics from host, 0 is disabled
+#ifndef CFG_TUD_STATS_VENDOR_REQUEST
+  #define CFG_TUD_STATS_VENDOR_REQUEST 0
+#endif
+
 #ifndef CFG_TUD_CDC
   #define CFG_TUD_CDC             0
 #endif
@@ -214,6 +255,12 @@
   #define CFG_TUD_VENDOR          0
 #endif
 
+// Bridge of first vendor interface to vendor device of host port, requires CFG_TUH_VENDOR.
+// tud_task() and tuh_task() must run in the same thread
+#ifndef CFG_TUD_VENDOR_BRIDGE
+  #define CFG_TUD_VENDOR_BRIDGE   0
+#endif
+
 #ifndef CFG_TUD_USBTMC
   #define CFG_TUD_USBTMC          0
 #endif
@@ -247,13 +294,108 @@
   //------------- HID CLASS -------------//
   #define HOST_CLASS_HID   ( CFG_TUH_HID_KEYBOARD + CFG_TUH_HID_MOUSE + CFG_TUSB_HOST_HID_GENERIC )
 
+  // report descriptor parser is required by generic interface
+  #ifndef CFG_TUH_HID_PARSER
+    #define CFG_TUH_HID_PARSER  CFG_TUSB_HOST_HID_GENERIC
+  #endif
+
+  // keep interrupt IN endpoints armed and store reports in a ring instead of application driven get_report
+  #ifndef CFG_TUH_HID_RING
+    #define CFG_TUH_HID_RING    0
+  #endif
+
+  // buffer of each device being enumerated, larger configuration descriptor is parsed in multiple reads
   #ifndef CFG_TUSB_HOST_ENUM_BUFFER_SIZE
     #define CFG_TUSB_HOST_ENUM_BUFFER_SIZE 256
   #endif
 
+  // number of devices enumerated concurrently (after SET_ADDRESS), only useful with hub
+  #ifndef CFG_TUH_ENUM_MAX
+    #if CFG_TUH_HUB
+      #define CFG_TUH_ENUM_MAX  2
+    #else
+      #define CFG_TUH_ENUM_MAX  1
+    #endif
+  #endif
+
   //------------- CLASS -------------//
 #endif // TUSB_OPT_HOST_ENABLED
 
+//------------- HOST CLASS -------------//
+// also sizing endpoint and transfer descriptor pools of host controller, see hcd.h
+
+#ifndef CFG_TUH_HUB
+  #define CFG_TUH_HUB             0
+#endif
+
+#ifndef CFG_TUH_CDC
+  #define CFG_TUH_CDC             0
+#endif
+
+#ifndef CFG_TUH_MSC
+  #define CFG_TUH_MSC             0
+#endif
+
+#ifndef CFG_TUH_HID_KEYBOARD
+  #define CFG_TUH_HID_KEYBOARD    0
+#endif
+
+#ifndef CFG_TUH_HID_MOUSE
+  #define CFG_TUH_HID_MOUSE       0
+#endif
+
+#ifndef CFG_TUSB_HOST_HID_GENERIC
+  #define CFG_TUSB_HOST_HID_GENERIC 0
+#endif
+
+#ifndef CFG_TUH_NET
+  #define CFG_TUH_NET             0
+#endif
+
+#ifndef CFG_TUH_VENDOR
+  #define CFG_TUH_VENDOR          0
+#endif
+
+// transfers kept queued on interrupt IN endpoint of each HID interface with CFG_TUH_HID_RING
+#ifndef CFG_TUH_HID_RING_ARMED
+  #define CFG_TUH_HID_RING_ARMED  2
+#endif
+
+// max bytes of a single MSC data stage transfer, larger command is split. Must be multiple of bulk packet size.
+// EHCI chains qTDs (16KB each of any alignment), OHCI chains TDs (4KB each of any alignment)
+#ifndef CFG_TUH_MSC_XFER_CHUNK_SIZE
+  #if CFG_TUSB_MCU == OPT_MCU_LPC175X_6X || CFG_TUSB_MCU == OPT_MCU_LPC40XX
+    #define CFG_TUH_MSC_XFER_CHUNK_SIZE   16384
+  #else
+    #define CFG_TUH_MSC_XFER_CHUNK_SIZE   65536
+  #endif
+#endif
+
+// network adapter receive buffers, every free one is queued on IN endpoint.
+// Size is also max NTB (NCM) or transfer (RNDIS) size requested from device
+#ifndef CFG_TUH_NET_RX_BUFS
+  #define CFG_TUH_NET_RX_BUFS     2
+#endif
+
+#ifndef CFG_TUH_NET_RX_BUFSIZE
+  #define CFG_TUH_NET_RX_BUFSIZE  2048
+#endif
+
+// network adapter transmit buffers, full ones are queued on OUT endpoint together while the last one collects frames
+#ifndef CFG_TUH_NET_TX_BUFS
+  #define CFG_TUH_NET_TX_BUFS     2
+#endif
+
+#ifndef CFG_TUH_NET_TX_BUFSIZE
+  #define CFG_TUH_NET_TX_BUFSIZE  2048
+#endif
+
+// max transfers queued at once on endpoints of a vendor device: IN stream buffers plus an OUT transfer,
+// or host side transfers of vendor bridge (split between both directions)
+#ifndef CFG_TUH_VENDOR_XFER_MAX
+  #define CFG_TUH_VENDOR_XFER_MAX 8
+#endif
+
 
 //------------------------------------------------------------------
 // Configuration Validation
@@ -0,0 +1,146 @@
+#include "../src/class/msc/msc.h"
+#include "../src/device/usbd.h"
+#include "../src/common/tusb_common.h"
+_Static_assert(512 < 
+
+                                      (65535)
+
+                                                , "Size is not correct");
+
+
+
+_Bool 
+
+    tud_msc_set_sense(uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier);
+
+int32_t tud_msc_read10_cb (uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize);
+
+int32_t tud_msc_write10_cb (uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize);
+
+
+
+
+
+
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4]);
+
+
+
+
+
+
+
+
+
+_Bool 
+
+    tud_msc_test_unit_ready_cb(uint8_t lun);
+
+
+
+
+
+
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t* block_count, uint16_t* block_size);
+
+int32_t tud_msc_scsi_cb (uint8_t lun, uint8_t const scsi_cmd[16], void* buffer, uint16_t bufsize);
+
+
+
+
+
+
+
+
+
+__attribute__ ((weak)) uint8_t tud_msc_get_maxlun_cb(void);
+
+
+
+
+
+
+
+
+
+__attribute__ ((weak)) 
+
+            _Bool 
+
+                 tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, 
+
+                                                                             _Bool 
+
+                                                                                  start, 
+
+                                                                                         _Bool 
+
+                                                                                              load_eject);
+
+
+
+
+
+__attribute__ ((weak)) void tud_msc_read10_complete_cb(uint8_t lun);
+
+
+
+
+
+__attribute__ ((weak)) void tud_msc_write10_complete_cb(uint8_t lun);
+
+
+
+
+
+__attribute__ ((weak)) void tud_msc_scsi_complete_cb(uint8_t lun, uint8_t const scsi_cmd[16]);
+
+
+
+
+
+__attribute__ ((weak)) 
+
+            _Bool 
+
+                 tud_msc_is_writable_cb(uint8_t lun);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void mscd_init (void);
+
+void mscd_reset (uint8_t rhport);
+
+uint16_t mscd_open (uint8_t rhport, tusb_desc_interface_t const * itf_desc, uint16_t max_len);
+
+
+
+_Bool 
+
+        mscd_control_request (uint8_t rhport, tusb_control_request_t const * p_request);
+
+
+
+_Bool 
+
+        mscd_control_complete (uint8_t rhport, tusb_control_request_t const * p_request);
+
+
+
+_Bool 
+
+        mscd_xfer_cb (uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
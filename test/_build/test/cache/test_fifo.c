@@ -0,0 +1,364 @@
+#include "_build/temp/_test_fifo.c"
+#include "../src/common/tusb_fifo.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+uint8_t ff_buf[10*sizeof(uint8_t)]; tu_fifo_t ff = { .buffer = ff_buf, .depth = 10, .item_size = sizeof(uint8_t), .overwritable = 
+
+0
+
+, };
+
+
+
+void setUp(void)
+
+{
+
+  tu_fifo_clear(&ff);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_normal(void)
+
+{
+
+  for(uint8_t i=0; i < 10; i++) tu_fifo_write(&ff, &i);
+
+
+
+  for(uint8_t i=0; i < 10; i++)
+
+  {
+
+    uint8_t c;
+
+    tu_fifo_read(&ff, &c);
+
+    UnityAssertEqualNumber((UNITY_INT)((i)), (UNITY_INT)((c)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(53), UNITY_DISPLAY_STYLE_INT);
+
+  }
+
+}
+
+
+
+void test_item_size(void)
+
+{
+
+  uint8_t ff4_buf[10*sizeof(uint32_t)]; tu_fifo_t ff4 = { .buffer = ff4_buf, .depth = 10, .item_size = sizeof(uint32_t), .overwritable = 
+
+ 0
+
+ , };
+
+  tu_fifo_clear(&ff4);
+
+
+
+  uint32_t data[20];
+
+  for(uint32_t i=0; i<sizeof(data)/4; i++) data[i] = i;
+
+
+
+  tu_fifo_write_n(&ff4, data, 10);
+
+
+
+  uint32_t rd[10];
+
+  uint16_t rd_count;
+
+
+
+
+
+  rd_count = tu_fifo_read_n(&ff4, rd, 5);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(72), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualIntArray(( const void*)((data)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(73), UNITY_DISPLAY_STYLE_UINT32, UNITY_ARRAY_TO_ARRAY);
+
+
+
+  tu_fifo_write_n(&ff4, data+10, 5);
+
+
+
+
+
+  rd_count = tu_fifo_read_n(&ff4, rd, 10);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(79), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualIntArray(( const void*)((data+5)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(80), UNITY_DISPLAY_STYLE_UINT32, UNITY_ARRAY_TO_ARRAY);
+
+}
+
+
+
+void test_read_n(void)
+
+{
+
+
+
+  uint8_t data[20];
+
+  for(int i=0; i<sizeof(data); i++) data[i] = i;
+
+
+
+  for(uint8_t i=0; i < 10; i++) tu_fifo_write(&ff, data+i);
+
+
+
+  uint8_t rd[10];
+
+  uint16_t rd_count;
+
+
+
+
+
+
+
+  rd_count = tu_fifo_read_n(&ff, rd, 5);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(97), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((data)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(98), UNITY_ARRAY_TO_ARRAY);
+
+
+
+
+
+
+
+  tu_fifo_write(&ff, data+10);
+
+  tu_fifo_write(&ff, data+11);
+
+  tu_fifo_write(&ff, data+12);
+
+
+
+  rd_count = tu_fifo_read_n(&ff, rd, 7);
+
+  UnityAssertEqualNumber((UNITY_INT)((7)), (UNITY_INT)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(107), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualMemory(( const void*)((data+5)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(109), UNITY_ARRAY_TO_ARRAY);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tu_fifo_read_n(&ff, rd, 100))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(112), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_write_n(void)
+
+{
+
+
+
+  uint8_t data[20];
+
+  for(int i=0; i<sizeof(data); i++) data[i] = i;
+
+
+
+
+
+  tu_fifo_write_n(&ff, data, 8);
+
+
+
+  uint8_t rd[10];
+
+  uint16_t rd_count;
+
+
+
+  rd_count = tu_fifo_read_n(&ff, rd, 5);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((rd_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((data)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(129), UNITY_ARRAY_TO_ARRAY);
+
+
+
+
+
+  tu_fifo_write_n(&ff, data+8, 6);
+
+
+
+  for(rd_count=0; rd_count<7; rd_count++) tu_fifo_read(&ff, rd+rd_count);
+
+
+
+  UnityAssertEqualMemory(( const void*)((data+5)), ( const void*)((rd)), (UNITY_UINT32)((rd_count)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(136), UNITY_ARRAY_TO_ARRAY);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((tu_fifo_count(&ff))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(138), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_peek(void)
+
+{
+
+  uint8_t temp;
+
+
+
+  temp = 10; tu_fifo_write(&ff, &temp);
+
+  temp = 20; tu_fifo_write(&ff, &temp);
+
+  temp = 30; tu_fifo_write(&ff, &temp);
+
+
+
+  temp = 0;
+
+
+
+  tu_fifo_peek(&ff, &temp);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((temp)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(152), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tu_fifo_peek_at(&ff, 1, &temp);
+
+  UnityAssertEqualNumber((UNITY_INT)((20)), (UNITY_INT)((temp)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(155), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_empty(void)
+
+{
+
+  uint8_t temp;
+
+  if ((tu_fifo_empty(&ff))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(161)));};
+
+  tu_fifo_write(&ff, &temp);
+
+  if (!(tu_fifo_empty(&ff))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(163)));};
+
+}
+
+
+
+void test_full(void)
+
+{
+
+  if (!(tu_fifo_full(&ff))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(168)));};
+
+
+
+  for(uint8_t i=0; i < 10; i++) tu_fifo_write(&ff, &i);
+
+
+
+  if ((tu_fifo_full(&ff))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(172)));};
+
+}
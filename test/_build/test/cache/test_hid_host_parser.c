@@ -0,0 +1,704 @@
+#include "_build/temp/_test_hid_host_parser.c"
+#include "../src/class/hid/hid_host_parser.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+static tuh_hid_report_map_t map;
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_keyboard(void)
+
+{
+
+  uint8_t const desc[] = { (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_KEYBOARD, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_APPLICATION, (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_KEYBOARD, (((1) << 4) | ((2) << 2) | (1)) , 224, (((2) << 4) | ((2) << 2) | (1)) , 231, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((1) << 2) | (1)) , 8, (((7) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (1<<0), (((1) << 4) | ((2) << 2) | (1)) , 0, (((2) << 4) | ((2) << 2) | (1)) , 255, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 255, (((9) << 4) | ((1) << 2) | (1)) , 6, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (0<<1) | (0<<2), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_LED, (((1) << 4) | ((2) << 2) | (1)) , 1, (((2) << 4) | ((2) << 2) | (1)) , 5, (((9) << 4) | ((1) << 2) | (1)) , 5, (((7) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 3, (((9) << 4) | ((0) << 2) | (1)) , (1<<0), (((12) << 4) | ((0) << 2) | (0)) };
+
+  if ((tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(120)));};
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((HID_USAGE_PAGE_DESKTOP)), (UNITY_INT)((map.usage_page)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(122), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((HID_USAGE_DESKTOP_KEYBOARD)), (UNITY_INT)((map.usage)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(123), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((map.field_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(126), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((8)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_FEATURE, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(129), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_field_t const* keycode = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_KEYBOARD, 0x04);
+
+  if ((((keycode)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(132))));};
+
+  UnityAssertEqualNumber((UNITY_INT)((16)), (UNITY_INT)((keycode->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(133), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((6)), (UNITY_INT)((keycode->count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(134), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((255)), (UNITY_INT)((keycode->logical_max)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(135), UNITY_DISPLAY_STYLE_INT);
+
+  if (!(keycode->flags & (1<<1))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(136)));};
+
+
+
+  tuh_hid_field_t const* shift = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_KEYBOARD, 0xE1);
+
+  if ((((shift)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(139))));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((shift->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(140), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  uint8_t const report[8] = { 0x02, 0, 0x04, 0x05, 0, 0, 0, 0 };
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_field_get_usage_value(shift, report, 0xE1))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(143), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_field_get_usage_value(shift, report, 0xE0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+  if ((tuh_hid_field_array_contains(keycode, report, 0x04))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(145)));};
+
+  if ((tuh_hid_field_array_contains(keycode, report, 0x05))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(146)));};
+
+  if (!(tuh_hid_field_array_contains(keycode, report, 0x06))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(147)));};
+
+
+
+  tuh_hid_field_t const* led = tuh_hid_find_field(&map, HID_REPORT_TYPE_OUTPUT, HID_USAGE_PAGE_LED, 2);
+
+  if ((((led)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(150))));};
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((led->count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(151), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  if ((((tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_LED, 2))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(154))));};
+
+}
+
+
+
+void test_mouse(void)
+
+{
+
+  uint8_t const desc[] = { (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_MOUSE, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_APPLICATION, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_POINTER, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_PHYSICAL, (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_BUTTON, (((1) << 4) | ((2) << 2) | (1)) , 1, (((2) << 4) | ((2) << 2) | (1)) , 5, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((1) << 2) | (1)) , 5, (((7) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 3, (((8) << 4) | ((0) << 2) | (1)) , (1<<0), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_X, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_Y, (((1) << 4) | ((1) << 2) | (1)) , 0x81, (((2) << 4) | ((1) << 2) | (1)) , 0x7f, (((9) << 4) | ((1) << 2) | (1)) , 2, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_WHEEL, (((9) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_CONSUMER, (((0) << 4) | ((2) << 2) | (2)) , ((uint8_t) ((HID_USAGE_CONSUMER_AC_PAN) & 0x00ff)), ((uint8_t) (((HID_USAGE_CONSUMER_AC_PAN) >> 8) & 0x00ff)), (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((12) << 4) | ((0) << 2) | (0)) , (((12) << 4) | ((0) << 2) | (0)) };
+
+  if ((tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(160)));};
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((HID_USAGE_DESKTOP_MOUSE)), (UNITY_INT)((map.usage)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(162), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(163), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_field_t const* buttons = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_BUTTON, 1);
+
+  tuh_hid_field_t const* x = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_X);
+
+  tuh_hid_field_t const* y = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_Y);
+
+  tuh_hid_field_t const* wheel = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_WHEEL);
+
+  tuh_hid_field_t const* pan = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_CONSUMER, HID_USAGE_CONSUMER_AC_PAN);
+
+
+
+  if ((((buttons)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(171))));};
+
+  if ((((wheel)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(172))));};
+
+  if ((((pan)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(173))));};
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT64)((x)), (UNITY_INT64)((y)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(176), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((8)), (UNITY_INT)((x->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(177), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((-127)), (UNITY_INT)((x->logical_min)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(178), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((127)), (UNITY_INT)((x->logical_max)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(179), UNITY_DISPLAY_STYLE_INT);
+
+  if ((x->flags & (1<<2))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(180)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((24)), (UNITY_INT)((wheel->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(181), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((32)), (UNITY_INT)((pan->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(182), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  uint8_t const report[] = { 0x05, 0xFF, 0x10, 0x81, 0x03 };
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_field_get_usage_value(buttons, report, 1))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(185), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_field_get_usage_value(buttons, report, 2))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(186), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_field_get_usage_value(buttons, report, 3))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(187), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((-1)), (UNITY_INT)((tuh_hid_field_get_usage_value(x, report, HID_USAGE_DESKTOP_X))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(188), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((16)), (UNITY_INT)((tuh_hid_field_get_usage_value(y, report, HID_USAGE_DESKTOP_Y))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(189), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((-127)), (UNITY_INT)((tuh_hid_field_get_value(wheel, report, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(190), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((tuh_hid_field_get_value(pan, report, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(191), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_report_id(void)
+
+{
+
+  uint8_t const desc[] =
+
+  {
+
+    (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_KEYBOARD, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_APPLICATION, (((8) << 4) | ((1) << 2) | (1)) , 1, (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_KEYBOARD, (((1) << 4) | ((2) << 2) | (1)) , 224, (((2) << 4) | ((2) << 2) | (1)) , 231, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((1) << 2) | (1)) , 8, (((7) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (1<<0), (((1) << 4) | ((2) << 2) | (1)) , 0, (((2) << 4) | ((2) << 2) | (1)) , 255, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 255, (((9) << 4) | ((1) << 2) | (1)) , 6, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (0<<1) | (0<<2), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_LED, (((1) << 4) | ((2) << 2) | (1)) , 1, (((2) << 4) | ((2) << 2) | (1)) , 5, (((9) << 4) | ((1) << 2) | (1)) , 5, (((7) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 3, (((9) << 4) | ((0) << 2) | (1)) , (1<<0), (((12) << 4) | ((0) << 2) | (0)) ,
+
+    (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_MOUSE, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_APPLICATION, (((8) << 4) | ((1) << 2) | (1)) , 2, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_POINTER, (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_PHYSICAL, (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_BUTTON, (((1) << 4) | ((2) << 2) | (1)) , 1, (((2) << 4) | ((2) << 2) | (1)) , 5, (((1) << 4) | ((1) << 2) | (1)) , 0, (((2) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((1) << 2) | (1)) , 5, (((7) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2), (((9) << 4) | ((1) << 2) | (1)) , 1, (((7) << 4) | ((1) << 2) | (1)) , 3, (((8) << 4) | ((0) << 2) | (1)) , (1<<0), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_X, (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_Y, (((1) << 4) | ((1) << 2) | (1)) , 0x81, (((2) << 4) | ((1) << 2) | (1)) , 0x7f, (((9) << 4) | ((1) << 2) | (1)) , 2, (((7) << 4) | ((1) << 2) | (1)) , 8, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_WHEEL, (((9) << 4) | ((1) << 2) | (1)) , 1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_CONSUMER, (((0) << 4) | ((2) << 2) | (2)) , ((uint8_t) ((HID_USAGE_CONSUMER_AC_PAN) & 0x00ff)), ((uint8_t) (((HID_USAGE_CONSUMER_AC_PAN) >> 8) & 0x00ff)), (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (1<<2), (((12) << 4) | ((0) << 2) | (0)) , (((12) << 4) | ((0) << 2) | (0))
+
+  };
+
+  if ((tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(201)));};
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((HID_USAGE_DESKTOP_KEYBOARD)), (UNITY_INT)((map.usage)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(204), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((map.report_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(205), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((9)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 1))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(207), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 1))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(208), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((6)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 2))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(209), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 2))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(210), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 3))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(211), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_field_t const* x = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_X);
+
+  if ((((x)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(214))));};
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((x->report_id)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(215), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((16)), (UNITY_INT)((x->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(216), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  uint8_t const kbd_report[] = { 1, 0, 0, 0x04, 0, 0, 0, 0, 0 };
+
+  uint8_t const mouse_report[] = { 2, 0, 0xFE, 0, 0, 0 };
+
+
+
+  if (!(tuh_hid_field_in_report(x, kbd_report))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(221)));};
+
+  if ((tuh_hid_field_in_report(x, mouse_report))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(222)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((-2)), (UNITY_INT)((tuh_hid_field_get_usage_value(x, mouse_report, HID_USAGE_DESKTOP_X))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(223), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+
+
+void test_unaligned_fields(void)
+
+{
+
+  uint8_t const desc[] =
+
+  {
+
+    (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DIGITIZER,
+
+    (((0) << 4) | ((2) << 2) | (1)) , 0x02,
+
+    (((10) << 4) | ((0) << 2) | (1)) , HID_COLLECTION_APPLICATION,
+
+      (((0) << 4) | ((2) << 2) | (1)) , 0x42,
+
+      (((1) << 4) | ((1) << 2) | (1)) , 0,
+
+      (((2) << 4) | ((1) << 2) | (1)) , 1,
+
+      (((7) << 4) | ((1) << 2) | (1)) , 1,
+
+      (((9) << 4) | ((1) << 2) | (1)) , 1,
+
+      (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2),
+
+      (((7) << 4) | ((1) << 2) | (1)) , 3,
+
+      (((8) << 4) | ((0) << 2) | (1)) , (1<<0),
+
+      (((10) << 4) | ((1) << 2) | (0)) ,
+
+      (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP,
+
+      (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_X,
+
+      (((0) << 4) | ((2) << 2) | (1)) , HID_USAGE_DESKTOP_Y,
+
+      (((2) << 4) | ((1) << 2) | (2)) , ((uint8_t) ((4095) & 0x00ff)), ((uint8_t) (((4095) >> 8) & 0x00ff)),
+
+      (((7) << 4) | ((1) << 2) | (1)) , 12,
+
+      (((9) << 4) | ((1) << 2) | (1)) , 2,
+
+      (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2),
+
+      (((11) << 4) | ((1) << 2) | (0)) ,
+
+
+
+      (((0) << 4) | ((2) << 2) | (1)) , 0x3D,
+
+      (((1) << 4) | ((1) << 2) | (2)) , ((uint8_t) ((-9000) & 0x00ff)), ((uint8_t) (((-9000) >> 8) & 0x00ff)),
+
+      (((2) << 4) | ((1) << 2) | (2)) , ((uint8_t) ((9000) & 0x00ff)), ((uint8_t) (((9000) >> 8) & 0x00ff)),
+
+      (((7) << 4) | ((1) << 2) | (1)) , 16,
+
+      (((9) << 4) | ((1) << 2) | (1)) , 1,
+
+      (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2),
+
+      (((0) << 4) | ((2) << 2) | (1)) , 0x56,
+
+      (((1) << 4) | ((1) << 2) | (1)) , 0,
+
+      (((2) << 4) | ((1) << 2) | (3)) , ((uint8_t) ((0x7fffffff) & 0x000000ff)), ((uint8_t) (((0x7fffffff) >> 8) & 0x000000ff)), ((uint8_t) (((0x7fffffff) >> 16) & 0x000000ff)), ((uint8_t) (((0x7fffffff) >> 24) & 0x000000ff)),
+
+      (((7) << 4) | ((1) << 2) | (1)) , 32,
+
+      (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1) | (0<<2),
+
+    (((12) << 4) | ((0) << 2) | (0))
+
+  };
+
+  if ((tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(265)));};
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(268), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_field_t const* tip = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x42);
+
+  tuh_hid_field_t const* xy = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_Y);
+
+  tuh_hid_field_t const* tilt = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x3D);
+
+  tuh_hid_field_t const* scan = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x56);
+
+
+
+  if ((((tip)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(275))));};
+
+  if ((((xy)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(276))));};
+
+  if ((((scan)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(277))));};
+
+
+
+
+
+  if ((((tilt)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(280))));};
+
+  UnityAssertEqualNumber((UNITY_INT)((28)), (UNITY_INT)((tilt->bit_offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(281), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4095)), (UNITY_INT)((xy->logical_max)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(282), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  uint8_t const report[] = { 0xC1, 0xAB, 0x23, 0xE1, 0xFF, 0x8F, 0x67, 0x45, 0x23, 0x01 };
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_field_get_value(tip, report, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(287), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0xABC)), (UNITY_INT)((tuh_hid_field_get_usage_value(xy, report, HID_USAGE_DESKTOP_X))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(288), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0x123)), (UNITY_INT)((tuh_hid_field_get_usage_value(xy, report, HID_USAGE_DESKTOP_Y))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(289), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((-2)), (UNITY_INT)((tuh_hid_field_get_value(tilt, report, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(290), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0x12345678)), (UNITY_INT)(UNITY_INT32)((tuh_hid_field_get_raw(scan, report, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(291), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_malformed(void)
+
+{
+
+
+
+  uint8_t const truncated[] = { (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_DESKTOP, 0x26, 0xFF };
+
+  if (!(tuh_hid_parse_report_descriptor(&map, truncated, sizeof(truncated)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(298)));};
+
+
+
+
+
+  uint8_t const unbalanced[] = { (((12) << 4) | ((0) << 2) | (0)) };
+
+  if (!(tuh_hid_parse_report_descriptor(&map, unbalanced, sizeof(unbalanced)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(302)));};
+
+
+
+
+
+  uint8_t const pop[] = { (((11) << 4) | ((1) << 2) | (0)) };
+
+  if (!(tuh_hid_parse_report_descriptor(&map, pop, sizeof(pop)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(306)));};
+
+}
+
+
+
+void test_too_many_fields(void)
+
+{
+
+
+
+  uint8_t desc[6*(32 +1) + 6];
+
+  uint8_t* p = desc;
+
+
+
+  uint8_t const header[] = { (((0) << 4) | ((1) << 2) | (1)) , HID_USAGE_PAGE_BUTTON, (((7) << 4) | ((1) << 2) | (1)) , 1, (((9) << 4) | ((1) << 2) | (1)) , 1 };
+
+  memcpy(p, header, sizeof(header));
+
+  p += sizeof(header);
+
+
+
+  for(uint8_t i=0; i<32 +1; i++)
+
+  {
+
+
+
+    uint8_t const item[] = { (((0) << 4) | ((2) << 2) | (1)) , 2*i+1, (((8) << 4) | ((0) << 2) | (1)) , (0<<0) | (1<<1), (((8) << 4) | ((0) << 2) | (1)) , (1<<0) };
+
+    memcpy(p, item, sizeof(item));
+
+    p += sizeof(item);
+
+  }
+
+
+
+  if (!(tuh_hid_parse_report_descriptor(&map, desc, (uint16_t) (p - desc)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(327)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((32)), (UNITY_INT)((map.field_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(328), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  if ((((tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_BUTTON, 1))) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(331))));};
+
+}
@@ -0,0 +1,356 @@
+#include "_build/temp/_test_hid_host_ring.c"
+#include "../src/class/hid/hid_host_ring.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+enum
+
+{
+
+  DEPTH = 8,
+
+  ARMED = 2
+
+};
+
+
+
+static tuh_hid_ring_t ring;
+
+
+
+
+
+static uint8_t arm(uint8_t* buffers[])
+
+{
+
+  uint8_t count = 0;
+
+  uint8_t* buffer;
+
+  while ( 
+
+         ((void *)0) 
+
+              != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+
+  {
+
+    if ( buffers ) buffers[count] = buffer;
+
+    count++;
+
+    tuh_hid_ring_xfer_queued(&ring);
+
+  }
+
+  return count;
+
+}
+
+
+
+
+
+static void receive(uint8_t value, uint32_t timestamp)
+
+{
+
+  uint8_t* buffer = ring.xfer_buf[ring.xfer_rd];
+
+  memset(buffer, value, 8);
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, timestamp);
+
+  arm(
+
+     ((void *)0)
+
+         );
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  tuh_hid_ring_init(&ring);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_arm_all_buffers(void)
+
+{
+
+  uint8_t* buffers[ARMED];
+
+  UnityAssertEqualNumber((UNITY_INT)((ARMED)), (UNITY_INT)((arm(buffers))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(78), UNITY_DISPLAY_STYLE_INT);
+
+  if ((((tuh_hid_ring_xfer_buffer(&ring))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(79))));};
+
+
+
+  for(uint8_t i=1; i<ARMED; i++) if ((buffers[i] != buffers[0])) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(81)));};
+
+
+
+
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, 0);
+
+  UnityAssertEqualNumber((UNITY_INT64)((buffers[0])), (UNITY_INT64)((tuh_hid_ring_xfer_buffer(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(85), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((arm(
+
+ ((void *)0)
+
+ ))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(86), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_reports_in_order(void)
+
+{
+
+  arm(
+
+     ((void *)0)
+
+         );
+
+
+
+  for(uint8_t i=0; i<5; i++) receive(i, 100+i);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((tuh_hid_ring_count(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(94), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_report_t report;
+
+  for(uint8_t i=0; i<5; i++)
+
+  {
+
+    if ((tuh_hid_ring_read(&ring, &report))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(99)));};
+
+    UnityAssertEqualNumber((UNITY_INT)((100+i)), (UNITY_INT)((report.timestamp)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(100), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((8)), (UNITY_INT)((report.len)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(101), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_UINT8 )((i)), 1), ( const void*)((report.data)), (UNITY_UINT32)((8)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(102), UNITY_DISPLAY_STYLE_UINT8, UNITY_ARRAY_TO_VAL);
+
+  }
+
+
+
+  if (!(tuh_hid_ring_read(&ring, &report))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(105)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->report_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(106), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((5)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->max_unread)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(107), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_overrun_keeps_newest(void)
+
+{
+
+  arm(
+
+     ((void *)0)
+
+         );
+
+
+
+  for(uint8_t i=0; i<DEPTH+3; i++) receive(i, i);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((DEPTH)), (UNITY_INT)((tuh_hid_ring_count(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(116), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->overrun_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(117), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((ARMED)), (UNITY_INT)((ring.xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(120), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_hid_report_t report;
+
+  if ((tuh_hid_ring_read(&ring, &report))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(123)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((report.data[0])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(124), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_failed_and_empty_transfer(void)
+
+{
+
+  arm(
+
+     ((void *)0)
+
+         );
+
+
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 0, 1);
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_STALLED, 0, 2);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_ring_count(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(134), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->error_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(135), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((ARMED-2)), (UNITY_INT)((ring.xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(136), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_init_discards_transfers(void)
+
+{
+
+  arm(
+
+     ((void *)0)
+
+         );
+
+  receive(1, 1);
+
+
+
+  tuh_hid_ring_init(&ring);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_ring_count(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(145), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, 2);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_ring_count(&ring))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(149), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->report_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(150), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,370 @@
+#include "_build/temp/_test_hid_host_ring_bench.c"
+#include "../src/class/hid/hid_host_ring.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  ARMED = 2
+
+};
+
+
+
+static tuh_hid_ring_t ring;
+
+
+
+void setUp(void)
+
+{
+
+  tuh_hid_ring_init(&ring);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  TICK_US = 25,
+
+  POLL_US = 125,
+
+  TASK_US = 50,
+
+  STALL_US = 150,
+
+  BENCH_MS = 10000,
+
+  REPORT_LEN = 8,
+
+  CTRL_MAX = ARMED > 1 ? ARMED : 1
+
+};
+
+
+
+typedef struct
+
+{
+
+  uint32_t received;
+
+  uint32_t lost;
+
+  uint64_t latency_sum;
+
+  uint32_t latency_max;
+
+} bench_result_t;
+
+
+
+static uint32_t bench_rand(uint32_t* seed)
+
+{
+
+  *seed = (*seed) * 1103515245u + 12345u;
+
+  return (*seed) >> 16;
+
+}
+
+
+
+static void bench_app_read(bench_result_t* result, uint32_t* next_seq, uint32_t seq, uint32_t now)
+
+{
+
+  if ((seq >= *next_seq)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(84)));};
+
+  result->lost += seq - *next_seq;
+
+  result->received++;
+
+  *next_seq = seq + 1;
+
+
+
+  uint32_t const latency = now - seq*POLL_US;
+
+  result->latency_sum += latency;
+
+  if ( latency > result->latency_max ) result->latency_max = latency;
+
+}
+
+
+
+static void bench_run(
+
+                     _Bool 
+
+                          use_ring, bench_result_t* result)
+
+{
+
+  memset((result), 0, (sizeof(bench_result_t)));
+
+  tuh_hid_ring_init(&ring);
+
+
+
+
+
+  uint8_t* ctrl[CTRL_MAX];
+
+  uint8_t ctrl_count = 0;
+
+  uint8_t done_count = 0;
+
+
+
+
+
+  uint8_t legacy_buf[REPORT_LEN];
+
+
+
+  uint32_t next_seq = 0;
+
+  uint32_t stall_from = 0;
+
+  uint32_t seed = 1;
+
+
+
+  if ( use_ring )
+
+  {
+
+    uint8_t* buffer;
+
+    while ( 
+
+           ((void *)0) 
+
+                != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+
+    {
+
+      ctrl[ctrl_count++] = buffer;
+
+      tuh_hid_ring_xfer_queued(&ring);
+
+    }
+
+  }
+
+  else
+
+  {
+
+    ctrl[ctrl_count++] = legacy_buf;
+
+  }
+
+
+
+  for(uint32_t now = 0; now < BENCH_MS*1000; now += TICK_US)
+
+  {
+
+
+
+    if ( now % POLL_US == 0 && ctrl_count )
+
+    {
+
+      uint32_t const seq = now / POLL_US;
+
+      memcpy(ctrl[0], &seq, sizeof(seq));
+
+      memmove(&ctrl[0], &ctrl[1], (CTRL_MAX-1)*sizeof(uint8_t*));
+
+      ctrl_count--;
+
+      done_count++;
+
+    }
+
+
+
+
+
+    if ( now % 1000 == 0 ) stall_from = now + STALL_US + (bench_rand(&seed) % ((1000 - 3*STALL_US)/TICK_US))*TICK_US;
+
+    if ( now >= stall_from && now < stall_from + STALL_US ) continue;
+
+    if ( now % TASK_US ) continue;
+
+
+
+
+
+    if ( use_ring )
+
+    {
+
+      for(; done_count; done_count--)
+
+      {
+
+        tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, REPORT_LEN, now);
+
+
+
+        uint8_t* buffer;
+
+        while ( 
+
+               ((void *)0) 
+
+                    != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+
+        {
+
+          ctrl[ctrl_count++] = buffer;
+
+          tuh_hid_ring_xfer_queued(&ring);
+
+        }
+
+      }
+
+
+
+      tuh_hid_report_t report;
+
+      while ( tuh_hid_ring_read(&ring, &report) )
+
+      {
+
+        uint32_t seq;
+
+        memcpy(&seq, report.data, sizeof(seq));
+
+        bench_app_read(result, &next_seq, seq, now);
+
+      }
+
+    }
+
+    else if ( done_count )
+
+    {
+
+
+
+      uint32_t seq;
+
+      memcpy(&seq, legacy_buf, sizeof(seq));
+
+      bench_app_read(result, &next_seq, seq, now);
+
+
+
+      done_count = 0;
+
+      ctrl[ctrl_count++] = legacy_buf;
+
+    }
+
+  }
+
+}
+
+
+
+void test_benchmark_report_rate(void)
+
+{
+
+  bench_result_t legacy, ringed;
+
+  bench_run(
+
+           0
+
+                , &legacy);
+
+  bench_run(
+
+           1 
+
+                , &ringed);
+
+
+
+  uint32_t const total = BENCH_MS*1000/POLL_US;
+
+
+
+  char msg[200];
+
+  snprintf(msg, sizeof(msg), "8 kHz reports/s %lu -> %lu, lost %lu -> %lu, latency avg %lu -> %lu us max %lu -> %lu us, overrun %lu",
+
+           (unsigned long) (legacy.received/(BENCH_MS/1000)), (unsigned long) (ringed.received/(BENCH_MS/1000)),
+
+           (unsigned long) legacy.lost, (unsigned long) ringed.lost,
+
+           (unsigned long) (legacy.latency_sum/legacy.received), (unsigned long) (ringed.latency_sum/ringed.received),
+
+           (unsigned long) legacy.latency_max, (unsigned long) ringed.latency_max,
+
+           (unsigned long) tuh_hid_ring_get_stats(&ring)->overrun_count);
+
+  UnityMessage((msg), 193);
+
+
+
+
+
+  if ((legacy.lost > 0)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(196)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((ringed.lost)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(197), UNITY_DISPLAY_STYLE_INT);
+
+  if ((ringed.received + 2 >= total)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(198)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_hid_ring_get_stats(&ring)->overrun_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(199), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,601 @@
+#include "@@@@msc_device.c"
+#include "../src/class/msc/msc_device.c"
+#include "@@@@usbd_control.c"
+#include "../src/device/usbd_control.c"
+#include "_build/temp/_test_msc_device.c"
+#include "_build/test/mocks/mock_dcd.h"
+#include "../src/device/usbd.h"
+#include "../src/tusb.h"
+#include "../src/common/tusb_fifo.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  EDPT_CTRL_OUT = 0x00,
+
+  EDPT_CTRL_IN = 0x80,
+
+
+
+  EDPT_MSC_OUT = 0x01,
+
+  EDPT_MSC_IN = 0x81,
+
+};
+
+
+
+uint8_t const rhport = 0;
+
+
+
+enum
+
+{
+
+  ITF_NUM_MSC,
+
+  ITF_NUM_TOTAL
+
+};
+
+
+
+
+
+
+
+uint8_t const data_desc_configuration[] =
+
+{
+
+
+
+  9, TUSB_DESC_CONFIGURATION, ((uint8_t) ((((9) + (9 + 7 + 7))) & 0x00ff)), ((uint8_t) (((((9) + (9 + 7 + 7))) >> 8) & 0x00ff)), ITF_NUM_TOTAL, 1, 0, (1U << (7)) | TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP, (100)/2,
+
+
+
+
+
+  9, TUSB_DESC_INTERFACE, ITF_NUM_MSC, 0, 2, TUSB_CLASS_MSC, MSC_SUBCLASS_SCSI, MSC_PROTOCOL_BOT, 0, 7, TUSB_DESC_ENDPOINT, EDPT_MSC_OUT, TUSB_XFER_BULK, ((uint8_t) ((( (0x01 | 0x20) & 0x20 ) ? 512 : 64) & 0x00ff)), ((uint8_t) (((( (0x01 | 0x20) & 0x20 ) ? 512 : 64) >> 8) & 0x00ff)), 0, 7, TUSB_DESC_ENDPOINT, EDPT_MSC_IN, TUSB_XFER_BULK, ((uint8_t) ((( (0x01 | 0x20) & 0x20 ) ? 512 : 64) & 0x00ff)), ((uint8_t) (((( (0x01 | 0x20) & 0x20 ) ? 512 : 64) >> 8) & 0x00ff)), 0,
+
+};
+
+
+
+tusb_control_request_t const request_set_configuration =
+
+{
+
+  .bmRequestType = 0x00,
+
+  .bRequest = TUSB_REQ_SET_CONFIGURATION,
+
+  .wValue = 1,
+
+  .wIndex = 0,
+
+  .wLength = 0
+
+};
+
+
+
+uint8_t const* desc_configuration;
+
+
+
+
+
+enum
+
+{
+
+  DISK_BLOCK_NUM = 16,
+
+  DISK_BLOCK_SIZE = 512
+
+};
+
+
+
+uint8_t msc_disk[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+
+
+
+
+
+
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4])
+
+{
+
+  (void) lun;
+
+
+
+  const char vid[] = "TinyUSB";
+
+  const char pid[] = "Mass Storage";
+
+  const char rev[] = "1.0";
+
+
+
+  memcpy(vendor_id , vid, strlen(vid));
+
+  memcpy(product_id , pid, strlen(pid));
+
+  memcpy(product_rev, rev, strlen(rev));
+
+}
+
+
+
+
+
+
+
+
+
+_Bool 
+
+    tud_msc_test_unit_ready_cb(uint8_t lun)
+
+{
+
+  (void) lun;
+
+
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+
+
+
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t* block_count, uint16_t* block_size)
+
+{
+
+  (void) lun;
+
+
+
+  *block_count = DISK_BLOCK_NUM;
+
+  *block_size = DISK_BLOCK_SIZE;
+
+}
+
+
+
+
+
+
+
+
+
+
+
+_Bool 
+
+    tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, 
+
+                                                                _Bool 
+
+                                                                     start, 
+
+                                                                            _Bool 
+
+                                                                                 load_eject)
+
+{
+
+  (void) lun;
+
+  (void) power_condition;
+
+
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+
+
+
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize)
+
+{
+
+  (void) lun;
+
+
+
+  uint8_t const* addr = msc_disk[lba] + offset;
+
+  memcpy(buffer, addr, bufsize);
+
+
+
+  return bufsize;
+
+}
+
+
+
+
+
+
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize)
+
+{
+
+  (void) lun;
+
+
+
+  uint8_t* addr = msc_disk[lba] + offset;
+
+  memcpy(addr, buffer, bufsize);
+
+
+
+  return bufsize;
+
+}
+
+
+
+
+
+
+
+
+
+int32_t tud_msc_scsi_cb (uint8_t lun, uint8_t const scsi_cmd[16], void* buffer, uint16_t bufsize)
+
+{
+
+
+
+
+
+  void const* response = 
+
+                        ((void *)0)
+
+                            ;
+
+  uint16_t resplen = 0;
+
+
+
+  return resplen;
+
+}
+
+
+
+
+
+
+
+
+
+uint8_t const * tud_descriptor_device_cb(void)
+
+{
+
+  return 
+
+        ((void *)0)
+
+            ;
+
+}
+
+
+
+uint8_t const * tud_descriptor_configuration_cb(uint8_t index)
+
+{
+
+  return desc_configuration;
+
+}
+
+
+
+uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid)
+
+{
+
+  (void) langid;
+
+
+
+  return 
+
+        ((void *)0)
+
+            ;
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  dcd_int_disable_CMockIgnore();
+
+  dcd_int_enable_CMockIgnore();
+
+
+
+  if ( !tusb_inited() )
+
+  {
+
+    dcd_init_CMockExpect(201, 0);
+
+    dcd_connect_CMockExpect(202, 0);
+
+    dcd_init_CMockExpect(203, 1);
+
+    dcd_connect_CMockExpect(204, 1);
+
+    tusb_init();
+
+  }
+
+
+
+  dcd_event_bus_signal(rhport, DCD_EVENT_BUS_RESET, 
+
+                                                   0
+
+                                                        );
+
+  tud_task();
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_msc(void)
+
+{
+
+
+
+  msc_cbw_t cbw_read10 =
+
+  {
+
+    .signature = MSC_CBW_SIGNATURE,
+
+    .tag = 0xCAFECAFE,
+
+    .total_bytes = 512,
+
+    .lun = 0,
+
+    .dir = TUSB_DIR_IN_MASK,
+
+    .cmd_len = sizeof(scsi_read10_t)
+
+  };
+
+
+
+  scsi_read10_t cmd_read10 =
+
+  {
+
+      .cmd_code = SCSI_CMD_READ_10,
+
+      .lba = ((__builtin_bswap32(0))),
+
+      .block_count = ((__builtin_bswap16(1)))
+
+  };
+
+
+
+  memcpy(cbw_read10.command, &cmd_read10, cbw_read10.cmd_len);
+
+
+
+  desc_configuration = data_desc_configuration;
+
+  uint8_t const* desc_ep = tu_desc_next(tu_desc_next(desc_configuration));
+
+
+
+  dcd_event_setup_received(rhport, (uint8_t*) &request_set_configuration, 
+
+                                                                         0
+
+                                                                              );
+
+
+
+
+
+  dcd_edpt_open_CMockExpectAndReturn(247, rhport, (tusb_desc_endpoint_t const *) desc_ep, 
+
+ 1
+
+ );
+
+  dcd_edpt_open_CMockExpectAndReturn(248, rhport, (tusb_desc_endpoint_t const *) tu_desc_next(desc_ep), 
+
+ 1
+
+ );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(251, rhport, EDPT_MSC_OUT, 
+
+ ((void *)0)
+
+ , sizeof(msc_cbw_t), 
+
+ 1
+
+ );
+
+  dcd_edpt_xfer_CMockIgnoreArg_buffer(252);
+
+  dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(253, (uint8_t*) &cbw_read10, sizeof(msc_cbw_t));
+
+
+
+
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_OUT, sizeof(msc_cbw_t), 0, 
+
+                                                                     1
+
+                                                                         );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(259, rhport, EDPT_CTRL_IN, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(262, rhport, EDPT_MSC_IN, 
+
+ ((void *)0)
+
+ , 512, 
+
+ 1
+
+ );
+
+  dcd_edpt_xfer_CMockIgnoreArg_buffer(263);
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_IN, 512, 0, 
+
+                                                      1
+
+                                                          );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(267, rhport, EDPT_MSC_IN, 
+
+ ((void *)0)
+
+ , 13, 
+
+ 1
+
+ );
+
+  dcd_edpt_xfer_CMockIgnoreArg_buffer(268);
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_IN, 13, 0, 
+
+                                                     1
+
+                                                         );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(272, rhport, EDPT_MSC_OUT, 
+
+ ((void *)0)
+
+ , sizeof(msc_cbw_t), 
+
+ 1
+
+ );
+
+  dcd_edpt_xfer_CMockIgnoreArg_buffer(273);
+
+
+
+  tud_task();
+
+}
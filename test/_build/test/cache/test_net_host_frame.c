@@ -0,0 +1,610 @@
+#include "_build/temp/_test_net_host_frame.c"
+#include "../src/class/cdc/cdc_rndis.h"
+#include "../src/class/net/ncm.h"
+#include "../src/class/net/net_host_frame.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum { BUFSIZE = 2048 };
+
+
+
+static uint8_t buffer[BUFSIZE] __attribute__ ((aligned(4)));
+
+static uint8_t frames[4][600];
+
+static uint16_t const frame_len[4] = { 60, 591, 42, 400 };
+
+
+
+static neth_tx_param_t const param_ncm = { .max_len = BUFSIZE, .max_count = 4, .protocol = NETH_PROTOCOL_NCM, .divisor = 4, .remainder = 2, .ndp_alignment = 4 };
+
+static neth_tx_param_t const param_rndis = { .max_len = BUFSIZE, .max_count = 4, .protocol = NETH_PROTOCOL_RNDIS, .divisor = 8 };
+
+static neth_tx_param_t const param_ecm = { .max_len = BUFSIZE, .max_count = 1, .protocol = NETH_PROTOCOL_ECM };
+
+
+
+void setUp(void)
+
+{
+
+  memset(buffer, 0xee, sizeof(buffer));
+
+  for(uint8_t i=0; i<4; i++) memset(frames[i], 0x10 + i, sizeof(frames[i]));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+static uint16_t build(neth_tx_param_t const* param, uint8_t count)
+
+{
+
+  neth_tx_block_t block;
+
+  neth_tx_block_init(param, &block, buffer);
+
+
+
+  for(uint8_t i=0; i<count; i++)
+
+  {
+
+    uint8_t* frame = neth_tx_block_add(param, &block, buffer, frame_len[i]);
+
+    if ((((frame)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(68))));};
+
+    memcpy(frame, frames[i], frame_len[i]);
+
+  }
+
+
+
+  return neth_tx_block_finalize(param, &block, buffer, 7);
+
+}
+
+
+
+
+
+static uint8_t parse(uint8_t protocol, uint16_t len)
+
+{
+
+  neth_rx_cursor_t cursor = { 0 };
+
+  uint8_t const* frame;
+
+  uint16_t flen;
+
+  uint8_t count = 0;
+
+
+
+  while ( neth_rx_frame_next(protocol, buffer, len, &cursor, &frame, &flen) )
+
+  {
+
+    UnityAssertEqualNumber((UNITY_INT)((frame_len[count])), (UNITY_INT)((flen)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(85), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualMemory(( const void*)((frames[count])), ( const void*)((frame)), (UNITY_UINT32)((flen)), 1, (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(86), UNITY_ARRAY_TO_ARRAY);
+
+    count++;
+
+  }
+
+
+
+  return count;
+
+}
+
+
+
+static void put_u32(uint8_t* p, uint32_t value)
+
+{
+
+  p[0] = (uint8_t) value;
+
+  p[1] = (uint8_t) (value >> 8);
+
+  p[2] = (uint8_t) (value >> 16);
+
+  p[3] = (uint8_t) (value >> 24);
+
+}
+
+
+
+
+
+
+
+
+
+void test_ncm_round_trip(void)
+
+{
+
+  uint16_t const len = build(&param_ncm, 4);
+
+
+
+  ncm_nth16_t const* nth = (ncm_nth16_t const*) buffer;
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0x484D434EUL)), (UNITY_INT)(UNITY_INT32)((nth->dwSignature)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(109), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)((7)), (UNITY_INT)((nth->wSequence)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(110), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((len)), (UNITY_INT)((nth->wBlockLength)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(111), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  ncm_ndp16_t const* ndp = (ncm_ndp16_t const*) (buffer + nth->wNdpIndex);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((nth->wNdpIndex % 4)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(114), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0x304D434EUL)), (UNITY_INT)(UNITY_INT32)((ndp->dwSignature)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(115), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)((sizeof(ncm_ndp16_t) + 5*sizeof(ncm_datagram16_t))), (UNITY_INT)((ndp->wLength)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(116), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  for(uint8_t i=0; i<4; i++) UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((ndp->datagram[i].wDatagramIndex % 4)), (
+
+                            ((void *)0)
+
+                            ), (UNITY_UINT)(119), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((ndp->datagram[4].wDatagramIndex)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(120), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((parse(NETH_PROTOCOL_NCM, len))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(122), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ncm_block_full(void)
+
+{
+
+  neth_tx_block_t block;
+
+  neth_tx_block_init(&param_ncm, &block, buffer);
+
+
+
+
+
+  for(uint8_t i=0; i<4; i++) if ((((neth_tx_block_add(&param_ncm, &block, buffer, 60))) != 
+
+                            ((void *)0)
+
+                            )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(131))));};
+
+  if (!(neth_tx_block_fits(&param_ncm, &block, 60))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(132)));};
+
+  if ((((neth_tx_block_add(&param_ncm, &block, buffer, 60))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(133))));};
+
+
+
+
+
+  neth_tx_block_init(&param_ncm, &block, buffer);
+
+  if ((((neth_tx_block_add(&param_ncm, &block, buffer, 1514))) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(137))));};
+
+  if (!(neth_tx_block_fits(&param_ncm, &block, 1514))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(138)));};
+
+  if ((neth_tx_block_fits(&param_ncm, &block, 60))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(139)));};
+
+}
+
+
+
+void test_ncm_ndp_chain(void)
+
+{
+
+  uint16_t const len = build(&param_ncm, 4);
+
+  ncm_nth16_t const* nth = (ncm_nth16_t const*) buffer;
+
+  ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + nth->wNdpIndex);
+
+
+
+
+
+  uint16_t const next = (uint16_t) ((len + 3) & ~3u);
+
+  ncm_ndp16_t* ndp2 = (ncm_ndp16_t*) (buffer + next);
+
+  ndp2->dwSignature = 0x314D434EUL;
+
+  ndp2->wLength = sizeof(ncm_ndp16_t) + 3*sizeof(ncm_datagram16_t);
+
+  ndp2->wNextNdpIndex = 0;
+
+  for(uint8_t i=0; i<2; i++)
+
+  {
+
+    ndp2->datagram[i].wDatagramIndex = ndp->datagram[2+i].wDatagramIndex;
+
+    ndp2->datagram[i].wDatagramLength = (uint16_t) (ndp->datagram[2+i].wDatagramLength + 4);
+
+  }
+
+  ndp2->datagram[2].wDatagramIndex = 0;
+
+  ndp2->datagram[2].wDatagramLength = 0;
+
+
+
+  ndp->datagram[2].wDatagramIndex = 0;
+
+  ndp->datagram[2].wDatagramLength = 0;
+
+  ndp->wNextNdpIndex = next;
+
+  ((ncm_nth16_t*) buffer)->wBlockLength = (uint16_t) (next + ndp2->wLength);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((parse(NETH_PROTOCOL_NCM, (uint16_t) (next + ndp2->wLength)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(167), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ncm_malformed(void)
+
+{
+
+  neth_rx_cursor_t cursor = { 0 };
+
+  uint8_t const* frame;
+
+  uint16_t flen;
+
+
+
+  uint16_t const len = build(&param_ncm, 2);
+
+  ncm_nth16_t* nth = (ncm_nth16_t*) buffer;
+
+  ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + nth->wNdpIndex);
+
+
+
+
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, 8, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(181)));};
+
+
+
+
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, (uint16_t) (len - 1), &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(184)));};
+
+
+
+
+
+  ndp->datagram[0].wDatagramLength = 4000;
+
+  memset(&cursor, 0, sizeof(cursor));
+
+  if ((neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(189)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((frame_len[1])), (UNITY_INT)((flen)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(190), UNITY_DISPLAY_STYLE_INT);
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(191)));};
+
+
+
+
+
+  ndp->wNextNdpIndex = nth->wNdpIndex;
+
+  memset(&cursor, 0, sizeof(cursor));
+
+  if ((neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(196)));};
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(197)));};
+
+
+
+
+
+  nth->dwSignature = 0;
+
+  memset(&cursor, 0, sizeof(cursor));
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(202)));};
+
+}
+
+
+
+
+
+
+
+
+
+void test_rndis_round_trip(void)
+
+{
+
+  uint16_t const len = build(&param_rndis, 4);
+
+
+
+
+
+  uint16_t offset = 0;
+
+  for(uint8_t i=0; i<4; i++)
+
+  {
+
+    rndis_msg_packet_t const* msg = (rndis_msg_packet_t const*) (buffer + offset);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((offset % 8)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(217), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((RNDIS_MSG_PACKET)), (UNITY_INT)(UNITY_INT32)((msg->type)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(218), UNITY_DISPLAY_STYLE_HEX32);
+
+    UnityAssertEqualNumber((UNITY_INT)((frame_len[i])), (UNITY_INT)((msg->data_length)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(219), UNITY_DISPLAY_STYLE_INT);
+
+    offset = (uint16_t) (offset + msg->length);
+
+  }
+
+  UnityAssertEqualNumber((UNITY_INT)((len)), (UNITY_INT)((offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(222), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((parse(NETH_PROTOCOL_RNDIS, len))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(224), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_rndis_skip_messages(void)
+
+{
+
+
+
+  uint8_t const status_len = sizeof(rndis_msg_indicate_status_t);
+
+  uint16_t const len = build(&param_rndis, 2);
+
+
+
+  memmove(buffer + status_len, buffer, len);
+
+  memset(buffer, 0, status_len);
+
+  put_u32(buffer , RNDIS_MSG_INDICATE_STATUS);
+
+  put_u32(buffer + 4, status_len);
+
+  buffer[status_len + len] = 0;
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((parse(NETH_PROTOCOL_RNDIS, (uint16_t) (status_len + len + 1)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(239), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_rndis_malformed(void)
+
+{
+
+  uint16_t const len = build(&param_rndis, 2);
+
+  rndis_msg_packet_t* msg = (rndis_msg_packet_t*) buffer;
+
+
+
+
+
+  msg->data_length = 2000;
+
+  neth_rx_cursor_t cursor = { 0 };
+
+  uint8_t const* frame;
+
+  uint16_t flen;
+
+  if ((neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(252)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((frame_len[1])), (UNITY_INT)((flen)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(253), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  msg->length = 0xFFFFFFF0UL;
+
+  memset(&cursor, 0, sizeof(cursor));
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(258)));};
+
+
+
+
+
+  msg->length = 0;
+
+  memset(&cursor, 0, sizeof(cursor));
+
+  if (!(neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(263)));};
+
+}
+
+
+
+
+
+
+
+
+
+void test_ecm_single_frame(void)
+
+{
+
+  neth_tx_block_t block;
+
+  neth_tx_block_init(&param_ecm, &block, buffer);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT64)((buffer)), (UNITY_INT64)((neth_tx_block_add(&param_ecm, &block, buffer, frame_len[0]))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(274), UNITY_DISPLAY_STYLE_HEX64);
+
+  memcpy(buffer, frames[0], frame_len[0]);
+
+  if (!(neth_tx_block_fits(&param_ecm, &block, 60))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(276)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((frame_len[0])), (UNITY_INT)((neth_tx_block_finalize(&param_ecm, &block, buffer, 0))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(277), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((parse(NETH_PROTOCOL_ECM, frame_len[0]))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(279), UNITY_DISPLAY_STYLE_INT);
+
+}
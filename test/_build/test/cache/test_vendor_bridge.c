@@ -0,0 +1,696 @@
+#include "_build/temp/_test_vendor_bridge.c"
+#include "../src/class/vendor/vendor_bridge.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  BUFSIZE = 2048,
+
+  BUFCOUNT = 8,
+
+  CREDIT = (8 - 8/4),
+
+  EP_SIZE = 512,
+
+  XFER_MAX = 64
+
+};
+
+
+
+typedef struct
+
+{
+
+  uint8_t* buffer;
+
+  uint16_t len;
+
+} xfer_t;
+
+
+
+typedef struct
+
+{
+
+  xfer_t xfer[XFER_MAX];
+
+  uint32_t rd, wr;
+
+} edpt_model_t;
+
+
+
+static vbridge_t bridge;
+
+static edpt_model_t edpt_model[VBRIDGE_EDPT_COUNT];
+
+static 
+
+      _Bool 
+
+           submit_fail;
+
+
+
+static 
+
+      _Bool 
+
+           model_xfer(void* ctx, vbridge_edpt_t edpt, uint8_t* buffer, uint16_t len)
+
+{
+
+  (void) ctx;
+
+  if ( submit_fail ) return 
+
+                           0
+
+                                ;
+
+
+
+  edpt_model_t* ep = &edpt_model[edpt];
+
+  if ((ep->wr - ep->rd < XFER_MAX)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(64)));};
+
+
+
+  ep->xfer[ep->wr % XFER_MAX] = (xfer_t) { .buffer = buffer, .len = len };
+
+  ep->wr++;
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static vbridge_backend_t const model_backend = { .xfer = model_xfer };
+
+
+
+static uint32_t queued(vbridge_edpt_t edpt)
+
+{
+
+  return edpt_model[edpt].wr - edpt_model[edpt].rd;
+
+}
+
+
+
+static xfer_t const* head(vbridge_edpt_t edpt)
+
+{
+
+  if ((queued(edpt) > 0)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(80)));};
+
+  return &edpt_model[edpt].xfer[edpt_model[edpt].rd % XFER_MAX];
+
+}
+
+
+
+
+
+static uint8_t* complete(vbridge_edpt_t edpt, xfer_result_t result, uint32_t xferred)
+
+{
+
+  uint8_t* buffer = head(edpt)->buffer;
+
+  edpt_model[edpt].rd++;
+
+  vbridge_xfer_complete(&bridge, edpt, result, xferred);
+
+  return buffer;
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           in_pool(uint8_t const* buffer)
+
+{
+
+  return (bridge.pool[0] <= buffer) && (buffer < bridge.pool[BUFCOUNT]);
+
+}
+
+
+
+static void open_all(void)
+
+{
+
+  vbridge_open(&bridge, VBRIDGE_DEV_IN , EP_SIZE, 1);
+
+  vbridge_open(&bridge, VBRIDGE_DEV_OUT , EP_SIZE, 1);
+
+  vbridge_open(&bridge, VBRIDGE_HOST_IN , EP_SIZE, (2*8));
+
+  vbridge_open(&bridge, VBRIDGE_HOST_OUT, EP_SIZE, (2*8));
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  memset((edpt_model), 0, (sizeof(edpt_model)));
+
+  submit_fail = 
+
+               0
+
+                    ;
+
+  vbridge_init(&bridge, &model_backend, 
+
+                                       ((void *)0)
+
+                                           );
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_receive_needs_both_sides(void)
+
+{
+
+  vbridge_open(&bridge, VBRIDGE_HOST_IN, EP_SIZE, (2*8));
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(123), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  vbridge_open(&bridge, VBRIDGE_DEV_IN, EP_SIZE, 1);
+
+  UnityAssertEqualNumber((UNITY_INT)((CREDIT)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((queued(VBRIDGE_DEV_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_forward_zero_copy(void)
+
+{
+
+  open_all();
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(134), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  uint8_t* buffer = head(VBRIDGE_DEV_OUT)->buffer;
+
+  if ((in_pool(buffer))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(138)));};
+
+  memset(buffer, 0xA5, 100);
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, 100);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT64)((buffer)), (UNITY_INT64)((head(VBRIDGE_HOST_OUT)->buffer)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(142), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((100)), (UNITY_INT)((head(VBRIDGE_HOST_OUT)->len)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(143), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  complete(VBRIDGE_HOST_OUT, XFER_RESULT_SUCCESS, 100);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(147), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((100)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->xfer_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(148), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  uint8_t* in0 = complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  uint8_t* in1 = complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, 10);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_DEV_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(154), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT64)((in0)), (UNITY_INT64)((head(VBRIDGE_DEV_IN)->buffer)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(155), UNITY_DISPLAY_STYLE_HEX64);
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  UnityAssertEqualNumber((UNITY_INT64)((in1)), (UNITY_INT64)((head(VBRIDGE_DEV_IN)->buffer)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(157), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((head(VBRIDGE_DEV_IN)->len)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(158), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_zlp_at_packet_boundary(void)
+
+{
+
+  open_all();
+
+
+
+
+
+  complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, EP_SIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((EP_SIZE)), (UNITY_INT)((head(VBRIDGE_DEV_IN)->len)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(167), UNITY_DISPLAY_STYLE_INT);
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, EP_SIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((head(VBRIDGE_DEV_IN)->len)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(169), UNITY_DISPLAY_STYLE_INT);
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, 0);
+
+
+
+
+
+  complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, 0);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((head(VBRIDGE_DEV_IN)->len)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(174), UNITY_DISPLAY_STYLE_INT);
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, 0);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_UPSTREAM)->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(177), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_UPSTREAM)->zlp_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(178), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((CREDIT)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(179), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_credit_backpressure(void)
+
+{
+
+  open_all();
+
+
+
+
+
+  for(uint32_t i=0; i<CREDIT; i++) complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(189), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((CREDIT)), (UNITY_INT)((vbridge_held(&bridge, VBRIDGE_UPSTREAM))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(190), UNITY_DISPLAY_STYLE_INT);
+
+  if ((vbridge_get_stats(&bridge, VBRIDGE_UPSTREAM)->credit_stall > 0)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(191)));};
+
+
+
+
+
+  for(uint32_t i=0; i<3*BUFCOUNT; i++)
+
+  {
+
+    complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, BUFSIZE);
+
+    complete(VBRIDGE_HOST_OUT, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  }
+
+  UnityAssertEqualNumber((UNITY_INT)((3*BUFCOUNT)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(199), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(203), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_submit_failure_retried(void)
+
+{
+
+  vbridge_open(&bridge, VBRIDGE_DEV_OUT , EP_SIZE, 1);
+
+  vbridge_open(&bridge, VBRIDGE_HOST_OUT, EP_SIZE, (2*8));
+
+
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, 64);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_HOST_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(212), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  submit_fail = 
+
+               1
+
+                   ;
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, 64);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_HOST_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(217), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(218), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  submit_fail = 
+
+               0
+
+                    ;
+
+  complete(VBRIDGE_HOST_OUT, XFER_RESULT_SUCCESS, 64);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_HOST_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(222), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(223), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_close_releases_blocks(void)
+
+{
+
+  open_all();
+
+
+
+  complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  complete(VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, BUFSIZE);
+
+
+
+
+
+  vbridge_close(&bridge, VBRIDGE_HOST_IN);
+
+  vbridge_close(&bridge, VBRIDGE_HOST_OUT);
+
+  edpt_model[VBRIDGE_HOST_IN ].rd = edpt_model[VBRIDGE_HOST_IN ].wr;
+
+  edpt_model[VBRIDGE_HOST_OUT].rd = edpt_model[VBRIDGE_HOST_OUT].wr;
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->drop_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(241), UNITY_DISPLAY_STYLE_INT);
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(243), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->drop_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(244), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_held(&bridge, VBRIDGE_DOWNSTREAM))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(245), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  complete(VBRIDGE_DEV_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_held(&bridge, VBRIDGE_UPSTREAM))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(250), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  vbridge_xfer_complete(&bridge, VBRIDGE_HOST_IN, XFER_RESULT_SUCCESS, BUFSIZE);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_held(&bridge, VBRIDGE_UPSTREAM))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(254), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  vbridge_open(&bridge, VBRIDGE_HOST_IN , EP_SIZE, (2*8));
+
+  vbridge_open(&bridge, VBRIDGE_HOST_OUT, EP_SIZE, (2*8));
+
+  UnityAssertEqualNumber((UNITY_INT)((CREDIT)), (UNITY_INT)((queued(VBRIDGE_HOST_IN))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(259), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((queued(VBRIDGE_DEV_OUT))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(260), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_failed_xfer_closes_endpoint(void)
+
+{
+
+  open_all();
+
+
+
+
+
+  complete(VBRIDGE_HOST_IN, XFER_RESULT_STALLED, 0);
+
+  if (!(bridge.opened[VBRIDGE_HOST_IN])) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(269)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_held(&bridge, VBRIDGE_UPSTREAM))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(270), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  complete(VBRIDGE_DEV_OUT, XFER_RESULT_SUCCESS, 8);
+
+  complete(VBRIDGE_HOST_OUT, XFER_RESULT_FAILED, 0);
+
+  if (!(bridge.opened[VBRIDGE_HOST_OUT])) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(274)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(275), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->drop_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(276), UNITY_DISPLAY_STYLE_INT);
+
+}
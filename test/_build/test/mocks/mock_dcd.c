@@ -0,0 +1,2138 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "mock_dcd.h"
+
+static const char* CMockString_buffer = "buffer";
+static const char* CMockString_dcd_connect = "dcd_connect";
+static const char* CMockString_dcd_disconnect = "dcd_disconnect";
+static const char* CMockString_dcd_edpt0_status_complete = "dcd_edpt0_status_complete";
+static const char* CMockString_dcd_edpt_clear_stall = "dcd_edpt_clear_stall";
+static const char* CMockString_dcd_edpt_close = "dcd_edpt_close";
+static const char* CMockString_dcd_edpt_open = "dcd_edpt_open";
+static const char* CMockString_dcd_edpt_stall = "dcd_edpt_stall";
+static const char* CMockString_dcd_edpt_xfer = "dcd_edpt_xfer";
+static const char* CMockString_dcd_init = "dcd_init";
+static const char* CMockString_dcd_int_disable = "dcd_int_disable";
+static const char* CMockString_dcd_int_enable = "dcd_int_enable";
+static const char* CMockString_dcd_int_handler = "dcd_int_handler";
+static const char* CMockString_dcd_remote_wakeup = "dcd_remote_wakeup";
+static const char* CMockString_dcd_set_address = "dcd_set_address";
+static const char* CMockString_dev_addr = "dev_addr";
+static const char* CMockString_ep_addr = "ep_addr";
+static const char* CMockString_p_endpoint_desc = "p_endpoint_desc";
+static const char* CMockString_request = "request";
+static const char* CMockString_rhport = "rhport";
+static const char* CMockString_total_bytes = "total_bytes";
+
+typedef struct _CMOCK_dcd_init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_init_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_int_handler_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_int_handler_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_int_enable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_int_enable_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_int_disable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_int_disable_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_set_address_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_dev_addr;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+  int IgnoreArg_dev_addr;
+
+} CMOCK_dcd_set_address_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_remote_wakeup_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_remote_wakeup_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_connect_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_connect_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_disconnect_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_dcd_disconnect_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  tusb_control_request_t const* Expected_request;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_request_Depth;
+  int IgnoreArg_rhport;
+  int IgnoreArg_request;
+
+} CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt_open_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  tusb_desc_endpoint_t const* Expected_p_endpoint_desc;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_p_endpoint_desc_Depth;
+  int IgnoreArg_rhport;
+  int IgnoreArg_p_endpoint_desc;
+
+} CMOCK_dcd_edpt_open_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt_close_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_ep_addr;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+  int IgnoreArg_ep_addr;
+
+} CMOCK_dcd_edpt_close_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt_xfer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_ep_addr;
+  uint8_t* Expected_buffer;
+  uint16_t Expected_total_bytes;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_buffer_Depth;
+  int ReturnThruPtr_buffer_Used;
+  uint8_t* ReturnThruPtr_buffer_Val;
+  int ReturnThruPtr_buffer_Size;
+  int IgnoreArg_rhport;
+  int IgnoreArg_ep_addr;
+  int IgnoreArg_buffer;
+  int IgnoreArg_total_bytes;
+
+} CMOCK_dcd_edpt_xfer_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt_stall_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_ep_addr;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+  int IgnoreArg_ep_addr;
+
+} CMOCK_dcd_edpt_stall_CALL_INSTANCE;
+
+typedef struct _CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_ep_addr;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+  int IgnoreArg_ep_addr;
+
+} CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE;
+
+static struct mock_dcdInstance
+{
+  int dcd_init_IgnoreBool;
+  int dcd_init_CallbackBool;
+  CMOCK_dcd_init_CALLBACK dcd_init_CallbackFunctionPointer;
+  int dcd_init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_init_CallInstance;
+  int dcd_int_handler_IgnoreBool;
+  int dcd_int_handler_CallbackBool;
+  CMOCK_dcd_int_handler_CALLBACK dcd_int_handler_CallbackFunctionPointer;
+  int dcd_int_handler_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_int_handler_CallInstance;
+  int dcd_int_enable_IgnoreBool;
+  int dcd_int_enable_CallbackBool;
+  CMOCK_dcd_int_enable_CALLBACK dcd_int_enable_CallbackFunctionPointer;
+  int dcd_int_enable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_int_enable_CallInstance;
+  int dcd_int_disable_IgnoreBool;
+  int dcd_int_disable_CallbackBool;
+  CMOCK_dcd_int_disable_CALLBACK dcd_int_disable_CallbackFunctionPointer;
+  int dcd_int_disable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_int_disable_CallInstance;
+  int dcd_set_address_IgnoreBool;
+  int dcd_set_address_CallbackBool;
+  CMOCK_dcd_set_address_CALLBACK dcd_set_address_CallbackFunctionPointer;
+  int dcd_set_address_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_set_address_CallInstance;
+  int dcd_remote_wakeup_IgnoreBool;
+  int dcd_remote_wakeup_CallbackBool;
+  CMOCK_dcd_remote_wakeup_CALLBACK dcd_remote_wakeup_CallbackFunctionPointer;
+  int dcd_remote_wakeup_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_remote_wakeup_CallInstance;
+  int dcd_connect_IgnoreBool;
+  int dcd_connect_CallbackBool;
+  CMOCK_dcd_connect_CALLBACK dcd_connect_CallbackFunctionPointer;
+  int dcd_connect_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_connect_CallInstance;
+  int dcd_disconnect_IgnoreBool;
+  int dcd_disconnect_CallbackBool;
+  CMOCK_dcd_disconnect_CALLBACK dcd_disconnect_CallbackFunctionPointer;
+  int dcd_disconnect_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_disconnect_CallInstance;
+  int dcd_edpt0_status_complete_IgnoreBool;
+  int dcd_edpt0_status_complete_CallbackBool;
+  CMOCK_dcd_edpt0_status_complete_CALLBACK dcd_edpt0_status_complete_CallbackFunctionPointer;
+  int dcd_edpt0_status_complete_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt0_status_complete_CallInstance;
+  int dcd_edpt_open_IgnoreBool;
+  _Bool dcd_edpt_open_FinalReturn;
+  int dcd_edpt_open_CallbackBool;
+  CMOCK_dcd_edpt_open_CALLBACK dcd_edpt_open_CallbackFunctionPointer;
+  int dcd_edpt_open_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt_open_CallInstance;
+  int dcd_edpt_close_IgnoreBool;
+  int dcd_edpt_close_CallbackBool;
+  CMOCK_dcd_edpt_close_CALLBACK dcd_edpt_close_CallbackFunctionPointer;
+  int dcd_edpt_close_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt_close_CallInstance;
+  int dcd_edpt_xfer_IgnoreBool;
+  _Bool dcd_edpt_xfer_FinalReturn;
+  int dcd_edpt_xfer_CallbackBool;
+  CMOCK_dcd_edpt_xfer_CALLBACK dcd_edpt_xfer_CallbackFunctionPointer;
+  int dcd_edpt_xfer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt_xfer_CallInstance;
+  int dcd_edpt_stall_IgnoreBool;
+  int dcd_edpt_stall_CallbackBool;
+  CMOCK_dcd_edpt_stall_CALLBACK dcd_edpt_stall_CallbackFunctionPointer;
+  int dcd_edpt_stall_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt_stall_CallInstance;
+  int dcd_edpt_clear_stall_IgnoreBool;
+  int dcd_edpt_clear_stall_CallbackBool;
+  CMOCK_dcd_edpt_clear_stall_CALLBACK dcd_edpt_clear_stall_CallbackFunctionPointer;
+  int dcd_edpt_clear_stall_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dcd_edpt_clear_stall_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_dcd_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.dcd_init_CallInstance;
+  if (Mock.dcd_init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_init);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_init_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_int_handler_CallInstance;
+  if (Mock.dcd_int_handler_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_int_handler);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_int_handler_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_int_enable_CallInstance;
+  if (Mock.dcd_int_enable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_int_enable);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_int_enable_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_int_disable_CallInstance;
+  if (Mock.dcd_int_disable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_int_disable);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_int_disable_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_set_address_CallInstance;
+  if (Mock.dcd_set_address_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_set_address);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_set_address_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_remote_wakeup_CallInstance;
+  if (Mock.dcd_remote_wakeup_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_remote_wakeup);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_remote_wakeup_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_connect_CallInstance;
+  if (Mock.dcd_connect_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_connect);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_connect_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_disconnect_CallInstance;
+  if (Mock.dcd_disconnect_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_disconnect);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_disconnect_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt0_status_complete_CallInstance;
+  if (Mock.dcd_edpt0_status_complete_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt0_status_complete);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt0_status_complete_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt_open_CallInstance;
+  if (Mock.dcd_edpt_open_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_open);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt_open_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt_close_CallInstance;
+  if (Mock.dcd_edpt_close_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_close);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt_close_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt_xfer_CallInstance;
+  if (Mock.dcd_edpt_xfer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_xfer);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt_xfer_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt_stall_CallInstance;
+  if (Mock.dcd_edpt_stall_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_stall);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt_stall_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.dcd_edpt_clear_stall_CallInstance;
+  if (Mock.dcd_edpt_clear_stall_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_clear_stall);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.dcd_edpt_clear_stall_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+}
+
+void mock_dcd_Init(void)
+{
+  mock_dcd_Destroy();
+}
+
+void mock_dcd_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void dcd_init(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_init);
+  cmock_call_instance = (CMOCK_dcd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_init_CallInstance);
+  Mock.dcd_init_CallInstance = CMock_Guts_MemNext(Mock.dcd_init_CallInstance);
+  if (Mock.dcd_init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_init_CallbackBool &&
+      Mock.dcd_init_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_init_CallbackFunctionPointer(rhport, Mock.dcd_init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_init,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_init_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_init_CallbackFunctionPointer(rhport, Mock.dcd_init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_init(CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_init(CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_init_CMockIgnore(void)
+{
+  Mock.dcd_init_IgnoreBool = (int)1;
+}
+
+void dcd_init_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_init_CALL_INSTANCE));
+  CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_init_CallInstance = CMock_Guts_MemChain(Mock.dcd_init_CallInstance, cmock_guts_index);
+  Mock.dcd_init_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_init(cmock_call_instance, rhport);
+}
+
+void dcd_init_AddCallback(CMOCK_dcd_init_CALLBACK Callback)
+{
+  Mock.dcd_init_IgnoreBool = (int)0;
+  Mock.dcd_init_CallbackBool = (int)1;
+  Mock.dcd_init_CallbackFunctionPointer = Callback;
+}
+
+void dcd_init_Stub(CMOCK_dcd_init_CALLBACK Callback)
+{
+  Mock.dcd_init_IgnoreBool = (int)0;
+  Mock.dcd_init_CallbackBool = (int)0;
+  Mock.dcd_init_CallbackFunctionPointer = Callback;
+}
+
+void dcd_init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_init_CALL_INSTANCE));
+  CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_init_CallInstance = CMock_Guts_MemChain(Mock.dcd_init_CallInstance, cmock_guts_index);
+  Mock.dcd_init_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_init(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_init_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_init_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_int_handler(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_int_handler);
+  cmock_call_instance = (CMOCK_dcd_int_handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_int_handler_CallInstance);
+  Mock.dcd_int_handler_CallInstance = CMock_Guts_MemNext(Mock.dcd_int_handler_CallInstance);
+  if (Mock.dcd_int_handler_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_int_handler_CallbackBool &&
+      Mock.dcd_int_handler_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_handler_CallbackFunctionPointer(rhport, Mock.dcd_int_handler_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_int_handler,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_int_handler_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_handler_CallbackFunctionPointer(rhport, Mock.dcd_int_handler_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_int_handler(CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_int_handler(CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_int_handler_CMockIgnore(void)
+{
+  Mock.dcd_int_handler_IgnoreBool = (int)1;
+}
+
+void dcd_int_handler_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_handler_CALL_INSTANCE));
+  CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_handler_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_handler_CallInstance, cmock_guts_index);
+  Mock.dcd_int_handler_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_handler(cmock_call_instance, rhport);
+}
+
+void dcd_int_handler_AddCallback(CMOCK_dcd_int_handler_CALLBACK Callback)
+{
+  Mock.dcd_int_handler_IgnoreBool = (int)0;
+  Mock.dcd_int_handler_CallbackBool = (int)1;
+  Mock.dcd_int_handler_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_handler_Stub(CMOCK_dcd_int_handler_CALLBACK Callback)
+{
+  Mock.dcd_int_handler_IgnoreBool = (int)0;
+  Mock.dcd_int_handler_CallbackBool = (int)0;
+  Mock.dcd_int_handler_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_handler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_handler_CALL_INSTANCE));
+  CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_handler_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_handler_CallInstance, cmock_guts_index);
+  Mock.dcd_int_handler_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_handler(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_int_handler_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_int_handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_int_handler_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_int_enable(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_int_enable);
+  cmock_call_instance = (CMOCK_dcd_int_enable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_int_enable_CallInstance);
+  Mock.dcd_int_enable_CallInstance = CMock_Guts_MemNext(Mock.dcd_int_enable_CallInstance);
+  if (Mock.dcd_int_enable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_int_enable_CallbackBool &&
+      Mock.dcd_int_enable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_enable_CallbackFunctionPointer(rhport, Mock.dcd_int_enable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_int_enable,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_int_enable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_enable_CallbackFunctionPointer(rhport, Mock.dcd_int_enable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_int_enable(CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_int_enable(CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_int_enable_CMockIgnore(void)
+{
+  Mock.dcd_int_enable_IgnoreBool = (int)1;
+}
+
+void dcd_int_enable_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_enable_CALL_INSTANCE));
+  CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_enable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_enable_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_enable_CallInstance, cmock_guts_index);
+  Mock.dcd_int_enable_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_enable(cmock_call_instance, rhport);
+}
+
+void dcd_int_enable_AddCallback(CMOCK_dcd_int_enable_CALLBACK Callback)
+{
+  Mock.dcd_int_enable_IgnoreBool = (int)0;
+  Mock.dcd_int_enable_CallbackBool = (int)1;
+  Mock.dcd_int_enable_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_enable_Stub(CMOCK_dcd_int_enable_CALLBACK Callback)
+{
+  Mock.dcd_int_enable_IgnoreBool = (int)0;
+  Mock.dcd_int_enable_CallbackBool = (int)0;
+  Mock.dcd_int_enable_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_enable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_enable_CALL_INSTANCE));
+  CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_enable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_enable_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_enable_CallInstance, cmock_guts_index);
+  Mock.dcd_int_enable_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_enable(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_int_enable_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_int_enable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_enable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_int_enable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_int_disable(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_int_disable);
+  cmock_call_instance = (CMOCK_dcd_int_disable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_int_disable_CallInstance);
+  Mock.dcd_int_disable_CallInstance = CMock_Guts_MemNext(Mock.dcd_int_disable_CallInstance);
+  if (Mock.dcd_int_disable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_int_disable_CallbackBool &&
+      Mock.dcd_int_disable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_disable_CallbackFunctionPointer(rhport, Mock.dcd_int_disable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_int_disable,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_int_disable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_int_disable_CallbackFunctionPointer(rhport, Mock.dcd_int_disable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_int_disable(CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_int_disable(CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_int_disable_CMockIgnore(void)
+{
+  Mock.dcd_int_disable_IgnoreBool = (int)1;
+}
+
+void dcd_int_disable_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_disable_CALL_INSTANCE));
+  CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_disable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_disable_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_disable_CallInstance, cmock_guts_index);
+  Mock.dcd_int_disable_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_disable(cmock_call_instance, rhport);
+}
+
+void dcd_int_disable_AddCallback(CMOCK_dcd_int_disable_CALLBACK Callback)
+{
+  Mock.dcd_int_disable_IgnoreBool = (int)0;
+  Mock.dcd_int_disable_CallbackBool = (int)1;
+  Mock.dcd_int_disable_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_disable_Stub(CMOCK_dcd_int_disable_CALLBACK Callback)
+{
+  Mock.dcd_int_disable_IgnoreBool = (int)0;
+  Mock.dcd_int_disable_CallbackBool = (int)0;
+  Mock.dcd_int_disable_CallbackFunctionPointer = Callback;
+}
+
+void dcd_int_disable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_int_disable_CALL_INSTANCE));
+  CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_disable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_int_disable_CallInstance = CMock_Guts_MemChain(Mock.dcd_int_disable_CallInstance, cmock_guts_index);
+  Mock.dcd_int_disable_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_int_disable(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_int_disable_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_int_disable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_int_disable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_int_disable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_set_address(uint8_t rhport, uint8_t dev_addr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_set_address);
+  cmock_call_instance = (CMOCK_dcd_set_address_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_set_address_CallInstance);
+  Mock.dcd_set_address_CallInstance = CMock_Guts_MemNext(Mock.dcd_set_address_CallInstance);
+  if (Mock.dcd_set_address_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_set_address_CallbackBool &&
+      Mock.dcd_set_address_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_set_address_CallbackFunctionPointer(rhport, dev_addr, Mock.dcd_set_address_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_set_address,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_dev_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_set_address,CMockString_dev_addr);
+    if (cmock_call_instance->Expected_dev_addr != dev_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dev_addr, dev_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_set_address_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_set_address_CallbackFunctionPointer(rhport, dev_addr, Mock.dcd_set_address_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_set_address(CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t dev_addr);
+void CMockExpectParameters_dcd_set_address(CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t dev_addr)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_dev_addr = dev_addr;
+  cmock_call_instance->IgnoreArg_dev_addr = 0;
+}
+
+void dcd_set_address_CMockIgnore(void)
+{
+  Mock.dcd_set_address_IgnoreBool = (int)1;
+}
+
+void dcd_set_address_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t dev_addr)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_set_address_CALL_INSTANCE));
+  CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_set_address_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_set_address_CallInstance = CMock_Guts_MemChain(Mock.dcd_set_address_CallInstance, cmock_guts_index);
+  Mock.dcd_set_address_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_set_address(cmock_call_instance, rhport, dev_addr);
+}
+
+void dcd_set_address_AddCallback(CMOCK_dcd_set_address_CALLBACK Callback)
+{
+  Mock.dcd_set_address_IgnoreBool = (int)0;
+  Mock.dcd_set_address_CallbackBool = (int)1;
+  Mock.dcd_set_address_CallbackFunctionPointer = Callback;
+}
+
+void dcd_set_address_Stub(CMOCK_dcd_set_address_CALLBACK Callback)
+{
+  Mock.dcd_set_address_IgnoreBool = (int)0;
+  Mock.dcd_set_address_CallbackBool = (int)0;
+  Mock.dcd_set_address_CallbackFunctionPointer = Callback;
+}
+
+void dcd_set_address_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t dev_addr, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_set_address_CALL_INSTANCE));
+  CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_set_address_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_set_address_CallInstance = CMock_Guts_MemChain(Mock.dcd_set_address_CallInstance, cmock_guts_index);
+  Mock.dcd_set_address_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_set_address(cmock_call_instance, rhport, dev_addr);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_set_address_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_set_address_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_set_address_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_set_address_CMockIgnoreArg_dev_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_set_address_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_set_address_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_set_address_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dev_addr = 1;
+}
+
+void dcd_remote_wakeup(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_remote_wakeup);
+  cmock_call_instance = (CMOCK_dcd_remote_wakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_remote_wakeup_CallInstance);
+  Mock.dcd_remote_wakeup_CallInstance = CMock_Guts_MemNext(Mock.dcd_remote_wakeup_CallInstance);
+  if (Mock.dcd_remote_wakeup_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_remote_wakeup_CallbackBool &&
+      Mock.dcd_remote_wakeup_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_remote_wakeup_CallbackFunctionPointer(rhport, Mock.dcd_remote_wakeup_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_remote_wakeup,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_remote_wakeup_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_remote_wakeup_CallbackFunctionPointer(rhport, Mock.dcd_remote_wakeup_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_remote_wakeup(CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_remote_wakeup(CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_remote_wakeup_CMockIgnore(void)
+{
+  Mock.dcd_remote_wakeup_IgnoreBool = (int)1;
+}
+
+void dcd_remote_wakeup_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_remote_wakeup_CALL_INSTANCE));
+  CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_remote_wakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_remote_wakeup_CallInstance = CMock_Guts_MemChain(Mock.dcd_remote_wakeup_CallInstance, cmock_guts_index);
+  Mock.dcd_remote_wakeup_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_remote_wakeup(cmock_call_instance, rhport);
+}
+
+void dcd_remote_wakeup_AddCallback(CMOCK_dcd_remote_wakeup_CALLBACK Callback)
+{
+  Mock.dcd_remote_wakeup_IgnoreBool = (int)0;
+  Mock.dcd_remote_wakeup_CallbackBool = (int)1;
+  Mock.dcd_remote_wakeup_CallbackFunctionPointer = Callback;
+}
+
+void dcd_remote_wakeup_Stub(CMOCK_dcd_remote_wakeup_CALLBACK Callback)
+{
+  Mock.dcd_remote_wakeup_IgnoreBool = (int)0;
+  Mock.dcd_remote_wakeup_CallbackBool = (int)0;
+  Mock.dcd_remote_wakeup_CallbackFunctionPointer = Callback;
+}
+
+void dcd_remote_wakeup_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_remote_wakeup_CALL_INSTANCE));
+  CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_remote_wakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_remote_wakeup_CallInstance = CMock_Guts_MemChain(Mock.dcd_remote_wakeup_CallInstance, cmock_guts_index);
+  Mock.dcd_remote_wakeup_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_remote_wakeup(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_remote_wakeup_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_remote_wakeup_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_remote_wakeup_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_remote_wakeup_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_connect(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_connect);
+  cmock_call_instance = (CMOCK_dcd_connect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_connect_CallInstance);
+  Mock.dcd_connect_CallInstance = CMock_Guts_MemNext(Mock.dcd_connect_CallInstance);
+  if (Mock.dcd_connect_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_connect_CallbackBool &&
+      Mock.dcd_connect_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_connect_CallbackFunctionPointer(rhport, Mock.dcd_connect_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_connect,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_connect_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_connect_CallbackFunctionPointer(rhport, Mock.dcd_connect_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_connect(CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_connect(CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_connect_CMockIgnore(void)
+{
+  Mock.dcd_connect_IgnoreBool = (int)1;
+}
+
+void dcd_connect_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_connect_CALL_INSTANCE));
+  CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_connect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_connect_CallInstance = CMock_Guts_MemChain(Mock.dcd_connect_CallInstance, cmock_guts_index);
+  Mock.dcd_connect_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_connect(cmock_call_instance, rhport);
+}
+
+void dcd_connect_AddCallback(CMOCK_dcd_connect_CALLBACK Callback)
+{
+  Mock.dcd_connect_IgnoreBool = (int)0;
+  Mock.dcd_connect_CallbackBool = (int)1;
+  Mock.dcd_connect_CallbackFunctionPointer = Callback;
+}
+
+void dcd_connect_Stub(CMOCK_dcd_connect_CALLBACK Callback)
+{
+  Mock.dcd_connect_IgnoreBool = (int)0;
+  Mock.dcd_connect_CallbackBool = (int)0;
+  Mock.dcd_connect_CallbackFunctionPointer = Callback;
+}
+
+void dcd_connect_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_connect_CALL_INSTANCE));
+  CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_connect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_connect_CallInstance = CMock_Guts_MemChain(Mock.dcd_connect_CallInstance, cmock_guts_index);
+  Mock.dcd_connect_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_connect(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_connect_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_connect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_connect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_connect_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_disconnect(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_disconnect);
+  cmock_call_instance = (CMOCK_dcd_disconnect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_disconnect_CallInstance);
+  Mock.dcd_disconnect_CallInstance = CMock_Guts_MemNext(Mock.dcd_disconnect_CallInstance);
+  if (Mock.dcd_disconnect_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_disconnect_CallbackBool &&
+      Mock.dcd_disconnect_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_disconnect_CallbackFunctionPointer(rhport, Mock.dcd_disconnect_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_disconnect,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_disconnect_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_disconnect_CallbackFunctionPointer(rhport, Mock.dcd_disconnect_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_disconnect(CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_dcd_disconnect(CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void dcd_disconnect_CMockIgnore(void)
+{
+  Mock.dcd_disconnect_IgnoreBool = (int)1;
+}
+
+void dcd_disconnect_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_disconnect_CALL_INSTANCE));
+  CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_disconnect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_disconnect_CallInstance = CMock_Guts_MemChain(Mock.dcd_disconnect_CallInstance, cmock_guts_index);
+  Mock.dcd_disconnect_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_disconnect(cmock_call_instance, rhport);
+}
+
+void dcd_disconnect_AddCallback(CMOCK_dcd_disconnect_CALLBACK Callback)
+{
+  Mock.dcd_disconnect_IgnoreBool = (int)0;
+  Mock.dcd_disconnect_CallbackBool = (int)1;
+  Mock.dcd_disconnect_CallbackFunctionPointer = Callback;
+}
+
+void dcd_disconnect_Stub(CMOCK_dcd_disconnect_CALLBACK Callback)
+{
+  Mock.dcd_disconnect_IgnoreBool = (int)0;
+  Mock.dcd_disconnect_CallbackBool = (int)0;
+  Mock.dcd_disconnect_CallbackFunctionPointer = Callback;
+}
+
+void dcd_disconnect_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_disconnect_CALL_INSTANCE));
+  CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_disconnect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_disconnect_CallInstance = CMock_Guts_MemChain(Mock.dcd_disconnect_CallInstance, cmock_guts_index);
+  Mock.dcd_disconnect_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_disconnect(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_disconnect_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_disconnect_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_disconnect_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_disconnect_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt0_status_complete(uint8_t rhport, tusb_control_request_t const* request)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt0_status_complete);
+  cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt0_status_complete_CallInstance);
+  Mock.dcd_edpt0_status_complete_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt0_status_complete_CallInstance);
+  if (Mock.dcd_edpt0_status_complete_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_edpt0_status_complete_CallbackBool &&
+      Mock.dcd_edpt0_status_complete_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt0_status_complete_CallbackFunctionPointer(rhport, request, Mock.dcd_edpt0_status_complete_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt0_status_complete,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_request)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt0_status_complete,CMockString_request);
+    if (cmock_call_instance->Expected_request != request) {
+    if (cmock_call_instance->Expected_request == NULL)
+      { UNITY_TEST_ASSERT_NULL(request, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_request), (void*)(request), sizeof(tusb_control_request_t const), cmock_call_instance->Expected_request_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.dcd_edpt0_status_complete_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt0_status_complete_CallbackFunctionPointer(rhport, request, Mock.dcd_edpt0_status_complete_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_edpt0_status_complete(CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* request, int request_Depth);
+void CMockExpectParameters_dcd_edpt0_status_complete(CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* request, int request_Depth)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_request = request;
+  cmock_call_instance->Expected_request_Depth = request_Depth;
+  cmock_call_instance->IgnoreArg_request = 0;
+}
+
+void dcd_edpt0_status_complete_CMockIgnore(void)
+{
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)1;
+}
+
+void dcd_edpt0_status_complete_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE));
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt0_status_complete_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt0_status_complete_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt0_status_complete(cmock_call_instance, rhport, request, 1);
+}
+
+void dcd_edpt0_status_complete_AddCallback(CMOCK_dcd_edpt0_status_complete_CALLBACK Callback)
+{
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)0;
+  Mock.dcd_edpt0_status_complete_CallbackBool = (int)1;
+  Mock.dcd_edpt0_status_complete_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt0_status_complete_Stub(CMOCK_dcd_edpt0_status_complete_CALLBACK Callback)
+{
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)0;
+  Mock.dcd_edpt0_status_complete_CallbackBool = (int)0;
+  Mock.dcd_edpt0_status_complete_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt0_status_complete_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE));
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt0_status_complete_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt0_status_complete_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt0_status_complete(cmock_call_instance, rhport, request, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt0_status_complete_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request, int request_Depth)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE));
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt0_status_complete_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt0_status_complete_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt0_status_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt0_status_complete(cmock_call_instance, rhport, request, request_Depth);
+}
+
+void dcd_edpt0_status_complete_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt0_status_complete_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt0_status_complete_CMockIgnoreArg_request(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt0_status_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt0_status_complete_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_request = 1;
+}
+
+_Bool dcd_edpt_open(uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_open);
+  cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt_open_CallInstance);
+  Mock.dcd_edpt_open_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt_open_CallInstance);
+  if (Mock.dcd_edpt_open_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.dcd_edpt_open_FinalReturn;
+    memcpy((void*)(&Mock.dcd_edpt_open_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.dcd_edpt_open_CallbackBool &&
+      Mock.dcd_edpt_open_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.dcd_edpt_open_CallbackFunctionPointer(rhport, p_endpoint_desc, Mock.dcd_edpt_open_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_open,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_p_endpoint_desc)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_open,CMockString_p_endpoint_desc);
+    if (cmock_call_instance->Expected_p_endpoint_desc != p_endpoint_desc) {
+    if (cmock_call_instance->Expected_p_endpoint_desc == NULL)
+      { UNITY_TEST_ASSERT_NULL(p_endpoint_desc, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_p_endpoint_desc), (void*)(p_endpoint_desc), sizeof(tusb_desc_endpoint_t const), cmock_call_instance->Expected_p_endpoint_desc_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.dcd_edpt_open_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.dcd_edpt_open_CallbackFunctionPointer(rhport, p_endpoint_desc, Mock.dcd_edpt_open_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_dcd_edpt_open(CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, int p_endpoint_desc_Depth);
+void CMockExpectParameters_dcd_edpt_open(CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, int p_endpoint_desc_Depth)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_p_endpoint_desc = p_endpoint_desc;
+  cmock_call_instance->Expected_p_endpoint_desc_Depth = p_endpoint_desc_Depth;
+  cmock_call_instance->IgnoreArg_p_endpoint_desc = 0;
+}
+
+void dcd_edpt_open_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_open_CALL_INSTANCE));
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_open_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_open_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.dcd_edpt_open_IgnoreBool = (int)1;
+}
+
+void dcd_edpt_open_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_open_CALL_INSTANCE));
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_open_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_open_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_open(cmock_call_instance, rhport, p_endpoint_desc, 1);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void dcd_edpt_open_AddCallback(CMOCK_dcd_edpt_open_CALLBACK Callback)
+{
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  Mock.dcd_edpt_open_CallbackBool = (int)1;
+  Mock.dcd_edpt_open_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_open_Stub(CMOCK_dcd_edpt_open_CALLBACK Callback)
+{
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  Mock.dcd_edpt_open_CallbackBool = (int)0;
+  Mock.dcd_edpt_open_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_open_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_open_CALL_INSTANCE));
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_open_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_open_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_open(cmock_call_instance, rhport, p_endpoint_desc, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt_open_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, int p_endpoint_desc_Depth, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_open_CALL_INSTANCE));
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_open_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_open_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_open(cmock_call_instance, rhport, p_endpoint_desc, p_endpoint_desc_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void dcd_edpt_open_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_open_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt_open_CMockIgnoreArg_p_endpoint_desc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_open_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_p_endpoint_desc = 1;
+}
+
+void dcd_edpt_close(uint8_t rhport, uint8_t ep_addr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_close);
+  cmock_call_instance = (CMOCK_dcd_edpt_close_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt_close_CallInstance);
+  Mock.dcd_edpt_close_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt_close_CallInstance);
+  if (Mock.dcd_edpt_close_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_edpt_close_CallbackBool &&
+      Mock.dcd_edpt_close_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_close_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_close_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_close,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_ep_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_close,CMockString_ep_addr);
+    if (cmock_call_instance->Expected_ep_addr != ep_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ep_addr, ep_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_edpt_close_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_close_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_close_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_edpt_close(CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr);
+void CMockExpectParameters_dcd_edpt_close(CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_ep_addr = ep_addr;
+  cmock_call_instance->IgnoreArg_ep_addr = 0;
+}
+
+void dcd_edpt_close_CMockIgnore(void)
+{
+  Mock.dcd_edpt_close_IgnoreBool = (int)1;
+}
+
+void dcd_edpt_close_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_close_CALL_INSTANCE));
+  CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_close_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_close_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_close_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_close_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_close(cmock_call_instance, rhport, ep_addr);
+}
+
+void dcd_edpt_close_AddCallback(CMOCK_dcd_edpt_close_CALLBACK Callback)
+{
+  Mock.dcd_edpt_close_IgnoreBool = (int)0;
+  Mock.dcd_edpt_close_CallbackBool = (int)1;
+  Mock.dcd_edpt_close_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_close_Stub(CMOCK_dcd_edpt_close_CALLBACK Callback)
+{
+  Mock.dcd_edpt_close_IgnoreBool = (int)0;
+  Mock.dcd_edpt_close_CallbackBool = (int)0;
+  Mock.dcd_edpt_close_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_close_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_close_CALL_INSTANCE));
+  CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_close_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_close_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_close_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_close_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_close(cmock_call_instance, rhport, ep_addr);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt_close_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_close_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_close_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt_close_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_close_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_close_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_close_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ep_addr = 1;
+}
+
+_Bool dcd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_xfer);
+  cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt_xfer_CallInstance);
+  Mock.dcd_edpt_xfer_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt_xfer_CallInstance);
+  if (Mock.dcd_edpt_xfer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.dcd_edpt_xfer_FinalReturn;
+    memcpy((void*)(&Mock.dcd_edpt_xfer_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.dcd_edpt_xfer_CallbackBool &&
+      Mock.dcd_edpt_xfer_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.dcd_edpt_xfer_CallbackFunctionPointer(rhport, ep_addr, buffer, total_bytes, Mock.dcd_edpt_xfer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_xfer,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_ep_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_xfer,CMockString_ep_addr);
+    if (cmock_call_instance->Expected_ep_addr != ep_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ep_addr, ep_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_buffer)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_xfer,CMockString_buffer);
+    if (cmock_call_instance->Expected_buffer != buffer) {
+    if (cmock_call_instance->Expected_buffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(buffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_buffer, buffer, cmock_call_instance->Expected_buffer_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_total_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_xfer,CMockString_total_bytes);
+    if (cmock_call_instance->Expected_total_bytes != total_bytes) {
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_total_bytes, total_bytes, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_edpt_xfer_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.dcd_edpt_xfer_CallbackFunctionPointer(rhport, ep_addr, buffer, total_bytes, Mock.dcd_edpt_xfer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_buffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(buffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)buffer, (void*)cmock_call_instance->ReturnThruPtr_buffer_Val,
+      cmock_call_instance->ReturnThruPtr_buffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_dcd_edpt_xfer(CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, int buffer_Depth, uint16_t total_bytes);
+void CMockExpectParameters_dcd_edpt_xfer(CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, int buffer_Depth, uint16_t total_bytes)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_ep_addr = ep_addr;
+  cmock_call_instance->IgnoreArg_ep_addr = 0;
+  cmock_call_instance->Expected_buffer = buffer;
+  cmock_call_instance->Expected_buffer_Depth = buffer_Depth;
+  cmock_call_instance->IgnoreArg_buffer = 0;
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 0;
+  cmock_call_instance->Expected_total_bytes = total_bytes;
+  cmock_call_instance->IgnoreArg_total_bytes = 0;
+}
+
+void dcd_edpt_xfer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_xfer_CALL_INSTANCE));
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_xfer_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_xfer_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)1;
+}
+
+void dcd_edpt_xfer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_xfer_CALL_INSTANCE));
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_xfer_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_xfer_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_xfer(cmock_call_instance, rhport, ep_addr, buffer, 1, total_bytes);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void dcd_edpt_xfer_AddCallback(CMOCK_dcd_edpt_xfer_CALLBACK Callback)
+{
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  Mock.dcd_edpt_xfer_CallbackBool = (int)1;
+  Mock.dcd_edpt_xfer_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_xfer_Stub(CMOCK_dcd_edpt_xfer_CALLBACK Callback)
+{
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  Mock.dcd_edpt_xfer_CallbackBool = (int)0;
+  Mock.dcd_edpt_xfer_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_xfer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_xfer_CALL_INSTANCE));
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_xfer_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_xfer_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_xfer(cmock_call_instance, rhport, ep_addr, buffer, 1, total_bytes);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt_xfer_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, int buffer_Depth, uint16_t total_bytes, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_xfer_CALL_INSTANCE));
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_xfer_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_xfer_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_xfer_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_xfer(cmock_call_instance, rhport, ep_addr, buffer, buffer_Depth, total_bytes);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, uint8_t* buffer, int cmock_size)
+{
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_xfer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_buffer_Val = buffer;
+  cmock_call_instance->ReturnThruPtr_buffer_Size = cmock_size;
+}
+
+void dcd_edpt_xfer_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_xfer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt_xfer_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_xfer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ep_addr = 1;
+}
+
+void dcd_edpt_xfer_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_xfer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_buffer = 1;
+}
+
+void dcd_edpt_xfer_CMockIgnoreArg_total_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_xfer_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_xfer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_xfer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_total_bytes = 1;
+}
+
+void dcd_edpt_stall(uint8_t rhport, uint8_t ep_addr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_stall);
+  cmock_call_instance = (CMOCK_dcd_edpt_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt_stall_CallInstance);
+  Mock.dcd_edpt_stall_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt_stall_CallInstance);
+  if (Mock.dcd_edpt_stall_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_edpt_stall_CallbackBool &&
+      Mock.dcd_edpt_stall_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_stall_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_stall_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_stall,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_ep_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_stall,CMockString_ep_addr);
+    if (cmock_call_instance->Expected_ep_addr != ep_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ep_addr, ep_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_edpt_stall_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_stall_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_stall_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_edpt_stall(CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr);
+void CMockExpectParameters_dcd_edpt_stall(CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_ep_addr = ep_addr;
+  cmock_call_instance->IgnoreArg_ep_addr = 0;
+}
+
+void dcd_edpt_stall_CMockIgnore(void)
+{
+  Mock.dcd_edpt_stall_IgnoreBool = (int)1;
+}
+
+void dcd_edpt_stall_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_stall_CALL_INSTANCE));
+  CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_stall_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_stall_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_stall_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_stall(cmock_call_instance, rhport, ep_addr);
+}
+
+void dcd_edpt_stall_AddCallback(CMOCK_dcd_edpt_stall_CALLBACK Callback)
+{
+  Mock.dcd_edpt_stall_IgnoreBool = (int)0;
+  Mock.dcd_edpt_stall_CallbackBool = (int)1;
+  Mock.dcd_edpt_stall_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_stall_Stub(CMOCK_dcd_edpt_stall_CALLBACK Callback)
+{
+  Mock.dcd_edpt_stall_IgnoreBool = (int)0;
+  Mock.dcd_edpt_stall_CallbackBool = (int)0;
+  Mock.dcd_edpt_stall_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_stall_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_stall_CALL_INSTANCE));
+  CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_stall_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_stall_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_stall_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_stall(cmock_call_instance, rhport, ep_addr);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt_stall_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_stall_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt_stall_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_stall_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ep_addr = 1;
+}
+
+void dcd_edpt_clear_stall(uint8_t rhport, uint8_t ep_addr)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dcd_edpt_clear_stall);
+  cmock_call_instance = (CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dcd_edpt_clear_stall_CallInstance);
+  Mock.dcd_edpt_clear_stall_CallInstance = CMock_Guts_MemNext(Mock.dcd_edpt_clear_stall_CallInstance);
+  if (Mock.dcd_edpt_clear_stall_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dcd_edpt_clear_stall_CallbackBool &&
+      Mock.dcd_edpt_clear_stall_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_clear_stall_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_clear_stall_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_clear_stall,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_ep_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_dcd_edpt_clear_stall,CMockString_ep_addr);
+    if (cmock_call_instance->Expected_ep_addr != ep_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ep_addr, ep_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.dcd_edpt_clear_stall_CallbackFunctionPointer != NULL)
+  {
+    Mock.dcd_edpt_clear_stall_CallbackFunctionPointer(rhport, ep_addr, Mock.dcd_edpt_clear_stall_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dcd_edpt_clear_stall(CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr);
+void CMockExpectParameters_dcd_edpt_clear_stall(CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_ep_addr = ep_addr;
+  cmock_call_instance->IgnoreArg_ep_addr = 0;
+}
+
+void dcd_edpt_clear_stall_CMockIgnore(void)
+{
+  Mock.dcd_edpt_clear_stall_IgnoreBool = (int)1;
+}
+
+void dcd_edpt_clear_stall_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE));
+  CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_clear_stall_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_clear_stall_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_clear_stall_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_clear_stall(cmock_call_instance, rhport, ep_addr);
+}
+
+void dcd_edpt_clear_stall_AddCallback(CMOCK_dcd_edpt_clear_stall_CALLBACK Callback)
+{
+  Mock.dcd_edpt_clear_stall_IgnoreBool = (int)0;
+  Mock.dcd_edpt_clear_stall_CallbackBool = (int)1;
+  Mock.dcd_edpt_clear_stall_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_clear_stall_Stub(CMOCK_dcd_edpt_clear_stall_CALLBACK Callback)
+{
+  Mock.dcd_edpt_clear_stall_IgnoreBool = (int)0;
+  Mock.dcd_edpt_clear_stall_CallbackBool = (int)0;
+  Mock.dcd_edpt_clear_stall_CallbackFunctionPointer = Callback;
+}
+
+void dcd_edpt_clear_stall_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE));
+  CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dcd_edpt_clear_stall_CallInstance = CMock_Guts_MemChain(Mock.dcd_edpt_clear_stall_CallInstance, cmock_guts_index);
+  Mock.dcd_edpt_clear_stall_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dcd_edpt_clear_stall(cmock_call_instance, rhport, ep_addr);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dcd_edpt_clear_stall_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_clear_stall_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void dcd_edpt_clear_stall_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE* cmock_call_instance = (CMOCK_dcd_edpt_clear_stall_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dcd_edpt_clear_stall_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ep_addr = 1;
+}
+
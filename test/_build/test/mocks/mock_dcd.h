@@ -0,0 +1,231 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_DCD_H
+#define _MOCK_DCD_H
+
+#include "unity.h"
+#include "dcd.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_dcd_Init(void);
+void mock_dcd_Destroy(void);
+void mock_dcd_Verify(void);
+
+
+
+
+#define dcd_init_Ignore() dcd_init_CMockIgnore()
+void dcd_init_CMockIgnore(void);
+#define dcd_init_Expect(rhport) dcd_init_CMockExpect(__LINE__, rhport)
+void dcd_init_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_init_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_init_AddCallback(CMOCK_dcd_init_CALLBACK Callback);
+void dcd_init_Stub(CMOCK_dcd_init_CALLBACK Callback);
+#define dcd_init_StubWithCallback dcd_init_Stub
+#define dcd_init_ExpectAndThrow(rhport, cmock_to_throw) dcd_init_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_init_IgnoreArg_rhport() dcd_init_CMockIgnoreArg_rhport(__LINE__)
+void dcd_init_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_int_handler_Ignore() dcd_int_handler_CMockIgnore()
+void dcd_int_handler_CMockIgnore(void);
+#define dcd_int_handler_Expect(rhport) dcd_int_handler_CMockExpect(__LINE__, rhport)
+void dcd_int_handler_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_int_handler_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_int_handler_AddCallback(CMOCK_dcd_int_handler_CALLBACK Callback);
+void dcd_int_handler_Stub(CMOCK_dcd_int_handler_CALLBACK Callback);
+#define dcd_int_handler_StubWithCallback dcd_int_handler_Stub
+#define dcd_int_handler_ExpectAndThrow(rhport, cmock_to_throw) dcd_int_handler_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_int_handler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_int_handler_IgnoreArg_rhport() dcd_int_handler_CMockIgnoreArg_rhport(__LINE__)
+void dcd_int_handler_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_int_enable_Ignore() dcd_int_enable_CMockIgnore()
+void dcd_int_enable_CMockIgnore(void);
+#define dcd_int_enable_Expect(rhport) dcd_int_enable_CMockExpect(__LINE__, rhport)
+void dcd_int_enable_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_int_enable_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_int_enable_AddCallback(CMOCK_dcd_int_enable_CALLBACK Callback);
+void dcd_int_enable_Stub(CMOCK_dcd_int_enable_CALLBACK Callback);
+#define dcd_int_enable_StubWithCallback dcd_int_enable_Stub
+#define dcd_int_enable_ExpectAndThrow(rhport, cmock_to_throw) dcd_int_enable_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_int_enable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_int_enable_IgnoreArg_rhport() dcd_int_enable_CMockIgnoreArg_rhport(__LINE__)
+void dcd_int_enable_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_int_disable_Ignore() dcd_int_disable_CMockIgnore()
+void dcd_int_disable_CMockIgnore(void);
+#define dcd_int_disable_Expect(rhport) dcd_int_disable_CMockExpect(__LINE__, rhport)
+void dcd_int_disable_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_int_disable_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_int_disable_AddCallback(CMOCK_dcd_int_disable_CALLBACK Callback);
+void dcd_int_disable_Stub(CMOCK_dcd_int_disable_CALLBACK Callback);
+#define dcd_int_disable_StubWithCallback dcd_int_disable_Stub
+#define dcd_int_disable_ExpectAndThrow(rhport, cmock_to_throw) dcd_int_disable_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_int_disable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_int_disable_IgnoreArg_rhport() dcd_int_disable_CMockIgnoreArg_rhport(__LINE__)
+void dcd_int_disable_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_set_address_Ignore() dcd_set_address_CMockIgnore()
+void dcd_set_address_CMockIgnore(void);
+#define dcd_set_address_Expect(rhport, dev_addr) dcd_set_address_CMockExpect(__LINE__, rhport, dev_addr)
+void dcd_set_address_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t dev_addr);
+typedef void (* CMOCK_dcd_set_address_CALLBACK)(uint8_t rhport, uint8_t dev_addr, int cmock_num_calls);
+void dcd_set_address_AddCallback(CMOCK_dcd_set_address_CALLBACK Callback);
+void dcd_set_address_Stub(CMOCK_dcd_set_address_CALLBACK Callback);
+#define dcd_set_address_StubWithCallback dcd_set_address_Stub
+#define dcd_set_address_ExpectAndThrow(rhport, dev_addr, cmock_to_throw) dcd_set_address_CMockExpectAndThrow(__LINE__, rhport, dev_addr, cmock_to_throw)
+void dcd_set_address_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t dev_addr, CEXCEPTION_T cmock_to_throw);
+#define dcd_set_address_IgnoreArg_rhport() dcd_set_address_CMockIgnoreArg_rhport(__LINE__)
+void dcd_set_address_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_set_address_IgnoreArg_dev_addr() dcd_set_address_CMockIgnoreArg_dev_addr(__LINE__)
+void dcd_set_address_CMockIgnoreArg_dev_addr(UNITY_LINE_TYPE cmock_line);
+#define dcd_remote_wakeup_Ignore() dcd_remote_wakeup_CMockIgnore()
+void dcd_remote_wakeup_CMockIgnore(void);
+#define dcd_remote_wakeup_Expect(rhport) dcd_remote_wakeup_CMockExpect(__LINE__, rhport)
+void dcd_remote_wakeup_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_remote_wakeup_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_remote_wakeup_AddCallback(CMOCK_dcd_remote_wakeup_CALLBACK Callback);
+void dcd_remote_wakeup_Stub(CMOCK_dcd_remote_wakeup_CALLBACK Callback);
+#define dcd_remote_wakeup_StubWithCallback dcd_remote_wakeup_Stub
+#define dcd_remote_wakeup_ExpectAndThrow(rhport, cmock_to_throw) dcd_remote_wakeup_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_remote_wakeup_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_remote_wakeup_IgnoreArg_rhport() dcd_remote_wakeup_CMockIgnoreArg_rhport(__LINE__)
+void dcd_remote_wakeup_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_connect_Ignore() dcd_connect_CMockIgnore()
+void dcd_connect_CMockIgnore(void);
+#define dcd_connect_Expect(rhport) dcd_connect_CMockExpect(__LINE__, rhport)
+void dcd_connect_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_connect_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_connect_AddCallback(CMOCK_dcd_connect_CALLBACK Callback);
+void dcd_connect_Stub(CMOCK_dcd_connect_CALLBACK Callback);
+#define dcd_connect_StubWithCallback dcd_connect_Stub
+#define dcd_connect_ExpectAndThrow(rhport, cmock_to_throw) dcd_connect_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_connect_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_connect_IgnoreArg_rhport() dcd_connect_CMockIgnoreArg_rhport(__LINE__)
+void dcd_connect_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_disconnect_Ignore() dcd_disconnect_CMockIgnore()
+void dcd_disconnect_CMockIgnore(void);
+#define dcd_disconnect_Expect(rhport) dcd_disconnect_CMockExpect(__LINE__, rhport)
+void dcd_disconnect_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_dcd_disconnect_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void dcd_disconnect_AddCallback(CMOCK_dcd_disconnect_CALLBACK Callback);
+void dcd_disconnect_Stub(CMOCK_dcd_disconnect_CALLBACK Callback);
+#define dcd_disconnect_StubWithCallback dcd_disconnect_Stub
+#define dcd_disconnect_ExpectAndThrow(rhport, cmock_to_throw) dcd_disconnect_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void dcd_disconnect_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define dcd_disconnect_IgnoreArg_rhport() dcd_disconnect_CMockIgnoreArg_rhport(__LINE__)
+void dcd_disconnect_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt0_status_complete_Ignore() dcd_edpt0_status_complete_CMockIgnore()
+void dcd_edpt0_status_complete_CMockIgnore(void);
+#define dcd_edpt0_status_complete_Expect(rhport, request) dcd_edpt0_status_complete_CMockExpect(__LINE__, rhport, request)
+void dcd_edpt0_status_complete_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request);
+typedef void (* CMOCK_dcd_edpt0_status_complete_CALLBACK)(uint8_t rhport, tusb_control_request_t const* request, int cmock_num_calls);
+void dcd_edpt0_status_complete_AddCallback(CMOCK_dcd_edpt0_status_complete_CALLBACK Callback);
+void dcd_edpt0_status_complete_Stub(CMOCK_dcd_edpt0_status_complete_CALLBACK Callback);
+#define dcd_edpt0_status_complete_StubWithCallback dcd_edpt0_status_complete_Stub
+#define dcd_edpt0_status_complete_ExpectAndThrow(rhport, request, cmock_to_throw) dcd_edpt0_status_complete_CMockExpectAndThrow(__LINE__, rhport, request, cmock_to_throw)
+void dcd_edpt0_status_complete_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt0_status_complete_ExpectWithArray(rhport, request, request_Depth) dcd_edpt0_status_complete_CMockExpectWithArray(__LINE__, rhport, request, request_Depth)
+void dcd_edpt0_status_complete_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* request, int request_Depth);
+#define dcd_edpt0_status_complete_IgnoreArg_rhport() dcd_edpt0_status_complete_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt0_status_complete_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt0_status_complete_IgnoreArg_request() dcd_edpt0_status_complete_CMockIgnoreArg_request(__LINE__)
+void dcd_edpt0_status_complete_CMockIgnoreArg_request(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_open_IgnoreAndReturn(cmock_retval) dcd_edpt_open_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void dcd_edpt_open_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define dcd_edpt_open_ExpectAndReturn(rhport, p_endpoint_desc, cmock_retval) dcd_edpt_open_CMockExpectAndReturn(__LINE__, rhport, p_endpoint_desc, cmock_retval)
+void dcd_edpt_open_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_dcd_edpt_open_CALLBACK)(uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, int cmock_num_calls);
+void dcd_edpt_open_AddCallback(CMOCK_dcd_edpt_open_CALLBACK Callback);
+void dcd_edpt_open_Stub(CMOCK_dcd_edpt_open_CALLBACK Callback);
+#define dcd_edpt_open_StubWithCallback dcd_edpt_open_Stub
+#define dcd_edpt_open_ExpectAndThrow(rhport, p_endpoint_desc, cmock_to_throw) dcd_edpt_open_CMockExpectAndThrow(__LINE__, rhport, p_endpoint_desc, cmock_to_throw)
+void dcd_edpt_open_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt_open_ExpectWithArrayAndReturn(rhport, p_endpoint_desc, p_endpoint_desc_Depth, cmock_retval) dcd_edpt_open_CMockExpectWithArrayAndReturn(__LINE__, rhport, p_endpoint_desc, p_endpoint_desc_Depth, cmock_retval)
+void dcd_edpt_open_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_endpoint_t const* p_endpoint_desc, int p_endpoint_desc_Depth, _Bool cmock_to_return);
+#define dcd_edpt_open_IgnoreArg_rhport() dcd_edpt_open_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt_open_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_open_IgnoreArg_p_endpoint_desc() dcd_edpt_open_CMockIgnoreArg_p_endpoint_desc(__LINE__)
+void dcd_edpt_open_CMockIgnoreArg_p_endpoint_desc(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_close_Ignore() dcd_edpt_close_CMockIgnore()
+void dcd_edpt_close_CMockIgnore(void);
+#define dcd_edpt_close_Expect(rhport, ep_addr) dcd_edpt_close_CMockExpect(__LINE__, rhport, ep_addr)
+void dcd_edpt_close_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr);
+typedef void (* CMOCK_dcd_edpt_close_CALLBACK)(uint8_t rhport, uint8_t ep_addr, int cmock_num_calls);
+void dcd_edpt_close_AddCallback(CMOCK_dcd_edpt_close_CALLBACK Callback);
+void dcd_edpt_close_Stub(CMOCK_dcd_edpt_close_CALLBACK Callback);
+#define dcd_edpt_close_StubWithCallback dcd_edpt_close_Stub
+#define dcd_edpt_close_ExpectAndThrow(rhport, ep_addr, cmock_to_throw) dcd_edpt_close_CMockExpectAndThrow(__LINE__, rhport, ep_addr, cmock_to_throw)
+void dcd_edpt_close_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt_close_IgnoreArg_rhport() dcd_edpt_close_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt_close_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_close_IgnoreArg_ep_addr() dcd_edpt_close_CMockIgnoreArg_ep_addr(__LINE__)
+void dcd_edpt_close_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_xfer_IgnoreAndReturn(cmock_retval) dcd_edpt_xfer_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void dcd_edpt_xfer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define dcd_edpt_xfer_ExpectAndReturn(rhport, ep_addr, buffer, total_bytes, cmock_retval) dcd_edpt_xfer_CMockExpectAndReturn(__LINE__, rhport, ep_addr, buffer, total_bytes, cmock_retval)
+void dcd_edpt_xfer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_dcd_edpt_xfer_CALLBACK)(uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes, int cmock_num_calls);
+void dcd_edpt_xfer_AddCallback(CMOCK_dcd_edpt_xfer_CALLBACK Callback);
+void dcd_edpt_xfer_Stub(CMOCK_dcd_edpt_xfer_CALLBACK Callback);
+#define dcd_edpt_xfer_StubWithCallback dcd_edpt_xfer_Stub
+#define dcd_edpt_xfer_ExpectAndThrow(rhport, ep_addr, buffer, total_bytes, cmock_to_throw) dcd_edpt_xfer_CMockExpectAndThrow(__LINE__, rhport, ep_addr, buffer, total_bytes, cmock_to_throw)
+void dcd_edpt_xfer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, uint16_t total_bytes, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt_xfer_ExpectWithArrayAndReturn(rhport, ep_addr, buffer, buffer_Depth, total_bytes, cmock_retval) dcd_edpt_xfer_CMockExpectWithArrayAndReturn(__LINE__, rhport, ep_addr, buffer, buffer_Depth, total_bytes, cmock_retval)
+void dcd_edpt_xfer_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, uint8_t* buffer, int buffer_Depth, uint16_t total_bytes, _Bool cmock_to_return);
+#define dcd_edpt_xfer_ReturnThruPtr_buffer(buffer) dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(__LINE__, buffer, sizeof(uint8_t))
+#define dcd_edpt_xfer_ReturnArrayThruPtr_buffer(buffer, cmock_len) dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(__LINE__, buffer, (int)(cmock_len * (int)sizeof(*buffer)))
+#define dcd_edpt_xfer_ReturnMemThruPtr_buffer(buffer, cmock_size) dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(__LINE__, buffer, cmock_size)
+void dcd_edpt_xfer_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, uint8_t* buffer, int cmock_size);
+#define dcd_edpt_xfer_IgnoreArg_rhport() dcd_edpt_xfer_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt_xfer_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_xfer_IgnoreArg_ep_addr() dcd_edpt_xfer_CMockIgnoreArg_ep_addr(__LINE__)
+void dcd_edpt_xfer_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_xfer_IgnoreArg_buffer() dcd_edpt_xfer_CMockIgnoreArg_buffer(__LINE__)
+void dcd_edpt_xfer_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_xfer_IgnoreArg_total_bytes() dcd_edpt_xfer_CMockIgnoreArg_total_bytes(__LINE__)
+void dcd_edpt_xfer_CMockIgnoreArg_total_bytes(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_stall_Ignore() dcd_edpt_stall_CMockIgnore()
+void dcd_edpt_stall_CMockIgnore(void);
+#define dcd_edpt_stall_Expect(rhport, ep_addr) dcd_edpt_stall_CMockExpect(__LINE__, rhport, ep_addr)
+void dcd_edpt_stall_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr);
+typedef void (* CMOCK_dcd_edpt_stall_CALLBACK)(uint8_t rhport, uint8_t ep_addr, int cmock_num_calls);
+void dcd_edpt_stall_AddCallback(CMOCK_dcd_edpt_stall_CALLBACK Callback);
+void dcd_edpt_stall_Stub(CMOCK_dcd_edpt_stall_CALLBACK Callback);
+#define dcd_edpt_stall_StubWithCallback dcd_edpt_stall_Stub
+#define dcd_edpt_stall_ExpectAndThrow(rhport, ep_addr, cmock_to_throw) dcd_edpt_stall_CMockExpectAndThrow(__LINE__, rhport, ep_addr, cmock_to_throw)
+void dcd_edpt_stall_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt_stall_IgnoreArg_rhport() dcd_edpt_stall_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt_stall_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_stall_IgnoreArg_ep_addr() dcd_edpt_stall_CMockIgnoreArg_ep_addr(__LINE__)
+void dcd_edpt_stall_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_clear_stall_Ignore() dcd_edpt_clear_stall_CMockIgnore()
+void dcd_edpt_clear_stall_CMockIgnore(void);
+#define dcd_edpt_clear_stall_Expect(rhport, ep_addr) dcd_edpt_clear_stall_CMockExpect(__LINE__, rhport, ep_addr)
+void dcd_edpt_clear_stall_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr);
+typedef void (* CMOCK_dcd_edpt_clear_stall_CALLBACK)(uint8_t rhport, uint8_t ep_addr, int cmock_num_calls);
+void dcd_edpt_clear_stall_AddCallback(CMOCK_dcd_edpt_clear_stall_CALLBACK Callback);
+void dcd_edpt_clear_stall_Stub(CMOCK_dcd_edpt_clear_stall_CALLBACK Callback);
+#define dcd_edpt_clear_stall_StubWithCallback dcd_edpt_clear_stall_Stub
+#define dcd_edpt_clear_stall_ExpectAndThrow(rhport, ep_addr, cmock_to_throw) dcd_edpt_clear_stall_CMockExpectAndThrow(__LINE__, rhport, ep_addr, cmock_to_throw)
+void dcd_edpt_clear_stall_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, CEXCEPTION_T cmock_to_throw);
+#define dcd_edpt_clear_stall_IgnoreArg_rhport() dcd_edpt_clear_stall_CMockIgnoreArg_rhport(__LINE__)
+void dcd_edpt_clear_stall_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define dcd_edpt_clear_stall_IgnoreArg_ep_addr() dcd_edpt_clear_stall_CMockIgnoreArg_ep_addr(__LINE__)
+void dcd_edpt_clear_stall_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
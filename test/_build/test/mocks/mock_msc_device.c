@@ -0,0 +1,3577 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "mock_msc_device.h"
+
+static const char* CMockString_add_sense_code = "add_sense_code";
+static const char* CMockString_add_sense_qualifier = "add_sense_qualifier";
+static const char* CMockString_block_count = "block_count";
+static const char* CMockString_block_size = "block_size";
+static const char* CMockString_buffer = "buffer";
+static const char* CMockString_bufsize = "bufsize";
+static const char* CMockString_ep_addr = "ep_addr";
+static const char* CMockString_event = "event";
+static const char* CMockString_itf_desc = "itf_desc";
+static const char* CMockString_lba = "lba";
+static const char* CMockString_load_eject = "load_eject";
+static const char* CMockString_lun = "lun";
+static const char* CMockString_max_len = "max_len";
+static const char* CMockString_mscd_control_complete = "mscd_control_complete";
+static const char* CMockString_mscd_control_request = "mscd_control_request";
+static const char* CMockString_mscd_init = "mscd_init";
+static const char* CMockString_mscd_open = "mscd_open";
+static const char* CMockString_mscd_reset = "mscd_reset";
+static const char* CMockString_mscd_xfer_cb = "mscd_xfer_cb";
+static const char* CMockString_offset = "offset";
+static const char* CMockString_p_request = "p_request";
+static const char* CMockString_power_condition = "power_condition";
+static const char* CMockString_product_id = "product_id";
+static const char* CMockString_product_rev = "product_rev";
+static const char* CMockString_rhport = "rhport";
+static const char* CMockString_scsi_cmd = "scsi_cmd";
+static const char* CMockString_sense_key = "sense_key";
+static const char* CMockString_start = "start";
+static const char* CMockString_tud_msc_capacity_cb = "tud_msc_capacity_cb";
+static const char* CMockString_tud_msc_get_maxlun_cb = "tud_msc_get_maxlun_cb";
+static const char* CMockString_tud_msc_inquiry_cb = "tud_msc_inquiry_cb";
+static const char* CMockString_tud_msc_is_writable_cb = "tud_msc_is_writable_cb";
+static const char* CMockString_tud_msc_read10_cb = "tud_msc_read10_cb";
+static const char* CMockString_tud_msc_read10_complete_cb = "tud_msc_read10_complete_cb";
+static const char* CMockString_tud_msc_scsi_cb = "tud_msc_scsi_cb";
+static const char* CMockString_tud_msc_scsi_complete_cb = "tud_msc_scsi_complete_cb";
+static const char* CMockString_tud_msc_set_sense = "tud_msc_set_sense";
+static const char* CMockString_tud_msc_start_stop_cb = "tud_msc_start_stop_cb";
+static const char* CMockString_tud_msc_test_unit_ready_cb = "tud_msc_test_unit_ready_cb";
+static const char* CMockString_tud_msc_write10_cb = "tud_msc_write10_cb";
+static const char* CMockString_tud_msc_write10_complete_cb = "tud_msc_write10_complete_cb";
+static const char* CMockString_vendor_id = "vendor_id";
+static const char* CMockString_xferred_bytes = "xferred_bytes";
+
+typedef struct _CMOCK_tud_msc_set_sense_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint8_t Expected_sense_key;
+  uint8_t Expected_add_sense_code;
+  uint8_t Expected_add_sense_qualifier;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+  int IgnoreArg_sense_key;
+  int IgnoreArg_add_sense_code;
+  int IgnoreArg_add_sense_qualifier;
+
+} CMOCK_tud_msc_set_sense_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_read10_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint32_t Expected_lba;
+  uint32_t Expected_offset;
+  void* Expected_buffer;
+  uint32_t Expected_bufsize;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_buffer_Depth;
+  int ReturnThruPtr_buffer_Used;
+  void* ReturnThruPtr_buffer_Val;
+  int ReturnThruPtr_buffer_Size;
+  int IgnoreArg_lun;
+  int IgnoreArg_lba;
+  int IgnoreArg_offset;
+  int IgnoreArg_buffer;
+  int IgnoreArg_bufsize;
+
+} CMOCK_tud_msc_read10_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_write10_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint32_t Expected_lba;
+  uint32_t Expected_offset;
+  uint8_t* Expected_buffer;
+  uint32_t Expected_bufsize;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_buffer_Depth;
+  int ReturnThruPtr_buffer_Used;
+  uint8_t* ReturnThruPtr_buffer_Val;
+  int ReturnThruPtr_buffer_Size;
+  int IgnoreArg_lun;
+  int IgnoreArg_lba;
+  int IgnoreArg_offset;
+  int IgnoreArg_buffer;
+  int IgnoreArg_bufsize;
+
+} CMOCK_tud_msc_write10_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint8_t* Expected_vendor_id;
+  uint8_t* Expected_product_id;
+  uint8_t* Expected_product_rev;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_vendor_id_Depth;
+  int Expected_product_id_Depth;
+  int Expected_product_rev_Depth;
+  int ReturnThruPtr_vendor_id_Used;
+  uint8_t* ReturnThruPtr_vendor_id_Val;
+  int ReturnThruPtr_vendor_id_Size;
+  int ReturnThruPtr_product_id_Used;
+  uint8_t* ReturnThruPtr_product_id_Val;
+  int ReturnThruPtr_product_id_Size;
+  int ReturnThruPtr_product_rev_Used;
+  uint8_t* ReturnThruPtr_product_rev_Val;
+  int ReturnThruPtr_product_rev_Size;
+  int IgnoreArg_lun;
+  int IgnoreArg_vendor_id;
+  int IgnoreArg_product_id;
+  int IgnoreArg_product_rev;
+
+} CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+
+} CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_capacity_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint32_t* Expected_block_count;
+  uint16_t* Expected_block_size;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_block_count_Depth;
+  int Expected_block_size_Depth;
+  int ReturnThruPtr_block_count_Used;
+  uint32_t* ReturnThruPtr_block_count_Val;
+  int ReturnThruPtr_block_count_Size;
+  int ReturnThruPtr_block_size_Used;
+  uint16_t* ReturnThruPtr_block_size_Val;
+  int ReturnThruPtr_block_size_Size;
+  int IgnoreArg_lun;
+  int IgnoreArg_block_count;
+  int IgnoreArg_block_size;
+
+} CMOCK_tud_msc_capacity_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_scsi_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint8_t const* Expected_scsi_cmd;
+  void* Expected_buffer;
+  uint16_t Expected_bufsize;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_scsi_cmd_Depth;
+  int Expected_buffer_Depth;
+  int ReturnThruPtr_buffer_Used;
+  void* ReturnThruPtr_buffer_Val;
+  int ReturnThruPtr_buffer_Size;
+  int IgnoreArg_lun;
+  int IgnoreArg_scsi_cmd;
+  int IgnoreArg_buffer;
+  int IgnoreArg_bufsize;
+
+} CMOCK_tud_msc_scsi_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint8_t Expected_power_condition;
+  _Bool Expected_start;
+  _Bool Expected_load_eject;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+  int IgnoreArg_power_condition;
+  int IgnoreArg_start;
+  int IgnoreArg_load_eject;
+
+} CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_lun;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+
+} CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_lun;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+
+} CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_lun;
+  uint8_t const* Expected_scsi_cmd;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_scsi_cmd_Depth;
+  int IgnoreArg_lun;
+  int IgnoreArg_scsi_cmd;
+
+} CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_lun;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_lun;
+
+} CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_mscd_init_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_reset_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+
+} CMOCK_mscd_reset_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_open_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  tusb_desc_interface_t const* Expected_itf_desc;
+  uint16_t Expected_max_len;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_itf_desc_Depth;
+  int IgnoreArg_rhport;
+  int IgnoreArg_itf_desc;
+  int IgnoreArg_max_len;
+
+} CMOCK_mscd_open_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_control_request_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  tusb_control_request_t const* Expected_p_request;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_p_request_Depth;
+  int IgnoreArg_rhport;
+  int IgnoreArg_p_request;
+
+} CMOCK_mscd_control_request_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_control_complete_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  tusb_control_request_t const* Expected_p_request;
+  CEXCEPTION_T ExceptionToThrow;
+  int Expected_p_request_Depth;
+  int IgnoreArg_rhport;
+  int IgnoreArg_p_request;
+
+} CMOCK_mscd_control_complete_CALL_INSTANCE;
+
+typedef struct _CMOCK_mscd_xfer_cb_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_rhport;
+  uint8_t Expected_ep_addr;
+  xfer_result_t Expected_event;
+  uint32_t Expected_xferred_bytes;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_rhport;
+  int IgnoreArg_ep_addr;
+  int IgnoreArg_event;
+  int IgnoreArg_xferred_bytes;
+
+} CMOCK_mscd_xfer_cb_CALL_INSTANCE;
+
+static struct mock_msc_deviceInstance
+{
+  int tud_msc_set_sense_IgnoreBool;
+  _Bool tud_msc_set_sense_FinalReturn;
+  int tud_msc_set_sense_CallbackBool;
+  CMOCK_tud_msc_set_sense_CALLBACK tud_msc_set_sense_CallbackFunctionPointer;
+  int tud_msc_set_sense_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_set_sense_CallInstance;
+  int tud_msc_read10_cb_IgnoreBool;
+  int32_t tud_msc_read10_cb_FinalReturn;
+  int tud_msc_read10_cb_CallbackBool;
+  CMOCK_tud_msc_read10_cb_CALLBACK tud_msc_read10_cb_CallbackFunctionPointer;
+  int tud_msc_read10_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_read10_cb_CallInstance;
+  int tud_msc_write10_cb_IgnoreBool;
+  int32_t tud_msc_write10_cb_FinalReturn;
+  int tud_msc_write10_cb_CallbackBool;
+  CMOCK_tud_msc_write10_cb_CALLBACK tud_msc_write10_cb_CallbackFunctionPointer;
+  int tud_msc_write10_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_write10_cb_CallInstance;
+  int tud_msc_inquiry_cb_IgnoreBool;
+  int tud_msc_inquiry_cb_CallbackBool;
+  CMOCK_tud_msc_inquiry_cb_CALLBACK tud_msc_inquiry_cb_CallbackFunctionPointer;
+  int tud_msc_inquiry_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_inquiry_cb_CallInstance;
+  int tud_msc_test_unit_ready_cb_IgnoreBool;
+  _Bool tud_msc_test_unit_ready_cb_FinalReturn;
+  int tud_msc_test_unit_ready_cb_CallbackBool;
+  CMOCK_tud_msc_test_unit_ready_cb_CALLBACK tud_msc_test_unit_ready_cb_CallbackFunctionPointer;
+  int tud_msc_test_unit_ready_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_test_unit_ready_cb_CallInstance;
+  int tud_msc_capacity_cb_IgnoreBool;
+  int tud_msc_capacity_cb_CallbackBool;
+  CMOCK_tud_msc_capacity_cb_CALLBACK tud_msc_capacity_cb_CallbackFunctionPointer;
+  int tud_msc_capacity_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_capacity_cb_CallInstance;
+  int tud_msc_scsi_cb_IgnoreBool;
+  int32_t tud_msc_scsi_cb_FinalReturn;
+  int tud_msc_scsi_cb_CallbackBool;
+  CMOCK_tud_msc_scsi_cb_CALLBACK tud_msc_scsi_cb_CallbackFunctionPointer;
+  int tud_msc_scsi_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_scsi_cb_CallInstance;
+  int tud_msc_get_maxlun_cb_IgnoreBool;
+  uint8_t tud_msc_get_maxlun_cb_FinalReturn;
+  int tud_msc_get_maxlun_cb_CallbackBool;
+  CMOCK_tud_msc_get_maxlun_cb_CALLBACK tud_msc_get_maxlun_cb_CallbackFunctionPointer;
+  int tud_msc_get_maxlun_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_get_maxlun_cb_CallInstance;
+  int tud_msc_start_stop_cb_IgnoreBool;
+  _Bool tud_msc_start_stop_cb_FinalReturn;
+  int tud_msc_start_stop_cb_CallbackBool;
+  CMOCK_tud_msc_start_stop_cb_CALLBACK tud_msc_start_stop_cb_CallbackFunctionPointer;
+  int tud_msc_start_stop_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_start_stop_cb_CallInstance;
+  int tud_msc_read10_complete_cb_IgnoreBool;
+  int tud_msc_read10_complete_cb_CallbackBool;
+  CMOCK_tud_msc_read10_complete_cb_CALLBACK tud_msc_read10_complete_cb_CallbackFunctionPointer;
+  int tud_msc_read10_complete_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_read10_complete_cb_CallInstance;
+  int tud_msc_write10_complete_cb_IgnoreBool;
+  int tud_msc_write10_complete_cb_CallbackBool;
+  CMOCK_tud_msc_write10_complete_cb_CALLBACK tud_msc_write10_complete_cb_CallbackFunctionPointer;
+  int tud_msc_write10_complete_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_write10_complete_cb_CallInstance;
+  int tud_msc_scsi_complete_cb_IgnoreBool;
+  int tud_msc_scsi_complete_cb_CallbackBool;
+  CMOCK_tud_msc_scsi_complete_cb_CALLBACK tud_msc_scsi_complete_cb_CallbackFunctionPointer;
+  int tud_msc_scsi_complete_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_scsi_complete_cb_CallInstance;
+  int tud_msc_is_writable_cb_IgnoreBool;
+  _Bool tud_msc_is_writable_cb_FinalReturn;
+  int tud_msc_is_writable_cb_CallbackBool;
+  CMOCK_tud_msc_is_writable_cb_CALLBACK tud_msc_is_writable_cb_CallbackFunctionPointer;
+  int tud_msc_is_writable_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE tud_msc_is_writable_cb_CallInstance;
+  int mscd_init_IgnoreBool;
+  int mscd_init_CallbackBool;
+  CMOCK_mscd_init_CALLBACK mscd_init_CallbackFunctionPointer;
+  int mscd_init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_init_CallInstance;
+  int mscd_reset_IgnoreBool;
+  int mscd_reset_CallbackBool;
+  CMOCK_mscd_reset_CALLBACK mscd_reset_CallbackFunctionPointer;
+  int mscd_reset_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_reset_CallInstance;
+  int mscd_open_IgnoreBool;
+  uint16_t mscd_open_FinalReturn;
+  int mscd_open_CallbackBool;
+  CMOCK_mscd_open_CALLBACK mscd_open_CallbackFunctionPointer;
+  int mscd_open_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_open_CallInstance;
+  int mscd_control_request_IgnoreBool;
+  _Bool mscd_control_request_FinalReturn;
+  int mscd_control_request_CallbackBool;
+  CMOCK_mscd_control_request_CALLBACK mscd_control_request_CallbackFunctionPointer;
+  int mscd_control_request_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_control_request_CallInstance;
+  int mscd_control_complete_IgnoreBool;
+  _Bool mscd_control_complete_FinalReturn;
+  int mscd_control_complete_CallbackBool;
+  CMOCK_mscd_control_complete_CALLBACK mscd_control_complete_CallbackFunctionPointer;
+  int mscd_control_complete_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_control_complete_CallInstance;
+  int mscd_xfer_cb_IgnoreBool;
+  _Bool mscd_xfer_cb_FinalReturn;
+  int mscd_xfer_cb_CallbackBool;
+  CMOCK_mscd_xfer_cb_CALLBACK mscd_xfer_cb_CallbackFunctionPointer;
+  int mscd_xfer_cb_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE mscd_xfer_cb_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_msc_device_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.tud_msc_set_sense_CallInstance;
+  if (Mock.tud_msc_set_sense_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_set_sense);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_set_sense_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_read10_cb_CallInstance;
+  if (Mock.tud_msc_read10_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_read10_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_read10_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_write10_cb_CallInstance;
+  if (Mock.tud_msc_write10_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_write10_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_write10_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_inquiry_cb_CallInstance;
+  if (Mock.tud_msc_inquiry_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_inquiry_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_inquiry_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_test_unit_ready_cb_CallInstance;
+  if (Mock.tud_msc_test_unit_ready_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_test_unit_ready_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_capacity_cb_CallInstance;
+  if (Mock.tud_msc_capacity_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_capacity_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_capacity_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_scsi_cb_CallInstance;
+  if (Mock.tud_msc_scsi_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_scsi_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_scsi_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_get_maxlun_cb_CallInstance;
+  if (Mock.tud_msc_get_maxlun_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_get_maxlun_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_start_stop_cb_CallInstance;
+  if (Mock.tud_msc_start_stop_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_start_stop_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_start_stop_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_read10_complete_cb_CallInstance;
+  if (Mock.tud_msc_read10_complete_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_read10_complete_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_write10_complete_cb_CallInstance;
+  if (Mock.tud_msc_write10_complete_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_write10_complete_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_scsi_complete_cb_CallInstance;
+  if (Mock.tud_msc_scsi_complete_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_scsi_complete_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.tud_msc_is_writable_cb_CallInstance;
+  if (Mock.tud_msc_is_writable_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_tud_msc_is_writable_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.tud_msc_is_writable_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_init_CallInstance;
+  if (Mock.mscd_init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_init);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_init_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_reset_CallInstance;
+  if (Mock.mscd_reset_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_reset);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_reset_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_open_CallInstance;
+  if (Mock.mscd_open_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_open);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_open_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_control_request_CallInstance;
+  if (Mock.mscd_control_request_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_control_request);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_control_request_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_control_complete_CallInstance;
+  if (Mock.mscd_control_complete_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_control_complete);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_control_complete_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+  call_instance = Mock.mscd_xfer_cb_CallInstance;
+  if (Mock.mscd_xfer_cb_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_mscd_xfer_cb);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == call_instance, cmock_line, CMockStringCalledLess);
+  UNITY_CLR_DETAILS();
+  if (Mock.mscd_xfer_cb_CallbackFunctionPointer != NULL)
+    call_instance = CMOCK_GUTS_NONE;
+}
+
+void mock_msc_device_Init(void)
+{
+  mock_msc_device_Destroy();
+}
+
+void mock_msc_device_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+_Bool tud_msc_set_sense(uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_set_sense);
+  cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_set_sense_CallInstance);
+  Mock.tud_msc_set_sense_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_set_sense_CallInstance);
+  if (Mock.tud_msc_set_sense_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_set_sense_FinalReturn;
+    memcpy((void*)(&Mock.tud_msc_set_sense_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_set_sense_CallbackBool &&
+      Mock.tud_msc_set_sense_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.tud_msc_set_sense_CallbackFunctionPointer(lun, sense_key, add_sense_code, add_sense_qualifier, Mock.tud_msc_set_sense_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_set_sense,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_sense_key)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_set_sense,CMockString_sense_key);
+    if (cmock_call_instance->Expected_sense_key != sense_key) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_sense_key, sense_key, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_add_sense_code)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_set_sense,CMockString_add_sense_code);
+    if (cmock_call_instance->Expected_add_sense_code != add_sense_code) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_add_sense_code, add_sense_code, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_add_sense_qualifier)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_set_sense,CMockString_add_sense_qualifier);
+    if (cmock_call_instance->Expected_add_sense_qualifier != add_sense_qualifier) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_add_sense_qualifier, add_sense_qualifier, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_set_sense_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_set_sense_CallbackFunctionPointer(lun, sense_key, add_sense_code, add_sense_qualifier, Mock.tud_msc_set_sense_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_set_sense(CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier);
+void CMockExpectParameters_tud_msc_set_sense(CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_sense_key = sense_key;
+  cmock_call_instance->IgnoreArg_sense_key = 0;
+  cmock_call_instance->Expected_add_sense_code = add_sense_code;
+  cmock_call_instance->IgnoreArg_add_sense_code = 0;
+  cmock_call_instance->Expected_add_sense_qualifier = add_sense_qualifier;
+  cmock_call_instance->IgnoreArg_add_sense_qualifier = 0;
+}
+
+void tud_msc_set_sense_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_set_sense_CALL_INSTANCE));
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_set_sense_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_set_sense_CallInstance, cmock_guts_index);
+  Mock.tud_msc_set_sense_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_set_sense_IgnoreBool = (int)1;
+}
+
+void tud_msc_set_sense_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_set_sense_CALL_INSTANCE));
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_set_sense_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_set_sense_CallInstance, cmock_guts_index);
+  Mock.tud_msc_set_sense_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_set_sense(cmock_call_instance, lun, sense_key, add_sense_code, add_sense_qualifier);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void tud_msc_set_sense_AddCallback(CMOCK_tud_msc_set_sense_CALLBACK Callback)
+{
+  Mock.tud_msc_set_sense_IgnoreBool = (int)0;
+  Mock.tud_msc_set_sense_CallbackBool = (int)1;
+  Mock.tud_msc_set_sense_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_set_sense_Stub(CMOCK_tud_msc_set_sense_CALLBACK Callback)
+{
+  Mock.tud_msc_set_sense_IgnoreBool = (int)0;
+  Mock.tud_msc_set_sense_CallbackBool = (int)0;
+  Mock.tud_msc_set_sense_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_set_sense_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_set_sense_CALL_INSTANCE));
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_set_sense_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_set_sense_CallInstance, cmock_guts_index);
+  Mock.tud_msc_set_sense_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_set_sense(cmock_call_instance, lun, sense_key, add_sense_code, add_sense_qualifier);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_set_sense_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_set_sense_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_set_sense_CMockIgnoreArg_sense_key(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_set_sense_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_sense_key = 1;
+}
+
+void tud_msc_set_sense_CMockIgnoreArg_add_sense_code(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_set_sense_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_add_sense_code = 1;
+}
+
+void tud_msc_set_sense_CMockIgnoreArg_add_sense_qualifier(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_set_sense_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_set_sense_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_set_sense_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_add_sense_qualifier = 1;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_read10_cb);
+  cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_read10_cb_CallInstance);
+  Mock.tud_msc_read10_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_read10_cb_CallInstance);
+  if (Mock.tud_msc_read10_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_read10_cb_FinalReturn;
+    Mock.tud_msc_read10_cb_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_read10_cb_CallbackBool &&
+      Mock.tud_msc_read10_cb_CallbackFunctionPointer != NULL)
+  {
+    int32_t ret = Mock.tud_msc_read10_cb_CallbackFunctionPointer(lun, lba, offset, buffer, bufsize, Mock.tud_msc_read10_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_lba)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_cb,CMockString_lba);
+    if (cmock_call_instance->Expected_lba != lba) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_lba, lba, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_cb,CMockString_offset);
+    if (cmock_call_instance->Expected_offset != offset) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_offset, offset, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_buffer)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_cb,CMockString_buffer);
+    if (cmock_call_instance->Expected_buffer != buffer) {
+    if (cmock_call_instance->Expected_buffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(buffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_buffer, buffer, cmock_call_instance->Expected_buffer_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_bufsize)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_cb,CMockString_bufsize);
+    if (cmock_call_instance->Expected_bufsize != bufsize) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_bufsize, bufsize, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_read10_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_read10_cb_CallbackFunctionPointer(lun, lba, offset, buffer, bufsize, Mock.tud_msc_read10_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_buffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(buffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)buffer, (void*)cmock_call_instance->ReturnThruPtr_buffer_Val,
+      cmock_call_instance->ReturnThruPtr_buffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_read10_cb(CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, int buffer_Depth, uint32_t bufsize);
+void CMockExpectParameters_tud_msc_read10_cb(CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, int buffer_Depth, uint32_t bufsize)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_lba = lba;
+  cmock_call_instance->IgnoreArg_lba = 0;
+  cmock_call_instance->Expected_offset = offset;
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_buffer = buffer;
+  cmock_call_instance->Expected_buffer_Depth = buffer_Depth;
+  cmock_call_instance->IgnoreArg_buffer = 0;
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 0;
+  cmock_call_instance->Expected_bufsize = bufsize;
+  cmock_call_instance->IgnoreArg_bufsize = 0;
+}
+
+void tud_msc_read10_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_read10_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_read10_cb(cmock_call_instance, lun, lba, offset, buffer, 1, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_read10_cb_AddCallback(CMOCK_tud_msc_read10_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_read10_cb_CallbackBool = (int)1;
+  Mock.tud_msc_read10_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_read10_cb_Stub(CMOCK_tud_msc_read10_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_read10_cb_CallbackBool = (int)0;
+  Mock.tud_msc_read10_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_read10_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_read10_cb(cmock_call_instance, lun, lba, offset, buffer, 1, bufsize);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_read10_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, int buffer_Depth, uint32_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_read10_cb(cmock_call_instance, lun, lba, offset, buffer, buffer_Depth, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_read10_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, void* buffer, int cmock_size)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_buffer_Val = buffer;
+  cmock_call_instance->ReturnThruPtr_buffer_Size = cmock_size;
+}
+
+void tud_msc_read10_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_read10_cb_CMockIgnoreArg_lba(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lba = 1;
+}
+
+void tud_msc_read10_cb_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void tud_msc_read10_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_buffer = 1;
+}
+
+void tud_msc_read10_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_bufsize = 1;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_write10_cb);
+  cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_write10_cb_CallInstance);
+  Mock.tud_msc_write10_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_write10_cb_CallInstance);
+  if (Mock.tud_msc_write10_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_write10_cb_FinalReturn;
+    Mock.tud_msc_write10_cb_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_write10_cb_CallbackBool &&
+      Mock.tud_msc_write10_cb_CallbackFunctionPointer != NULL)
+  {
+    int32_t ret = Mock.tud_msc_write10_cb_CallbackFunctionPointer(lun, lba, offset, buffer, bufsize, Mock.tud_msc_write10_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_lba)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_cb,CMockString_lba);
+    if (cmock_call_instance->Expected_lba != lba) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_lba, lba, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_cb,CMockString_offset);
+    if (cmock_call_instance->Expected_offset != offset) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_offset, offset, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_buffer)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_cb,CMockString_buffer);
+    if (cmock_call_instance->Expected_buffer != buffer) {
+    if (cmock_call_instance->Expected_buffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(buffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_buffer, buffer, cmock_call_instance->Expected_buffer_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_bufsize)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_cb,CMockString_bufsize);
+    if (cmock_call_instance->Expected_bufsize != bufsize) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_bufsize, bufsize, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_write10_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_write10_cb_CallbackFunctionPointer(lun, lba, offset, buffer, bufsize, Mock.tud_msc_write10_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_buffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(buffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)buffer, (void*)cmock_call_instance->ReturnThruPtr_buffer_Val,
+      cmock_call_instance->ReturnThruPtr_buffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_write10_cb(CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, int buffer_Depth, uint32_t bufsize);
+void CMockExpectParameters_tud_msc_write10_cb(CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, int buffer_Depth, uint32_t bufsize)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_lba = lba;
+  cmock_call_instance->IgnoreArg_lba = 0;
+  cmock_call_instance->Expected_offset = offset;
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_buffer = buffer;
+  cmock_call_instance->Expected_buffer_Depth = buffer_Depth;
+  cmock_call_instance->IgnoreArg_buffer = 0;
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 0;
+  cmock_call_instance->Expected_bufsize = bufsize;
+  cmock_call_instance->IgnoreArg_bufsize = 0;
+}
+
+void tud_msc_write10_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_write10_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_write10_cb(cmock_call_instance, lun, lba, offset, buffer, 1, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_write10_cb_AddCallback(CMOCK_tud_msc_write10_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_write10_cb_CallbackBool = (int)1;
+  Mock.tud_msc_write10_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_write10_cb_Stub(CMOCK_tud_msc_write10_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_write10_cb_CallbackBool = (int)0;
+  Mock.tud_msc_write10_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_write10_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_write10_cb(cmock_call_instance, lun, lba, offset, buffer, 1, bufsize);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_write10_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, int buffer_Depth, uint32_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_write10_cb(cmock_call_instance, lun, lba, offset, buffer, buffer_Depth, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_write10_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, uint8_t* buffer, int cmock_size)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_buffer_Val = buffer;
+  cmock_call_instance->ReturnThruPtr_buffer_Size = cmock_size;
+}
+
+void tud_msc_write10_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_write10_cb_CMockIgnoreArg_lba(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lba = 1;
+}
+
+void tud_msc_write10_cb_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void tud_msc_write10_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_buffer = 1;
+}
+
+void tud_msc_write10_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_bufsize = 1;
+}
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_inquiry_cb);
+  cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_inquiry_cb_CallInstance);
+  Mock.tud_msc_inquiry_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_inquiry_cb_CallInstance);
+  if (Mock.tud_msc_inquiry_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.tud_msc_inquiry_cb_CallbackBool &&
+      Mock.tud_msc_inquiry_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_inquiry_cb_CallbackFunctionPointer(lun, vendor_id, product_id, product_rev, Mock.tud_msc_inquiry_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_inquiry_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_vendor_id)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_inquiry_cb,CMockString_vendor_id);
+    if (cmock_call_instance->Expected_vendor_id != vendor_id) {
+    if (cmock_call_instance->Expected_vendor_id == NULL)
+      { UNITY_TEST_ASSERT_NULL(vendor_id, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_vendor_id, vendor_id, cmock_call_instance->Expected_vendor_id_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_product_id)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_inquiry_cb,CMockString_product_id);
+    if (cmock_call_instance->Expected_product_id != product_id) {
+    if (cmock_call_instance->Expected_product_id == NULL)
+      { UNITY_TEST_ASSERT_NULL(product_id, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_product_id, product_id, cmock_call_instance->Expected_product_id_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_product_rev)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_inquiry_cb,CMockString_product_rev);
+    if (cmock_call_instance->Expected_product_rev != product_rev) {
+    if (cmock_call_instance->Expected_product_rev == NULL)
+      { UNITY_TEST_ASSERT_NULL(product_rev, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_product_rev, product_rev, cmock_call_instance->Expected_product_rev_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.tud_msc_inquiry_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_inquiry_cb_CallbackFunctionPointer(lun, vendor_id, product_id, product_rev, Mock.tud_msc_inquiry_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_vendor_id_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(vendor_id, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)vendor_id, (void*)cmock_call_instance->ReturnThruPtr_vendor_id_Val,
+      cmock_call_instance->ReturnThruPtr_vendor_id_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_product_id_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(product_id, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)product_id, (void*)cmock_call_instance->ReturnThruPtr_product_id_Val,
+      cmock_call_instance->ReturnThruPtr_product_id_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_product_rev_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(product_rev, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)product_rev, (void*)cmock_call_instance->ReturnThruPtr_product_rev_Val,
+      cmock_call_instance->ReturnThruPtr_product_rev_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_tud_msc_inquiry_cb(CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t* vendor_id, int vendor_id_Depth, uint8_t* product_id, int product_id_Depth, uint8_t* product_rev, int product_rev_Depth);
+void CMockExpectParameters_tud_msc_inquiry_cb(CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t* vendor_id, int vendor_id_Depth, uint8_t* product_id, int product_id_Depth, uint8_t* product_rev, int product_rev_Depth)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_vendor_id = vendor_id;
+  cmock_call_instance->Expected_vendor_id_Depth = vendor_id_Depth;
+  cmock_call_instance->IgnoreArg_vendor_id = 0;
+  cmock_call_instance->ReturnThruPtr_vendor_id_Used = 0;
+  cmock_call_instance->Expected_product_id = product_id;
+  cmock_call_instance->Expected_product_id_Depth = product_id_Depth;
+  cmock_call_instance->IgnoreArg_product_id = 0;
+  cmock_call_instance->ReturnThruPtr_product_id_Used = 0;
+  cmock_call_instance->Expected_product_rev = product_rev;
+  cmock_call_instance->Expected_product_rev_Depth = product_rev_Depth;
+  cmock_call_instance->IgnoreArg_product_rev = 0;
+  cmock_call_instance->ReturnThruPtr_product_rev_Used = 0;
+}
+
+void tud_msc_inquiry_cb_CMockIgnore(void)
+{
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_inquiry_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_inquiry_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_inquiry_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_inquiry_cb(cmock_call_instance, lun, vendor_id, 1, product_id, 1, product_rev, 1);
+}
+
+void tud_msc_inquiry_cb_AddCallback(CMOCK_tud_msc_inquiry_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_inquiry_cb_CallbackBool = (int)1;
+  Mock.tud_msc_inquiry_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_inquiry_cb_Stub(CMOCK_tud_msc_inquiry_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_inquiry_cb_CallbackBool = (int)0;
+  Mock.tud_msc_inquiry_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_inquiry_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_inquiry_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_inquiry_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_inquiry_cb(cmock_call_instance, lun, vendor_id, 1, product_id, 1, product_rev, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_inquiry_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, int vendor_id_Depth, uint8_t* product_id, int product_id_Depth, uint8_t* product_rev, int product_rev_Depth)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_inquiry_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_inquiry_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_inquiry_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_inquiry_cb(cmock_call_instance, lun, vendor_id, vendor_id_Depth, product_id, product_id_Depth, product_rev, product_rev_Depth);
+}
+
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_vendor_id(UNITY_LINE_TYPE cmock_line, uint8_t* vendor_id, int cmock_size)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_vendor_id_Used = 1;
+  cmock_call_instance->ReturnThruPtr_vendor_id_Val = vendor_id;
+  cmock_call_instance->ReturnThruPtr_vendor_id_Size = cmock_size;
+}
+
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_id(UNITY_LINE_TYPE cmock_line, uint8_t* product_id, int cmock_size)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_product_id_Used = 1;
+  cmock_call_instance->ReturnThruPtr_product_id_Val = product_id;
+  cmock_call_instance->ReturnThruPtr_product_id_Size = cmock_size;
+}
+
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_rev(UNITY_LINE_TYPE cmock_line, uint8_t* product_rev, int cmock_size)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_product_rev_Used = 1;
+  cmock_call_instance->ReturnThruPtr_product_rev_Val = product_rev;
+  cmock_call_instance->ReturnThruPtr_product_rev_Size = cmock_size;
+}
+
+void tud_msc_inquiry_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_inquiry_cb_CMockIgnoreArg_vendor_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_vendor_id = 1;
+}
+
+void tud_msc_inquiry_cb_CMockIgnoreArg_product_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_product_id = 1;
+}
+
+void tud_msc_inquiry_cb_CMockIgnoreArg_product_rev(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_inquiry_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_inquiry_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_product_rev = 1;
+}
+
+_Bool tud_msc_test_unit_ready_cb(uint8_t lun)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_test_unit_ready_cb);
+  cmock_call_instance = (CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_test_unit_ready_cb_CallInstance);
+  Mock.tud_msc_test_unit_ready_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_test_unit_ready_cb_CallInstance);
+  if (Mock.tud_msc_test_unit_ready_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_test_unit_ready_cb_FinalReturn;
+    memcpy((void*)(&Mock.tud_msc_test_unit_ready_cb_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_test_unit_ready_cb_CallbackBool &&
+      Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer(lun, Mock.tud_msc_test_unit_ready_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_test_unit_ready_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer(lun, Mock.tud_msc_test_unit_ready_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_test_unit_ready_cb(CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun);
+void CMockExpectParameters_tud_msc_test_unit_ready_cb(CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+}
+
+void tud_msc_test_unit_ready_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_test_unit_ready_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_test_unit_ready_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_test_unit_ready_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_test_unit_ready_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_test_unit_ready_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_test_unit_ready_cb(cmock_call_instance, lun);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void tud_msc_test_unit_ready_cb_AddCallback(CMOCK_tud_msc_test_unit_ready_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_test_unit_ready_cb_CallbackBool = (int)1;
+  Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_test_unit_ready_cb_Stub(CMOCK_tud_msc_test_unit_ready_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_test_unit_ready_cb_CallbackBool = (int)0;
+  Mock.tud_msc_test_unit_ready_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_test_unit_ready_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_test_unit_ready_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_test_unit_ready_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_test_unit_ready_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_test_unit_ready_cb(cmock_call_instance, lun);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_test_unit_ready_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_test_unit_ready_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_test_unit_ready_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t* block_count, uint16_t* block_size)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_capacity_cb);
+  cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_capacity_cb_CallInstance);
+  Mock.tud_msc_capacity_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_capacity_cb_CallInstance);
+  if (Mock.tud_msc_capacity_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.tud_msc_capacity_cb_CallbackBool &&
+      Mock.tud_msc_capacity_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_capacity_cb_CallbackFunctionPointer(lun, block_count, block_size, Mock.tud_msc_capacity_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_capacity_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_block_count)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_capacity_cb,CMockString_block_count);
+    if (cmock_call_instance->Expected_block_count != block_count) {
+    if (cmock_call_instance->Expected_block_count == NULL)
+      { UNITY_TEST_ASSERT_NULL(block_count, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_block_count, block_count, cmock_call_instance->Expected_block_count_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_block_size)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_capacity_cb,CMockString_block_size);
+    if (cmock_call_instance->Expected_block_size != block_size) {
+    if (cmock_call_instance->Expected_block_size == NULL)
+      { UNITY_TEST_ASSERT_NULL(block_size, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_block_size, block_size, cmock_call_instance->Expected_block_size_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.tud_msc_capacity_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_capacity_cb_CallbackFunctionPointer(lun, block_count, block_size, Mock.tud_msc_capacity_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_block_count_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(block_count, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)block_count, (void*)cmock_call_instance->ReturnThruPtr_block_count_Val,
+      cmock_call_instance->ReturnThruPtr_block_count_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_block_size_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(block_size, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)block_size, (void*)cmock_call_instance->ReturnThruPtr_block_size_Val,
+      cmock_call_instance->ReturnThruPtr_block_size_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_tud_msc_capacity_cb(CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t* block_count, int block_count_Depth, uint16_t* block_size, int block_size_Depth);
+void CMockExpectParameters_tud_msc_capacity_cb(CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint32_t* block_count, int block_count_Depth, uint16_t* block_size, int block_size_Depth)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_block_count = block_count;
+  cmock_call_instance->Expected_block_count_Depth = block_count_Depth;
+  cmock_call_instance->IgnoreArg_block_count = 0;
+  cmock_call_instance->ReturnThruPtr_block_count_Used = 0;
+  cmock_call_instance->Expected_block_size = block_size;
+  cmock_call_instance->Expected_block_size_Depth = block_size_Depth;
+  cmock_call_instance->IgnoreArg_block_size = 0;
+  cmock_call_instance->ReturnThruPtr_block_size_Used = 0;
+}
+
+void tud_msc_capacity_cb_CMockIgnore(void)
+{
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_capacity_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, uint16_t* block_size)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_capacity_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_capacity_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_capacity_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_capacity_cb(cmock_call_instance, lun, block_count, 1, block_size, 1);
+}
+
+void tud_msc_capacity_cb_AddCallback(CMOCK_tud_msc_capacity_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_capacity_cb_CallbackBool = (int)1;
+  Mock.tud_msc_capacity_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_capacity_cb_Stub(CMOCK_tud_msc_capacity_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_capacity_cb_CallbackBool = (int)0;
+  Mock.tud_msc_capacity_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_capacity_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, uint16_t* block_size, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_capacity_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_capacity_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_capacity_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_capacity_cb(cmock_call_instance, lun, block_count, 1, block_size, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_capacity_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, int block_count_Depth, uint16_t* block_size, int block_size_Depth)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_capacity_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_capacity_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_capacity_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_capacity_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_capacity_cb(cmock_call_instance, lun, block_count, block_count_Depth, block_size, block_size_Depth);
+}
+
+void tud_msc_capacity_cb_CMockReturnMemThruPtr_block_count(UNITY_LINE_TYPE cmock_line, uint32_t* block_count, int cmock_size)
+{
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_capacity_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_block_count_Used = 1;
+  cmock_call_instance->ReturnThruPtr_block_count_Val = block_count;
+  cmock_call_instance->ReturnThruPtr_block_count_Size = cmock_size;
+}
+
+void tud_msc_capacity_cb_CMockReturnMemThruPtr_block_size(UNITY_LINE_TYPE cmock_line, uint16_t* block_size, int cmock_size)
+{
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_capacity_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_block_size_Used = 1;
+  cmock_call_instance->ReturnThruPtr_block_size_Val = block_size;
+  cmock_call_instance->ReturnThruPtr_block_size_Size = cmock_size;
+}
+
+void tud_msc_capacity_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_capacity_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_capacity_cb_CMockIgnoreArg_block_count(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_capacity_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_block_count = 1;
+}
+
+void tud_msc_capacity_cb_CMockIgnoreArg_block_size(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_capacity_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_capacity_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_capacity_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_block_size = 1;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_scsi_cb);
+  cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_scsi_cb_CallInstance);
+  Mock.tud_msc_scsi_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_scsi_cb_CallInstance);
+  if (Mock.tud_msc_scsi_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_scsi_cb_FinalReturn;
+    Mock.tud_msc_scsi_cb_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_scsi_cb_CallbackBool &&
+      Mock.tud_msc_scsi_cb_CallbackFunctionPointer != NULL)
+  {
+    int32_t ret = Mock.tud_msc_scsi_cb_CallbackFunctionPointer(lun, scsi_cmd, buffer, bufsize, Mock.tud_msc_scsi_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_scsi_cmd)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_cb,CMockString_scsi_cmd);
+    if (cmock_call_instance->Expected_scsi_cmd != scsi_cmd) {
+    if (cmock_call_instance->Expected_scsi_cmd == NULL)
+      { UNITY_TEST_ASSERT_NULL(scsi_cmd, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_scsi_cmd, scsi_cmd, cmock_call_instance->Expected_scsi_cmd_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_buffer)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_cb,CMockString_buffer);
+    if (cmock_call_instance->Expected_buffer != buffer) {
+    if (cmock_call_instance->Expected_buffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(buffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_buffer, buffer, cmock_call_instance->Expected_buffer_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_bufsize)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_cb,CMockString_bufsize);
+    if (cmock_call_instance->Expected_bufsize != bufsize) {
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_bufsize, bufsize, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_scsi_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_scsi_cb_CallbackFunctionPointer(lun, scsi_cmd, buffer, bufsize, Mock.tud_msc_scsi_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_buffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(buffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)buffer, (void*)cmock_call_instance->ReturnThruPtr_buffer_Val,
+      cmock_call_instance->ReturnThruPtr_buffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_scsi_cb(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth, void* buffer, int buffer_Depth, uint16_t bufsize);
+void CMockExpectParameters_tud_msc_scsi_cb(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth, void* buffer, int buffer_Depth, uint16_t bufsize)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_scsi_cmd = scsi_cmd;
+  cmock_call_instance->Expected_scsi_cmd_Depth = scsi_cmd_Depth;
+  cmock_call_instance->IgnoreArg_scsi_cmd = 0;
+  cmock_call_instance->Expected_buffer = buffer;
+  cmock_call_instance->Expected_buffer_Depth = buffer_Depth;
+  cmock_call_instance->IgnoreArg_buffer = 0;
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 0;
+  cmock_call_instance->Expected_bufsize = bufsize;
+  cmock_call_instance->IgnoreArg_bufsize = 0;
+}
+
+void tud_msc_scsi_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_scsi_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_cb(cmock_call_instance, lun, scsi_cmd, 1, buffer, 1, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_scsi_cb_AddCallback(CMOCK_tud_msc_scsi_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_scsi_cb_CallbackBool = (int)1;
+  Mock.tud_msc_scsi_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_scsi_cb_Stub(CMOCK_tud_msc_scsi_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_scsi_cb_CallbackBool = (int)0;
+  Mock.tud_msc_scsi_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_scsi_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_cb(cmock_call_instance, lun, scsi_cmd, 1, buffer, 1, bufsize);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_scsi_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth, void* buffer, int buffer_Depth, uint16_t bufsize, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_cb(cmock_call_instance, lun, scsi_cmd, scsi_cmd_Depth, buffer, buffer_Depth, bufsize);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_scsi_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, void* buffer, int cmock_size)
+{
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_buffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_buffer_Val = buffer;
+  cmock_call_instance->ReturnThruPtr_buffer_Size = cmock_size;
+}
+
+void tud_msc_scsi_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_scsi_cb_CMockIgnoreArg_scsi_cmd(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_scsi_cmd = 1;
+}
+
+void tud_msc_scsi_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_buffer = 1;
+}
+
+void tud_msc_scsi_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_bufsize = 1;
+}
+
+uint8_t tud_msc_get_maxlun_cb(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_get_maxlun_cb);
+  cmock_call_instance = (CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_get_maxlun_cb_CallInstance);
+  Mock.tud_msc_get_maxlun_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_get_maxlun_cb_CallInstance);
+  if (Mock.tud_msc_get_maxlun_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_get_maxlun_cb_FinalReturn;
+    Mock.tud_msc_get_maxlun_cb_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_get_maxlun_cb_CallbackBool &&
+      Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer != NULL)
+  {
+    uint8_t ret = Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer(Mock.tud_msc_get_maxlun_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer(Mock.tud_msc_get_maxlun_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void tud_msc_get_maxlun_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_get_maxlun_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_get_maxlun_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_get_maxlun_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_get_maxlun_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_get_maxlun_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void tud_msc_get_maxlun_cb_AddCallback(CMOCK_tud_msc_get_maxlun_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_get_maxlun_cb_CallbackBool = (int)1;
+  Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_get_maxlun_cb_Stub(CMOCK_tud_msc_get_maxlun_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_get_maxlun_cb_CallbackBool = (int)0;
+  Mock.tud_msc_get_maxlun_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_get_maxlun_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_get_maxlun_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_get_maxlun_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_get_maxlun_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_get_maxlun_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_start_stop_cb);
+  cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_start_stop_cb_CallInstance);
+  Mock.tud_msc_start_stop_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_start_stop_cb_CallInstance);
+  if (Mock.tud_msc_start_stop_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_start_stop_cb_FinalReturn;
+    memcpy((void*)(&Mock.tud_msc_start_stop_cb_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_start_stop_cb_CallbackBool &&
+      Mock.tud_msc_start_stop_cb_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.tud_msc_start_stop_cb_CallbackFunctionPointer(lun, power_condition, start, load_eject, Mock.tud_msc_start_stop_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_start_stop_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_power_condition)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_start_stop_cb,CMockString_power_condition);
+    if (cmock_call_instance->Expected_power_condition != power_condition) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_power_condition, power_condition, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_start)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_start_stop_cb,CMockString_start);
+    if (&cmock_call_instance->Expected_start != &start) {
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_start), (void*)(&start), sizeof(_Bool), cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_load_eject)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_start_stop_cb,CMockString_load_eject);
+    if (&cmock_call_instance->Expected_load_eject != &load_eject) {
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_load_eject), (void*)(&load_eject), sizeof(_Bool), cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_start_stop_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_start_stop_cb_CallbackFunctionPointer(lun, power_condition, start, load_eject, Mock.tud_msc_start_stop_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_start_stop_cb(CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject);
+void CMockExpectParameters_tud_msc_start_stop_cb(CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_power_condition = power_condition;
+  cmock_call_instance->IgnoreArg_power_condition = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_start), (void*)(&start),
+         sizeof(_Bool[sizeof(start) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_start = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_load_eject), (void*)(&load_eject),
+         sizeof(_Bool[sizeof(load_eject) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_load_eject = 0;
+}
+
+void tud_msc_start_stop_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_start_stop_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_start_stop_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_start_stop_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_start_stop_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_start_stop_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_start_stop_cb(cmock_call_instance, lun, power_condition, start, load_eject);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void tud_msc_start_stop_cb_AddCallback(CMOCK_tud_msc_start_stop_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_start_stop_cb_CallbackBool = (int)1;
+  Mock.tud_msc_start_stop_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_start_stop_cb_Stub(CMOCK_tud_msc_start_stop_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_start_stop_cb_CallbackBool = (int)0;
+  Mock.tud_msc_start_stop_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_start_stop_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_start_stop_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_start_stop_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_start_stop_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_start_stop_cb(cmock_call_instance, lun, power_condition, start, load_eject);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_start_stop_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_start_stop_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_start_stop_cb_CMockIgnoreArg_power_condition(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_start_stop_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_power_condition = 1;
+}
+
+void tud_msc_start_stop_cb_CMockIgnoreArg_start(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_start_stop_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_start = 1;
+}
+
+void tud_msc_start_stop_cb_CMockIgnoreArg_load_eject(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_start_stop_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_start_stop_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_load_eject = 1;
+}
+
+void tud_msc_read10_complete_cb(uint8_t lun)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_read10_complete_cb);
+  cmock_call_instance = (CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_read10_complete_cb_CallInstance);
+  Mock.tud_msc_read10_complete_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_read10_complete_cb_CallInstance);
+  if (Mock.tud_msc_read10_complete_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.tud_msc_read10_complete_cb_CallbackBool &&
+      Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer(lun, Mock.tud_msc_read10_complete_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_read10_complete_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer(lun, Mock.tud_msc_read10_complete_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_tud_msc_read10_complete_cb(CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun);
+void CMockExpectParameters_tud_msc_read10_complete_cb(CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+}
+
+void tud_msc_read10_complete_cb_CMockIgnore(void)
+{
+  Mock.tud_msc_read10_complete_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_read10_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_read10_complete_cb(cmock_call_instance, lun);
+}
+
+void tud_msc_read10_complete_cb_AddCallback(CMOCK_tud_msc_read10_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_read10_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_read10_complete_cb_CallbackBool = (int)1;
+  Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_read10_complete_cb_Stub(CMOCK_tud_msc_read10_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_read10_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_read10_complete_cb_CallbackBool = (int)0;
+  Mock.tud_msc_read10_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_read10_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_read10_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_read10_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_read10_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_read10_complete_cb(cmock_call_instance, lun);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_read10_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_read10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_read10_complete_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_write10_complete_cb(uint8_t lun)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_write10_complete_cb);
+  cmock_call_instance = (CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_write10_complete_cb_CallInstance);
+  Mock.tud_msc_write10_complete_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_write10_complete_cb_CallInstance);
+  if (Mock.tud_msc_write10_complete_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.tud_msc_write10_complete_cb_CallbackBool &&
+      Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer(lun, Mock.tud_msc_write10_complete_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_write10_complete_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer(lun, Mock.tud_msc_write10_complete_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_tud_msc_write10_complete_cb(CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun);
+void CMockExpectParameters_tud_msc_write10_complete_cb(CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+}
+
+void tud_msc_write10_complete_cb_CMockIgnore(void)
+{
+  Mock.tud_msc_write10_complete_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_write10_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_write10_complete_cb(cmock_call_instance, lun);
+}
+
+void tud_msc_write10_complete_cb_AddCallback(CMOCK_tud_msc_write10_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_write10_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_write10_complete_cb_CallbackBool = (int)1;
+  Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_write10_complete_cb_Stub(CMOCK_tud_msc_write10_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_write10_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_write10_complete_cb_CallbackBool = (int)0;
+  Mock.tud_msc_write10_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_write10_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_write10_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_write10_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_write10_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_write10_complete_cb(cmock_call_instance, lun);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_write10_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_write10_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_write10_complete_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_scsi_complete_cb(uint8_t lun, uint8_t const* scsi_cmd)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_scsi_complete_cb);
+  cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_scsi_complete_cb_CallInstance);
+  Mock.tud_msc_scsi_complete_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_scsi_complete_cb_CallInstance);
+  if (Mock.tud_msc_scsi_complete_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.tud_msc_scsi_complete_cb_CallbackBool &&
+      Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer(lun, scsi_cmd, Mock.tud_msc_scsi_complete_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_complete_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_scsi_cmd)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_scsi_complete_cb,CMockString_scsi_cmd);
+    if (cmock_call_instance->Expected_scsi_cmd != scsi_cmd) {
+    if (cmock_call_instance->Expected_scsi_cmd == NULL)
+      { UNITY_TEST_ASSERT_NULL(scsi_cmd, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_scsi_cmd, scsi_cmd, cmock_call_instance->Expected_scsi_cmd_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer != NULL)
+  {
+    Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer(lun, scsi_cmd, Mock.tud_msc_scsi_complete_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_tud_msc_scsi_complete_cb(CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth);
+void CMockExpectParameters_tud_msc_scsi_complete_cb(CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+  cmock_call_instance->Expected_scsi_cmd = scsi_cmd;
+  cmock_call_instance->Expected_scsi_cmd_Depth = scsi_cmd_Depth;
+  cmock_call_instance->IgnoreArg_scsi_cmd = 0;
+}
+
+void tud_msc_scsi_complete_cb_CMockIgnore(void)
+{
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_scsi_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_complete_cb(cmock_call_instance, lun, scsi_cmd, 1);
+}
+
+void tud_msc_scsi_complete_cb_AddCallback(CMOCK_tud_msc_scsi_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_scsi_complete_cb_CallbackBool = (int)1;
+  Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_scsi_complete_cb_Stub(CMOCK_tud_msc_scsi_complete_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_scsi_complete_cb_CallbackBool = (int)0;
+  Mock.tud_msc_scsi_complete_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_scsi_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_complete_cb(cmock_call_instance, lun, scsi_cmd, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_scsi_complete_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_scsi_complete_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_scsi_complete_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_scsi_complete_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_scsi_complete_cb(cmock_call_instance, lun, scsi_cmd, scsi_cmd_Depth);
+}
+
+void tud_msc_scsi_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_complete_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void tud_msc_scsi_complete_cb_CMockIgnoreArg_scsi_cmd(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_scsi_complete_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_scsi_complete_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_scsi_cmd = 1;
+}
+
+_Bool tud_msc_is_writable_cb(uint8_t lun)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_tud_msc_is_writable_cb);
+  cmock_call_instance = (CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.tud_msc_is_writable_cb_CallInstance);
+  Mock.tud_msc_is_writable_cb_CallInstance = CMock_Guts_MemNext(Mock.tud_msc_is_writable_cb_CallInstance);
+  if (Mock.tud_msc_is_writable_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.tud_msc_is_writable_cb_FinalReturn;
+    memcpy((void*)(&Mock.tud_msc_is_writable_cb_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.tud_msc_is_writable_cb_CallbackBool &&
+      Mock.tud_msc_is_writable_cb_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.tud_msc_is_writable_cb_CallbackFunctionPointer(lun, Mock.tud_msc_is_writable_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_lun)
+  {
+    UNITY_SET_DETAILS(CMockString_tud_msc_is_writable_cb,CMockString_lun);
+    if (cmock_call_instance->Expected_lun != lun) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_lun, lun, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.tud_msc_is_writable_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.tud_msc_is_writable_cb_CallbackFunctionPointer(lun, Mock.tud_msc_is_writable_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_tud_msc_is_writable_cb(CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun);
+void CMockExpectParameters_tud_msc_is_writable_cb(CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance, uint8_t lun)
+{
+  cmock_call_instance->Expected_lun = lun;
+  cmock_call_instance->IgnoreArg_lun = 0;
+}
+
+void tud_msc_is_writable_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_is_writable_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_is_writable_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)1;
+}
+
+void tud_msc_is_writable_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_is_writable_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_is_writable_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_is_writable_cb(cmock_call_instance, lun);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void tud_msc_is_writable_cb_AddCallback(CMOCK_tud_msc_is_writable_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_is_writable_cb_CallbackBool = (int)1;
+  Mock.tud_msc_is_writable_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_is_writable_cb_Stub(CMOCK_tud_msc_is_writable_cb_CALLBACK Callback)
+{
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)0;
+  Mock.tud_msc_is_writable_cb_CallbackBool = (int)0;
+  Mock.tud_msc_is_writable_cb_CallbackFunctionPointer = Callback;
+}
+
+void tud_msc_is_writable_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE));
+  CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.tud_msc_is_writable_cb_CallInstance = CMock_Guts_MemChain(Mock.tud_msc_is_writable_cb_CallInstance, cmock_guts_index);
+  Mock.tud_msc_is_writable_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_tud_msc_is_writable_cb(cmock_call_instance, lun);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void tud_msc_is_writable_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_tud_msc_is_writable_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.tud_msc_is_writable_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_lun = 1;
+}
+
+void mscd_init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_init);
+  cmock_call_instance = (CMOCK_mscd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_init_CallInstance);
+  Mock.mscd_init_CallInstance = CMock_Guts_MemNext(Mock.mscd_init_CallInstance);
+  if (Mock.mscd_init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.mscd_init_CallbackBool &&
+      Mock.mscd_init_CallbackFunctionPointer != NULL)
+  {
+    Mock.mscd_init_CallbackFunctionPointer(Mock.mscd_init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.mscd_init_CallbackFunctionPointer != NULL)
+  {
+    Mock.mscd_init_CallbackFunctionPointer(Mock.mscd_init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void mscd_init_CMockIgnore(void)
+{
+  Mock.mscd_init_IgnoreBool = (int)1;
+}
+
+void mscd_init_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_init_CALL_INSTANCE));
+  CMOCK_mscd_init_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_init_CallInstance = CMock_Guts_MemChain(Mock.mscd_init_CallInstance, cmock_guts_index);
+  Mock.mscd_init_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void mscd_init_AddCallback(CMOCK_mscd_init_CALLBACK Callback)
+{
+  Mock.mscd_init_IgnoreBool = (int)0;
+  Mock.mscd_init_CallbackBool = (int)1;
+  Mock.mscd_init_CallbackFunctionPointer = Callback;
+}
+
+void mscd_init_Stub(CMOCK_mscd_init_CALLBACK Callback)
+{
+  Mock.mscd_init_IgnoreBool = (int)0;
+  Mock.mscd_init_CallbackBool = (int)0;
+  Mock.mscd_init_CallbackFunctionPointer = Callback;
+}
+
+void mscd_init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_init_CALL_INSTANCE));
+  CMOCK_mscd_init_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_init_CallInstance = CMock_Guts_MemChain(Mock.mscd_init_CallInstance, cmock_guts_index);
+  Mock.mscd_init_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_reset(uint8_t rhport)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_reset);
+  cmock_call_instance = (CMOCK_mscd_reset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_reset_CallInstance);
+  Mock.mscd_reset_CallInstance = CMock_Guts_MemNext(Mock.mscd_reset_CallInstance);
+  if (Mock.mscd_reset_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.mscd_reset_CallbackBool &&
+      Mock.mscd_reset_CallbackFunctionPointer != NULL)
+  {
+    Mock.mscd_reset_CallbackFunctionPointer(rhport, Mock.mscd_reset_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_reset,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.mscd_reset_CallbackFunctionPointer != NULL)
+  {
+    Mock.mscd_reset_CallbackFunctionPointer(rhport, Mock.mscd_reset_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_mscd_reset(CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance, uint8_t rhport);
+void CMockExpectParameters_mscd_reset(CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance, uint8_t rhport)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+}
+
+void mscd_reset_CMockIgnore(void)
+{
+  Mock.mscd_reset_IgnoreBool = (int)1;
+}
+
+void mscd_reset_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_reset_CALL_INSTANCE));
+  CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_reset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_reset_CallInstance = CMock_Guts_MemChain(Mock.mscd_reset_CallInstance, cmock_guts_index);
+  Mock.mscd_reset_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_reset(cmock_call_instance, rhport);
+}
+
+void mscd_reset_AddCallback(CMOCK_mscd_reset_CALLBACK Callback)
+{
+  Mock.mscd_reset_IgnoreBool = (int)0;
+  Mock.mscd_reset_CallbackBool = (int)1;
+  Mock.mscd_reset_CallbackFunctionPointer = Callback;
+}
+
+void mscd_reset_Stub(CMOCK_mscd_reset_CALLBACK Callback)
+{
+  Mock.mscd_reset_IgnoreBool = (int)0;
+  Mock.mscd_reset_CallbackBool = (int)0;
+  Mock.mscd_reset_CallbackFunctionPointer = Callback;
+}
+
+void mscd_reset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_reset_CALL_INSTANCE));
+  CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_reset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_reset_CallInstance = CMock_Guts_MemChain(Mock.mscd_reset_CallInstance, cmock_guts_index);
+  Mock.mscd_reset_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_reset(cmock_call_instance, rhport);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_reset_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_reset_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_reset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_reset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+uint16_t mscd_open(uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_open);
+  cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_open_CallInstance);
+  Mock.mscd_open_CallInstance = CMock_Guts_MemNext(Mock.mscd_open_CallInstance);
+  if (Mock.mscd_open_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mscd_open_FinalReturn;
+    Mock.mscd_open_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mscd_open_CallbackBool &&
+      Mock.mscd_open_CallbackFunctionPointer != NULL)
+  {
+    uint16_t ret = Mock.mscd_open_CallbackFunctionPointer(rhport, itf_desc, max_len, Mock.mscd_open_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_open,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_itf_desc)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_open,CMockString_itf_desc);
+    if (cmock_call_instance->Expected_itf_desc != itf_desc) {
+    if (cmock_call_instance->Expected_itf_desc == NULL)
+      { UNITY_TEST_ASSERT_NULL(itf_desc, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_itf_desc), (void*)(itf_desc), sizeof(tusb_desc_interface_t const), cmock_call_instance->Expected_itf_desc_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_max_len)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_open,CMockString_max_len);
+    if (cmock_call_instance->Expected_max_len != max_len) {
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_max_len, max_len, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.mscd_open_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mscd_open_CallbackFunctionPointer(rhport, itf_desc, max_len, Mock.mscd_open_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mscd_open(CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_desc_interface_t const* itf_desc, int itf_desc_Depth, uint16_t max_len);
+void CMockExpectParameters_mscd_open(CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_desc_interface_t const* itf_desc, int itf_desc_Depth, uint16_t max_len)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_itf_desc = itf_desc;
+  cmock_call_instance->Expected_itf_desc_Depth = itf_desc_Depth;
+  cmock_call_instance->IgnoreArg_itf_desc = 0;
+  cmock_call_instance->Expected_max_len = max_len;
+  cmock_call_instance->IgnoreArg_max_len = 0;
+}
+
+void mscd_open_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_open_CALL_INSTANCE));
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_open_CallInstance = CMock_Guts_MemChain(Mock.mscd_open_CallInstance, cmock_guts_index);
+  Mock.mscd_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mscd_open_IgnoreBool = (int)1;
+}
+
+void mscd_open_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_open_CALL_INSTANCE));
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_open_CallInstance = CMock_Guts_MemChain(Mock.mscd_open_CallInstance, cmock_guts_index);
+  Mock.mscd_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_open(cmock_call_instance, rhport, itf_desc, 1, max_len);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mscd_open_AddCallback(CMOCK_mscd_open_CALLBACK Callback)
+{
+  Mock.mscd_open_IgnoreBool = (int)0;
+  Mock.mscd_open_CallbackBool = (int)1;
+  Mock.mscd_open_CallbackFunctionPointer = Callback;
+}
+
+void mscd_open_Stub(CMOCK_mscd_open_CALLBACK Callback)
+{
+  Mock.mscd_open_IgnoreBool = (int)0;
+  Mock.mscd_open_CallbackBool = (int)0;
+  Mock.mscd_open_CallbackFunctionPointer = Callback;
+}
+
+void mscd_open_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_open_CALL_INSTANCE));
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_open_CallInstance = CMock_Guts_MemChain(Mock.mscd_open_CallInstance, cmock_guts_index);
+  Mock.mscd_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_open(cmock_call_instance, rhport, itf_desc, 1, max_len);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_open_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, int itf_desc_Depth, uint16_t max_len, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_open_CALL_INSTANCE));
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_open_CallInstance = CMock_Guts_MemChain(Mock.mscd_open_CallInstance, cmock_guts_index);
+  Mock.mscd_open_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_open(cmock_call_instance, rhport, itf_desc, itf_desc_Depth, max_len);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mscd_open_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_open_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void mscd_open_CMockIgnoreArg_itf_desc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_open_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_itf_desc = 1;
+}
+
+void mscd_open_CMockIgnoreArg_max_len(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_open_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_open_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_open_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_max_len = 1;
+}
+
+_Bool mscd_control_request(uint8_t rhport, tusb_control_request_t const* p_request)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_control_request);
+  cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_control_request_CallInstance);
+  Mock.mscd_control_request_CallInstance = CMock_Guts_MemNext(Mock.mscd_control_request_CallInstance);
+  if (Mock.mscd_control_request_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mscd_control_request_FinalReturn;
+    memcpy((void*)(&Mock.mscd_control_request_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mscd_control_request_CallbackBool &&
+      Mock.mscd_control_request_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.mscd_control_request_CallbackFunctionPointer(rhport, p_request, Mock.mscd_control_request_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_control_request,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_p_request)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_control_request,CMockString_p_request);
+    if (cmock_call_instance->Expected_p_request != p_request) {
+    if (cmock_call_instance->Expected_p_request == NULL)
+      { UNITY_TEST_ASSERT_NULL(p_request, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_p_request), (void*)(p_request), sizeof(tusb_control_request_t const), cmock_call_instance->Expected_p_request_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.mscd_control_request_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mscd_control_request_CallbackFunctionPointer(rhport, p_request, Mock.mscd_control_request_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mscd_control_request(CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth);
+void CMockExpectParameters_mscd_control_request(CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_p_request = p_request;
+  cmock_call_instance->Expected_p_request_Depth = p_request_Depth;
+  cmock_call_instance->IgnoreArg_p_request = 0;
+}
+
+void mscd_control_request_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_request_CALL_INSTANCE));
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_request_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_request_CallInstance, cmock_guts_index);
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mscd_control_request_IgnoreBool = (int)1;
+}
+
+void mscd_control_request_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_request_CALL_INSTANCE));
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_request_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_request_CallInstance, cmock_guts_index);
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_request(cmock_call_instance, rhport, p_request, 1);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void mscd_control_request_AddCallback(CMOCK_mscd_control_request_CALLBACK Callback)
+{
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  Mock.mscd_control_request_CallbackBool = (int)1;
+  Mock.mscd_control_request_CallbackFunctionPointer = Callback;
+}
+
+void mscd_control_request_Stub(CMOCK_mscd_control_request_CALLBACK Callback)
+{
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  Mock.mscd_control_request_CallbackBool = (int)0;
+  Mock.mscd_control_request_CallbackFunctionPointer = Callback;
+}
+
+void mscd_control_request_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_request_CALL_INSTANCE));
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_request_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_request_CallInstance, cmock_guts_index);
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_request(cmock_call_instance, rhport, p_request, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_control_request_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_request_CALL_INSTANCE));
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_request_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_request_CallInstance, cmock_guts_index);
+  Mock.mscd_control_request_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_request(cmock_call_instance, rhport, p_request, p_request_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mscd_control_request_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_control_request_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void mscd_control_request_CMockIgnoreArg_p_request(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_control_request_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_request_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_control_request_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_p_request = 1;
+}
+
+_Bool mscd_control_complete(uint8_t rhport, tusb_control_request_t const* p_request)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_control_complete);
+  cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_control_complete_CallInstance);
+  Mock.mscd_control_complete_CallInstance = CMock_Guts_MemNext(Mock.mscd_control_complete_CallInstance);
+  if (Mock.mscd_control_complete_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mscd_control_complete_FinalReturn;
+    memcpy((void*)(&Mock.mscd_control_complete_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mscd_control_complete_CallbackBool &&
+      Mock.mscd_control_complete_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.mscd_control_complete_CallbackFunctionPointer(rhport, p_request, Mock.mscd_control_complete_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_control_complete,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_p_request)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_control_complete,CMockString_p_request);
+    if (cmock_call_instance->Expected_p_request != p_request) {
+    if (cmock_call_instance->Expected_p_request == NULL)
+      { UNITY_TEST_ASSERT_NULL(p_request, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_p_request), (void*)(p_request), sizeof(tusb_control_request_t const), cmock_call_instance->Expected_p_request_Depth, cmock_line, CMockStringMismatch); }
+      }
+  }
+  if (Mock.mscd_control_complete_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mscd_control_complete_CallbackFunctionPointer(rhport, p_request, Mock.mscd_control_complete_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mscd_control_complete(CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth);
+void CMockExpectParameters_mscd_control_complete(CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_p_request = p_request;
+  cmock_call_instance->Expected_p_request_Depth = p_request_Depth;
+  cmock_call_instance->IgnoreArg_p_request = 0;
+}
+
+void mscd_control_complete_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_complete_CALL_INSTANCE));
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_complete_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_complete_CallInstance, cmock_guts_index);
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mscd_control_complete_IgnoreBool = (int)1;
+}
+
+void mscd_control_complete_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_complete_CALL_INSTANCE));
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_complete_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_complete_CallInstance, cmock_guts_index);
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_complete(cmock_call_instance, rhport, p_request, 1);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void mscd_control_complete_AddCallback(CMOCK_mscd_control_complete_CALLBACK Callback)
+{
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  Mock.mscd_control_complete_CallbackBool = (int)1;
+  Mock.mscd_control_complete_CallbackFunctionPointer = Callback;
+}
+
+void mscd_control_complete_Stub(CMOCK_mscd_control_complete_CALLBACK Callback)
+{
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  Mock.mscd_control_complete_CallbackBool = (int)0;
+  Mock.mscd_control_complete_CallbackFunctionPointer = Callback;
+}
+
+void mscd_control_complete_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_complete_CALL_INSTANCE));
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_complete_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_complete_CallInstance, cmock_guts_index);
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_complete(cmock_call_instance, rhport, p_request, 1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_control_complete_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_control_complete_CALL_INSTANCE));
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_control_complete_CallInstance = CMock_Guts_MemChain(Mock.mscd_control_complete_CallInstance, cmock_guts_index);
+  Mock.mscd_control_complete_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_control_complete(cmock_call_instance, rhport, p_request, p_request_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void mscd_control_complete_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_control_complete_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void mscd_control_complete_CMockIgnoreArg_p_request(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_control_complete_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_control_complete_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_control_complete_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_p_request = 1;
+}
+
+_Bool mscd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_mscd_xfer_cb);
+  cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.mscd_xfer_cb_CallInstance);
+  Mock.mscd_xfer_cb_CallInstance = CMock_Guts_MemNext(Mock.mscd_xfer_cb_CallInstance);
+  if (Mock.mscd_xfer_cb_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.mscd_xfer_cb_FinalReturn;
+    memcpy((void*)(&Mock.mscd_xfer_cb_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.mscd_xfer_cb_CallbackBool &&
+      Mock.mscd_xfer_cb_CallbackFunctionPointer != NULL)
+  {
+    _Bool ret = Mock.mscd_xfer_cb_CallbackFunctionPointer(rhport, ep_addr, event, xferred_bytes, Mock.mscd_xfer_cb_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_rhport)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_xfer_cb,CMockString_rhport);
+    if (cmock_call_instance->Expected_rhport != rhport) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_rhport, rhport, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_ep_addr)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_xfer_cb,CMockString_ep_addr);
+    if (cmock_call_instance->Expected_ep_addr != ep_addr) {
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_ep_addr, ep_addr, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_event)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_xfer_cb,CMockString_event);
+    if (&cmock_call_instance->Expected_event != &event) {
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_event), (void*)(&event), sizeof(xfer_result_t), cmock_line, CMockStringMismatch);
+      }
+  }
+  if (!cmock_call_instance->IgnoreArg_xferred_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_mscd_xfer_cb,CMockString_xferred_bytes);
+    if (cmock_call_instance->Expected_xferred_bytes != xferred_bytes) {
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_xferred_bytes, xferred_bytes, cmock_line, CMockStringMismatch);
+      }
+  }
+  if (Mock.mscd_xfer_cb_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.mscd_xfer_cb_CallbackFunctionPointer(rhport, ep_addr, event, xferred_bytes, Mock.mscd_xfer_cb_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_mscd_xfer_cb(CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes);
+void CMockExpectParameters_mscd_xfer_cb(CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes)
+{
+  cmock_call_instance->Expected_rhport = rhport;
+  cmock_call_instance->IgnoreArg_rhport = 0;
+  cmock_call_instance->Expected_ep_addr = ep_addr;
+  cmock_call_instance->IgnoreArg_ep_addr = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_event), (void*)(&event),
+         sizeof(xfer_result_t[sizeof(event) == sizeof(xfer_result_t) ? 1 : -1])); /* add xfer_result_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_event = 0;
+  cmock_call_instance->Expected_xferred_bytes = xferred_bytes;
+  cmock_call_instance->IgnoreArg_xferred_bytes = 0;
+}
+
+void mscd_xfer_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_xfer_cb_CALL_INSTANCE));
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_xfer_cb_CallInstance = CMock_Guts_MemChain(Mock.mscd_xfer_cb_CallInstance, cmock_guts_index);
+  Mock.mscd_xfer_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.mscd_xfer_cb_IgnoreBool = (int)1;
+}
+
+void mscd_xfer_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_xfer_cb_CALL_INSTANCE));
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_xfer_cb_CallInstance = CMock_Guts_MemChain(Mock.mscd_xfer_cb_CallInstance, cmock_guts_index);
+  Mock.mscd_xfer_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_xfer_cb(cmock_call_instance, rhport, ep_addr, event, xferred_bytes);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void mscd_xfer_cb_AddCallback(CMOCK_mscd_xfer_cb_CALLBACK Callback)
+{
+  Mock.mscd_xfer_cb_IgnoreBool = (int)0;
+  Mock.mscd_xfer_cb_CallbackBool = (int)1;
+  Mock.mscd_xfer_cb_CallbackFunctionPointer = Callback;
+}
+
+void mscd_xfer_cb_Stub(CMOCK_mscd_xfer_cb_CALLBACK Callback)
+{
+  Mock.mscd_xfer_cb_IgnoreBool = (int)0;
+  Mock.mscd_xfer_cb_CallbackBool = (int)0;
+  Mock.mscd_xfer_cb_CallbackFunctionPointer = Callback;
+}
+
+void mscd_xfer_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_mscd_xfer_cb_CALL_INSTANCE));
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.mscd_xfer_cb_CallInstance = CMock_Guts_MemChain(Mock.mscd_xfer_cb_CallInstance, cmock_guts_index);
+  Mock.mscd_xfer_cb_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_mscd_xfer_cb(cmock_call_instance, rhport, ep_addr, event, xferred_bytes);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void mscd_xfer_cb_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_xfer_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rhport = 1;
+}
+
+void mscd_xfer_cb_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_xfer_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ep_addr = 1;
+}
+
+void mscd_xfer_cb_CMockIgnoreArg_event(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_xfer_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_event = 1;
+}
+
+void mscd_xfer_cb_CMockIgnoreArg_xferred_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_mscd_xfer_cb_CALL_INSTANCE* cmock_call_instance = (CMOCK_mscd_xfer_cb_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.mscd_xfer_cb_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_xferred_bytes = 1;
+}
+
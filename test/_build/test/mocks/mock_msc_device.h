@@ -0,0 +1,369 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_MSC_DEVICE_H
+#define _MOCK_MSC_DEVICE_H
+
+#include "unity.h"
+#include "msc_device.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_msc_device_Init(void);
+void mock_msc_device_Destroy(void);
+void mock_msc_device_Verify(void);
+
+
+
+
+#define tud_msc_set_sense_IgnoreAndReturn(cmock_retval) tud_msc_set_sense_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_set_sense_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define tud_msc_set_sense_ExpectAndReturn(lun, sense_key, add_sense_code, add_sense_qualifier, cmock_retval) tud_msc_set_sense_CMockExpectAndReturn(__LINE__, lun, sense_key, add_sense_code, add_sense_qualifier, cmock_retval)
+void tud_msc_set_sense_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_tud_msc_set_sense_CALLBACK)(uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier, int cmock_num_calls);
+void tud_msc_set_sense_AddCallback(CMOCK_tud_msc_set_sense_CALLBACK Callback);
+void tud_msc_set_sense_Stub(CMOCK_tud_msc_set_sense_CALLBACK Callback);
+#define tud_msc_set_sense_StubWithCallback tud_msc_set_sense_Stub
+#define tud_msc_set_sense_ExpectAndThrow(lun, sense_key, add_sense_code, add_sense_qualifier, cmock_to_throw) tud_msc_set_sense_CMockExpectAndThrow(__LINE__, lun, sense_key, add_sense_code, add_sense_qualifier, cmock_to_throw)
+void tud_msc_set_sense_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t sense_key, uint8_t add_sense_code, uint8_t add_sense_qualifier, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_set_sense_IgnoreArg_lun() tud_msc_set_sense_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_set_sense_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_set_sense_IgnoreArg_sense_key() tud_msc_set_sense_CMockIgnoreArg_sense_key(__LINE__)
+void tud_msc_set_sense_CMockIgnoreArg_sense_key(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_set_sense_IgnoreArg_add_sense_code() tud_msc_set_sense_CMockIgnoreArg_add_sense_code(__LINE__)
+void tud_msc_set_sense_CMockIgnoreArg_add_sense_code(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_set_sense_IgnoreArg_add_sense_qualifier() tud_msc_set_sense_CMockIgnoreArg_add_sense_qualifier(__LINE__)
+void tud_msc_set_sense_CMockIgnoreArg_add_sense_qualifier(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_cb_IgnoreAndReturn(cmock_retval) tud_msc_read10_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_read10_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define tud_msc_read10_cb_ExpectAndReturn(lun, lba, offset, buffer, bufsize, cmock_retval) tud_msc_read10_cb_CMockExpectAndReturn(__LINE__, lun, lba, offset, buffer, bufsize, cmock_retval)
+void tud_msc_read10_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_tud_msc_read10_cb_CALLBACK)(uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize, int cmock_num_calls);
+void tud_msc_read10_cb_AddCallback(CMOCK_tud_msc_read10_cb_CALLBACK Callback);
+void tud_msc_read10_cb_Stub(CMOCK_tud_msc_read10_cb_CALLBACK Callback);
+#define tud_msc_read10_cb_StubWithCallback tud_msc_read10_cb_Stub
+#define tud_msc_read10_cb_ExpectAndThrow(lun, lba, offset, buffer, bufsize, cmock_to_throw) tud_msc_read10_cb_CMockExpectAndThrow(__LINE__, lun, lba, offset, buffer, bufsize, cmock_to_throw)
+void tud_msc_read10_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_read10_cb_ExpectWithArrayAndReturn(lun, lba, offset, buffer, buffer_Depth, bufsize, cmock_retval) tud_msc_read10_cb_CMockExpectWithArrayAndReturn(__LINE__, lun, lba, offset, buffer, buffer_Depth, bufsize, cmock_retval)
+void tud_msc_read10_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, void* buffer, int buffer_Depth, uint32_t bufsize, int32_t cmock_to_return);
+#define tud_msc_read10_cb_ReturnThruPtr_buffer(buffer) tud_msc_read10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, sizeof(void))
+#define tud_msc_read10_cb_ReturnArrayThruPtr_buffer(buffer, cmock_len) tud_msc_read10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, (int)(cmock_len * (int)sizeof(*buffer)))
+#define tud_msc_read10_cb_ReturnMemThruPtr_buffer(buffer, cmock_size) tud_msc_read10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, cmock_size)
+void tud_msc_read10_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, void* buffer, int cmock_size);
+#define tud_msc_read10_cb_IgnoreArg_lun() tud_msc_read10_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_read10_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_cb_IgnoreArg_lba() tud_msc_read10_cb_CMockIgnoreArg_lba(__LINE__)
+void tud_msc_read10_cb_CMockIgnoreArg_lba(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_cb_IgnoreArg_offset() tud_msc_read10_cb_CMockIgnoreArg_offset(__LINE__)
+void tud_msc_read10_cb_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_cb_IgnoreArg_buffer() tud_msc_read10_cb_CMockIgnoreArg_buffer(__LINE__)
+void tud_msc_read10_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_cb_IgnoreArg_bufsize() tud_msc_read10_cb_CMockIgnoreArg_bufsize(__LINE__)
+void tud_msc_read10_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_cb_IgnoreAndReturn(cmock_retval) tud_msc_write10_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_write10_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define tud_msc_write10_cb_ExpectAndReturn(lun, lba, offset, buffer, bufsize, cmock_retval) tud_msc_write10_cb_CMockExpectAndReturn(__LINE__, lun, lba, offset, buffer, bufsize, cmock_retval)
+void tud_msc_write10_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_tud_msc_write10_cb_CALLBACK)(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize, int cmock_num_calls);
+void tud_msc_write10_cb_AddCallback(CMOCK_tud_msc_write10_cb_CALLBACK Callback);
+void tud_msc_write10_cb_Stub(CMOCK_tud_msc_write10_cb_CALLBACK Callback);
+#define tud_msc_write10_cb_StubWithCallback tud_msc_write10_cb_Stub
+#define tud_msc_write10_cb_ExpectAndThrow(lun, lba, offset, buffer, bufsize, cmock_to_throw) tud_msc_write10_cb_CMockExpectAndThrow(__LINE__, lun, lba, offset, buffer, bufsize, cmock_to_throw)
+void tud_msc_write10_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_write10_cb_ExpectWithArrayAndReturn(lun, lba, offset, buffer, buffer_Depth, bufsize, cmock_retval) tud_msc_write10_cb_CMockExpectWithArrayAndReturn(__LINE__, lun, lba, offset, buffer, buffer_Depth, bufsize, cmock_retval)
+void tud_msc_write10_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t lba, uint32_t offset, uint8_t* buffer, int buffer_Depth, uint32_t bufsize, int32_t cmock_to_return);
+#define tud_msc_write10_cb_ReturnThruPtr_buffer(buffer) tud_msc_write10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, sizeof(uint8_t))
+#define tud_msc_write10_cb_ReturnArrayThruPtr_buffer(buffer, cmock_len) tud_msc_write10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, (int)(cmock_len * (int)sizeof(*buffer)))
+#define tud_msc_write10_cb_ReturnMemThruPtr_buffer(buffer, cmock_size) tud_msc_write10_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, cmock_size)
+void tud_msc_write10_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, uint8_t* buffer, int cmock_size);
+#define tud_msc_write10_cb_IgnoreArg_lun() tud_msc_write10_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_write10_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_cb_IgnoreArg_lba() tud_msc_write10_cb_CMockIgnoreArg_lba(__LINE__)
+void tud_msc_write10_cb_CMockIgnoreArg_lba(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_cb_IgnoreArg_offset() tud_msc_write10_cb_CMockIgnoreArg_offset(__LINE__)
+void tud_msc_write10_cb_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_cb_IgnoreArg_buffer() tud_msc_write10_cb_CMockIgnoreArg_buffer(__LINE__)
+void tud_msc_write10_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_cb_IgnoreArg_bufsize() tud_msc_write10_cb_CMockIgnoreArg_bufsize(__LINE__)
+void tud_msc_write10_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_inquiry_cb_Ignore() tud_msc_inquiry_cb_CMockIgnore()
+void tud_msc_inquiry_cb_CMockIgnore(void);
+#define tud_msc_inquiry_cb_Expect(lun, vendor_id, product_id, product_rev) tud_msc_inquiry_cb_CMockExpect(__LINE__, lun, vendor_id, product_id, product_rev)
+void tud_msc_inquiry_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev);
+typedef void (* CMOCK_tud_msc_inquiry_cb_CALLBACK)(uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev, int cmock_num_calls);
+void tud_msc_inquiry_cb_AddCallback(CMOCK_tud_msc_inquiry_cb_CALLBACK Callback);
+void tud_msc_inquiry_cb_Stub(CMOCK_tud_msc_inquiry_cb_CALLBACK Callback);
+#define tud_msc_inquiry_cb_StubWithCallback tud_msc_inquiry_cb_Stub
+#define tud_msc_inquiry_cb_ExpectAndThrow(lun, vendor_id, product_id, product_rev, cmock_to_throw) tud_msc_inquiry_cb_CMockExpectAndThrow(__LINE__, lun, vendor_id, product_id, product_rev, cmock_to_throw)
+void tud_msc_inquiry_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, uint8_t* product_id, uint8_t* product_rev, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_inquiry_cb_ExpectWithArray(lun, vendor_id, vendor_id_Depth, product_id, product_id_Depth, product_rev, product_rev_Depth) tud_msc_inquiry_cb_CMockExpectWithArray(__LINE__, lun, vendor_id, vendor_id_Depth, product_id, product_id_Depth, product_rev, product_rev_Depth)
+void tud_msc_inquiry_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t* vendor_id, int vendor_id_Depth, uint8_t* product_id, int product_id_Depth, uint8_t* product_rev, int product_rev_Depth);
+#define tud_msc_inquiry_cb_ReturnThruPtr_vendor_id(vendor_id) tud_msc_inquiry_cb_CMockReturnMemThruPtr_vendor_id(__LINE__, vendor_id, sizeof(uint8_t))
+#define tud_msc_inquiry_cb_ReturnArrayThruPtr_vendor_id(vendor_id, cmock_len) tud_msc_inquiry_cb_CMockReturnMemThruPtr_vendor_id(__LINE__, vendor_id, (int)(cmock_len * (int)sizeof(*vendor_id)))
+#define tud_msc_inquiry_cb_ReturnMemThruPtr_vendor_id(vendor_id, cmock_size) tud_msc_inquiry_cb_CMockReturnMemThruPtr_vendor_id(__LINE__, vendor_id, cmock_size)
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_vendor_id(UNITY_LINE_TYPE cmock_line, uint8_t* vendor_id, int cmock_size);
+#define tud_msc_inquiry_cb_ReturnThruPtr_product_id(product_id) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_id(__LINE__, product_id, sizeof(uint8_t))
+#define tud_msc_inquiry_cb_ReturnArrayThruPtr_product_id(product_id, cmock_len) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_id(__LINE__, product_id, (int)(cmock_len * (int)sizeof(*product_id)))
+#define tud_msc_inquiry_cb_ReturnMemThruPtr_product_id(product_id, cmock_size) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_id(__LINE__, product_id, cmock_size)
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_id(UNITY_LINE_TYPE cmock_line, uint8_t* product_id, int cmock_size);
+#define tud_msc_inquiry_cb_ReturnThruPtr_product_rev(product_rev) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_rev(__LINE__, product_rev, sizeof(uint8_t))
+#define tud_msc_inquiry_cb_ReturnArrayThruPtr_product_rev(product_rev, cmock_len) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_rev(__LINE__, product_rev, (int)(cmock_len * (int)sizeof(*product_rev)))
+#define tud_msc_inquiry_cb_ReturnMemThruPtr_product_rev(product_rev, cmock_size) tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_rev(__LINE__, product_rev, cmock_size)
+void tud_msc_inquiry_cb_CMockReturnMemThruPtr_product_rev(UNITY_LINE_TYPE cmock_line, uint8_t* product_rev, int cmock_size);
+#define tud_msc_inquiry_cb_IgnoreArg_lun() tud_msc_inquiry_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_inquiry_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_inquiry_cb_IgnoreArg_vendor_id() tud_msc_inquiry_cb_CMockIgnoreArg_vendor_id(__LINE__)
+void tud_msc_inquiry_cb_CMockIgnoreArg_vendor_id(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_inquiry_cb_IgnoreArg_product_id() tud_msc_inquiry_cb_CMockIgnoreArg_product_id(__LINE__)
+void tud_msc_inquiry_cb_CMockIgnoreArg_product_id(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_inquiry_cb_IgnoreArg_product_rev() tud_msc_inquiry_cb_CMockIgnoreArg_product_rev(__LINE__)
+void tud_msc_inquiry_cb_CMockIgnoreArg_product_rev(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_test_unit_ready_cb_IgnoreAndReturn(cmock_retval) tud_msc_test_unit_ready_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_test_unit_ready_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define tud_msc_test_unit_ready_cb_ExpectAndReturn(lun, cmock_retval) tud_msc_test_unit_ready_cb_CMockExpectAndReturn(__LINE__, lun, cmock_retval)
+void tud_msc_test_unit_ready_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_tud_msc_test_unit_ready_cb_CALLBACK)(uint8_t lun, int cmock_num_calls);
+void tud_msc_test_unit_ready_cb_AddCallback(CMOCK_tud_msc_test_unit_ready_cb_CALLBACK Callback);
+void tud_msc_test_unit_ready_cb_Stub(CMOCK_tud_msc_test_unit_ready_cb_CALLBACK Callback);
+#define tud_msc_test_unit_ready_cb_StubWithCallback tud_msc_test_unit_ready_cb_Stub
+#define tud_msc_test_unit_ready_cb_ExpectAndThrow(lun, cmock_to_throw) tud_msc_test_unit_ready_cb_CMockExpectAndThrow(__LINE__, lun, cmock_to_throw)
+void tud_msc_test_unit_ready_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_test_unit_ready_cb_IgnoreArg_lun() tud_msc_test_unit_ready_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_test_unit_ready_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_capacity_cb_Ignore() tud_msc_capacity_cb_CMockIgnore()
+void tud_msc_capacity_cb_CMockIgnore(void);
+#define tud_msc_capacity_cb_Expect(lun, block_count, block_size) tud_msc_capacity_cb_CMockExpect(__LINE__, lun, block_count, block_size)
+void tud_msc_capacity_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, uint16_t* block_size);
+typedef void (* CMOCK_tud_msc_capacity_cb_CALLBACK)(uint8_t lun, uint32_t* block_count, uint16_t* block_size, int cmock_num_calls);
+void tud_msc_capacity_cb_AddCallback(CMOCK_tud_msc_capacity_cb_CALLBACK Callback);
+void tud_msc_capacity_cb_Stub(CMOCK_tud_msc_capacity_cb_CALLBACK Callback);
+#define tud_msc_capacity_cb_StubWithCallback tud_msc_capacity_cb_Stub
+#define tud_msc_capacity_cb_ExpectAndThrow(lun, block_count, block_size, cmock_to_throw) tud_msc_capacity_cb_CMockExpectAndThrow(__LINE__, lun, block_count, block_size, cmock_to_throw)
+void tud_msc_capacity_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, uint16_t* block_size, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_capacity_cb_ExpectWithArray(lun, block_count, block_count_Depth, block_size, block_size_Depth) tud_msc_capacity_cb_CMockExpectWithArray(__LINE__, lun, block_count, block_count_Depth, block_size, block_size_Depth)
+void tud_msc_capacity_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint32_t* block_count, int block_count_Depth, uint16_t* block_size, int block_size_Depth);
+#define tud_msc_capacity_cb_ReturnThruPtr_block_count(block_count) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_count(__LINE__, block_count, sizeof(uint32_t))
+#define tud_msc_capacity_cb_ReturnArrayThruPtr_block_count(block_count, cmock_len) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_count(__LINE__, block_count, (int)(cmock_len * (int)sizeof(*block_count)))
+#define tud_msc_capacity_cb_ReturnMemThruPtr_block_count(block_count, cmock_size) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_count(__LINE__, block_count, cmock_size)
+void tud_msc_capacity_cb_CMockReturnMemThruPtr_block_count(UNITY_LINE_TYPE cmock_line, uint32_t* block_count, int cmock_size);
+#define tud_msc_capacity_cb_ReturnThruPtr_block_size(block_size) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_size(__LINE__, block_size, sizeof(uint16_t))
+#define tud_msc_capacity_cb_ReturnArrayThruPtr_block_size(block_size, cmock_len) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_size(__LINE__, block_size, (int)(cmock_len * (int)sizeof(*block_size)))
+#define tud_msc_capacity_cb_ReturnMemThruPtr_block_size(block_size, cmock_size) tud_msc_capacity_cb_CMockReturnMemThruPtr_block_size(__LINE__, block_size, cmock_size)
+void tud_msc_capacity_cb_CMockReturnMemThruPtr_block_size(UNITY_LINE_TYPE cmock_line, uint16_t* block_size, int cmock_size);
+#define tud_msc_capacity_cb_IgnoreArg_lun() tud_msc_capacity_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_capacity_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_capacity_cb_IgnoreArg_block_count() tud_msc_capacity_cb_CMockIgnoreArg_block_count(__LINE__)
+void tud_msc_capacity_cb_CMockIgnoreArg_block_count(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_capacity_cb_IgnoreArg_block_size() tud_msc_capacity_cb_CMockIgnoreArg_block_size(__LINE__)
+void tud_msc_capacity_cb_CMockIgnoreArg_block_size(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_cb_IgnoreAndReturn(cmock_retval) tud_msc_scsi_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_scsi_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define tud_msc_scsi_cb_ExpectAndReturn(lun, scsi_cmd, buffer, bufsize, cmock_retval) tud_msc_scsi_cb_CMockExpectAndReturn(__LINE__, lun, scsi_cmd, buffer, bufsize, cmock_retval)
+void tud_msc_scsi_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_tud_msc_scsi_cb_CALLBACK)(uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize, int cmock_num_calls);
+void tud_msc_scsi_cb_AddCallback(CMOCK_tud_msc_scsi_cb_CALLBACK Callback);
+void tud_msc_scsi_cb_Stub(CMOCK_tud_msc_scsi_cb_CALLBACK Callback);
+#define tud_msc_scsi_cb_StubWithCallback tud_msc_scsi_cb_Stub
+#define tud_msc_scsi_cb_ExpectAndThrow(lun, scsi_cmd, buffer, bufsize, cmock_to_throw) tud_msc_scsi_cb_CMockExpectAndThrow(__LINE__, lun, scsi_cmd, buffer, bufsize, cmock_to_throw)
+void tud_msc_scsi_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, void* buffer, uint16_t bufsize, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_scsi_cb_ExpectWithArrayAndReturn(lun, scsi_cmd, scsi_cmd_Depth, buffer, buffer_Depth, bufsize, cmock_retval) tud_msc_scsi_cb_CMockExpectWithArrayAndReturn(__LINE__, lun, scsi_cmd, scsi_cmd_Depth, buffer, buffer_Depth, bufsize, cmock_retval)
+void tud_msc_scsi_cb_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth, void* buffer, int buffer_Depth, uint16_t bufsize, int32_t cmock_to_return);
+#define tud_msc_scsi_cb_ReturnThruPtr_buffer(buffer) tud_msc_scsi_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, sizeof(void))
+#define tud_msc_scsi_cb_ReturnArrayThruPtr_buffer(buffer, cmock_len) tud_msc_scsi_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, (int)(cmock_len * (int)sizeof(*buffer)))
+#define tud_msc_scsi_cb_ReturnMemThruPtr_buffer(buffer, cmock_size) tud_msc_scsi_cb_CMockReturnMemThruPtr_buffer(__LINE__, buffer, cmock_size)
+void tud_msc_scsi_cb_CMockReturnMemThruPtr_buffer(UNITY_LINE_TYPE cmock_line, void* buffer, int cmock_size);
+#define tud_msc_scsi_cb_IgnoreArg_lun() tud_msc_scsi_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_scsi_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_cb_IgnoreArg_scsi_cmd() tud_msc_scsi_cb_CMockIgnoreArg_scsi_cmd(__LINE__)
+void tud_msc_scsi_cb_CMockIgnoreArg_scsi_cmd(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_cb_IgnoreArg_buffer() tud_msc_scsi_cb_CMockIgnoreArg_buffer(__LINE__)
+void tud_msc_scsi_cb_CMockIgnoreArg_buffer(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_cb_IgnoreArg_bufsize() tud_msc_scsi_cb_CMockIgnoreArg_bufsize(__LINE__)
+void tud_msc_scsi_cb_CMockIgnoreArg_bufsize(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_get_maxlun_cb_IgnoreAndReturn(cmock_retval) tud_msc_get_maxlun_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_get_maxlun_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define tud_msc_get_maxlun_cb_ExpectAndReturn(cmock_retval) tud_msc_get_maxlun_cb_CMockExpectAndReturn(__LINE__, cmock_retval)
+void tud_msc_get_maxlun_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_tud_msc_get_maxlun_cb_CALLBACK)(int cmock_num_calls);
+void tud_msc_get_maxlun_cb_AddCallback(CMOCK_tud_msc_get_maxlun_cb_CALLBACK Callback);
+void tud_msc_get_maxlun_cb_Stub(CMOCK_tud_msc_get_maxlun_cb_CALLBACK Callback);
+#define tud_msc_get_maxlun_cb_StubWithCallback tud_msc_get_maxlun_cb_Stub
+#define tud_msc_get_maxlun_cb_ExpectAndThrow(cmock_to_throw) tud_msc_get_maxlun_cb_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void tud_msc_get_maxlun_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_start_stop_cb_IgnoreAndReturn(cmock_retval) tud_msc_start_stop_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_start_stop_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define tud_msc_start_stop_cb_ExpectAndReturn(lun, power_condition, start, load_eject, cmock_retval) tud_msc_start_stop_cb_CMockExpectAndReturn(__LINE__, lun, power_condition, start, load_eject, cmock_retval)
+void tud_msc_start_stop_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_tud_msc_start_stop_cb_CALLBACK)(uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject, int cmock_num_calls);
+void tud_msc_start_stop_cb_AddCallback(CMOCK_tud_msc_start_stop_cb_CALLBACK Callback);
+void tud_msc_start_stop_cb_Stub(CMOCK_tud_msc_start_stop_cb_CALLBACK Callback);
+#define tud_msc_start_stop_cb_StubWithCallback tud_msc_start_stop_cb_Stub
+#define tud_msc_start_stop_cb_ExpectAndThrow(lun, power_condition, start, load_eject, cmock_to_throw) tud_msc_start_stop_cb_CMockExpectAndThrow(__LINE__, lun, power_condition, start, load_eject, cmock_to_throw)
+void tud_msc_start_stop_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t power_condition, _Bool start, _Bool load_eject, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_start_stop_cb_IgnoreArg_lun() tud_msc_start_stop_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_start_stop_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_start_stop_cb_IgnoreArg_power_condition() tud_msc_start_stop_cb_CMockIgnoreArg_power_condition(__LINE__)
+void tud_msc_start_stop_cb_CMockIgnoreArg_power_condition(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_start_stop_cb_IgnoreArg_start() tud_msc_start_stop_cb_CMockIgnoreArg_start(__LINE__)
+void tud_msc_start_stop_cb_CMockIgnoreArg_start(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_start_stop_cb_IgnoreArg_load_eject() tud_msc_start_stop_cb_CMockIgnoreArg_load_eject(__LINE__)
+void tud_msc_start_stop_cb_CMockIgnoreArg_load_eject(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_read10_complete_cb_Ignore() tud_msc_read10_complete_cb_CMockIgnore()
+void tud_msc_read10_complete_cb_CMockIgnore(void);
+#define tud_msc_read10_complete_cb_Expect(lun) tud_msc_read10_complete_cb_CMockExpect(__LINE__, lun)
+void tud_msc_read10_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun);
+typedef void (* CMOCK_tud_msc_read10_complete_cb_CALLBACK)(uint8_t lun, int cmock_num_calls);
+void tud_msc_read10_complete_cb_AddCallback(CMOCK_tud_msc_read10_complete_cb_CALLBACK Callback);
+void tud_msc_read10_complete_cb_Stub(CMOCK_tud_msc_read10_complete_cb_CALLBACK Callback);
+#define tud_msc_read10_complete_cb_StubWithCallback tud_msc_read10_complete_cb_Stub
+#define tud_msc_read10_complete_cb_ExpectAndThrow(lun, cmock_to_throw) tud_msc_read10_complete_cb_CMockExpectAndThrow(__LINE__, lun, cmock_to_throw)
+void tud_msc_read10_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_read10_complete_cb_IgnoreArg_lun() tud_msc_read10_complete_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_read10_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_write10_complete_cb_Ignore() tud_msc_write10_complete_cb_CMockIgnore()
+void tud_msc_write10_complete_cb_CMockIgnore(void);
+#define tud_msc_write10_complete_cb_Expect(lun) tud_msc_write10_complete_cb_CMockExpect(__LINE__, lun)
+void tud_msc_write10_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun);
+typedef void (* CMOCK_tud_msc_write10_complete_cb_CALLBACK)(uint8_t lun, int cmock_num_calls);
+void tud_msc_write10_complete_cb_AddCallback(CMOCK_tud_msc_write10_complete_cb_CALLBACK Callback);
+void tud_msc_write10_complete_cb_Stub(CMOCK_tud_msc_write10_complete_cb_CALLBACK Callback);
+#define tud_msc_write10_complete_cb_StubWithCallback tud_msc_write10_complete_cb_Stub
+#define tud_msc_write10_complete_cb_ExpectAndThrow(lun, cmock_to_throw) tud_msc_write10_complete_cb_CMockExpectAndThrow(__LINE__, lun, cmock_to_throw)
+void tud_msc_write10_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_write10_complete_cb_IgnoreArg_lun() tud_msc_write10_complete_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_write10_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_complete_cb_Ignore() tud_msc_scsi_complete_cb_CMockIgnore()
+void tud_msc_scsi_complete_cb_CMockIgnore(void);
+#define tud_msc_scsi_complete_cb_Expect(lun, scsi_cmd) tud_msc_scsi_complete_cb_CMockExpect(__LINE__, lun, scsi_cmd)
+void tud_msc_scsi_complete_cb_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd);
+typedef void (* CMOCK_tud_msc_scsi_complete_cb_CALLBACK)(uint8_t lun, uint8_t const* scsi_cmd, int cmock_num_calls);
+void tud_msc_scsi_complete_cb_AddCallback(CMOCK_tud_msc_scsi_complete_cb_CALLBACK Callback);
+void tud_msc_scsi_complete_cb_Stub(CMOCK_tud_msc_scsi_complete_cb_CALLBACK Callback);
+#define tud_msc_scsi_complete_cb_StubWithCallback tud_msc_scsi_complete_cb_Stub
+#define tud_msc_scsi_complete_cb_ExpectAndThrow(lun, scsi_cmd, cmock_to_throw) tud_msc_scsi_complete_cb_CMockExpectAndThrow(__LINE__, lun, scsi_cmd, cmock_to_throw)
+void tud_msc_scsi_complete_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_scsi_complete_cb_ExpectWithArray(lun, scsi_cmd, scsi_cmd_Depth) tud_msc_scsi_complete_cb_CMockExpectWithArray(__LINE__, lun, scsi_cmd, scsi_cmd_Depth)
+void tud_msc_scsi_complete_cb_CMockExpectWithArray(UNITY_LINE_TYPE cmock_line, uint8_t lun, uint8_t const* scsi_cmd, int scsi_cmd_Depth);
+#define tud_msc_scsi_complete_cb_IgnoreArg_lun() tud_msc_scsi_complete_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_scsi_complete_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_scsi_complete_cb_IgnoreArg_scsi_cmd() tud_msc_scsi_complete_cb_CMockIgnoreArg_scsi_cmd(__LINE__)
+void tud_msc_scsi_complete_cb_CMockIgnoreArg_scsi_cmd(UNITY_LINE_TYPE cmock_line);
+#define tud_msc_is_writable_cb_IgnoreAndReturn(cmock_retval) tud_msc_is_writable_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void tud_msc_is_writable_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define tud_msc_is_writable_cb_ExpectAndReturn(lun, cmock_retval) tud_msc_is_writable_cb_CMockExpectAndReturn(__LINE__, lun, cmock_retval)
+void tud_msc_is_writable_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t lun, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_tud_msc_is_writable_cb_CALLBACK)(uint8_t lun, int cmock_num_calls);
+void tud_msc_is_writable_cb_AddCallback(CMOCK_tud_msc_is_writable_cb_CALLBACK Callback);
+void tud_msc_is_writable_cb_Stub(CMOCK_tud_msc_is_writable_cb_CALLBACK Callback);
+#define tud_msc_is_writable_cb_StubWithCallback tud_msc_is_writable_cb_Stub
+#define tud_msc_is_writable_cb_ExpectAndThrow(lun, cmock_to_throw) tud_msc_is_writable_cb_CMockExpectAndThrow(__LINE__, lun, cmock_to_throw)
+void tud_msc_is_writable_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t lun, CEXCEPTION_T cmock_to_throw);
+#define tud_msc_is_writable_cb_IgnoreArg_lun() tud_msc_is_writable_cb_CMockIgnoreArg_lun(__LINE__)
+void tud_msc_is_writable_cb_CMockIgnoreArg_lun(UNITY_LINE_TYPE cmock_line);
+#define mscd_init_Ignore() mscd_init_CMockIgnore()
+void mscd_init_CMockIgnore(void);
+#define mscd_init_Expect() mscd_init_CMockExpect(__LINE__)
+void mscd_init_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_mscd_init_CALLBACK)(int cmock_num_calls);
+void mscd_init_AddCallback(CMOCK_mscd_init_CALLBACK Callback);
+void mscd_init_Stub(CMOCK_mscd_init_CALLBACK Callback);
+#define mscd_init_StubWithCallback mscd_init_Stub
+#define mscd_init_ExpectAndThrow(cmock_to_throw) mscd_init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void mscd_init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define mscd_reset_Ignore() mscd_reset_CMockIgnore()
+void mscd_reset_CMockIgnore(void);
+#define mscd_reset_Expect(rhport) mscd_reset_CMockExpect(__LINE__, rhport)
+void mscd_reset_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t rhport);
+typedef void (* CMOCK_mscd_reset_CALLBACK)(uint8_t rhport, int cmock_num_calls);
+void mscd_reset_AddCallback(CMOCK_mscd_reset_CALLBACK Callback);
+void mscd_reset_Stub(CMOCK_mscd_reset_CALLBACK Callback);
+#define mscd_reset_StubWithCallback mscd_reset_Stub
+#define mscd_reset_ExpectAndThrow(rhport, cmock_to_throw) mscd_reset_CMockExpectAndThrow(__LINE__, rhport, cmock_to_throw)
+void mscd_reset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, CEXCEPTION_T cmock_to_throw);
+#define mscd_reset_IgnoreArg_rhport() mscd_reset_CMockIgnoreArg_rhport(__LINE__)
+void mscd_reset_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define mscd_open_IgnoreAndReturn(cmock_retval) mscd_open_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mscd_open_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define mscd_open_ExpectAndReturn(rhport, itf_desc, max_len, cmock_retval) mscd_open_CMockExpectAndReturn(__LINE__, rhport, itf_desc, max_len, cmock_retval)
+void mscd_open_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_mscd_open_CALLBACK)(uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len, int cmock_num_calls);
+void mscd_open_AddCallback(CMOCK_mscd_open_CALLBACK Callback);
+void mscd_open_Stub(CMOCK_mscd_open_CALLBACK Callback);
+#define mscd_open_StubWithCallback mscd_open_Stub
+#define mscd_open_ExpectAndThrow(rhport, itf_desc, max_len, cmock_to_throw) mscd_open_CMockExpectAndThrow(__LINE__, rhport, itf_desc, max_len, cmock_to_throw)
+void mscd_open_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, uint16_t max_len, CEXCEPTION_T cmock_to_throw);
+#define mscd_open_ExpectWithArrayAndReturn(rhport, itf_desc, itf_desc_Depth, max_len, cmock_retval) mscd_open_CMockExpectWithArrayAndReturn(__LINE__, rhport, itf_desc, itf_desc_Depth, max_len, cmock_retval)
+void mscd_open_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_desc_interface_t const* itf_desc, int itf_desc_Depth, uint16_t max_len, uint16_t cmock_to_return);
+#define mscd_open_IgnoreArg_rhport() mscd_open_CMockIgnoreArg_rhport(__LINE__)
+void mscd_open_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define mscd_open_IgnoreArg_itf_desc() mscd_open_CMockIgnoreArg_itf_desc(__LINE__)
+void mscd_open_CMockIgnoreArg_itf_desc(UNITY_LINE_TYPE cmock_line);
+#define mscd_open_IgnoreArg_max_len() mscd_open_CMockIgnoreArg_max_len(__LINE__)
+void mscd_open_CMockIgnoreArg_max_len(UNITY_LINE_TYPE cmock_line);
+#define mscd_control_request_IgnoreAndReturn(cmock_retval) mscd_control_request_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mscd_control_request_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define mscd_control_request_ExpectAndReturn(rhport, p_request, cmock_retval) mscd_control_request_CMockExpectAndReturn(__LINE__, rhport, p_request, cmock_retval)
+void mscd_control_request_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_mscd_control_request_CALLBACK)(uint8_t rhport, tusb_control_request_t const* p_request, int cmock_num_calls);
+void mscd_control_request_AddCallback(CMOCK_mscd_control_request_CALLBACK Callback);
+void mscd_control_request_Stub(CMOCK_mscd_control_request_CALLBACK Callback);
+#define mscd_control_request_StubWithCallback mscd_control_request_Stub
+#define mscd_control_request_ExpectAndThrow(rhport, p_request, cmock_to_throw) mscd_control_request_CMockExpectAndThrow(__LINE__, rhport, p_request, cmock_to_throw)
+void mscd_control_request_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, CEXCEPTION_T cmock_to_throw);
+#define mscd_control_request_ExpectWithArrayAndReturn(rhport, p_request, p_request_Depth, cmock_retval) mscd_control_request_CMockExpectWithArrayAndReturn(__LINE__, rhport, p_request, p_request_Depth, cmock_retval)
+void mscd_control_request_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth, _Bool cmock_to_return);
+#define mscd_control_request_IgnoreArg_rhport() mscd_control_request_CMockIgnoreArg_rhport(__LINE__)
+void mscd_control_request_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define mscd_control_request_IgnoreArg_p_request() mscd_control_request_CMockIgnoreArg_p_request(__LINE__)
+void mscd_control_request_CMockIgnoreArg_p_request(UNITY_LINE_TYPE cmock_line);
+#define mscd_control_complete_IgnoreAndReturn(cmock_retval) mscd_control_complete_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mscd_control_complete_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define mscd_control_complete_ExpectAndReturn(rhport, p_request, cmock_retval) mscd_control_complete_CMockExpectAndReturn(__LINE__, rhport, p_request, cmock_retval)
+void mscd_control_complete_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_mscd_control_complete_CALLBACK)(uint8_t rhport, tusb_control_request_t const* p_request, int cmock_num_calls);
+void mscd_control_complete_AddCallback(CMOCK_mscd_control_complete_CALLBACK Callback);
+void mscd_control_complete_Stub(CMOCK_mscd_control_complete_CALLBACK Callback);
+#define mscd_control_complete_StubWithCallback mscd_control_complete_Stub
+#define mscd_control_complete_ExpectAndThrow(rhport, p_request, cmock_to_throw) mscd_control_complete_CMockExpectAndThrow(__LINE__, rhport, p_request, cmock_to_throw)
+void mscd_control_complete_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, CEXCEPTION_T cmock_to_throw);
+#define mscd_control_complete_ExpectWithArrayAndReturn(rhport, p_request, p_request_Depth, cmock_retval) mscd_control_complete_CMockExpectWithArrayAndReturn(__LINE__, rhport, p_request, p_request_Depth, cmock_retval)
+void mscd_control_complete_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, tusb_control_request_t const* p_request, int p_request_Depth, _Bool cmock_to_return);
+#define mscd_control_complete_IgnoreArg_rhport() mscd_control_complete_CMockIgnoreArg_rhport(__LINE__)
+void mscd_control_complete_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define mscd_control_complete_IgnoreArg_p_request() mscd_control_complete_CMockIgnoreArg_p_request(__LINE__)
+void mscd_control_complete_CMockIgnoreArg_p_request(UNITY_LINE_TYPE cmock_line);
+#define mscd_xfer_cb_IgnoreAndReturn(cmock_retval) mscd_xfer_cb_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void mscd_xfer_cb_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define mscd_xfer_cb_ExpectAndReturn(rhport, ep_addr, event, xferred_bytes, cmock_retval) mscd_xfer_cb_CMockExpectAndReturn(__LINE__, rhport, ep_addr, event, xferred_bytes, cmock_retval)
+void mscd_xfer_cb_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_mscd_xfer_cb_CALLBACK)(uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, int cmock_num_calls);
+void mscd_xfer_cb_AddCallback(CMOCK_mscd_xfer_cb_CALLBACK Callback);
+void mscd_xfer_cb_Stub(CMOCK_mscd_xfer_cb_CALLBACK Callback);
+#define mscd_xfer_cb_StubWithCallback mscd_xfer_cb_Stub
+#define mscd_xfer_cb_ExpectAndThrow(rhport, ep_addr, event, xferred_bytes, cmock_to_throw) mscd_xfer_cb_CMockExpectAndThrow(__LINE__, rhport, ep_addr, event, xferred_bytes, cmock_to_throw)
+void mscd_xfer_cb_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t rhport, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, CEXCEPTION_T cmock_to_throw);
+#define mscd_xfer_cb_IgnoreArg_rhport() mscd_xfer_cb_CMockIgnoreArg_rhport(__LINE__)
+void mscd_xfer_cb_CMockIgnoreArg_rhport(UNITY_LINE_TYPE cmock_line);
+#define mscd_xfer_cb_IgnoreArg_ep_addr() mscd_xfer_cb_CMockIgnoreArg_ep_addr(__LINE__)
+void mscd_xfer_cb_CMockIgnoreArg_ep_addr(UNITY_LINE_TYPE cmock_line);
+#define mscd_xfer_cb_IgnoreArg_event() mscd_xfer_cb_CMockIgnoreArg_event(__LINE__)
+void mscd_xfer_cb_CMockIgnoreArg_event(UNITY_LINE_TYPE cmock_line);
+#define mscd_xfer_cb_IgnoreArg_xferred_bytes() mscd_xfer_cb_CMockIgnoreArg_xferred_bytes(__LINE__)
+void mscd_xfer_cb_CMockIgnoreArg_xferred_bytes(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,272 @@
+#include "../src/common/tusb_common.h"
+
+
+
+
+
+
+
+
+
+
+typedef enum
+
+{
+
+  DCD_EVENT_INVALID = 0,
+
+  DCD_EVENT_BUS_RESET,
+
+  DCD_EVENT_UNPLUGGED,
+
+  DCD_EVENT_SOF,
+
+  DCD_EVENT_SUSPEND,
+
+  DCD_EVENT_RESUME,
+
+
+
+  DCD_EVENT_SETUP_RECEIVED,
+
+  DCD_EVENT_XFER_COMPLETE,
+
+
+
+
+
+  USBD_EVENT_FUNC_CALL,
+
+
+
+  DCD_EVENT_COUNT
+
+} dcd_eventid_t;
+
+
+
+typedef struct __attribute__ ((aligned(4)))
+
+{
+
+  uint8_t rhport;
+
+  uint8_t event_id;
+
+  uint8_t bus_epoch;
+
+
+
+  union
+
+  {
+
+
+
+    struct {
+
+      tusb_speed_t speed;
+
+    } bus_reset;
+
+
+
+
+
+    tusb_control_request_t setup_received;
+
+
+
+
+
+    struct {
+
+      uint8_t ep_addr;
+
+      uint8_t result;
+
+      uint32_t len;
+
+    }xfer_complete;
+
+
+
+
+
+    struct {
+
+      void (*func) (void*);
+
+      void* param;
+
+    }func_call;
+
+  };
+
+
+
+
+
+  uint32_t timestamp;
+
+
+
+} dcd_event_t;
+
+void dcd_init (uint8_t rhport);
+
+
+
+
+
+void dcd_int_handler(uint8_t rhport);
+
+
+
+
+
+void dcd_int_enable (uint8_t rhport);
+
+
+
+
+
+void dcd_int_disable(uint8_t rhport);
+
+
+
+
+
+void dcd_set_address(uint8_t rhport, uint8_t dev_addr);
+
+
+
+
+
+void dcd_remote_wakeup(uint8_t rhport);
+
+
+
+
+
+void dcd_connect(uint8_t rhport) __attribute__ ((weak));
+
+
+
+
+
+void dcd_disconnect(uint8_t rhport) __attribute__ ((weak));
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void dcd_edpt0_status_complete(uint8_t rhport, tusb_control_request_t const * request) __attribute__ ((weak));
+
+
+
+
+
+
+
+_Bool 
+
+    dcd_edpt_open (uint8_t rhport, tusb_desc_endpoint_t const * p_endpoint_desc);
+
+
+
+
+
+
+
+void dcd_edpt_close (uint8_t rhport, uint8_t ep_addr) __attribute__ ((weak));
+
+
+
+
+
+
+
+_Bool 
+
+    dcd_edpt_xfer (uint8_t rhport, uint8_t ep_addr, uint8_t * buffer, uint16_t total_bytes);
+
+
+
+
+
+void dcd_edpt_stall (uint8_t rhport, uint8_t ep_addr);
+
+
+
+
+
+void dcd_edpt_clear_stall (uint8_t rhport, uint8_t ep_addr);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dcd_event_handler(dcd_event_t const * event, 
+
+                                                        _Bool 
+
+                                                             in_isr);
+
+
+
+
+
+extern void dcd_event_bus_signal (uint8_t rhport, dcd_eventid_t eid, 
+
+                                                                    _Bool 
+
+                                                                         in_isr);
+
+
+
+
+
+extern void dcd_event_bus_reset (uint8_t rhport, tusb_speed_t speed, 
+
+                                                                    _Bool 
+
+                                                                         in_isr);
+
+
+
+
+
+extern void dcd_event_setup_received(uint8_t rhport, uint8_t const * setup, 
+
+                                                                           _Bool 
+
+                                                                                in_isr);
+
+
+
+
+
+extern void dcd_event_xfer_complete (uint8_t rhport, uint8_t ep_addr, uint32_t xferred_bytes, uint8_t result, 
+
+                                                                                                             _Bool 
+
+                                                                                                                  in_isr);
@@ -0,0 +1,1306 @@
+#include "_build/temp/_test_ehci_iso.c"
+#include "../src/host/ehci/ehci_iso.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum { QHD_TAIL = 0x1000 | (EHCI_QTYPE_QHD << 1) };
+
+
+
+static ehci_link_t framelist[(1024 >> 5)];
+
+static uint8_t buffer[2][8*1024];
+
+
+
+static uint16_t device_len;
+
+
+
+static inline uint32_t addr32(void const* p)
+
+{
+
+  return (uint32_t) (uintptr_t) p;
+
+}
+
+
+
+static uint8_t* resolve_buffer(uint32_t addr)
+
+{
+
+  for(uint8_t i=0; i<2; i++)
+
+  {
+
+    if ( addr - addr32(buffer[i]) < sizeof(buffer[i]) ) return buffer[i] + (addr - addr32(buffer[i]));
+
+  }
+
+  UnityFail( (("unknown buffer address")), (UNITY_UINT)(54));
+
+  return 
+
+        ((void *)0)
+
+            ;
+
+}
+
+
+
+static void* resolve_td(uint32_t addr)
+
+{
+
+  for(uint8_t i=0; i<2; i++)
+
+  {
+
+    ehci_iso_stream_t* stream = ehci_iso_get(i);
+
+    if ( !stream ) continue;
+
+
+
+    for(uint8_t k=0; k<8; k++)
+
+    {
+
+      if ( addr == addr32(&stream->itd[k]) ) return &stream->itd[k];
+
+      if ( addr == addr32(&stream->sitd[k]) ) return &stream->sitd[k];
+
+    }
+
+  }
+
+  UnityFail( (("unknown descriptor address")), (UNITY_UINT)(71));
+
+  return 
+
+        ((void *)0)
+
+            ;
+
+}
+
+
+
+static void itd_execute(ehci_itd_t* itd)
+
+{
+
+  
+
+ _Bool 
+
+      const is_in = (itd->BufferPointer[1] & (1U << (11))) != 0;
+
+
+
+  for(uint8_t u=0; u<8; u++)
+
+  {
+
+    if ( !itd->xact[u].active ) continue;
+
+
+
+    if ( is_in )
+
+    {
+
+      uint32_t const addr = (itd->BufferPointer[itd->xact[u].page_select] & ~0xFFFUL) + itd->xact[u].offset;
+
+      uint16_t const len = tu_min16(device_len, itd->xact[u].length);
+
+
+
+      memset(resolve_buffer(addr), 0xA0 + u, len);
+
+      itd->xact[u].length = len;
+
+    }
+
+    itd->xact[u].active = 0;
+
+  }
+
+}
+
+
+
+static void sitd_execute(ehci_sitd_t* sitd)
+
+{
+
+  if ( !sitd->active ) return;
+
+
+
+  if ( sitd->direction )
+
+  {
+
+    uint16_t const len = tu_min16(device_len, sitd->total_bytes);
+
+    memset(resolve_buffer(sitd->buffer[0]), 0x55, len);
+
+    sitd->total_bytes -= len;
+
+  }else
+
+  {
+
+    sitd->total_bytes = 0;
+
+  }
+
+  sitd->active = 0;
+
+}
+
+
+
+
+
+static void hc_run_frame(uint32_t frame)
+
+{
+
+  ehci_link_t link = framelist[frame % (1024 >> 5)];
+
+
+
+  while ( !link.terminate && link.address != QHD_TAIL )
+
+  {
+
+    void* td = resolve_td(tu_align32(link.address));
+
+
+
+    if ( link.type == EHCI_QTYPE_ITD )
+
+    {
+
+      itd_execute((ehci_itd_t*) td);
+
+      link = ((ehci_itd_t*) td)->next;
+
+    }else
+
+    {
+
+      UnityAssertEqualNumber((UNITY_INT)((EHCI_QTYPE_SITD)), (UNITY_INT)((link.type)), (
+
+     ((void *)0)
+
+     ), (UNITY_UINT)(126), UNITY_DISPLAY_STYLE_INT);
+
+      sitd_execute((ehci_sitd_t*) td);
+
+      link = ((ehci_sitd_t*) td)->next;
+
+    }
+
+  }
+
+}
+
+
+
+
+
+
+
+
+
+typedef struct
+
+{
+
+  uint8_t* buffer;
+
+  uint16_t xferred_bytes;
+
+  xfer_result_t result;
+
+} cb_record_t;
+
+
+
+static cb_record_t record[32];
+
+static uint8_t record_count;
+
+static uint16_t next_len;
+
+
+
+static uint16_t stream_cb(uint8_t dev_addr, uint8_t ep_addr, uint8_t* buf, uint16_t xferred_bytes, xfer_result_t result)
+
+{
+
+  (void) dev_addr; (void) ep_addr;
+
+
+
+  UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)((( sizeof(record) / sizeof(record[0]) ))), (UNITY_INT)((record_count)), UNITY_SMALLER_THAN, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(151), UNITY_DISPLAY_STYLE_INT);
+
+  record[record_count++] = (cb_record_t) { buf, xferred_bytes, result };
+
+
+
+  return next_len;
+
+}
+
+
+
+static tusb_desc_endpoint_t ep_desc(uint8_t ep_addr, uint16_t size, uint8_t mult, uint8_t interval)
+
+{
+
+  tusb_desc_endpoint_t desc =
+
+  {
+
+    .bLength = sizeof(tusb_desc_endpoint_t),
+
+    .bDescriptorType = TUSB_DESC_ENDPOINT,
+
+    .bEndpointAddress = ep_addr,
+
+    .bmAttributes = { .xfer = TUSB_XFER_ISOCHRONOUS },
+
+    .wMaxPacketSize = { .size = size, .hs_period_mult = mult },
+
+    .bInterval = interval
+
+  };
+
+  return desc;
+
+}
+
+
+
+static ehci_link_t link_of(void const* td, uint8_t type)
+
+{
+
+  return (ehci_link_t) { .address = addr32(td) | (type << 1) };
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  for(uint32_t i=0; i<(1024 >> 5); i++) framelist[i].address = QHD_TAIL;
+
+  ehci_iso_init(framelist);
+
+
+
+  memset(buffer, 0, sizeof(buffer));
+
+  memset(record, 0, sizeof(record));
+
+  record_count = 0;
+
+  next_len = 0;
+
+  device_len = 0;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_open_highspeed_micro_frames(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  if ((((stream)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(200))));};
+
+  if ((stream->is_highspeed)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(201)));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0xFF)), (UNITY_INT)(UNITY_INT8 )((stream->smask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(202), UNITY_DISPLAY_STYLE_HEX8);
+
+  UnityAssertEqualNumber((UNITY_INT)((512)), (UNITY_INT)((stream->xact_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(203), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  desc = ep_desc(0x02, 1024, 2, 3);
+
+  stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  if ((((stream)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(209))));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x11)), (UNITY_INT)(UNITY_INT8 )((stream->smask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(210), UNITY_DISPLAY_STYLE_HEX8);
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((stream->mult)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(211), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((3072)), (UNITY_INT)((stream->xact_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(212), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_open_unsupported(void)
+
+{
+
+
+
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 5);
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(219))));};
+
+
+
+  desc = ep_desc(0x81, 192, 0, 2);
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_FULL, 2, 1, &desc))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(222))));};
+
+
+
+
+
+  desc = ep_desc(0x81, 1000, 0, 1);
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_FULL, 2, 1, &desc))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(226))));};
+
+
+
+
+
+  desc = ep_desc(0x81, 512, 0, 1);
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc))) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(230))));};
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(231))));};
+
+
+
+  for(uint8_t i=1; i<2; i++)
+
+  {
+
+    desc = ep_desc(0x81 + i, 512, 0, 1);
+
+    if ((((ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(236))));};
+
+  }
+
+
+
+  desc = ep_desc(0x02, 512, 0, 1);
+
+  if ((((ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(240))));};
+
+}
+
+
+
+void test_open_split_masks(void)
+
+{
+
+
+
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 192, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_FULL, 2, 3, &desc);
+
+
+
+  if ((((stream)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(249))));};
+
+  if (!(stream->is_highspeed)) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(250)));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x01)), (UNITY_INT)(UNITY_INT8 )((stream->smask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(251), UNITY_DISPLAY_STYLE_HEX8);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x3C)), (UNITY_INT)(UNITY_INT8 )((stream->cmask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(252), UNITY_DISPLAY_STYLE_HEX8);
+
+
+
+
+
+  desc = ep_desc(0x02, 600, 0, 1);
+
+  stream = ehci_iso_open(1, TUSB_SPEED_FULL, 2, 3, &desc);
+
+
+
+  if ((((stream)) != 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(258))));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x0F)), (UNITY_INT)(UNITY_INT8 )((stream->smask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(259), UNITY_DISPLAY_STYLE_HEX8);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x00)), (UNITY_INT)(UNITY_INT8 )((stream->cmask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(260), UNITY_DISPLAY_STYLE_HEX8);
+
+}
+
+
+
+
+
+
+
+
+
+void test_start_queues_frames_ahead(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x83, 512, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(5, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  if ((ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(271)));};
+
+
+
+  for(uint32_t f=100; f<100+(1024 >> 5); f++)
+
+  {
+
+    ehci_link_t const link = framelist[f % (1024 >> 5)];
+
+
+
+    if ( f < 102 || f >= 102 + 8 )
+
+    {
+
+      UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((link.address)), (
+
+     ((void *)0)
+
+     ), (UNITY_UINT)(279), UNITY_DISPLAY_STYLE_HEX32);
+
+    }else
+
+    {
+
+      ehci_itd_t const* itd = &stream->itd[f-102];
+
+      UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(itd, EHCI_QTYPE_ITD).address)), (UNITY_INT)(UNITY_INT32)((link.address)), (
+
+     ((void *)0)
+
+     ), (UNITY_UINT)(283), UNITY_DISPLAY_STYLE_HEX32);
+
+      UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((itd->next.address)), (
+
+     ((void *)0)
+
+     ), (UNITY_UINT)(284), UNITY_DISPLAY_STYLE_HEX32);
+
+    }
+
+  }
+
+
+
+
+
+  ehci_itd_t const* itd = &stream->itd[1];
+
+  uint32_t const addr = addr32(buffer[0] + 1024);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((itd->xact[0].active)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(292), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((512)), (UNITY_INT)((itd->xact[0].length)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(293), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((addr & 0xFFF)), (UNITY_INT)((itd->xact[0].offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(294), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((itd->xact[0].int_on_complete)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(295), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((itd->xact[1].active)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(297), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((512)), (UNITY_INT)((itd->xact[1].length)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(298), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(((addr + 512) & ~0xFFFUL)), (UNITY_INT)(UNITY_INT32)((itd->BufferPointer[itd->xact[1].page_select] & ~0xFFFUL)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(299), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(((addr + 512) & 0xFFF)), (UNITY_INT)((itd->xact[1].offset)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(300), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((itd->xact[1].int_on_complete)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(301), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((itd->xact[2].active)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(303), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(((3 << 8) | 5)), (UNITY_INT)(UNITY_INT32)((itd->BufferPointer[0] & 0xFFF)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(305), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(((1U << (11)) | 512)), (UNITY_INT)(UNITY_INT32)((itd->BufferPointer[1] & 0xFFF)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(306), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((1)), (UNITY_INT)(UNITY_INT32)((itd->BufferPointer[2] & 0xFFF)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(307), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_restart_waits_stop_frame_over(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x83, 512, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(5, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  if ((ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(315)));};
+
+  ehci_iso_stop(stream, 105);
+
+
+
+  for(uint32_t i=0; i<(1024 >> 5); i++) UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((framelist[i].address)), (
+
+                                               ((void *)0)
+
+                                               ), (UNITY_UINT)(318), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+
+
+  if (!(ehci_iso_unlinked(stream, 106))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(321)));};
+
+  if (!(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 106))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(322)));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((framelist[108 % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(323), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+  if ((ehci_iso_unlinked(stream, 107))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(325)));};
+
+  if ((ehci_iso_start(stream, buffer[0], 1024, stream_cb, 107))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(326)));};
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&stream->itd[0], EHCI_QTYPE_ITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[109 % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(327), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_isr_reports_and_rearms(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  if ((ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(335)));};
+
+
+
+
+
+  ehci_iso_isr(102);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(339), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  device_len = 100;
+
+  next_len = 600;
+
+  hc_run_frame(102);
+
+  ehci_iso_isr(103);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(347), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT64)((buffer[0])), (UNITY_INT64)((record[0].buffer)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(348), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((XFER_RESULT_SUCCESS)), (UNITY_INT)((record[0].result)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(349), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((200)), (UNITY_INT)((record[0].xferred_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(350), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_INT8 )((0xA0)), 1), ( const void*)((buffer[0])), (UNITY_UINT32)((100)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(351), UNITY_DISPLAY_STYLE_HEX8, UNITY_ARRAY_TO_VAL);
+
+  UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_INT8 )((0xA1)), 1), ( const void*)((buffer[0] + 100)), (UNITY_UINT32)((100)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(352), UNITY_DISPLAY_STYLE_HEX8, UNITY_ARRAY_TO_VAL);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((framelist[102 % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(355), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&stream->itd[0], EHCI_QTYPE_ITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[(102 + 8) % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(356), UNITY_DISPLAY_STYLE_HEX32)
+
+                                                                                                    ;
+
+  UnityAssertEqualNumber((UNITY_INT)((600)), (UNITY_INT)((stream->itd[0].xact[0].length + stream->itd[0].xact[1].length)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(358), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  device_len = 512;
+
+  next_len = 1024;
+
+  for(uint32_t f=103; f<102 + 8; f++) hc_run_frame(f);
+
+  ehci_iso_isr(102 + 8);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((8)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(366), UNITY_DISPLAY_STYLE_INT);
+
+  for(uint8_t k=1; k<8; k++)
+
+  {
+
+    UnityAssertEqualNumber((UNITY_INT64)((buffer[0] + 1024*k)), (UNITY_INT64)((record[k].buffer)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(369), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((UNITY_INT)((1024)), (UNITY_INT)((record[k].xferred_bytes)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(370), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((XFER_RESULT_SUCCESS)), (UNITY_INT)((record[k].result)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(371), UNITY_DISPLAY_STYLE_INT);
+
+  }
+
+}
+
+
+
+void test_isr_late_skips_ahead(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x01, 512, 0, 2);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  next_len = 512;
+
+  if ((ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(381)));};
+
+
+
+
+
+  ehci_iso_isr(300);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((8)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(386), UNITY_DISPLAY_STYLE_INT);
+
+  for(uint8_t k=0; k<8; k++)
+
+  {
+
+    UnityAssertEqualNumber((UNITY_INT)((XFER_RESULT_FAILED)), (UNITY_INT)((record[k].result)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(389), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((record[k].xferred_bytes)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(390), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((302 + k)), (UNITY_INT)((stream->frame[k])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(391), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((512)), (UNITY_INT)((stream->itd[k].xact[0].length)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(394), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((stream->itd[k].xact[2].active)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(395), UNITY_DISPLAY_STYLE_INT);
+
+  }
+
+
+
+  for(uint32_t f=0; f<(1024 >> 5); f++)
+
+  {
+
+    uint32_t const frame = 300 + f;
+
+    
+
+   _Bool 
+
+        const queued = (frame >= 302) && (frame < 302 + 8);
+
+    UnityAssertEqualNumber((UNITY_INT)((queued)), (UNITY_INT)((framelist[frame % (1024 >> 5)].address != QHD_TAIL)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(402), UNITY_DISPLAY_STYLE_INT);
+
+  }
+
+}
+
+
+
+void test_split_out_descriptor(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x02, 600, 0, 1);
+
+  ehci_iso_stream_t* stream = ehci_iso_open(4, TUSB_SPEED_FULL, 2, 3, &desc);
+
+
+
+  if ((ehci_iso_start(stream, buffer[0], 400, stream_cb, 0))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(411)));};
+
+
+
+  ehci_sitd_t const* sitd = &stream->sitd[0];
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(sitd, EHCI_QTYPE_SITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[2].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(414), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((sitd->dev_addr)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(416), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((sitd->ep_number)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(417), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((sitd->hub_addr)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(418), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((sitd->port_number)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(419), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((sitd->direction)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(420), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((0x0F)), (UNITY_INT)(UNITY_INT8 )((sitd->int_smask)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(421), UNITY_DISPLAY_STYLE_HEX8);
+
+  UnityAssertEqualNumber((UNITY_INT)((400)), (UNITY_INT)((sitd->total_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(422), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((sitd->active)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(423), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((sitd->int_on_complete)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(424), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((sitd->back.terminate)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(425), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((addr32(buffer[0]))), (UNITY_INT)(UNITY_INT32)((sitd->buffer[0])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(428), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(((1 << 3) | 3)), (UNITY_INT)(UNITY_INT32)((sitd->buffer[1] & 0x1F)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(429), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+  next_len = 100;
+
+  hc_run_frame(2);
+
+  ehci_iso_isr(3);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(435), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((400)), (UNITY_INT)((record[0].xferred_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(436), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((100)), (UNITY_INT)((sitd->total_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(437), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((1)), (UNITY_INT)(UNITY_INT32)((sitd->buffer[1] & 0x1F)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(438), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_streams_share_frames(void)
+
+{
+
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+
+  ehci_iso_stream_t* hs = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+
+
+  desc = ep_desc(0x82, 192, 0, 1);
+
+  ehci_iso_stream_t* fs = ehci_iso_open(2, TUSB_SPEED_FULL, 1, 1, &desc);
+
+
+
+
+
+  if ((ehci_iso_start(fs, buffer[1], 192, stream_cb, 101))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(450)));};
+
+  if ((ehci_iso_start(hs, buffer[0], 512, stream_cb, 100))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(451)));};
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&hs->itd[0], EHCI_QTYPE_ITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[102 % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(453), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((hs->itd[0].next.address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(454), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&hs->itd[1], EHCI_QTYPE_ITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[103 % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(456), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&fs->sitd[0], EHCI_QTYPE_SITD).address)), (UNITY_INT)(UNITY_INT32)((hs->itd[1].next.address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(457), UNITY_DISPLAY_STYLE_HEX32);
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((fs->sitd[0].next.address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(458), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+
+
+  device_len = 192;
+
+  next_len = 192;
+
+  hc_run_frame(102);
+
+  hc_run_frame(103);
+
+  ehci_iso_isr(104);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((record_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(467), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((192)), (UNITY_INT)((record[0].xferred_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(468), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((192)), (UNITY_INT)((record[1].xferred_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(469), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT64)((buffer[1])), (UNITY_INT64)((record[2].buffer)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(470), UNITY_DISPLAY_STYLE_HEX64);
+
+  UnityAssertEqualNumber((UNITY_INT)((192)), (UNITY_INT)((record[2].xferred_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(471), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_INT8 )((0x55)), 1), ( const void*)((buffer[1])), (UNITY_UINT32)((192)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(472), UNITY_DISPLAY_STYLE_HEX8, UNITY_ARRAY_TO_VAL);
+
+
+
+
+
+  ehci_iso_stop(hs, 104);
+
+
+
+  for(uint32_t f=104; f<104 + 8; f++)
+
+  {
+
+    uint8_t const k = (uint8_t) ((f - 103) % 8);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((link_of(&fs->sitd[k], EHCI_QTYPE_SITD).address)), (UNITY_INT)(UNITY_INT32)((framelist[f % (1024 >> 5)].address)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(480), UNITY_DISPLAY_STYLE_HEX32);
+
+  }
+
+  UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((framelist[(104 + 8) % (1024 >> 5)].address)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(482), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+  ehci_iso_close(fs);
+
+  for(uint32_t i=0; i<(1024 >> 5); i++) UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((QHD_TAIL)), (UNITY_INT)(UNITY_INT32)((framelist[i].address)), (
+
+                                               ((void *)0)
+
+                                               ), (UNITY_UINT)(485), UNITY_DISPLAY_STYLE_HEX32);
+
+}
@@ -0,0 +1,536 @@
+#include "_build/temp/_test_msc_host_cache.c"
+#include "../src/class/msc/msc_host_cache.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  DISK_BLOCK_NUM = 1024,
+
+  DISK_BLOCK_SIZE = 512
+
+};
+
+
+
+static uint8_t ram_disk[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+
+static uint8_t shadow[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+
+
+
+static uint32_t disk_reads, disk_writes;
+
+
+
+static 
+
+      _Bool 
+
+           ram_read(void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count)
+
+{
+
+  (void) ctx;
+
+  if ((lba + count <= DISK_BLOCK_NUM)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(51)));};
+
+
+
+  disk_reads++;
+
+  memcpy(buffer, ram_disk[lba], count*DISK_BLOCK_SIZE);
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           ram_write(void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count)
+
+{
+
+  (void) ctx;
+
+  if ((lba + count <= DISK_BLOCK_NUM)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(61)));};
+
+
+
+  disk_writes++;
+
+  memcpy(ram_disk[lba], buffer, count*DISK_BLOCK_SIZE);
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static tuh_msc_cache_backend_t const ram_backend = { .read = ram_read, .write = ram_write };
+
+
+
+static tuh_msc_cache_t cache;
+
+static uint8_t buf[16][DISK_BLOCK_SIZE];
+
+
+
+static void fill_sector(uint8_t* sector, uint32_t lba, uint32_t gen)
+
+{
+
+  for(uint32_t i=0; i<DISK_BLOCK_SIZE; i++) sector[i] = (uint8_t) (lba*7 + gen*13 + i);
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  for(uint32_t lba=0; lba<DISK_BLOCK_NUM; lba++) fill_sector(ram_disk[lba], lba, 0);
+
+  memcpy(shadow, ram_disk, sizeof(ram_disk));
+
+
+
+  disk_reads = disk_writes = 0;
+
+  tuh_msc_cache_init(&cache, &ram_backend, 
+
+                                          ((void *)0)
+
+                                              , DISK_BLOCK_NUM);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_read_hit(void)
+
+{
+
+  if ((tuh_msc_cache_read(&cache, 5, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(96)));};
+
+  if ((tuh_msc_cache_read(&cache, 100, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(97)));};
+
+  if ((tuh_msc_cache_read(&cache, 5, buf[2], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(98)));};
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(100), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((shadow[5])), ( const void*)((buf[2])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(101), UNITY_ARRAY_TO_ARRAY);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tuh_msc_cache_get_stats(&cache)->read_hits)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(102), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((tuh_msc_cache_get_stats(&cache)->read_misses)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(103), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((33)), (UNITY_INT)((tuh_msc_cache_hit_rate(&cache))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(104), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_readahead_sequential(void)
+
+{
+
+  for(uint32_t lba=10; lba<10+8 +1; lba++)
+
+  {
+
+    if ((tuh_msc_cache_read(&cache, lba, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(111)));};
+
+    UnityAssertEqualMemory(( const void*)((shadow[lba])), ( const void*)((buf[0])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(112), UNITY_ARRAY_TO_ARRAY);
+
+  }
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(116), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((8 -1)), (UNITY_INT)((tuh_msc_cache_get_stats(&cache)->readahead_hits)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(117), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_readahead_limited_by_block_count(void)
+
+{
+
+  if ((tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-3, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(122)));};
+
+  if ((tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-2, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(123)));};
+
+  if ((tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-1, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(124)));};
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(126), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((shadow[DISK_BLOCK_NUM-1])), ( const void*)((buf[0])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(127), UNITY_ARRAY_TO_ARRAY);
+
+}
+
+
+
+void test_write_coalesce(void)
+
+{
+
+  for(uint32_t lba=23; lba>=20; lba--)
+
+  {
+
+    fill_sector(buf[0], lba, 1);
+
+    if ((tuh_msc_cache_write(&cache, lba, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(135)));};
+
+    memcpy(shadow[lba], buf[0], DISK_BLOCK_SIZE);
+
+  }
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((disk_writes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(139), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  if ((tuh_msc_cache_sync(&cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(141)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((disk_writes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(142), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((tuh_msc_cache_get_stats(&cache)->device_write_sectors)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(143), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((shadow)), ( const void*)((ram_disk)), (UNITY_UINT32)((sizeof(ram_disk))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(144), UNITY_ARRAY_TO_ARRAY);
+
+
+
+
+
+  if ((tuh_msc_cache_sync(&cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(147)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((disk_writes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(148), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_multiple_read_sees_dirty_sector(void)
+
+{
+
+  fill_sector(buf[0], 30, 1);
+
+  if ((tuh_msc_cache_write(&cache, 30, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(154)));};
+
+  memcpy(shadow[30], buf[0], DISK_BLOCK_SIZE);
+
+
+
+  if ((tuh_msc_cache_read(&cache, 28, buf[1], 6))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(157)));};
+
+  UnityAssertEqualMemory(( const void*)((shadow[28])), ( const void*)((buf[1])), (UNITY_UINT32)((6*DISK_BLOCK_SIZE)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(158), UNITY_ARRAY_TO_ARRAY);
+
+}
+
+
+
+void test_multiple_write_updates_line(void)
+
+{
+
+  if ((tuh_msc_cache_read(&cache, 50, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(163)));};
+
+
+
+  for(uint32_t i=0; i<4; i++) fill_sector(buf[i], 48+i, 2);
+
+  if ((tuh_msc_cache_write(&cache, 48, buf[0], 4))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(166)));};
+
+  memcpy(shadow[48], buf[0], 4*DISK_BLOCK_SIZE);
+
+
+
+  if ((tuh_msc_cache_read(&cache, 50, buf[8], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(169)));};
+
+  UnityAssertEqualMemory(( const void*)((shadow[50])), ( const void*)((buf[8])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(170), UNITY_ARRAY_TO_ARRAY);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(171), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_lru_eviction(void)
+
+{
+
+
+
+  for(uint32_t i=0; i<16 +4; i++)
+
+  {
+
+    if ((tuh_msc_cache_read(&cache, 0, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(179)));};
+
+    if ((tuh_msc_cache_read(&cache, 200 + 2*i, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(180)));};
+
+  }
+
+
+
+  uint32_t const reads = disk_reads;
+
+  if ((tuh_msc_cache_read(&cache, 0, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(184)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((reads)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(185), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  if ((tuh_msc_cache_read(&cache, 200, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(188)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((reads+1)), (UNITY_INT)((disk_reads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(189), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_dirty_eviction_writes_back(void)
+
+{
+
+  fill_sector(buf[0], 300, 3);
+
+  if ((tuh_msc_cache_write(&cache, 300, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(195)));};
+
+  memcpy(shadow[300], buf[0], DISK_BLOCK_SIZE);
+
+
+
+  for(uint32_t i=0; i<16; i++)
+
+  {
+
+    if ((tuh_msc_cache_read(&cache, 400 + 2*i, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(200)));};
+
+  }
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((disk_writes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(203), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((shadow[300])), ( const void*)((ram_disk[300])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(204), UNITY_ARRAY_TO_ARRAY);
+
+}
+
+
+
+
+
+void test_random_consistency(void)
+
+{
+
+  srand(1234);
+
+
+
+  for(uint32_t n=0; n<5000; n++)
+
+  {
+
+    uint32_t const lba = (uint32_t) rand() % 64;
+
+    uint32_t const count = (rand() % 4) ? 1 : 1 + (uint32_t) rand() % 8;
+
+    uint32_t const op = (uint32_t) rand() % 3;
+
+
+
+    if ( op == 0 )
+
+    {
+
+      for(uint32_t i=0; i<count; i++) fill_sector(buf[i], lba+i, n);
+
+      if ((tuh_msc_cache_write(&cache, lba, buf[0], count))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(221)));};
+
+      memcpy(shadow[lba], buf[0], count*DISK_BLOCK_SIZE);
+
+    }
+
+    else
+
+    {
+
+      if ((tuh_msc_cache_read(&cache, lba, buf[0], count))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(226)));};
+
+      UnityAssertEqualMemory(( const void*)((shadow[lba])), ( const void*)((buf[0])), (UNITY_UINT32)((count*DISK_BLOCK_SIZE)), 1, (
+
+     ((void *)0)
+
+     ), (UNITY_UINT)(227), UNITY_ARRAY_TO_ARRAY);
+
+    }
+
+
+
+    if ( (n % 1000) == 999 )
+
+    {
+
+      if ((tuh_msc_cache_sync(&cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(232)));};
+
+    }
+
+  }
+
+
+
+  if ((tuh_msc_cache_sync(&cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(236)));};
+
+  UnityAssertEqualMemory(( const void*)((shadow)), ( const void*)((ram_disk)), (UNITY_UINT32)((sizeof(ram_disk))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(237), UNITY_ARRAY_TO_ARRAY);
+
+}
@@ -0,0 +1,402 @@
+#include "_build/temp/_test_msc_host_cache_bench.c"
+#include "../src/class/msc/msc_host_cache.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  DISK_BLOCK_NUM = 1024,
+
+  DISK_BLOCK_SIZE = 512
+
+};
+
+
+
+static uint8_t ram_disk[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+
+static uint8_t shadow[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+
+
+
+static uint32_t disk_reads, disk_writes, disk_sectors;
+
+
+
+static 
+
+      _Bool 
+
+           ram_read(void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count)
+
+{
+
+  (void) ctx;
+
+  if ((lba + count <= DISK_BLOCK_NUM)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(52)));};
+
+
+
+  disk_reads++;
+
+  disk_sectors += count;
+
+  memcpy(buffer, ram_disk[lba], count*DISK_BLOCK_SIZE);
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           ram_write(void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count)
+
+{
+
+  (void) ctx;
+
+  if ((lba + count <= DISK_BLOCK_NUM)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(63)));};
+
+
+
+  disk_writes++;
+
+  disk_sectors += count;
+
+  memcpy(ram_disk[lba], buffer, count*DISK_BLOCK_SIZE);
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static tuh_msc_cache_backend_t const ram_backend = { .read = ram_read, .write = ram_write };
+
+
+
+static tuh_msc_cache_t cache;
+
+static uint8_t buf[2][DISK_BLOCK_SIZE];
+
+
+
+static void fill_sector(uint8_t* sector, uint32_t lba, uint32_t gen)
+
+{
+
+  for(uint32_t i=0; i<DISK_BLOCK_SIZE; i++) sector[i] = (uint8_t) (lba*7 + gen*13 + i);
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  for(uint32_t lba=0; lba<DISK_BLOCK_NUM; lba++) fill_sector(ram_disk[lba], lba, 0);
+
+  memcpy(shadow, ram_disk, sizeof(ram_disk));
+
+
+
+  disk_reads = disk_writes = disk_sectors = 0;
+
+  tuh_msc_cache_init(&cache, &ram_backend, 
+
+                                          ((void *)0)
+
+                                              , DISK_BLOCK_NUM);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  FAT_LBA = 32,
+
+  DIR_LBA = 64,
+
+  DATA_LBA = 128,
+
+  FILE_SECTORS = 256
+
+};
+
+
+
+typedef struct
+
+{
+
+  
+
+ _Bool 
+
+      (* read ) (void* ctx, uint64_t lba, void* buffer, uint32_t count);
+
+  
+
+ _Bool 
+
+      (* write) (void* ctx, uint64_t lba, void const* buffer, uint32_t count);
+
+  void* ctx;
+
+} bench_io_t;
+
+
+
+
+
+static 
+
+      _Bool 
+
+           direct_read(void* ctx, uint64_t lba, void* buffer, uint32_t count)
+
+{
+
+  return ram_read(ctx, lba, (uint8_t*) buffer, count);
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           direct_write(void* ctx, uint64_t lba, void const* buffer, uint32_t count)
+
+{
+
+  return ram_write(ctx, lba, (uint8_t const*) buffer, count);
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           cache_read(void* ctx, uint64_t lba, void* buffer, uint32_t count)
+
+{
+
+  return tuh_msc_cache_read((tuh_msc_cache_t*) ctx, lba, buffer, count);
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           cache_write(void* ctx, uint64_t lba, void const* buffer, uint32_t count)
+
+{
+
+  return tuh_msc_cache_write((tuh_msc_cache_t*) ctx, lba, buffer, count);
+
+}
+
+
+
+static void bench_workload(bench_io_t const* io)
+
+{
+
+
+
+  if ((io->read(io->ctx, DIR_LBA, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(137)));};
+
+
+
+
+
+  for(uint32_t i=0; i<FILE_SECTORS; i++)
+
+  {
+
+    if ( (i % 16) == 0 ) if ((io->read(io->ctx, FAT_LBA + i/128, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(142)));};
+
+    if ((io->read(io->ctx, DATA_LBA + i, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(143)));};
+
+    UnityAssertEqualMemory(( const void*)((shadow[DATA_LBA+i])), ( const void*)((buf[0])), (UNITY_UINT32)((DISK_BLOCK_SIZE)), 1, (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(144), UNITY_ARRAY_TO_ARRAY);
+
+  }
+
+
+
+
+
+  for(uint32_t i=0; i<FILE_SECTORS/2; i++)
+
+  {
+
+    fill_sector(buf[0], DATA_LBA + FILE_SECTORS + i, 5);
+
+    if ((io->write(io->ctx, DATA_LBA + FILE_SECTORS + i, buf[0], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(151)));};
+
+    memcpy(shadow[DATA_LBA + FILE_SECTORS + i], buf[0], DISK_BLOCK_SIZE);
+
+
+
+    if ( (i % 16) == 15 )
+
+    {
+
+      if ((io->read (io->ctx, FAT_LBA + 2, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(156)));};
+
+      buf[1][i/16] = 0xAA;
+
+      if ((io->write(io->ctx, FAT_LBA + 2, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(158)));};
+
+      memcpy(shadow[FAT_LBA + 2], buf[1], DISK_BLOCK_SIZE);
+
+
+
+      if ((io->read (io->ctx, DIR_LBA, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(161)));};
+
+      buf[1][0] = (uint8_t) i;
+
+      if ((io->write(io->ctx, DIR_LBA, buf[1], 1))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(163)));};
+
+      memcpy(shadow[DIR_LBA], buf[1], DISK_BLOCK_SIZE);
+
+    }
+
+  }
+
+}
+
+
+
+static uint32_t bench_cost_us(void)
+
+{
+
+  return (disk_reads + disk_writes)*1000 + disk_sectors*40;
+
+}
+
+
+
+void test_benchmark_fat_workload(void)
+
+{
+
+  bench_io_t const direct = { .read = direct_read, .write = direct_write, .ctx = 
+
+                                                                                ((void *)0) 
+
+                                                                                     };
+
+  bench_workload(&direct);
+
+  UnityAssertEqualMemory(( const void*)((shadow)), ( const void*)((ram_disk)), (UNITY_UINT32)((sizeof(ram_disk))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(178), UNITY_ARRAY_TO_ARRAY);
+
+
+
+  uint32_t const direct_cmds = disk_reads + disk_writes;
+
+  uint32_t const direct_cost = bench_cost_us();
+
+
+
+  setUp();
+
+  bench_io_t const cached = { .read = cache_read, .write = cache_write, .ctx = &cache };
+
+  bench_workload(&cached);
+
+  if ((tuh_msc_cache_sync(&cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(186)));};
+
+  UnityAssertEqualMemory(( const void*)((shadow)), ( const void*)((ram_disk)), (UNITY_UINT32)((sizeof(ram_disk))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(187), UNITY_ARRAY_TO_ARRAY);
+
+
+
+  uint32_t const cached_cmds = disk_reads + disk_writes;
+
+  uint32_t const cached_cost = bench_cost_us();
+
+
+
+  char msg[160];
+
+  snprintf(msg, sizeof(msg), "commands %lu -> %lu, estimated %lu ms -> %lu ms, read hit rate %u%%",
+
+           (unsigned long) direct_cmds, (unsigned long) cached_cmds,
+
+           (unsigned long) direct_cost/1000, (unsigned long) cached_cost/1000, tuh_msc_cache_hit_rate(&cache));
+
+  UnityMessage((msg), 196);
+
+
+
+  if ((cached_cmds*4 < direct_cmds)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(198)));};
+
+  if ((tuh_msc_cache_hit_rate(&cache) >= 80)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(199)));};
+
+}
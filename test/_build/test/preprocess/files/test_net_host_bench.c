@@ -0,0 +1,298 @@
+#include "_build/temp/_test_net_host_bench.c"
+#include "../src/class/net/net_host_frame.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  BUFSIZE = 8192,
+
+  FRAME_COUNT = 2000,
+
+  XFER_COST_US = 250,
+
+  BYTES_PER_US = 40
+
+};
+
+
+
+static uint8_t buffer[BUFSIZE] __attribute__ ((aligned(4)));
+
+static uint8_t frame[1514];
+
+
+
+
+
+static uint16_t const mix_len[] = { 60, 590, 1514, 1024, 1000, 64, 1514, 1514, 512, 42 };
+
+
+
+typedef struct
+
+{
+
+  uint32_t xfers;
+
+  uint32_t bytes;
+
+  uint32_t frames;
+
+} bench_result_t;
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+static uint16_t bench_frame_len(uint32_t index)
+
+{
+
+  return mix_len[index % ( sizeof(mix_len) / sizeof(mix_len[0]) )];
+
+}
+
+
+
+static void bench_fill(uint8_t* p, uint32_t index)
+
+{
+
+  uint16_t const len = bench_frame_len(index);
+
+  for(uint16_t i=0; i<len; i++) p[i] = (uint8_t) (index + i);
+
+}
+
+
+
+
+
+static void bench_echo(neth_tx_param_t const* param, uint16_t len, bench_result_t* result)
+
+{
+
+  neth_rx_cursor_t cursor = { 0 };
+
+  uint8_t const* p;
+
+  uint16_t flen;
+
+
+
+  while ( neth_rx_frame_next(param->protocol, buffer, len, &cursor, &p, &flen) )
+
+  {
+
+    uint32_t const index = result->frames;
+
+    bench_fill(frame, index);
+
+    UnityAssertEqualNumber((UNITY_INT)((bench_frame_len(index))), (UNITY_INT)((flen)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(91), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualMemory(( const void*)((frame)), ( const void*)((p)), (UNITY_UINT32)((flen)), 1, (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(92), UNITY_ARRAY_TO_ARRAY);
+
+    result->frames++;
+
+  }
+
+
+
+  result->xfers += 2;
+
+  result->bytes += 2u*len;
+
+}
+
+
+
+static bench_result_t bench_run(neth_tx_param_t const* param)
+
+{
+
+  bench_result_t result = { 0 };
+
+  neth_tx_block_t block;
+
+  uint16_t sequence = 0;
+
+
+
+  neth_tx_block_init(param, &block, buffer);
+
+
+
+  for(uint32_t i=0; i<FRAME_COUNT; i++)
+
+  {
+
+    uint16_t const len = bench_frame_len(i);
+
+
+
+
+
+    if ( !neth_tx_block_fits(param, &block, len) )
+
+    {
+
+      uint16_t const xfer_len = neth_tx_block_finalize(param, &block, buffer, sequence++);
+
+      bench_echo(param, xfer_len, &result);
+
+      neth_tx_block_init(param, &block, buffer);
+
+    }
+
+
+
+    uint8_t* p = neth_tx_block_add(param, &block, buffer, len);
+
+    if ((((p)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(121))));};
+
+    bench_fill(p, i);
+
+  }
+
+
+
+  bench_echo(param, neth_tx_block_finalize(param, &block, buffer, sequence), &result);
+
+  UnityAssertEqualNumber((UNITY_INT)((FRAME_COUNT)), (UNITY_INT)((result.frames)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(126), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  return result;
+
+}
+
+
+
+
+
+static uint32_t bench_report(char const* name, bench_result_t const* result)
+
+{
+
+  uint32_t const cost_us = result->xfers*XFER_COST_US + result->bytes/BYTES_PER_US;
+
+  uint32_t const rate = (FRAME_COUNT*1000000UL) / cost_us;
+
+
+
+  char msg[160];
+
+  snprintf(msg, sizeof(msg), "%-5s %lu frames in %lu transfers, %lu bytes, estimated %lu ms, %lu frames/s",
+
+           name, (unsigned long) result->frames, (unsigned long) result->xfers, (unsigned long) result->bytes,
+
+           (unsigned long) cost_us/1000, (unsigned long) rate);
+
+  UnityMessage((msg), 141);
+
+
+
+  return rate;
+
+}
+
+
+
+void test_benchmark_aggregation(void)
+
+{
+
+  neth_tx_param_t const param_ecm = { .max_len = 1514, .max_count = 1, .protocol = NETH_PROTOCOL_ECM };
+
+  neth_tx_param_t const param_ncm = { .max_len = BUFSIZE, .max_count = 8, .protocol = NETH_PROTOCOL_NCM,
+
+                                        .divisor = 4, .remainder = 2, .ndp_alignment = 4 };
+
+  neth_tx_param_t const param_rndis = { .max_len = BUFSIZE, .max_count = 8, .protocol = NETH_PROTOCOL_RNDIS,
+
+                                        .divisor = 8 };
+
+
+
+  bench_result_t const ecm = bench_run(&param_ecm);
+
+  bench_result_t const ncm = bench_run(&param_ncm);
+
+  bench_result_t const rndis = bench_run(&param_rndis);
+
+
+
+  uint32_t const ecm_rate = bench_report("ECM" , &ecm);
+
+  uint32_t const ncm_rate = bench_report("NCM" , &ncm);
+
+  uint32_t const rndis_rate = bench_report("RNDIS", &rndis);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((2*FRAME_COUNT)), (UNITY_INT)((ecm.xfers)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(163), UNITY_DISPLAY_STYLE_INT);
+
+  if ((ncm.xfers*4 < ecm.xfers)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(164)));};
+
+  if ((rndis.xfers*4 < ecm.xfers)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(165)));};
+
+  if ((ncm_rate >= 3*ecm_rate)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(166)));};
+
+  if ((rndis_rate >= 3*ecm_rate)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(167)));};
+
+}
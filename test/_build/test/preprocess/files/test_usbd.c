@@ -0,0 +1,1343 @@
+#include "@@@@usbd_control.c"
+#include "../src/device/usbd_control.c"
+#include "_build/temp/_test_usbd.c"
+#include "_build/test/mocks/mock_msc_device.h"
+#include "_build/test/mocks/mock_dcd.h"
+#include "../src/device/usbd_pvt.h"
+#include "../src/device/usbd.h"
+#include "../src/tusb.h"
+#include "../src/common/tusb_fifo.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  EDPT_CTRL_OUT = 0x00,
+
+  EDPT_CTRL_IN = 0x80
+
+};
+
+
+
+uint8_t const rhport = 0;
+
+
+
+tusb_desc_device_t const data_desc_device =
+
+{
+
+    .bLength = sizeof(tusb_desc_device_t),
+
+    .bDescriptorType = TUSB_DESC_DEVICE,
+
+    .bcdUSB = 0x0200,
+
+
+
+
+
+
+
+    .bDeviceClass = TUSB_CLASS_MISC,
+
+    .bDeviceSubClass = MISC_SUBCLASS_COMMON,
+
+    .bDeviceProtocol = MISC_PROTOCOL_IAD,
+
+
+
+    .bMaxPacketSize0 = 64,
+
+
+
+    .idVendor = 0xCafe,
+
+    .idProduct = 0xCafe,
+
+    .bcdDevice = 0x0100,
+
+
+
+    .iManufacturer = 0x01,
+
+    .iProduct = 0x02,
+
+    .iSerialNumber = 0x03,
+
+
+
+    .bNumConfigurations = 0x01
+
+};
+
+
+
+uint8_t const data_desc_configuration[] =
+
+{
+
+
+
+  9, TUSB_DESC_CONFIGURATION, ((uint8_t) (((9)) & 0x00ff)), ((uint8_t) ((((9)) >> 8) & 0x00ff)), 0, 1, 0, (1U << (7)) | TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP, (100)/2,
+
+};
+
+
+
+tusb_control_request_t const req_get_desc_device =
+
+{
+
+  .bmRequestType = 0x80,
+
+  .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+
+  .wValue = (TUSB_DESC_DEVICE << 8),
+
+  .wIndex = 0x0000,
+
+  .wLength = 64
+
+};
+
+
+
+tusb_control_request_t const req_get_desc_configuration =
+
+{
+
+  .bmRequestType = 0x80,
+
+  .bRequest = TUSB_REQ_GET_DESCRIPTOR,
+
+  .wValue = (TUSB_DESC_CONFIGURATION << 8),
+
+  .wIndex = 0x0000,
+
+  .wLength = 256
+
+};
+
+
+
+tusb_control_request_t const req_set_configuration =
+
+{
+
+  .bmRequestType = 0x00,
+
+  .bRequest = TUSB_REQ_SET_CONFIGURATION,
+
+  .wValue = 1,
+
+  .wIndex = 0x0000,
+
+  .wLength = 0
+
+};
+
+
+
+uint8_t const* desc_device;
+
+uint8_t const* desc_configuration;
+
+
+
+
+
+uint32_t bulk_count;
+
+uint32_t bulk_count_at_setup;
+
+
+
+
+
+
+
+
+
+uint8_t const * tud_descriptor_device_cb(void)
+
+{
+
+  bulk_count_at_setup = bulk_count;
+
+  return desc_device;
+
+}
+
+
+
+uint8_t const * tud_descriptor_configuration_cb(uint8_t index)
+
+{
+
+  return desc_configuration;
+
+}
+
+
+
+uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid)
+
+{
+
+  (void) langid;
+
+
+
+  return 
+
+        ((void *)0)
+
+            ;
+
+}
+
+
+
+
+
+uint32_t clock_ms;
+
+uint32_t idle_count;
+
+uint32_t idle_timeout[8];
+
+uint32_t idle_defer_at;
+
+uint32_t defer_count;
+
+
+
+uint32_t tud_time_millis_cb(void)
+
+{
+
+  return clock_ms;
+
+}
+
+
+
+static void defer_func(void* param)
+
+{
+
+  (void) param;
+
+  defer_count++;
+
+}
+
+
+
+void tud_idle_cb(uint32_t timeout_ms)
+
+{
+
+  if ( idle_count < ( sizeof(idle_timeout) / sizeof(idle_timeout[0]) ) ) idle_timeout[idle_count] = timeout_ms;
+
+  idle_count++;
+
+
+
+  clock_ms += 3;
+
+  if ( idle_count == idle_defer_at ) usbd_defer_func(defer_func, 
+
+                                                                ((void *)0)
+
+                                                                    , 
+
+                                                                      1
+
+                                                                          );
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  clock_ms = 1000;
+
+  idle_count = 0;
+
+  idle_defer_at = 0;
+
+  defer_count = 0;
+
+
+
+  dcd_int_disable_CMockIgnore();
+
+  dcd_int_enable_CMockIgnore();
+
+
+
+  if ( !tusb_inited() )
+
+  {
+
+    mscd_init_CMockExpect(175);
+
+    dcd_init_CMockExpect(176, 0);
+
+    dcd_connect_CMockExpect(177, 0);
+
+    dcd_init_CMockExpect(178, 1);
+
+    dcd_connect_CMockExpect(179, 1);
+
+    tusb_init();
+
+  }
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+void test_usbd_get_device_descriptor(void)
+
+{
+
+  desc_device = (uint8_t const *) &data_desc_device;
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_get_desc_device, 
+
+                                                                   0
+
+                                                                        );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(199, rhport, 0x80, (uint8_t*)&data_desc_device, sizeof(tusb_desc_device_t), sizeof(tusb_desc_device_t), 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, sizeof(tusb_desc_device_t), 0, 
+
+                                                                              0
+
+                                                                                   );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(203, rhport, EDPT_CTRL_OUT, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_OUT, 0, 0, 
+
+                                                      0
+
+                                                           );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(205, rhport, &req_get_desc_device, 1);
+
+
+
+  tud_task();
+
+}
+
+
+
+void test_usbd_get_device_descriptor_null(void)
+
+{
+
+  desc_device = 
+
+               ((void *)0)
+
+                   ;
+
+
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_get_desc_device, 
+
+                                                                   0
+
+                                                                        );
+
+
+
+  dcd_edpt_stall_CMockExpect(216, rhport, EDPT_CTRL_OUT);
+
+  dcd_edpt_stall_CMockExpect(217, rhport, EDPT_CTRL_IN);
+
+
+
+  tud_task();
+
+}
+
+
+
+
+
+
+
+void test_usbd_get_configuration_descriptor(void)
+
+{
+
+  desc_configuration = data_desc_configuration;
+
+  uint16_t total_len = ((tusb_desc_configuration_t const*) data_desc_configuration)->wTotalLength;
+
+
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_get_desc_configuration, 
+
+                                                                          0
+
+                                                                               );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(232, rhport, 0x80, (uint8_t*) data_desc_configuration, total_len, total_len, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, total_len, 0, 
+
+                                                             0
+
+                                                                  );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(236, rhport, EDPT_CTRL_OUT, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_OUT, 0, 0, 
+
+                                                      0
+
+                                                           );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(238, rhport, &req_get_desc_configuration, 1);
+
+
+
+  tud_task();
+
+}
+
+
+
+void test_usbd_get_configuration_descriptor_null(void)
+
+{
+
+  desc_configuration = 
+
+                      ((void *)0)
+
+                          ;
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_get_desc_configuration, 
+
+                                                                          0
+
+                                                                               );
+
+
+
+  dcd_edpt_stall_CMockExpect(248, rhport, EDPT_CTRL_OUT);
+
+  dcd_edpt_stall_CMockExpect(249, rhport, EDPT_CTRL_IN);
+
+
+
+  tud_task();
+
+}
+
+
+
+
+
+
+
+
+
+
+
+void test_usbd_control_in_zlp(void)
+
+{
+
+
+
+
+
+  uint8_t zlp_desc_configuration[64*2] =
+
+  {
+
+
+
+    9, TUSB_DESC_CONFIGURATION, ((uint8_t) ((64*2) & 0x00ff)), ((uint8_t) (((64*2) >> 8) & 0x00ff)), 0, 1, 0, (1U << (7)) | TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP, (100)/2,
+
+  };
+
+
+
+  desc_configuration = zlp_desc_configuration;
+
+
+
+
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_get_desc_configuration, 
+
+                                                                          0
+
+                                                                               );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(274, rhport, EDPT_CTRL_IN, zlp_desc_configuration, 64, 64, 
+
+ 1
+
+ )
+
+                                                                                                                    ;
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, 64, 0, 
+
+                                                                         0
+
+                                                                              );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(279, rhport, EDPT_CTRL_IN, zlp_desc_configuration + 64, 64, 64, 
+
+ 1
+
+ )
+
+                                                                                                                                            ;
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, 64, 0, 
+
+                                                                         0
+
+                                                                              );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(284, rhport, EDPT_CTRL_IN, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, 0, 0, 
+
+                                                     0
+
+                                                          );
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(288, rhport, EDPT_CTRL_OUT, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_OUT, 0, 0, 
+
+                                                      0
+
+                                                           );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(290, rhport, &req_get_desc_configuration, 1);
+
+
+
+  tud_task();
+
+}
+
+
+
+
+
+
+
+
+
+
+
+void test_usbd_stats(void)
+
+{
+
+  tud_stats_clear();
+
+  test_usbd_get_device_descriptor();
+
+
+
+  tud_stats_edpt_t const* stats_in = tud_stats_edpt(EDPT_CTRL_IN);
+
+  tud_stats_edpt_t const* stats_out = tud_stats_edpt(EDPT_CTRL_OUT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((stats_in->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(307), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((sizeof(tusb_desc_device_t))), (UNITY_INT)((stats_in->xfer_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(308), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((stats_out->xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(309), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((stats_out->xfer_bytes)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(310), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((3)), (UNITY_INT)((tud_stats()->queue_hwm)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(313), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  test_usbd_get_device_descriptor_null();
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((stats_in->stall_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(316), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((stats_out->stall_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(317), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  if ((((tud_stats_edpt(0x80 | 8))) == 
+
+ ((void *)0)
+
+ )) {} else {UnityFail( (((" Expected NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(319))));};
+
+}
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  EDPT_MSC_OUT = 0x01,
+
+  EDPT_MSC_IN = 0x81,
+
+
+
+  BULK_FLOOD_COUNT = 64
+
+};
+
+
+
+uint8_t const data_desc_configuration_msc[] =
+
+{
+
+
+
+  9, TUSB_DESC_CONFIGURATION, ((uint8_t) (((9) + (9 + 7 + 7)) & 0x00ff)), ((uint8_t) ((((9) + (9 + 7 + 7)) >> 8) & 0x00ff)), 1, 1, 0, (1U << (7)) | 0x00, (100)/2,
+
+
+
+
+
+  9, TUSB_DESC_INTERFACE, 0, 0, 2, TUSB_CLASS_MSC, MSC_SUBCLASS_SCSI, MSC_PROTOCOL_BOT, 0, 7, TUSB_DESC_ENDPOINT, EDPT_MSC_OUT, TUSB_XFER_BULK, ((uint8_t) ((512) & 0x00ff)), ((uint8_t) (((512) >> 8) & 0x00ff)), 0, 7, TUSB_DESC_ENDPOINT, EDPT_MSC_IN, TUSB_XFER_BULK, ((uint8_t) ((512) & 0x00ff)), ((uint8_t) (((512) >> 8) & 0x00ff)), 0,
+
+};
+
+
+
+static void reset_and_configure_msc(void)
+
+{
+
+  dcd_event_bus_reset(rhport, TUSB_SPEED_HIGH, 
+
+                                              0
+
+                                                   );
+
+  mscd_reset_CMockExpect(345, rhport);
+
+
+
+  desc_configuration = data_desc_configuration_msc;
+
+  dcd_event_setup_received(rhport, (uint8_t*) &req_set_configuration, 
+
+                                                                     0
+
+                                                                          );
+
+
+
+  mscd_open_CMockExpectAndReturn(350, rhport, (tusb_desc_interface_t const*) (data_desc_configuration_msc + (9)), (9 + 7 + 7), (9 + 7 + 7))
+
+                                                               ;
+
+
+
+
+
+  dcd_edpt_xfer_CMockExpectAndReturn(354, rhport, EDPT_CTRL_IN, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, 0, 0, 
+
+                                                     0
+
+                                                          );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(356, rhport, &req_set_configuration, 1);
+
+
+
+  tud_task();
+
+  if ((tud_mounted())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(359)));};
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           bulk_xfer_cb(uint8_t rhport_, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, int num_calls)
+
+{
+
+  (void) ep_addr; (void) event; (void) xferred_bytes; (void) num_calls;
+
+
+
+  bulk_count++;
+
+
+
+
+
+  if ( bulk_count == BULK_FLOOD_COUNT/2 )
+
+  {
+
+    dcd_event_setup_received(rhport_, (uint8_t*) &req_get_desc_device, 
+
+                                                                      1
+
+                                                                          );
+
+  }
+
+
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+void test_usbd_setup_not_blocked_by_bulk(void)
+
+{
+
+  reset_and_configure_msc();
+
+
+
+  bulk_count = 0;
+
+  bulk_count_at_setup = 
+
+                       (4294967295U)
+
+                                 ;
+
+  mscd_xfer_cb_Stub(bulk_xfer_cb);
+
+
+
+  for(uint32_t i=0; i<BULK_FLOOD_COUNT; i++)
+
+  {
+
+    dcd_event_xfer_complete(rhport, (i & 1) ? EDPT_MSC_IN : EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, 
+
+                                                                                                   1
+
+                                                                                                       );
+
+  }
+
+
+
+
+
+  desc_device = (uint8_t const *) &data_desc_device;
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(392, rhport, EDPT_CTRL_IN, (uint8_t*)&data_desc_device, sizeof(tusb_desc_device_t), sizeof(tusb_desc_device_t), 
+
+ 1
+
+ );
+
+
+
+  tud_task();
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((BULK_FLOOD_COUNT)), (UNITY_INT)((bulk_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(397), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((BULK_FLOOD_COUNT/2)), (UNITY_INT)((bulk_count_at_setup)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(398), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, sizeof(tusb_desc_device_t), 0, 
+
+                                                                              0
+
+                                                                                   );
+
+  dcd_edpt_xfer_CMockExpectAndReturn(402, rhport, EDPT_CTRL_OUT, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_OUT, 0, 0, 
+
+                                                      0
+
+                                                           );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(404, rhport, &req_get_desc_device, 1);
+
+
+
+  tud_task();
+
+}
+
+
+
+void test_usbd_bulk_before_bus_reset_skipped(void)
+
+{
+
+  reset_and_configure_msc();
+
+
+
+
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, 
+
+                                                                         1
+
+                                                                             );
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_IN , 512, XFER_RESULT_SUCCESS, 
+
+                                                                         1
+
+                                                                             );
+
+  dcd_event_bus_reset(rhport, TUSB_SPEED_HIGH, 
+
+                                              1
+
+                                                  );
+
+  mscd_reset_CMockExpect(417, rhport);
+
+
+
+  tud_task();
+
+}
+
+
+
+
+
+
+
+
+
+
+
+void test_usbd_second_port_enumerate(void)
+
+{
+
+  uint8_t const rhport1 = 1;
+
+
+
+  reset_and_configure_msc();
+
+
+
+
+
+  dcd_event_bus_reset(rhport1, TUSB_SPEED_FULL, 
+
+                                               0
+
+                                                    );
+
+  mscd_reset_CMockExpect(434, rhport1);
+
+
+
+  desc_device = (uint8_t const *) &data_desc_device;
+
+  dcd_event_setup_received(rhport1, (uint8_t*) &req_get_desc_device, 
+
+                                                                    0
+
+                                                                         );
+
+  dcd_edpt_xfer_CMockExpectWithArrayAndReturn(438, rhport1, EDPT_CTRL_IN, (uint8_t*)&data_desc_device, sizeof(tusb_desc_device_t), sizeof(tusb_desc_device_t), 
+
+ 1
+
+ );
+
+
+
+  tud_task();
+
+
+
+  if ((tud_rhport_mounted(rhport))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(442)));};
+
+  if (!(tud_rhport_mounted(rhport1))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(443)));};
+
+
+
+
+
+  dcd_event_xfer_complete(rhport1, EDPT_CTRL_IN, sizeof(tusb_desc_device_t), 0, 
+
+                                                                               0
+
+                                                                                    );
+
+  dcd_edpt_xfer_CMockExpectAndReturn(447, rhport1, EDPT_CTRL_OUT, 
+
+ ((void *)0)
+
+ , 0, 
+
+ 1
+
+ );
+
+  dcd_event_xfer_complete(rhport1, EDPT_CTRL_OUT, 0, 0, 
+
+                                                       0
+
+                                                            );
+
+  dcd_edpt0_status_complete_CMockExpectWithArray(449, rhport1, &req_get_desc_device, 1);
+
+
+
+  tud_task();
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((tud_rhport_stats(rhport1)->edpt[0][TUSB_DIR_IN].xfer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(453), UNITY_DISPLAY_STYLE_INT);
+
+  if ((tud_rhport_mounted(rhport))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(454)));};
+
+}
+
+
+
+void test_usbd_bus_reset_other_port(void)
+
+{
+
+  uint8_t const rhport1 = 1;
+
+
+
+  reset_and_configure_msc();
+
+
+
+
+
+  dcd_event_xfer_complete(rhport, EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, 
+
+                                                                         1
+
+                                                                             );
+
+  dcd_event_bus_reset(rhport1, TUSB_SPEED_FULL, 
+
+                                               1
+
+                                                   );
+
+
+
+  mscd_reset_CMockExpect(467, rhport1);
+
+  mscd_xfer_cb_CMockExpectAndReturn(468, rhport, EDPT_MSC_OUT, XFER_RESULT_SUCCESS, 512, 
+
+ 1
+
+ );
+
+
+
+  tud_task();
+
+
+
+  if ((tud_rhport_mounted(rhport))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(472)));};
+
+  if (!(tud_rhport_mounted(rhport1))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(473)));};
+
+}
+
+
+
+
+
+
+
+
+
+void test_usbd_task_ext_timeout(void)
+
+{
+
+  tud_task_ext(10);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(484), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((idle_timeout[0])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(485), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((7)), (UNITY_INT)((idle_timeout[1])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(486), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_timeout[2])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(487), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((idle_timeout[3])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(488), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1012)), (UNITY_INT)((clock_ms)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(489), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  tud_task_ext(0);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(493), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_usbd_task_ext_deadline_kept_across_events(void)
+
+{
+
+  idle_defer_at = 2;
+
+
+
+  tud_task_ext(10);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((defer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(503), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(504), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((idle_timeout[0])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(505), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((7)), (UNITY_INT)((idle_timeout[1])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(506), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_timeout[2])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(507), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((idle_timeout[3])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(508), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1012)), (UNITY_INT)((clock_ms)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(509), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_usbd_task_ext_event_ready(void)
+
+{
+
+  usbd_defer_func(defer_func, 
+
+                             ((void *)0)
+
+                                 , 
+
+                                   0
+
+                                        );
+
+
+
+  tud_task_ext(10);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((defer_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(519), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((4)), (UNITY_INT)((idle_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(520), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((10)), (UNITY_INT)((idle_timeout[0])), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(521), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,488 @@
+#include "_build/temp/_test_usbh_desc_cache.c"
+#include "../src/host/usbh_desc_cache.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static const tusb_desc_device_t desc_device =
+
+{
+
+  .bLength = sizeof(tusb_desc_device_t),
+
+  .bDescriptorType = TUSB_DESC_DEVICE,
+
+  .bcdUSB = 0x0200,
+
+  .bMaxPacketSize0 = 64,
+
+  .idVendor = 0xCafe,
+
+  .idProduct = 0x4001,
+
+  .bcdDevice = 0x0100,
+
+  .iSerialNumber = 0x03,
+
+  .bNumConfigurations = 0x01
+
+};
+
+
+
+
+
+static uint8_t desc_config[18] = { 9, TUSB_DESC_CONFIGURATION, 18, 0, 1, 1, 0, 0x80, 50, 9, TUSB_DESC_INTERFACE, 0, 0, 0, 0xff, 0, 0, 0 };
+
+
+
+static const uint8_t str_serial_a[] = { 8, TUSB_DESC_STRING, '1', 0, '2', 0, '3', 0 };
+
+static const uint8_t str_serial_b[] = { 8, TUSB_DESC_STRING, '1', 0, '2', 0, '4', 0 };
+
+
+
+static tuh_desc_cache_key_t make_key(uint16_t pid, uint8_t const* serial)
+
+{
+
+  tuh_desc_cache_key_t key;
+
+  memset(&key, 0, sizeof(key));
+
+
+
+  key.device = desc_device;
+
+  key.device.idProduct = pid;
+
+  key.serial_hash = serial ? tuh_desc_cache_serial_hash(serial) : 0;
+
+
+
+  return key;
+
+}
+
+
+
+
+
+
+
+
+
+static uint8_t flash_config[256];
+
+static uint16_t flash_len;
+
+static uint32_t flash_loads, flash_stores;
+
+
+
+uint16_t tuh_desc_cache_load_cb(tuh_desc_cache_key_t const* key, uint8_t* config, uint16_t bufsize)
+
+{
+
+  (void) key;
+
+  flash_loads++;
+
+  if ( flash_len == 0 || flash_len > bufsize ) return 0;
+
+  memcpy(config, flash_config, flash_len);
+
+  return flash_len;
+
+}
+
+
+
+void tuh_desc_cache_store_cb(tuh_desc_cache_key_t const* key, uint8_t const* config, uint16_t len)
+
+{
+
+  (void) key;
+
+  flash_stores++;
+
+  memcpy(flash_config, config, len);
+
+  flash_len = len;
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  tuh_desc_cache_clear();
+
+  flash_len = 0;
+
+  flash_loads = flash_stores = 0;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+void test_serial_hash(void)
+
+{
+
+  if (((0) != (tuh_desc_cache_serial_hash(str_serial_a)))) {} else {UnityFail( ((" Expected Not-Equal")), (UNITY_UINT)((UNITY_UINT)(108)));};
+
+  if (((tuh_desc_cache_serial_hash(str_serial_a)) != (tuh_desc_cache_serial_hash(str_serial_b)))) {} else {UnityFail( ((" Expected Not-Equal")), (UNITY_UINT)((UNITY_UINT)(109)));};
+
+}
+
+
+
+void test_store_lookup(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[64];
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(117), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  tuh_desc_cache_store(&key, desc_config);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((flash_stores)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(120), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  memset(buf, 0, sizeof(buf));
+
+  UnityAssertEqualNumber((UNITY_INT)((sizeof(desc_config))), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(123), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((desc_config)), ( const void*)((buf)), (UNITY_UINT32)((sizeof(desc_config))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(124), UNITY_ARRAY_TO_ARRAY);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(desc_config)-1))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_key_mismatch(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[64];
+
+
+
+  tuh_desc_cache_store(&key, desc_config);
+
+  flash_len = 0;
+
+
+
+
+
+  tuh_desc_cache_key_t other = make_key(0x4001, str_serial_b);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&other, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(140), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  other = key;
+
+  other.device.bcdDevice = 0x0101;
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&other, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(145), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  other = make_key(0x4002, str_serial_a);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&other, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(149), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_lru_replacement(void)
+
+{
+
+  uint8_t buf[64];
+
+
+
+  for(uint16_t i=0; i<4; i++)
+
+  {
+
+    tuh_desc_cache_key_t key = make_key(i, 
+
+                                          ((void *)0)
+
+                                              );
+
+    tuh_desc_cache_store(&key, desc_config);
+
+  }
+
+
+
+
+
+  tuh_desc_cache_key_t first = make_key(0, 
+
+                                          ((void *)0)
+
+                                              );
+
+  if (((0) != (tuh_desc_cache_lookup(&first, buf, sizeof(buf))))) {} else {UnityFail( ((" Expected Not-Equal")), (UNITY_UINT)((UNITY_UINT)(164)));};
+
+
+
+  tuh_desc_cache_key_t key = make_key(4, 
+
+                                                                 ((void *)0)
+
+                                                                     );
+
+  tuh_desc_cache_store(&key, desc_config);
+
+  flash_len = 0;
+
+
+
+  tuh_desc_cache_key_t second = make_key(1, 
+
+                                           ((void *)0)
+
+                                               );
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&second, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(171), UNITY_DISPLAY_STYLE_INT);
+
+  if (((0) != (tuh_desc_cache_lookup(&first, buf, sizeof(buf))))) {} else {UnityFail( ((" Expected Not-Equal")), (UNITY_UINT)((UNITY_UINT)(172)));};
+
+  if (((0) != (tuh_desc_cache_lookup(&key, buf, sizeof(buf))))) {} else {UnityFail( ((" Expected Not-Equal")), (UNITY_UINT)((UNITY_UINT)(173)));};
+
+}
+
+
+
+void test_invalidate(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[64];
+
+
+
+  tuh_desc_cache_store(&key, desc_config);
+
+  flash_len = 0;
+
+
+
+  tuh_desc_cache_invalidate(&key);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(185), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_config_too_long(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[8];
+
+  uint8_t long_config[9] = { 9, TUSB_DESC_CONFIGURATION, ((uint8_t) ((256 +1) & 0x00ff)), ((uint8_t) (((256 +1) >> 8) & 0x00ff)), 1, 1, 0, 0x80, 50 };
+
+
+
+  tuh_desc_cache_store(&key, long_config);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((flash_stores)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(196), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(197), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_persistent_load(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[64];
+
+
+
+  memcpy(flash_config, desc_config, sizeof(desc_config));
+
+  flash_len = sizeof(desc_config);
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((sizeof(desc_config))), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(209), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualMemory(( const void*)((desc_config)), ( const void*)((buf)), (UNITY_UINT32)((sizeof(desc_config))), 1, (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(210), UNITY_ARRAY_TO_ARRAY);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((flash_loads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(211), UNITY_DISPLAY_STYLE_INT);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((sizeof(desc_config))), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(213), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((flash_loads)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(214), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_persistent_load_corrupted(void)
+
+{
+
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+
+  uint8_t buf[64];
+
+
+
+
+
+  memcpy(flash_config, desc_config, sizeof(desc_config));
+
+  flash_config[2] = 30;
+
+  flash_len = sizeof(desc_config);
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((tuh_desc_cache_lookup(&key, buf, sizeof(buf)))), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(227), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,728 @@
+#include "_build/temp/_test_vendor_bridge_bench.c"
+#include "../src/class/vendor/vendor_bridge.h"
+#include "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  BUFSIZE = 2048,
+
+  BUFCOUNT = 8,
+
+  EP_SIZE = 512,
+
+  XFER_MAX = 64
+
+};
+
+
+
+typedef struct
+
+{
+
+  uint8_t* buffer;
+
+  uint16_t len;
+
+} xfer_t;
+
+
+
+typedef struct
+
+{
+
+  xfer_t xfer[XFER_MAX];
+
+  uint32_t rd, wr;
+
+} edpt_model_t;
+
+
+
+static vbridge_t bridge;
+
+static edpt_model_t edpt_model[VBRIDGE_EDPT_COUNT];
+
+
+
+static 
+
+      _Bool 
+
+           model_xfer(void* ctx, vbridge_edpt_t edpt, uint8_t* buffer, uint16_t len)
+
+{
+
+  (void) ctx;
+
+
+
+  edpt_model_t* ep = &edpt_model[edpt];
+
+  if ((ep->wr - ep->rd < XFER_MAX)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(63)));};
+
+
+
+  ep->xfer[ep->wr % XFER_MAX] = (xfer_t) { .buffer = buffer, .len = len };
+
+  ep->wr++;
+
+  return 
+
+        1
+
+            ;
+
+}
+
+
+
+static vbridge_backend_t const model_backend = { .xfer = model_xfer };
+
+
+
+static uint32_t queued(vbridge_edpt_t edpt)
+
+{
+
+  return edpt_model[edpt].wr - edpt_model[edpt].rd;
+
+}
+
+
+
+static xfer_t const* head(vbridge_edpt_t edpt)
+
+{
+
+  if ((queued(edpt) > 0)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(79)));};
+
+  return &edpt_model[edpt].xfer[edpt_model[edpt].rd % XFER_MAX];
+
+}
+
+
+
+static void open_all(void)
+
+{
+
+  vbridge_open(&bridge, VBRIDGE_DEV_IN , EP_SIZE, 1);
+
+  vbridge_open(&bridge, VBRIDGE_DEV_OUT , EP_SIZE, 1);
+
+  vbridge_open(&bridge, VBRIDGE_HOST_IN , EP_SIZE, (2*8));
+
+  vbridge_open(&bridge, VBRIDGE_HOST_OUT, EP_SIZE, (2*8));
+
+}
+
+
+
+void setUp(void)
+
+{
+
+  memset((edpt_model), 0, (sizeof(edpt_model)));
+
+  vbridge_init(&bridge, &model_backend, 
+
+                                       ((void *)0)
+
+                                           );
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+enum
+
+{
+
+  BUS_NS_PER_BYTE = 20,
+
+  BUS_XFER_NS = 2000,
+
+  TASK_LATENCY_NS = 5000,
+
+  ECHO_DEPTH = 2,
+
+  BENCH_BYTES = 8*1024*1024,
+
+
+
+  BUS_DEVICE = 0,
+
+  BUS_HOST = 1,
+
+};
+
+
+
+typedef struct
+
+{
+
+  uint64_t time;
+
+  uint8_t edpt;
+
+  uint32_t xferred;
+
+} bench_event_t;
+
+
+
+typedef struct
+
+{
+
+  uint64_t busy_until;
+
+  int active;
+
+  uint8_t turn;
+
+} bench_bus_t;
+
+
+
+static struct
+
+{
+
+  uint64_t now;
+
+  bench_bus_t bus[2];
+
+
+
+  bench_event_t event[4*XFER_MAX];
+
+  uint32_t event_count;
+
+
+
+  uint32_t sent, received;
+
+  uint8_t echo[ECHO_DEPTH][BUFSIZE];
+
+  uint16_t echo_len[ECHO_DEPTH];
+
+  uint32_t echo_rd, echo_wr;
+
+
+
+
+
+  uint64_t rx_done[BUFCOUNT];
+
+  uint64_t latency_sum[VBRIDGE_DIR_COUNT];
+
+  uint64_t latency_max[VBRIDGE_DIR_COUNT];
+
+  uint32_t latency_count[VBRIDGE_DIR_COUNT];
+
+} bench;
+
+
+
+static vbridge_edpt_t const bus_edpt[2][2] =
+
+{
+
+  { VBRIDGE_DEV_OUT, VBRIDGE_DEV_IN },
+
+  { VBRIDGE_HOST_OUT, VBRIDGE_HOST_IN }
+
+};
+
+
+
+static inline uint8_t bench_pattern(uint32_t offset)
+
+{
+
+  return (uint8_t) (offset ^ (offset >> 8) ^ (offset >> 16));
+
+}
+
+
+
+static uint32_t block_of(uint8_t const* buffer)
+
+{
+
+  return (uint32_t) ((buffer - bridge.pool[0]) / BUFSIZE);
+
+}
+
+
+
+
+
+static 
+
+      _Bool 
+
+           bench_ready(vbridge_edpt_t edpt, uint32_t* xferred)
+
+{
+
+  if ( !queued(edpt) ) return 
+
+                             0
+
+                                  ;
+
+  xfer_t const* xfer = head(edpt);
+
+
+
+  switch ( edpt )
+
+  {
+
+    case VBRIDGE_DEV_OUT:
+
+      if ( bench.sent >= BENCH_BYTES ) return 
+
+                                             0
+
+                                                  ;
+
+      *xferred = tu_min32(xfer->len, BENCH_BYTES - bench.sent);
+
+    return 
+
+          1
+
+              ;
+
+
+
+    case VBRIDGE_HOST_OUT:
+
+      if ( bench.echo_wr - bench.echo_rd >= ECHO_DEPTH ) return 
+
+                                                               0
+
+                                                                    ;
+
+      *xferred = xfer->len;
+
+    return 
+
+          1
+
+              ;
+
+
+
+    case VBRIDGE_HOST_IN:
+
+      if ( bench.echo_wr == bench.echo_rd ) return 
+
+                                                  0
+
+                                                       ;
+
+      *xferred = bench.echo_len[bench.echo_rd % ECHO_DEPTH];
+
+    return 
+
+          1
+
+              ;
+
+
+
+    case VBRIDGE_DEV_IN:
+
+    default:
+
+      *xferred = xfer->len;
+
+    return 
+
+          1
+
+              ;
+
+  }
+
+}
+
+
+
+
+
+static void bench_bus_done(vbridge_edpt_t edpt, uint32_t xferred)
+
+{
+
+  xfer_t const* xfer = head(edpt);
+
+
+
+  switch ( edpt )
+
+  {
+
+    case VBRIDGE_DEV_OUT:
+
+      for(uint32_t i=0; i<xferred; i++) xfer->buffer[i] = bench_pattern(bench.sent + i);
+
+      bench.sent += xferred;
+
+    break;
+
+
+
+    case VBRIDGE_HOST_OUT:
+
+      memcpy(bench.echo[bench.echo_wr % ECHO_DEPTH], xfer->buffer, xferred);
+
+      bench.echo_len[bench.echo_wr % ECHO_DEPTH] = (uint16_t) xferred;
+
+      bench.echo_wr++;
+
+    break;
+
+
+
+    case VBRIDGE_HOST_IN:
+
+      memcpy(xfer->buffer, bench.echo[bench.echo_rd % ECHO_DEPTH], xferred);
+
+      bench.echo_rd++;
+
+    break;
+
+
+
+    case VBRIDGE_DEV_IN:
+
+    default:
+
+      for(uint32_t i=0; i<xferred; i++) UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )((bench_pattern(bench.received + i))), (UNITY_INT)(UNITY_INT8 )((xfer->buffer[i])), (
+
+                                       ((void *)0)
+
+                                       ), (UNITY_UINT)(223), UNITY_DISPLAY_STYLE_HEX8);
+
+      bench.received += xferred;
+
+    break;
+
+  }
+
+
+
+  if ( xferred && (edpt == VBRIDGE_DEV_OUT || edpt == VBRIDGE_HOST_IN) ) bench.rx_done[block_of(xfer->buffer)] = bench.now;
+
+
+
+  edpt_model[edpt].rd++;
+
+
+
+  if ((bench.event_count < ( sizeof(bench.event) / sizeof(bench.event[0]) ))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(232)));};
+
+  bench.event[bench.event_count++] = (bench_event_t) { .time = bench.now + TASK_LATENCY_NS, .edpt = edpt, .xferred = xferred };
+
+}
+
+
+
+static void bench_bus_start(bench_bus_t* bus, vbridge_edpt_t const edpts[2])
+
+{
+
+  for(uint8_t i=0; i<2; i++)
+
+  {
+
+    vbridge_edpt_t const edpt = edpts[(bus->turn + i) % 2];
+
+    uint32_t xferred;
+
+
+
+    if ( !bench_ready(edpt, &xferred) ) continue;
+
+
+
+
+
+    xfer_t const* xfer = head(edpt);
+
+    if ( xferred && (edpt == VBRIDGE_DEV_IN || edpt == VBRIDGE_HOST_OUT) )
+
+    {
+
+      uint8_t const dir = (edpt == VBRIDGE_DEV_IN) ? VBRIDGE_UPSTREAM : VBRIDGE_DOWNSTREAM;
+
+      uint64_t const wait = bench.now - bench.rx_done[block_of(xfer->buffer)];
+
+
+
+      bench.latency_sum[dir] += wait;
+
+      bench.latency_max[dir] = (wait > bench.latency_max[dir]) ? wait : bench.latency_max[dir];
+
+      bench.latency_count[dir]++;
+
+    }
+
+
+
+    bus->active = edpt;
+
+    bus->busy_until = bench.now + BUS_XFER_NS + (uint64_t) xferred*BUS_NS_PER_BYTE;
+
+    bus->turn = (uint8_t) ((bus->turn + i + 1) % 2);
+
+    return;
+
+  }
+
+}
+
+
+
+static void bench_run(void)
+
+{
+
+  memset((&bench), 0, (sizeof(bench)));
+
+  bench.bus[BUS_DEVICE].active = bench.bus[BUS_HOST].active = -1;
+
+
+
+  open_all();
+
+
+
+  while ( bench.received < BENCH_BYTES )
+
+  {
+
+
+
+    for(uint8_t b=0; b<2; b++)
+
+    {
+
+      if ( bench.bus[b].active < 0 ) bench_bus_start(&bench.bus[b], bus_edpt[b]);
+
+    }
+
+
+
+
+
+    uint64_t next = 
+
+                   (18446744073709551615UL)
+
+                             ;
+
+    for(uint8_t b=0; b<2; b++)
+
+    {
+
+      if ( bench.bus[b].active >= 0 && bench.bus[b].busy_until < next ) next = bench.bus[b].busy_until;
+
+    }
+
+    for(uint32_t i=0; i<bench.event_count; i++)
+
+    {
+
+      if ( bench.event[i].time < next ) next = bench.event[i].time;
+
+    }
+
+    if ((next != 
+
+   (18446744073709551615UL)
+
+   )) {} else {UnityFail( ((("loopback stalled"))), (UNITY_UINT)((UNITY_UINT)(289)));};
+
+    bench.now = next;
+
+
+
+    for(uint8_t b=0; b<2; b++)
+
+    {
+
+      bench_bus_t* bus = &bench.bus[b];
+
+      if ( bus->active >= 0 && bus->busy_until == bench.now )
+
+      {
+
+        uint32_t xferred = 0;
+
+        bench_ready((vbridge_edpt_t) bus->active, &xferred);
+
+        bench_bus_done((vbridge_edpt_t) bus->active, xferred);
+
+        bus->active = -1;
+
+      }
+
+    }
+
+
+
+
+
+    for(uint32_t i=0; i<bench.event_count; )
+
+    {
+
+      if ( bench.event[i].time == bench.now )
+
+      {
+
+        bench_event_t const event = bench.event[i];
+
+        memmove(&bench.event[i], &bench.event[i+1], (bench.event_count - i - 1)*sizeof(bench_event_t));
+
+        bench.event_count--;
+
+        vbridge_xfer_complete(&bridge, (vbridge_edpt_t) event.edpt, XFER_RESULT_SUCCESS, event.xferred);
+
+      }
+
+      else
+
+      {
+
+        i++;
+
+      }
+
+    }
+
+  }
+
+}
+
+
+
+void test_benchmark_loopback(void)
+
+{
+
+  bench_run();
+
+
+
+
+
+  UnityAssertEqualNumber((UNITY_INT)((BENCH_BYTES)), (UNITY_INT)((bench.received)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(327), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+  uint32_t const mbps_x10 = (uint32_t) ((uint64_t) BENCH_BYTES*10*1000 / bench.now);
+
+  uint32_t const limit_x10 = 10*1000 / (2*BUS_NS_PER_BYTE);
+
+
+
+  uint32_t latency_avg[VBRIDGE_DIR_COUNT];
+
+  for(uint8_t dir=0; dir<VBRIDGE_DIR_COUNT; dir++)
+
+  {
+
+    if ((bench.latency_count[dir] > 0)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(336)));};
+
+    latency_avg[dir] = (uint32_t) (bench.latency_sum[dir] / bench.latency_count[dir] / 1000);
+
+  }
+
+
+
+  char msg[200];
+
+  snprintf(msg, sizeof(msg), "loopback %lu.%lu MB/s (half duplex bus limit %lu.%lu MB/s), added latency "
+
+           "down avg %lu us max %lu us, up avg %lu us max %lu us, pool %u x %u",
+
+           (unsigned long) mbps_x10/10, (unsigned long) mbps_x10%10,
+
+           (unsigned long) limit_x10/10, (unsigned long) limit_x10%10,
+
+           (unsigned long) latency_avg[VBRIDGE_DOWNSTREAM], (unsigned long) (bench.latency_max[VBRIDGE_DOWNSTREAM]/1000),
+
+           (unsigned long) latency_avg[VBRIDGE_UPSTREAM] , (unsigned long) (bench.latency_max[VBRIDGE_UPSTREAM]/1000),
+
+           BUFCOUNT, BUFSIZE);
+
+  UnityMessage((msg), 348);
+
+
+
+
+
+  if ((mbps_x10*10 >= limit_x10*8)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(351)));};
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_UPSTREAM)->drop_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(352), UNITY_DISPLAY_STYLE_INT);
+
+  UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((vbridge_get_stats(&bridge, VBRIDGE_DOWNSTREAM)->drop_count)), (
+
+ ((void *)0)
+
+ ), (UNITY_UINT)(353), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,2 @@
+---
+- "../src/common/tusb_common.h"
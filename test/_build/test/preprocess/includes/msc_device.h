@@ -0,0 +1,4 @@
+---
+- "../src/common/tusb_common.h"
+- "../src/device/usbd.h"
+- "../src/class/msc/msc.h"
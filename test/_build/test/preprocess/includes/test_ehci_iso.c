@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/host/ehci/ehci_iso.h"
+- _build/temp/_test_ehci_iso.c
@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/common/tusb_fifo.h"
+- _build/temp/_test_fifo.c
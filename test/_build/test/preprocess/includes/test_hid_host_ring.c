@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/class/hid/hid_host_ring.h"
+- _build/temp/_test_hid_host_ring.c
@@ -0,0 +1,11 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/common/tusb_fifo.h"
+- "../src/tusb.h"
+- "../src/device/usbd.h"
+- _build/test/mocks/mock_dcd.h
+- _build/temp/_test_msc_device.c
+- "../src/device/usbd_control.c"
+- "@@@@usbd_control.c"
+- "../src/class/msc/msc_device.c"
+- "@@@@msc_device.c"
@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/class/msc/msc_host_cache.h"
+- _build/temp/_test_msc_host_cache_bench.c
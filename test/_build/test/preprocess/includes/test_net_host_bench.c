@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/class/net/net_host_frame.h"
+- _build/temp/_test_net_host_bench.c
@@ -0,0 +1,6 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/class/net/net_host_frame.h"
+- "../src/class/net/ncm.h"
+- "../src/class/cdc/cdc_rndis.h"
+- _build/temp/_test_net_host_frame.c
@@ -0,0 +1,11 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/common/tusb_fifo.h"
+- "../src/tusb.h"
+- "../src/device/usbd.h"
+- "../src/device/usbd_pvt.h"
+- _build/test/mocks/mock_dcd.h
+- _build/test/mocks/mock_msc_device.h
+- _build/temp/_test_usbd.c
+- "../src/device/usbd_control.c"
+- "@@@@usbd_control.c"
@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/host/usbh_desc_cache.h"
+- _build/temp/_test_usbh_desc_cache.c
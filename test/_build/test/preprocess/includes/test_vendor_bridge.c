@@ -0,0 +1,4 @@
+---
+- "/root/repo/test/vendor/ceedling/vendor/unity/src/unity.h"
+- "../src/class/vendor/vendor_bridge.h"
+- _build/temp/_test_vendor_bridge.c
@@ -0,0 +1,107 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_open_highspeed_micro_frames(void);
+extern void test_open_unsupported(void);
+extern void test_open_split_masks(void);
+extern void test_start_queues_frames_ahead(void);
+extern void test_restart_waits_stop_frame_over(void);
+extern void test_isr_reports_and_rearms(void);
+extern void test_isr_late_skips_ahead(void);
+extern void test_split_out_descriptor(void);
+extern void test_streams_share_frames(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, int line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+
+        CEXCEPTION_T e;
+        Try {
+
+            setUp();
+            func();
+
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_ehci_iso.c");
+  run_test(test_open_highspeed_micro_frames, "test_open_highspeed_micro_frames", 195);
+  run_test(test_open_unsupported, "test_open_unsupported", 215);
+  run_test(test_open_split_masks, "test_open_split_masks", 243);
+  run_test(test_start_queues_frames_ahead, "test_start_queues_frames_ahead", 266);
+  run_test(test_restart_waits_stop_frame_over, "test_restart_waits_stop_frame_over", 310);
+  run_test(test_isr_reports_and_rearms, "test_isr_reports_and_rearms", 330);
+  run_test(test_isr_late_skips_ahead, "test_isr_late_skips_ahead", 375);
+  run_test(test_split_out_descriptor, "test_split_out_descriptor", 406);
+  run_test(test_streams_share_frames, "test_streams_share_frames", 441);
+
+  return UnityEnd();
+}
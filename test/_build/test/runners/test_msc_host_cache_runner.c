@@ -0,0 +1,107 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_read_hit(void);
+extern void test_readahead_sequential(void);
+extern void test_readahead_limited_by_block_count(void);
+extern void test_write_coalesce(void);
+extern void test_multiple_read_sees_dirty_sector(void);
+extern void test_multiple_write_updates_line(void);
+extern void test_lru_eviction(void);
+extern void test_dirty_eviction_writes_back(void);
+extern void test_random_consistency(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, int line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+
+        CEXCEPTION_T e;
+        Try {
+
+            setUp();
+            func();
+
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_msc_host_cache.c");
+  run_test(test_read_hit, "test_read_hit", 94);
+  run_test(test_readahead_sequential, "test_readahead_sequential", 107);
+  run_test(test_readahead_limited_by_block_count, "test_readahead_limited_by_block_count", 120);
+  run_test(test_write_coalesce, "test_write_coalesce", 130);
+  run_test(test_multiple_read_sees_dirty_sector, "test_multiple_read_sees_dirty_sector", 151);
+  run_test(test_multiple_write_updates_line, "test_multiple_write_updates_line", 161);
+  run_test(test_lru_eviction, "test_lru_eviction", 174);
+  run_test(test_dirty_eviction_writes_back, "test_dirty_eviction_writes_back", 192);
+  run_test(test_random_consistency, "test_random_consistency", 208);
+
+  return UnityEnd();
+}
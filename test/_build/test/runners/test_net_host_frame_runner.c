@@ -0,0 +1,105 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ncm_round_trip(void);
+extern void test_ncm_block_full(void);
+extern void test_ncm_ndp_chain(void);
+extern void test_ncm_malformed(void);
+extern void test_rndis_round_trip(void);
+extern void test_rndis_skip_messages(void);
+extern void test_rndis_malformed(void);
+extern void test_ecm_single_frame(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, int line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+
+        CEXCEPTION_T e;
+        Try {
+
+            setUp();
+            func();
+
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_net_host_frame.c");
+  run_test(test_ncm_round_trip, "test_ncm_round_trip", 104);
+  run_test(test_ncm_block_full, "test_ncm_block_full", 125);
+  run_test(test_ncm_ndp_chain, "test_ncm_ndp_chain", 142);
+  run_test(test_ncm_malformed, "test_ncm_malformed", 170);
+  run_test(test_rndis_round_trip, "test_rndis_round_trip", 208);
+  run_test(test_rndis_skip_messages, "test_rndis_skip_messages", 227);
+  run_test(test_rndis_malformed, "test_rndis_malformed", 242);
+  run_test(test_ecm_single_frame, "test_ecm_single_frame", 269);
+
+  return UnityEnd();
+}
@@ -0,0 +1,125 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "mock_dcd.h"
+#include "mock_msc_device.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_usbd_get_device_descriptor(void);
+extern void test_usbd_get_device_descriptor_null(void);
+extern void test_usbd_get_configuration_descriptor(void);
+extern void test_usbd_get_configuration_descriptor_null(void);
+extern void test_usbd_control_in_zlp(void);
+extern void test_usbd_stats(void);
+extern void test_usbd_setup_not_blocked_by_bulk(void);
+extern void test_usbd_bulk_before_bus_reset_skipped(void);
+extern void test_usbd_second_port_enumerate(void);
+extern void test_usbd_bus_reset_other_port(void);
+extern void test_usbd_task_ext_timeout(void);
+extern void test_usbd_task_ext_deadline_kept_across_events(void);
+extern void test_usbd_task_ext_event_ready(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_dcd_Init();
+  mock_msc_device_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_dcd_Verify();
+  mock_msc_device_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_dcd_Destroy();
+  mock_msc_device_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, int line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+
+        CEXCEPTION_T e;
+        Try {
+
+            setUp();
+            func();
+
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_usbd.c");
+  run_test(test_usbd_get_device_descriptor, "test_usbd_get_device_descriptor", 193);
+  run_test(test_usbd_get_device_descriptor_null, "test_usbd_get_device_descriptor_null", 210);
+  run_test(test_usbd_get_configuration_descriptor, "test_usbd_get_configuration_descriptor", 224);
+  run_test(test_usbd_get_configuration_descriptor_null, "test_usbd_get_configuration_descriptor_null", 243);
+  run_test(test_usbd_control_in_zlp, "test_usbd_control_in_zlp", 258);
+  run_test(test_usbd_stats, "test_usbd_stats", 299);
+  run_test(test_usbd_setup_not_blocked_by_bulk, "test_usbd_setup_not_blocked_by_bulk", 377);
+  run_test(test_usbd_bulk_before_bus_reset_skipped, "test_usbd_bulk_before_bus_reset_skipped", 409);
+  run_test(test_usbd_second_port_enumerate, "test_usbd_second_port_enumerate", 426);
+  run_test(test_usbd_bus_reset_other_port, "test_usbd_bus_reset_other_port", 457);
+  run_test(test_usbd_task_ext_timeout, "test_usbd_task_ext_timeout", 479);
+  run_test(test_usbd_task_ext_deadline_kept_across_events, "test_usbd_task_ext_deadline_kept_across_events", 496);
+  run_test(test_usbd_task_ext_event_ready, "test_usbd_task_ext_event_ready", 512);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
@@ -0,0 +1,103 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_receive_needs_both_sides(void);
+extern void test_forward_zero_copy(void);
+extern void test_zlp_at_packet_boundary(void);
+extern void test_credit_backpressure(void);
+extern void test_submit_failure_retried(void);
+extern void test_close_releases_blocks(void);
+extern void test_failed_xfer_closes_endpoint(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, int line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+
+        CEXCEPTION_T e;
+        Try {
+
+            setUp();
+            func();
+
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_vendor_bridge.c");
+  run_test(test_receive_needs_both_sides, "test_receive_needs_both_sides", 120);
+  run_test(test_forward_zero_copy, "test_forward_zero_copy", 131);
+  run_test(test_zlp_at_packet_boundary, "test_zlp_at_packet_boundary", 161);
+  run_test(test_credit_backpressure, "test_credit_backpressure", 182);
+  run_test(test_submit_failure_retried, "test_submit_failure_retried", 206);
+  run_test(test_close_releases_blocks, "test_close_releases_blocks", 226);
+  run_test(test_failed_xfer_closes_endpoint, "test_failed_xfer_closes_endpoint", 263);
+
+  return UnityEnd();
+}
@@ -198,8 +198,10 @@ void setUp(void)
 
   if ( !tusb_inited() )
   {
-    dcd_init_Expect(rhport);
-    dcd_connect_Expect(rhport);
+    dcd_init_Expect(0);
+    dcd_connect_Expect(0);
+    dcd_init_Expect(1);
+    dcd_connect_Expect(1);
     tusb_init();
   }
 
@@ -28,6 +28,7 @@
 #include "tusb_fifo.h"
 #include "tusb.h"
 #include "usbd.h"
+#include "usbd_pvt.h"
 TEST_FILE("usbd_control.c")
 
 // Mock File
@@ -95,14 +96,28 @@ tusb_control_request_t const req_get_desc_configuration =
   .wLength = 256
 };
 
+tusb_control_request_t const req_set_configuration =
+{
+  .bmRequestType = 0x00,
+  .bRequest = TUSB_REQ_SET_CONFIGURATION,
+  .wValue = 1,
+  .wIndex = 0x0000,
+  .wLength = 0
+};
+
 uint8_t const* desc_device;
 uint8_t const* desc_configuration;
 
+// number of bulk callbacks invoked when device descriptor is requested
+uint32_t bulk_count;
+uint32_t bulk_count_at_setup;
+
 //--------------------------------------------------------------------+
 //
 //--------------------------------------------------------------------+
 uint8_t const * tud_descriptor_device_cb(void)
 {
+  bulk_count_at_setup = bulk_count;
   return desc_device;
 }
 
@@ -118,16 +133,50 @@ uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid)
   return NULL;
 }
 
+// clock advanced by idle callback
+uint32_t clock_ms;
+uint32_t idle_count;
+uint32_t idle_timeout[8];
+uint32_t idle_defer_at; // idle call that queues a deferred function, 0 for none
+uint32_t defer_count;
+
+uint32_t tud_time_millis_cb(void)
+{
+  return clock_ms;
+}
+
+static void defer_func(void* param)
+{
+  (void) param;
+  defer_count++;
+}
+
+void tud_idle_cb(uint32_t timeout_ms)
+{
+  if ( idle_count < TU_ARRAY_SIZE(idle_timeout) ) idle_timeout[idle_count] = timeout_ms;
+  idle_count++;
+
+  clock_ms += 3;
+  if ( idle_count == idle_defer_at ) usbd_defer_func(defer_func, NULL, true);
+}
+
 void setUp(void)
 {
+  clock_ms      = 1000;
+  idle_count    = 0;
+  idle_defer_at = 0;
+  defer_count   = 0;
+
   dcd_int_disable_Ignore();
   dcd_int_enable_Ignore();
 
   if ( !tusb_inited() )
   {
     mscd_init_Expect();
-    dcd_init_Expect(rhport);
-    dcd_connect_Expect(rhport);
+    dcd_init_Expect(0);
+    dcd_connect_Expect(0);
+    dcd_init_Expect(1);
+    dcd_connect_Expect(1);
     tusb_init();
   }
 }
@@ -242,3 +291,232 @@ void test_usbd_control_in_zlp(void)
 
   tud_task();
 }
+
+//--------------------------------------------------------------------+
+// Statistics
+//--------------------------------------------------------------------+
+
+void test_usbd_stats(void)
+{
+  tud_stats_clear();
+  test_usbd_get_device_descriptor();
+
+  tud_stats_edpt_t const* stats_in  = tud_stats_edpt(EDPT_CTRL_IN);
+  tud_stats_edpt_t const* stats_out = tud_stats_edpt(EDPT_CTRL_OUT);
+
+  TEST_ASSERT_EQUAL(1, stats_in->xfer_count);
+  TEST_ASSERT_EQUAL(sizeof(tusb_desc_device_t), stats_in->xfer_bytes);
+  TEST_ASSERT_EQUAL(1, stats_out->xfer_count);
+  TEST_ASSERT_EQUAL(0, stats_out->xfer_bytes);
+
+  // setup + 2 xfer complete are queued before tud_task()
+  TEST_ASSERT_EQUAL(3, tud_stats()->queue_hwm);
+
+  test_usbd_get_device_descriptor_null();
+  TEST_ASSERT_EQUAL(1, stats_in->stall_count);
+  TEST_ASSERT_EQUAL(1, stats_out->stall_count);
+  // endpoint number beyond tracked endpoints
+  TEST_ASSERT_NULL(tud_stats_edpt(0x80 | CFG_TUD_ENDPOINT_MAX));
+}
+
+//--------------------------------------------------------------------+
+// Event Priority
+//--------------------------------------------------------------------+
+enum
+{
+  EDPT_MSC_OUT = 0x01,
+  EDPT_MSC_IN  = 0x81,
+
+  BULK_FLOOD_COUNT = 64 // less than CFG_TUD_TASK_QUEUE_SZ
+};
+
+uint8_t const data_desc_configuration_msc[] =
+{
+  // Config number, interface count, string index, total length, attribute, power in mA
+  TUD_CONFIG_DESCRIPTOR(1, 1, 0, TUD_CONFIG_DESC_LEN + TUD_MSC_DESC_LEN, 0x00, 100),
+
+  // Interface number, string index, EP Out & EP In address, EP size
+  TUD_MSC_DESCRIPTOR(0, 0, EDPT_MSC_OUT, EDPT_MSC_IN, 512),
+};
+
+static void reset_and_configure_msc(void)
+{
+  dcd_event_bus_reset(rhport, TUSB_SPEED_HIGH, false);
+  mscd_reset_Expect(rhport);
+
+  desc_configuration = data_desc_configuration_msc;
+  dcd_event_setup_received(rhport, (uint8_t*) &req_set_configuration, false);
+
+  mscd_open_ExpectAndReturn(rhport, (tusb_desc_interface_t const*) (data_desc_configuration_msc + TUD_CONFIG_DESC_LEN),
+                            TUD_MSC_DESC_LEN, TUD_MSC_DESC_LEN);
+
+  // status
+  dcd_edpt_xfer_ExpectAndReturn(rhport, EDPT_CTRL_IN, NULL, 0, true);
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, 0, 0, false);
+  dcd_edpt0_status_complete_ExpectWithArray(rhport, &req_set_configuration, 1);
+
+  tud_task();
+  TEST_ASSERT_TRUE(tud_mounted());
+}
+
+static bool bulk_xfer_cb(uint8_t rhport_, uint8_t ep_addr, xfer_result_t event, uint32_t xferred_bytes, int num_calls)
+{
+  (void) ep_addr; (void) event; (void) xferred_bytes; (void) num_calls;
+
+  bulk_count++;
+
+  // SETUP arrives while task is busy with bulk transfer events
+  if ( bulk_count == BULK_FLOOD_COUNT/2 )
+  {
+    dcd_event_setup_received(rhport_, (uint8_t*) &req_get_desc_device, true);
+  }
+
+  return true;
+}
+
+void test_usbd_setup_not_blocked_by_bulk(void)
+{
+  reset_and_configure_msc();
+
+  bulk_count = 0;
+  bulk_count_at_setup = UINT32_MAX;
+  mscd_xfer_cb_StubWithCallback(bulk_xfer_cb);
+
+  for(uint32_t i=0; i<BULK_FLOOD_COUNT; i++)
+  {
+    dcd_event_xfer_complete(rhport, (i & 1) ? EDPT_MSC_IN : EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, true);
+  }
+
+  // data stage of SETUP
+  desc_device = (uint8_t const *) &data_desc_device;
+  dcd_edpt_xfer_ExpectWithArrayAndReturn(rhport, EDPT_CTRL_IN, (uint8_t*)&data_desc_device, sizeof(tusb_desc_device_t), sizeof(tusb_desc_device_t), true);
+
+  tud_task();
+
+  // SETUP is serviced right after the bulk event being processed when it arrives, not after the whole burst
+  TEST_ASSERT_EQUAL(BULK_FLOOD_COUNT, bulk_count);
+  TEST_ASSERT_EQUAL(BULK_FLOOD_COUNT/2, bulk_count_at_setup);
+
+  // complete control transfer
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_IN, sizeof(tusb_desc_device_t), 0, false);
+  dcd_edpt_xfer_ExpectAndReturn(rhport, EDPT_CTRL_OUT, NULL, 0, true);
+  dcd_event_xfer_complete(rhport, EDPT_CTRL_OUT, 0, 0, false);
+  dcd_edpt0_status_complete_ExpectWithArray(rhport, &req_get_desc_device, 1);
+
+  tud_task();
+}
+
+void test_usbd_bulk_before_bus_reset_skipped(void)
+{
+  reset_and_configure_msc();
+
+  // bus reset is processed first, transfers completed before it are stale and must not reach class driver
+  dcd_event_xfer_complete(rhport, EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, true);
+  dcd_event_xfer_complete(rhport, EDPT_MSC_IN , 512, XFER_RESULT_SUCCESS, true);
+  dcd_event_bus_reset(rhport, TUSB_SPEED_HIGH, true);
+  mscd_reset_Expect(rhport);
+
+  tud_task();
+}
+
+//--------------------------------------------------------------------+
+// Multiple device ports
+//--------------------------------------------------------------------+
+
+void test_usbd_second_port_enumerate(void)
+{
+  uint8_t const rhport1 = 1;
+
+  reset_and_configure_msc();
+
+  // port 1 is enumerated independently while port 0 stays configured
+  dcd_event_bus_reset(rhport1, TUSB_SPEED_FULL, false);
+  mscd_reset_Expect(rhport1);
+
+  desc_device = (uint8_t const *) &data_desc_device;
+  dcd_event_setup_received(rhport1, (uint8_t*) &req_get_desc_device, false);
+  dcd_edpt_xfer_ExpectWithArrayAndReturn(rhport1, EDPT_CTRL_IN, (uint8_t*)&data_desc_device, sizeof(tusb_desc_device_t), sizeof(tusb_desc_device_t), true);
+
+  tud_task();
+
+  TEST_ASSERT_TRUE (tud_rhport_mounted(rhport));
+  TEST_ASSERT_FALSE(tud_rhport_mounted(rhport1));
+
+  // finish control transfer on port 1
+  dcd_event_xfer_complete(rhport1, EDPT_CTRL_IN, sizeof(tusb_desc_device_t), 0, false);
+  dcd_edpt_xfer_ExpectAndReturn(rhport1, EDPT_CTRL_OUT, NULL, 0, true);
+  dcd_event_xfer_complete(rhport1, EDPT_CTRL_OUT, 0, 0, false);
+  dcd_edpt0_status_complete_ExpectWithArray(rhport1, &req_get_desc_device, 1);
+
+  tud_task();
+
+  TEST_ASSERT_EQUAL(1, tud_rhport_stats(rhport1)->edpt[0][TUSB_DIR_IN].xfer_count);
+  TEST_ASSERT_TRUE (tud_rhport_mounted(rhport));
+}
+
+void test_usbd_bus_reset_other_port(void)
+{
+  uint8_t const rhport1 = 1;
+
+  reset_and_configure_msc();
+
+  // transfer of port 0 queued before bus reset of port 1 is still delivered
+  dcd_event_xfer_complete(rhport, EDPT_MSC_OUT, 512, XFER_RESULT_SUCCESS, true);
+  dcd_event_bus_reset(rhport1, TUSB_SPEED_FULL, true);
+
+  mscd_reset_Expect(rhport1);
+  mscd_xfer_cb_ExpectAndReturn(rhport, EDPT_MSC_OUT, XFER_RESULT_SUCCESS, 512, true);
+
+  tud_task();
+
+  TEST_ASSERT_TRUE (tud_rhport_mounted(rhport));
+  TEST_ASSERT_FALSE(tud_rhport_mounted(rhport1));
+}
+
+//--------------------------------------------------------------------+
+// Task with timeout
+//--------------------------------------------------------------------+
+void test_usbd_task_ext_timeout(void)
+{
+  tud_task_ext(10);
+
+  // sleeps until timeout is elapsed
+  TEST_ASSERT_EQUAL(4, idle_count);
+  TEST_ASSERT_EQUAL(10, idle_timeout[0]);
+  TEST_ASSERT_EQUAL(7 , idle_timeout[1]);
+  TEST_ASSERT_EQUAL(4 , idle_timeout[2]);
+  TEST_ASSERT_EQUAL(1 , idle_timeout[3]);
+  TEST_ASSERT_EQUAL(1012, clock_ms);
+
+  // no timeout: returns right away
+  tud_task_ext(0);
+  TEST_ASSERT_EQUAL(4, idle_count);
+}
+
+void test_usbd_task_ext_deadline_kept_across_events(void)
+{
+  idle_defer_at = 2;
+
+  tud_task_ext(10);
+
+  // event wakes up the task, waiting again only takes the time left
+  TEST_ASSERT_EQUAL(1, defer_count);
+  TEST_ASSERT_EQUAL(4, idle_count);
+  TEST_ASSERT_EQUAL(10, idle_timeout[0]);
+  TEST_ASSERT_EQUAL(7 , idle_timeout[1]);
+  TEST_ASSERT_EQUAL(4 , idle_timeout[2]);
+  TEST_ASSERT_EQUAL(1 , idle_timeout[3]);
+  TEST_ASSERT_EQUAL(1012, clock_ms);
+}
+
+void test_usbd_task_ext_event_ready(void)
+{
+  usbd_defer_func(defer_func, NULL, false);
+
+  tud_task_ext(10);
+
+  // pending event is processed without sleeping first
+  TEST_ASSERT_EQUAL(1, defer_count);
+  TEST_ASSERT_EQUAL(4, idle_count);
+  TEST_ASSERT_EQUAL(10, idle_timeout[0]);
+}
@@ -0,0 +1,486 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "unity.h"
+
+// Files to test
+#include "ehci_iso.h"
+
+//--------------------------------------------------------------------+
+// Host controller model: frame list and descriptors are only reachable through 32-bit link addresses,
+// which are resolved back to known objects since pointers of the test host can be wider
+//--------------------------------------------------------------------+
+enum { QHD_TAIL = 0x1000 | (EHCI_QTYPE_QHD << 1) }; // interrupt tree following iso descriptors
+
+static ehci_link_t framelist[EHCI_FRAMELIST_SIZE];
+static uint8_t buffer[2][CFG_TUH_ISO_FRAMES_AHEAD*1024];
+
+static uint16_t device_len; // bytes device sends for each IN transaction
+
+static inline uint32_t addr32(void const* p)
+{
+  return (uint32_t) (uintptr_t) p;
+}
+
+static uint8_t* resolve_buffer(uint32_t addr)
+{
+  for(uint8_t i=0; i<2; i++)
+  {
+    if ( addr - addr32(buffer[i]) < sizeof(buffer[i]) ) return buffer[i] + (addr - addr32(buffer[i]));
+  }
+  TEST_FAIL_MESSAGE("unknown buffer address");
+  return NULL;
+}
+
+static void* resolve_td(uint32_t addr)
+{
+  for(uint8_t i=0; i<CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    ehci_iso_stream_t* stream = ehci_iso_get(i);
+    if ( !stream ) continue;
+
+    for(uint8_t k=0; k<CFG_TUH_ISO_FRAMES_AHEAD; k++)
+    {
+      if ( addr == addr32(&stream->itd[k]) ) return &stream->itd[k];
+      if ( addr == addr32(&stream->sitd[k]) ) return &stream->sitd[k];
+    }
+  }
+  TEST_FAIL_MESSAGE("unknown descriptor address");
+  return NULL;
+}
+
+static void itd_execute(ehci_itd_t* itd)
+{
+  bool const is_in = (itd->BufferPointer[1] & TU_BIT(11)) != 0;
+
+  for(uint8_t u=0; u<8; u++)
+  {
+    if ( !itd->xact[u].active ) continue;
+
+    if ( is_in )
+    {
+      uint32_t const addr = (itd->BufferPointer[itd->xact[u].page_select] & ~0xFFFUL) + itd->xact[u].offset;
+      uint16_t const len  = tu_min16(device_len, itd->xact[u].length);
+
+      memset(resolve_buffer(addr), 0xA0 + u, len);
+      itd->xact[u].length = len;
+    }
+    itd->xact[u].active = 0;
+  }
+}
+
+static void sitd_execute(ehci_sitd_t* sitd)
+{
+  if ( !sitd->active ) return;
+
+  if ( sitd->direction )
+  {
+    uint16_t const len = tu_min16(device_len, sitd->total_bytes);
+    memset(resolve_buffer(sitd->buffer[0]), 0x55, len);
+    sitd->total_bytes -= len;
+  }else
+  {
+    sitd->total_bytes = 0;
+  }
+  sitd->active = 0;
+}
+
+// Execute iso descriptors of a frame, stop at interrupt tree
+static void hc_run_frame(uint32_t frame)
+{
+  ehci_link_t link = framelist[frame % EHCI_FRAMELIST_SIZE];
+
+  while ( !link.terminate && link.address != QHD_TAIL )
+  {
+    void* td = resolve_td(tu_align32(link.address));
+
+    if ( link.type == EHCI_QTYPE_ITD )
+    {
+      itd_execute((ehci_itd_t*) td);
+      link = ((ehci_itd_t*) td)->next;
+    }else
+    {
+      TEST_ASSERT_EQUAL(EHCI_QTYPE_SITD, link.type);
+      sitd_execute((ehci_sitd_t*) td);
+      link = ((ehci_sitd_t*) td)->next;
+    }
+  }
+}
+
+//--------------------------------------------------------------------+
+// Stream callback
+//--------------------------------------------------------------------+
+typedef struct
+{
+  uint8_t*      buffer;
+  uint16_t      xferred_bytes;
+  xfer_result_t result;
+} cb_record_t;
+
+static cb_record_t record[32];
+static uint8_t     record_count;
+static uint16_t    next_len;
+
+static uint16_t stream_cb(uint8_t dev_addr, uint8_t ep_addr, uint8_t* buf, uint16_t xferred_bytes, xfer_result_t result)
+{
+  (void) dev_addr; (void) ep_addr;
+
+  TEST_ASSERT_LESS_THAN(TU_ARRAY_SIZE(record), record_count);
+  record[record_count++] = (cb_record_t) { buf, xferred_bytes, result };
+
+  return next_len;
+}
+
+static tusb_desc_endpoint_t ep_desc(uint8_t ep_addr, uint16_t size, uint8_t mult, uint8_t interval)
+{
+  tusb_desc_endpoint_t desc =
+  {
+    .bLength          = sizeof(tusb_desc_endpoint_t),
+    .bDescriptorType  = TUSB_DESC_ENDPOINT,
+    .bEndpointAddress = ep_addr,
+    .bmAttributes     = { .xfer = TUSB_XFER_ISOCHRONOUS },
+    .wMaxPacketSize   = { .size = size, .hs_period_mult = mult },
+    .bInterval        = interval
+  };
+  return desc;
+}
+
+static ehci_link_t link_of(void const* td, uint8_t type)
+{
+  return (ehci_link_t) { .address = addr32(td) | (type << 1) };
+}
+
+void setUp(void)
+{
+  for(uint32_t i=0; i<EHCI_FRAMELIST_SIZE; i++) framelist[i].address = QHD_TAIL;
+  ehci_iso_init(framelist);
+
+  memset(buffer, 0, sizeof(buffer));
+  memset(record, 0, sizeof(record));
+  record_count = 0;
+  next_len     = 0;
+  device_len   = 0;
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Open
+//--------------------------------------------------------------------+
+void test_open_highspeed_micro_frames(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_TRUE(stream->is_highspeed);
+  TEST_ASSERT_EQUAL_HEX8(0xFF, stream->smask);
+  TEST_ASSERT_EQUAL(512, stream->xact_bytes);
+
+  // high bandwidth: 3 transactions of 1024 every 4 micro frames
+  desc = ep_desc(0x02, 1024, 2, 3);
+  stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_EQUAL_HEX8(0x11, stream->smask);
+  TEST_ASSERT_EQUAL(3, stream->mult);
+  TEST_ASSERT_EQUAL(3072, stream->xact_bytes);
+}
+
+void test_open_unsupported(void)
+{
+  // interval longer than a frame
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 5);
+  TEST_ASSERT_NULL(ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc));
+
+  desc = ep_desc(0x81, 192, 0, 2);
+  TEST_ASSERT_NULL(ehci_iso_open(1, TUSB_SPEED_FULL, 2, 1, &desc));
+
+  // complete splits would not end within frame
+  desc = ep_desc(0x81, 1000, 0, 1);
+  TEST_ASSERT_NULL(ehci_iso_open(1, TUSB_SPEED_FULL, 2, 1, &desc));
+
+  // already opened, then out of streams
+  desc = ep_desc(0x81, 512, 0, 1);
+  TEST_ASSERT_NOT_NULL(ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc));
+  TEST_ASSERT_NULL(ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc));
+
+  for(uint8_t i=1; i<CFG_TUH_ISO_STREAM_MAX; i++)
+  {
+    desc = ep_desc(0x81 + i, 512, 0, 1);
+    TEST_ASSERT_NOT_NULL(ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc));
+  }
+
+  desc = ep_desc(0x02, 512, 0, 1);
+  TEST_ASSERT_NULL(ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc));
+}
+
+void test_open_split_masks(void)
+{
+  // IN: start split at 0, complete splits from 2 until data is done plus one
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 192, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_FULL, 2, 3, &desc);
+
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_FALSE(stream->is_highspeed);
+  TEST_ASSERT_EQUAL_HEX8(0x01, stream->smask);
+  TEST_ASSERT_EQUAL_HEX8(0x3C, stream->cmask);
+
+  // OUT: one start split per 188 bytes
+  desc = ep_desc(0x02, 600, 0, 1);
+  stream = ehci_iso_open(1, TUSB_SPEED_FULL, 2, 3, &desc);
+
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_EQUAL_HEX8(0x0F, stream->smask);
+  TEST_ASSERT_EQUAL_HEX8(0x00, stream->cmask);
+}
+
+//--------------------------------------------------------------------+
+// Schedule
+//--------------------------------------------------------------------+
+void test_start_queues_frames_ahead(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x83, 512, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(5, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100));
+
+  for(uint32_t f=100; f<100+EHCI_FRAMELIST_SIZE; f++)
+  {
+    ehci_link_t const link = framelist[f % EHCI_FRAMELIST_SIZE];
+
+    if ( f < 102 || f >= 102 + CFG_TUH_ISO_FRAMES_AHEAD )
+    {
+      TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, link.address);
+    }else
+    {
+      ehci_itd_t const* itd = &stream->itd[f-102];
+      TEST_ASSERT_EQUAL_HEX32(link_of(itd, EHCI_QTYPE_ITD).address, link.address);
+      TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, itd->next.address);
+    }
+  }
+
+  // 1024 bytes take the first 2 micro frames, interrupt on the last one
+  ehci_itd_t const* itd = &stream->itd[1];
+  uint32_t const addr = addr32(buffer[0] + 1024);
+
+  TEST_ASSERT_EQUAL(1, itd->xact[0].active);
+  TEST_ASSERT_EQUAL(512, itd->xact[0].length);
+  TEST_ASSERT_EQUAL(addr & 0xFFF, itd->xact[0].offset);
+  TEST_ASSERT_EQUAL(0, itd->xact[0].int_on_complete);
+
+  TEST_ASSERT_EQUAL(1, itd->xact[1].active);
+  TEST_ASSERT_EQUAL(512, itd->xact[1].length);
+  TEST_ASSERT_EQUAL_HEX32((addr + 512) & ~0xFFFUL, itd->BufferPointer[itd->xact[1].page_select] & ~0xFFFUL);
+  TEST_ASSERT_EQUAL((addr + 512) & 0xFFF, itd->xact[1].offset);
+  TEST_ASSERT_EQUAL(1, itd->xact[1].int_on_complete);
+
+  TEST_ASSERT_EQUAL(0, itd->xact[2].active);
+
+  TEST_ASSERT_EQUAL_HEX32((3 << 8) | 5, itd->BufferPointer[0] & 0xFFF);
+  TEST_ASSERT_EQUAL_HEX32(TU_BIT(11) | 512, itd->BufferPointer[1] & 0xFFF);
+  TEST_ASSERT_EQUAL_HEX32(1, itd->BufferPointer[2] & 0xFFF);
+}
+
+void test_restart_waits_stop_frame_over(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x83, 512, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(5, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100));
+  ehci_iso_stop(stream, 105);
+
+  for(uint32_t i=0; i<EHCI_FRAMELIST_SIZE; i++) TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, framelist[i].address);
+
+  // descriptor of frame 105 may still be executed, it is not re-armed until frame 106 is over
+  TEST_ASSERT_FALSE(ehci_iso_unlinked(stream, 106));
+  TEST_ASSERT_FALSE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 106));
+  TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, framelist[108 % EHCI_FRAMELIST_SIZE].address);
+
+  TEST_ASSERT_TRUE(ehci_iso_unlinked(stream, 107));
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 107));
+  TEST_ASSERT_EQUAL_HEX32(link_of(&stream->itd[0], EHCI_QTYPE_ITD).address, framelist[109 % EHCI_FRAMELIST_SIZE].address);
+}
+
+void test_isr_reports_and_rearms(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100));
+
+  // frame 102 is still in progress
+  ehci_iso_isr(102);
+  TEST_ASSERT_EQUAL(0, record_count);
+
+  // short first packet: data is moved to be contiguous
+  device_len = 100;
+  next_len   = 600;
+  hc_run_frame(102);
+  ehci_iso_isr(103);
+
+  TEST_ASSERT_EQUAL(1, record_count);
+  TEST_ASSERT_EQUAL_PTR(buffer[0], record[0].buffer);
+  TEST_ASSERT_EQUAL(XFER_RESULT_SUCCESS, record[0].result);
+  TEST_ASSERT_EQUAL(200, record[0].xferred_bytes);
+  TEST_ASSERT_EACH_EQUAL_HEX8(0xA0, buffer[0], 100);
+  TEST_ASSERT_EACH_EQUAL_HEX8(0xA1, buffer[0] + 100, 100);
+
+  // slot is removed from its frame and queued again after the last one
+  TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, framelist[102 % EHCI_FRAMELIST_SIZE].address);
+  TEST_ASSERT_EQUAL_HEX32(link_of(&stream->itd[0], EHCI_QTYPE_ITD).address,
+                          framelist[(102 + CFG_TUH_ISO_FRAMES_AHEAD) % EHCI_FRAMELIST_SIZE].address);
+  TEST_ASSERT_EQUAL(600, stream->itd[0].xact[0].length + stream->itd[0].xact[1].length);
+
+  // remaining slots complete in order
+  device_len = 512;
+  next_len = 1024;
+  for(uint32_t f=103; f<102 + CFG_TUH_ISO_FRAMES_AHEAD; f++) hc_run_frame(f);
+  ehci_iso_isr(102 + CFG_TUH_ISO_FRAMES_AHEAD);
+
+  TEST_ASSERT_EQUAL(CFG_TUH_ISO_FRAMES_AHEAD, record_count);
+  for(uint8_t k=1; k<CFG_TUH_ISO_FRAMES_AHEAD; k++)
+  {
+    TEST_ASSERT_EQUAL_PTR(buffer[0] + 1024*k, record[k].buffer);
+    TEST_ASSERT_EQUAL(1024, record[k].xferred_bytes);
+    TEST_ASSERT_EQUAL(XFER_RESULT_SUCCESS, record[k].result);
+  }
+}
+
+void test_isr_late_skips_ahead(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x01, 512, 0, 2);
+  ehci_iso_stream_t* stream = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  next_len = 512;
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 1024, stream_cb, 100));
+
+  // interrupt is serviced long after, frames are missed and slots queued from frame after next
+  ehci_iso_isr(300);
+
+  TEST_ASSERT_EQUAL(CFG_TUH_ISO_FRAMES_AHEAD, record_count);
+  for(uint8_t k=0; k<CFG_TUH_ISO_FRAMES_AHEAD; k++)
+  {
+    TEST_ASSERT_EQUAL(XFER_RESULT_FAILED, record[k].result);
+    TEST_ASSERT_EQUAL(0, record[k].xferred_bytes);
+    TEST_ASSERT_EQUAL(302 + k, stream->frame[k]);
+
+    // OUT of 512 bytes takes a single micro frame
+    TEST_ASSERT_EQUAL(512, stream->itd[k].xact[0].length);
+    TEST_ASSERT_EQUAL(0, stream->itd[k].xact[2].active);
+  }
+
+  for(uint32_t f=0; f<EHCI_FRAMELIST_SIZE; f++)
+  {
+    uint32_t const frame = 300 + f;
+    bool const queued = (frame >= 302) && (frame < 302 + CFG_TUH_ISO_FRAMES_AHEAD);
+    TEST_ASSERT_EQUAL(queued, framelist[frame % EHCI_FRAMELIST_SIZE].address != QHD_TAIL);
+  }
+}
+
+void test_split_out_descriptor(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x02, 600, 0, 1);
+  ehci_iso_stream_t* stream = ehci_iso_open(4, TUSB_SPEED_FULL, 2, 3, &desc);
+
+  TEST_ASSERT_TRUE(ehci_iso_start(stream, buffer[0], 400, stream_cb, 0));
+
+  ehci_sitd_t const* sitd = &stream->sitd[0];
+  TEST_ASSERT_EQUAL_HEX32(link_of(sitd, EHCI_QTYPE_SITD).address, framelist[2].address);
+
+  TEST_ASSERT_EQUAL(4, sitd->dev_addr);
+  TEST_ASSERT_EQUAL(2, sitd->ep_number);
+  TEST_ASSERT_EQUAL(2, sitd->hub_addr);
+  TEST_ASSERT_EQUAL(3, sitd->port_number);
+  TEST_ASSERT_EQUAL(0, sitd->direction);
+  TEST_ASSERT_EQUAL_HEX8(0x0F, sitd->int_smask);
+  TEST_ASSERT_EQUAL(400, sitd->total_bytes);
+  TEST_ASSERT_EQUAL(1, sitd->active);
+  TEST_ASSERT_EQUAL(1, sitd->int_on_complete);
+  TEST_ASSERT_EQUAL(1, sitd->back.terminate);
+
+  // 400 bytes: 3 start splits beginning with transaction position "begin"
+  TEST_ASSERT_EQUAL_HEX32(addr32(buffer[0]), sitd->buffer[0]);
+  TEST_ASSERT_EQUAL_HEX32((1 << 3) | 3, sitd->buffer[1] & 0x1F);
+
+  next_len = 100;
+  hc_run_frame(2);
+  ehci_iso_isr(3);
+
+  TEST_ASSERT_EQUAL(1, record_count);
+  TEST_ASSERT_EQUAL(400, record[0].xferred_bytes);
+  TEST_ASSERT_EQUAL(100, sitd->total_bytes);
+  TEST_ASSERT_EQUAL_HEX32(1, sitd->buffer[1] & 0x1F);
+}
+
+void test_streams_share_frames(void)
+{
+  tusb_desc_endpoint_t desc = ep_desc(0x81, 512, 0, 1);
+  ehci_iso_stream_t* hs = ehci_iso_open(1, TUSB_SPEED_HIGH, 0, 0, &desc);
+
+  desc = ep_desc(0x82, 192, 0, 1);
+  ehci_iso_stream_t* fs = ehci_iso_open(2, TUSB_SPEED_FULL, 1, 1, &desc);
+
+  // full speed stream starts one frame later, its descriptors follow high speed ones in shared frames
+  TEST_ASSERT_TRUE(ehci_iso_start(fs, buffer[1], 192, stream_cb, 101));
+  TEST_ASSERT_TRUE(ehci_iso_start(hs, buffer[0], 512, stream_cb, 100));
+
+  TEST_ASSERT_EQUAL_HEX32(link_of(&hs->itd[0], EHCI_QTYPE_ITD).address, framelist[102 % EHCI_FRAMELIST_SIZE].address);
+  TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, hs->itd[0].next.address);
+
+  TEST_ASSERT_EQUAL_HEX32(link_of(&hs->itd[1], EHCI_QTYPE_ITD).address, framelist[103 % EHCI_FRAMELIST_SIZE].address);
+  TEST_ASSERT_EQUAL_HEX32(link_of(&fs->sitd[0], EHCI_QTYPE_SITD).address, hs->itd[1].next.address);
+  TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, fs->sitd[0].next.address);
+
+  // both complete in the same interrupt
+  device_len = 192;
+  next_len   = 192;
+  hc_run_frame(102);
+  hc_run_frame(103);
+  ehci_iso_isr(104);
+
+  TEST_ASSERT_EQUAL(3, record_count);
+  TEST_ASSERT_EQUAL(192, record[0].xferred_bytes);
+  TEST_ASSERT_EQUAL(192, record[1].xferred_bytes);
+  TEST_ASSERT_EQUAL_PTR(buffer[1], record[2].buffer);
+  TEST_ASSERT_EQUAL(192, record[2].xferred_bytes);
+  TEST_ASSERT_EACH_EQUAL_HEX8(0x55, buffer[1], 192);
+
+  // stopping the first stream keeps the other one reachable
+  ehci_iso_stop(hs, 104);
+
+  for(uint32_t f=104; f<104 + CFG_TUH_ISO_FRAMES_AHEAD; f++)
+  {
+    uint8_t const k = (uint8_t) ((f - 103) % CFG_TUH_ISO_FRAMES_AHEAD);
+    TEST_ASSERT_EQUAL_HEX32(link_of(&fs->sitd[k], EHCI_QTYPE_SITD).address, framelist[f % EHCI_FRAMELIST_SIZE].address);
+  }
+  TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, framelist[(104 + CFG_TUH_ISO_FRAMES_AHEAD) % EHCI_FRAMELIST_SIZE].address);
+
+  ehci_iso_close(fs);
+  for(uint32_t i=0; i<EHCI_FRAMELIST_SIZE; i++) TEST_ASSERT_EQUAL_HEX32(QHD_TAIL, framelist[i].address);
+}
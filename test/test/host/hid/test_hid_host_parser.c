@@ -0,0 +1,332 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "unity.h"
+
+// Files to test
+#include "hid_host_parser.h"
+
+//--------------------------------------------------------------------+
+// Report Descriptors, same layout as device templates
+//--------------------------------------------------------------------+
+#define DESC_KEYBOARD(...) \
+  HID_USAGE_PAGE ( HID_USAGE_PAGE_DESKTOP     ), \
+  HID_USAGE      ( HID_USAGE_DESKTOP_KEYBOARD ), \
+  HID_COLLECTION ( HID_COLLECTION_APPLICATION ), \
+    __VA_ARGS__ \
+    HID_USAGE_PAGE   ( HID_USAGE_PAGE_KEYBOARD ), \
+    HID_USAGE_MIN    ( 224                     ), \
+    HID_USAGE_MAX    ( 231                     ), \
+    HID_LOGICAL_MIN  ( 0                       ), \
+    HID_LOGICAL_MAX  ( 1                       ), \
+    HID_REPORT_COUNT ( 8                       ), \
+    HID_REPORT_SIZE  ( 1                       ), \
+    HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ), \
+    HID_REPORT_COUNT ( 1                       ), \
+    HID_REPORT_SIZE  ( 8                       ), \
+    HID_INPUT        ( HID_CONSTANT            ), \
+    HID_USAGE_MIN    ( 0                       ), \
+    HID_USAGE_MAX    ( 255                     ), \
+    HID_LOGICAL_MIN  ( 0                       ), \
+    HID_LOGICAL_MAX  ( 255                     ), \
+    HID_REPORT_COUNT ( 6                       ), \
+    HID_REPORT_SIZE  ( 8                       ), \
+    HID_INPUT        ( HID_DATA | HID_ARRAY | HID_ABSOLUTE ), \
+    HID_USAGE_PAGE   ( HID_USAGE_PAGE_LED      ), \
+    HID_USAGE_MIN    ( 1                       ), \
+    HID_USAGE_MAX    ( 5                       ), \
+    HID_REPORT_COUNT ( 5                       ), \
+    HID_REPORT_SIZE  ( 1                       ), \
+    HID_OUTPUT       ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ), \
+    HID_REPORT_COUNT ( 1                       ), \
+    HID_REPORT_SIZE  ( 3                       ), \
+    HID_OUTPUT       ( HID_CONSTANT            ), \
+  HID_COLLECTION_END
+
+#define DESC_MOUSE(...) \
+  HID_USAGE_PAGE ( HID_USAGE_PAGE_DESKTOP     ), \
+  HID_USAGE      ( HID_USAGE_DESKTOP_MOUSE    ), \
+  HID_COLLECTION ( HID_COLLECTION_APPLICATION ), \
+    __VA_ARGS__ \
+    HID_USAGE      ( HID_USAGE_DESKTOP_POINTER ), \
+    HID_COLLECTION ( HID_COLLECTION_PHYSICAL   ), \
+      HID_USAGE_PAGE   ( HID_USAGE_PAGE_BUTTON ), \
+      HID_USAGE_MIN    ( 1                     ), \
+      HID_USAGE_MAX    ( 5                     ), \
+      HID_LOGICAL_MIN  ( 0                     ), \
+      HID_LOGICAL_MAX  ( 1                     ), \
+      HID_REPORT_COUNT ( 5                     ), \
+      HID_REPORT_SIZE  ( 1                     ), \
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ), \
+      HID_REPORT_COUNT ( 1                     ), \
+      HID_REPORT_SIZE  ( 3                     ), \
+      HID_INPUT        ( HID_CONSTANT          ), \
+      HID_USAGE_PAGE   ( HID_USAGE_PAGE_DESKTOP ), \
+      HID_USAGE        ( HID_USAGE_DESKTOP_X   ), \
+      HID_USAGE        ( HID_USAGE_DESKTOP_Y   ), \
+      HID_LOGICAL_MIN  ( 0x81                  ), \
+      HID_LOGICAL_MAX  ( 0x7f                  ), \
+      HID_REPORT_COUNT ( 2                     ), \
+      HID_REPORT_SIZE  ( 8                     ), \
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_RELATIVE ), \
+      HID_USAGE        ( HID_USAGE_DESKTOP_WHEEL ), \
+      HID_REPORT_COUNT ( 1                     ), \
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_RELATIVE ), \
+      HID_USAGE_PAGE   ( HID_USAGE_PAGE_CONSUMER ), \
+      HID_USAGE_N      ( HID_USAGE_CONSUMER_AC_PAN, 2 ), \
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_RELATIVE ), \
+    HID_COLLECTION_END, \
+  HID_COLLECTION_END
+
+static tuh_hid_report_map_t map;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+//
+//--------------------------------------------------------------------+
+void test_keyboard(void)
+{
+  uint8_t const desc[] = { DESC_KEYBOARD() };
+  TEST_ASSERT_TRUE( tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)) );
+
+  TEST_ASSERT_EQUAL(HID_USAGE_PAGE_DESKTOP, map.usage_page);
+  TEST_ASSERT_EQUAL(HID_USAGE_DESKTOP_KEYBOARD, map.usage);
+
+  // modifier, keycodes, led
+  TEST_ASSERT_EQUAL(3, map.field_count);
+  TEST_ASSERT_EQUAL(8, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0));
+  TEST_ASSERT_EQUAL(1, tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 0));
+  TEST_ASSERT_EQUAL(0, tuh_hid_report_length(&map, HID_REPORT_TYPE_FEATURE, 0));
+
+  tuh_hid_field_t const* keycode = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_KEYBOARD, HID_KEY_A);
+  TEST_ASSERT_NOT_NULL(keycode);
+  TEST_ASSERT_EQUAL(16, keycode->bit_offset);
+  TEST_ASSERT_EQUAL(6, keycode->count);
+  TEST_ASSERT_EQUAL(255, keycode->logical_max); // 1-byte 0xFF
+  TEST_ASSERT_FALSE(keycode->flags & HID_VARIABLE);
+
+  tuh_hid_field_t const* shift = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_KEYBOARD, HID_KEY_SHIFT_LEFT);
+  TEST_ASSERT_NOT_NULL(shift);
+  TEST_ASSERT_EQUAL(0, shift->bit_offset);
+
+  uint8_t const report[8] = { 0x02, 0, HID_KEY_A, 0x05, 0, 0, 0, 0 };
+  TEST_ASSERT_EQUAL(1, tuh_hid_field_get_usage_value(shift, report, HID_KEY_SHIFT_LEFT));
+  TEST_ASSERT_EQUAL(0, tuh_hid_field_get_usage_value(shift, report, HID_KEY_CONTROL_LEFT));
+  TEST_ASSERT_TRUE (tuh_hid_field_array_contains(keycode, report, HID_KEY_A));
+  TEST_ASSERT_TRUE (tuh_hid_field_array_contains(keycode, report, 0x05));
+  TEST_ASSERT_FALSE(tuh_hid_field_array_contains(keycode, report, 0x06));
+
+  tuh_hid_field_t const* led = tuh_hid_find_field(&map, HID_REPORT_TYPE_OUTPUT, HID_USAGE_PAGE_LED, 2);
+  TEST_ASSERT_NOT_NULL(led);
+  TEST_ASSERT_EQUAL(5, led->count);
+
+  // LED usage is not in input report
+  TEST_ASSERT_NULL( tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_LED, 2) );
+}
+
+void test_mouse(void)
+{
+  uint8_t const desc[] = { DESC_MOUSE() };
+  TEST_ASSERT_TRUE( tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)) );
+
+  TEST_ASSERT_EQUAL(HID_USAGE_DESKTOP_MOUSE, map.usage);
+  TEST_ASSERT_EQUAL(5, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0));
+
+  tuh_hid_field_t const* buttons = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_BUTTON, 1);
+  tuh_hid_field_t const* x       = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_X);
+  tuh_hid_field_t const* y       = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_Y);
+  tuh_hid_field_t const* wheel   = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_WHEEL);
+  tuh_hid_field_t const* pan     = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_CONSUMER, HID_USAGE_CONSUMER_AC_PAN);
+
+  TEST_ASSERT_NOT_NULL(buttons);
+  TEST_ASSERT_NOT_NULL(wheel);
+  TEST_ASSERT_NOT_NULL(pan);
+
+  // X and Y have consecutive usages and share one field
+  TEST_ASSERT_EQUAL_PTR(x, y);
+  TEST_ASSERT_EQUAL(8, x->bit_offset);
+  TEST_ASSERT_EQUAL(-127, x->logical_min);
+  TEST_ASSERT_EQUAL(127, x->logical_max);
+  TEST_ASSERT_TRUE(x->flags & HID_RELATIVE);
+  TEST_ASSERT_EQUAL(24, wheel->bit_offset);
+  TEST_ASSERT_EQUAL(32, pan->bit_offset);
+
+  uint8_t const report[] = { 0x05, 0xFF, 0x10, 0x81, 0x03 };
+  TEST_ASSERT_EQUAL(1   , tuh_hid_field_get_usage_value(buttons, report, 1));
+  TEST_ASSERT_EQUAL(0   , tuh_hid_field_get_usage_value(buttons, report, 2));
+  TEST_ASSERT_EQUAL(1   , tuh_hid_field_get_usage_value(buttons, report, 3));
+  TEST_ASSERT_EQUAL(-1  , tuh_hid_field_get_usage_value(x, report, HID_USAGE_DESKTOP_X));
+  TEST_ASSERT_EQUAL(16  , tuh_hid_field_get_usage_value(y, report, HID_USAGE_DESKTOP_Y));
+  TEST_ASSERT_EQUAL(-127, tuh_hid_field_get_value(wheel, report, 0));
+  TEST_ASSERT_EQUAL(3   , tuh_hid_field_get_value(pan, report, 0));
+}
+
+void test_report_id(void)
+{
+  uint8_t const desc[] =
+  {
+    DESC_KEYBOARD( HID_REPORT_ID(1) ),
+    DESC_MOUSE   ( HID_REPORT_ID(2) )
+  };
+  TEST_ASSERT_TRUE( tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)) );
+
+  // first application collection
+  TEST_ASSERT_EQUAL(HID_USAGE_DESKTOP_KEYBOARD, map.usage);
+  TEST_ASSERT_EQUAL(2, map.report_count);
+
+  TEST_ASSERT_EQUAL(9, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 1));
+  TEST_ASSERT_EQUAL(2, tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 1));
+  TEST_ASSERT_EQUAL(6, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 2));
+  TEST_ASSERT_EQUAL(0, tuh_hid_report_length(&map, HID_REPORT_TYPE_OUTPUT, 2));
+  TEST_ASSERT_EQUAL(0, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT , 3));
+
+  tuh_hid_field_t const* x = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_X);
+  TEST_ASSERT_NOT_NULL(x);
+  TEST_ASSERT_EQUAL(2, x->report_id);
+  TEST_ASSERT_EQUAL(16, x->bit_offset); // after report ID and buttons
+
+  uint8_t const kbd_report[]   = { 1, 0, 0, HID_KEY_A, 0, 0, 0, 0, 0 };
+  uint8_t const mouse_report[] = { 2, 0, 0xFE, 0, 0, 0 };
+
+  TEST_ASSERT_FALSE( tuh_hid_field_in_report(x, kbd_report) );
+  TEST_ASSERT_TRUE ( tuh_hid_field_in_report(x, mouse_report) );
+  TEST_ASSERT_EQUAL(-2, tuh_hid_field_get_usage_value(x, mouse_report, HID_USAGE_DESKTOP_X));
+}
+
+// Digitizer-like fields that are not byte aligned
+void test_unaligned_fields(void)
+{
+  uint8_t const desc[] =
+  {
+    HID_USAGE_PAGE   ( HID_USAGE_PAGE_DIGITIZER ),
+    HID_USAGE        ( 0x02                     ),
+    HID_COLLECTION   ( HID_COLLECTION_APPLICATION ),
+      HID_USAGE        ( 0x42                   ), // tip switch
+      HID_LOGICAL_MIN  ( 0                      ),
+      HID_LOGICAL_MAX  ( 1                      ),
+      HID_REPORT_SIZE  ( 1                      ),
+      HID_REPORT_COUNT ( 1                      ),
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ),
+      HID_REPORT_SIZE  ( 3                      ),
+      HID_INPUT        ( HID_CONSTANT           ),
+      HID_PUSH,
+      HID_USAGE_PAGE   ( HID_USAGE_PAGE_DESKTOP ),
+      HID_USAGE        ( HID_USAGE_DESKTOP_X    ),
+      HID_USAGE        ( HID_USAGE_DESKTOP_Y    ),
+      HID_LOGICAL_MAX_N( 4095, 2                ),
+      HID_REPORT_SIZE  ( 12                     ),
+      HID_REPORT_COUNT ( 2                      ),
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ),
+      HID_POP,
+      // 16-bit signed and 32-bit counter after 4 bit padding
+      HID_USAGE        ( 0x3D                   ), // X tilt
+      HID_LOGICAL_MIN_N( -9000, 2               ),
+      HID_LOGICAL_MAX_N( 9000, 2                ),
+      HID_REPORT_SIZE  ( 16                     ),
+      HID_REPORT_COUNT ( 1                      ),
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ),
+      HID_USAGE        ( 0x56                   ), // scan time
+      HID_LOGICAL_MIN  ( 0                      ),
+      HID_LOGICAL_MAX_N( 0x7fffffff, 3          ),
+      HID_REPORT_SIZE  ( 32                     ),
+      HID_INPUT        ( HID_DATA | HID_VARIABLE | HID_ABSOLUTE ),
+    HID_COLLECTION_END
+  };
+  TEST_ASSERT_TRUE( tuh_hid_parse_report_descriptor(&map, desc, sizeof(desc)) );
+
+  // 4 + 24 + 16 + 32 bits
+  TEST_ASSERT_EQUAL(10, tuh_hid_report_length(&map, HID_REPORT_TYPE_INPUT, 0));
+
+  tuh_hid_field_t const* tip  = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x42);
+  tuh_hid_field_t const* xy   = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DESKTOP, HID_USAGE_DESKTOP_Y);
+  tuh_hid_field_t const* tilt = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x3D);
+  tuh_hid_field_t const* scan = tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_DIGITIZER, 0x56);
+
+  TEST_ASSERT_NOT_NULL(tip);
+  TEST_ASSERT_NOT_NULL(xy);
+  TEST_ASSERT_NOT_NULL(scan);
+
+  // usage page is restored by pop
+  TEST_ASSERT_NOT_NULL(tilt);
+  TEST_ASSERT_EQUAL(28, tilt->bit_offset);
+  TEST_ASSERT_EQUAL(4095, xy->logical_max);
+
+  // tip = 1, X = 0xABC, Y = 0x123, tilt = -2, scan = 0x12345678
+  uint8_t const report[] = { 0xC1, 0xAB, 0x23, 0xE1, 0xFF, 0x8F, 0x67, 0x45, 0x23, 0x01 };
+
+  TEST_ASSERT_EQUAL(1     , tuh_hid_field_get_value(tip, report, 0));
+  TEST_ASSERT_EQUAL(0xABC , tuh_hid_field_get_usage_value(xy, report, HID_USAGE_DESKTOP_X));
+  TEST_ASSERT_EQUAL(0x123 , tuh_hid_field_get_usage_value(xy, report, HID_USAGE_DESKTOP_Y));
+  TEST_ASSERT_EQUAL(-2    , tuh_hid_field_get_value(tilt, report, 0));
+  TEST_ASSERT_EQUAL_HEX32(0x12345678, tuh_hid_field_get_raw(scan, report, 0));
+}
+
+void test_malformed(void)
+{
+  // truncated 2-byte logical maximum
+  uint8_t const truncated[] = { HID_USAGE_PAGE(HID_USAGE_PAGE_DESKTOP), 0x26, 0xFF };
+  TEST_ASSERT_FALSE( tuh_hid_parse_report_descriptor(&map, truncated, sizeof(truncated)) );
+
+  // unbalanced collection end
+  uint8_t const unbalanced[] = { HID_COLLECTION_END };
+  TEST_ASSERT_FALSE( tuh_hid_parse_report_descriptor(&map, unbalanced, sizeof(unbalanced)) );
+
+  // pop without push
+  uint8_t const pop[] = { HID_POP };
+  TEST_ASSERT_FALSE( tuh_hid_parse_report_descriptor(&map, pop, sizeof(pop)) );
+}
+
+void test_too_many_fields(void)
+{
+  // each input has a single usage which is a separate field
+  uint8_t desc[6*(CFG_TUH_HID_FIELD_MAX+1) + 6];
+  uint8_t* p = desc;
+
+  uint8_t const header[] = { HID_USAGE_PAGE(HID_USAGE_PAGE_BUTTON), HID_REPORT_SIZE(1), HID_REPORT_COUNT(1) };
+  memcpy(p, header, sizeof(header));
+  p += sizeof(header);
+
+  for(uint8_t i=0; i<CFG_TUH_HID_FIELD_MAX+1; i++)
+  {
+    // skip one usage each time so that fields are not merged
+    uint8_t const item[] = { HID_USAGE(2*i+1), HID_INPUT(HID_DATA | HID_VARIABLE), HID_INPUT(HID_CONSTANT) };
+    memcpy(p, item, sizeof(item));
+    p += sizeof(item);
+  }
+
+  TEST_ASSERT_FALSE( tuh_hid_parse_report_descriptor(&map, desc, (uint16_t) (p - desc)) );
+  TEST_ASSERT_EQUAL(CFG_TUH_HID_FIELD_MAX, map.field_count);
+
+  // compiled fields are still usable
+  TEST_ASSERT_NOT_NULL( tuh_hid_find_field(&map, HID_REPORT_TYPE_INPUT, HID_USAGE_PAGE_BUTTON, 1) );
+}
@@ -0,0 +1,151 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include "unity.h"
+
+// Files to test
+#include "hid_host_ring.h"
+
+enum
+{
+  DEPTH = CFG_TUH_HID_RING_DEPTH,
+  ARMED = CFG_TUH_HID_RING_ARMED
+};
+
+static tuh_hid_ring_t ring;
+
+// queue all free transfer buffers as driver does, return number of buffers queued
+static uint8_t arm(uint8_t* buffers[])
+{
+  uint8_t count = 0;
+  uint8_t* buffer;
+  while ( NULL != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+  {
+    if ( buffers ) buffers[count] = buffer;
+    count++;
+    tuh_hid_ring_xfer_queued(&ring);
+  }
+  return count;
+}
+
+// complete oldest transfer with report of given value
+static void receive(uint8_t value, uint32_t timestamp)
+{
+  uint8_t* buffer = ring.xfer_buf[ring.xfer_rd];
+  memset(buffer, value, 8);
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, timestamp);
+  arm(NULL);
+}
+
+void setUp(void)
+{
+  tuh_hid_ring_init(&ring);
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_arm_all_buffers(void)
+{
+  uint8_t* buffers[ARMED];
+  TEST_ASSERT_EQUAL(ARMED, arm(buffers));
+  TEST_ASSERT_NULL(tuh_hid_ring_xfer_buffer(&ring));
+
+  for(uint8_t i=1; i<ARMED; i++) TEST_ASSERT_TRUE(buffers[i] != buffers[0]);
+
+  // completed buffer is queued again, others stay queued
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, 0);
+  TEST_ASSERT_EQUAL_PTR(buffers[0], tuh_hid_ring_xfer_buffer(&ring));
+  TEST_ASSERT_EQUAL(1, arm(NULL));
+}
+
+void test_reports_in_order(void)
+{
+  arm(NULL);
+
+  for(uint8_t i=0; i<5; i++) receive(i, 100+i);
+  TEST_ASSERT_EQUAL(5, tuh_hid_ring_count(&ring));
+
+  tuh_hid_report_t report;
+  for(uint8_t i=0; i<5; i++)
+  {
+    TEST_ASSERT_TRUE(tuh_hid_ring_read(&ring, &report));
+    TEST_ASSERT_EQUAL(100+i, report.timestamp);
+    TEST_ASSERT_EQUAL(8, report.len);
+    TEST_ASSERT_EACH_EQUAL_UINT8(i, report.data, 8);
+  }
+
+  TEST_ASSERT_FALSE(tuh_hid_ring_read(&ring, &report));
+  TEST_ASSERT_EQUAL(5, tuh_hid_ring_get_stats(&ring)->report_count);
+  TEST_ASSERT_EQUAL(5, tuh_hid_ring_get_stats(&ring)->max_unread);
+}
+
+void test_overrun_keeps_newest(void)
+{
+  arm(NULL);
+
+  for(uint8_t i=0; i<DEPTH+3; i++) receive(i, i);
+
+  TEST_ASSERT_EQUAL(DEPTH, tuh_hid_ring_count(&ring));
+  TEST_ASSERT_EQUAL(3, tuh_hid_ring_get_stats(&ring)->overrun_count);
+
+  // endpoint stays armed
+  TEST_ASSERT_EQUAL(ARMED, ring.xfer_count);
+
+  tuh_hid_report_t report;
+  TEST_ASSERT_TRUE(tuh_hid_ring_read(&ring, &report));
+  TEST_ASSERT_EQUAL(3, report.data[0]);
+}
+
+void test_failed_and_empty_transfer(void)
+{
+  arm(NULL);
+
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 0, 1);
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_STALLED, 0, 2);
+
+  TEST_ASSERT_EQUAL(0, tuh_hid_ring_count(&ring));
+  TEST_ASSERT_EQUAL(1, tuh_hid_ring_get_stats(&ring)->error_count);
+  TEST_ASSERT_EQUAL(ARMED-2, ring.xfer_count);
+}
+
+void test_init_discards_transfers(void)
+{
+  arm(NULL);
+  receive(1, 1);
+
+  tuh_hid_ring_init(&ring);
+  TEST_ASSERT_EQUAL(0, tuh_hid_ring_count(&ring));
+
+  // completion of transfer queued before is ignored
+  tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, 8, 2);
+  TEST_ASSERT_EQUAL(0, tuh_hid_ring_count(&ring));
+  TEST_ASSERT_EQUAL(0, tuh_hid_ring_get_stats(&ring)->report_count);
+}
@@ -0,0 +1,200 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+// Files to test
+#include "hid_host_ring.h"
+
+enum
+{
+  ARMED = CFG_TUH_HID_RING_ARMED
+};
+
+static tuh_hid_ring_t ring;
+
+void setUp(void)
+{
+  tuh_hid_ring_init(&ring);
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Sustained report rate benchmark
+// High speed device reports every microframe (8 kHz). Completions are processed by main loop running tuh_task()
+// every TASK_US, which is held up once per ms by STALL_US of other work. Single buffer re-armed by application
+// in callback is compared with ring keeping CFG_TUH_HID_RING_ARMED transfers queued.
+//--------------------------------------------------------------------+
+enum
+{
+  TICK_US      = 25,
+  POLL_US      = 125,
+  TASK_US      = 50,
+  STALL_US     = 150,
+  BENCH_MS     = 10000,
+  REPORT_LEN   = 8,
+  CTRL_MAX     = ARMED > 1 ? ARMED : 1
+};
+
+typedef struct
+{
+  uint32_t received;
+  uint32_t lost;
+  uint64_t latency_sum;
+  uint32_t latency_max;
+} bench_result_t;
+
+static uint32_t bench_rand(uint32_t* seed)
+{
+  *seed = (*seed) * 1103515245u + 12345u;
+  return (*seed) >> 16;
+}
+
+static void bench_app_read(bench_result_t* result, uint32_t* next_seq, uint32_t seq, uint32_t now)
+{
+  TEST_ASSERT_TRUE(seq >= *next_seq);
+  result->lost += seq - *next_seq;
+  result->received++;
+  *next_seq = seq + 1;
+
+  uint32_t const latency = now - seq*POLL_US;
+  result->latency_sum += latency;
+  if ( latency > result->latency_max ) result->latency_max = latency;
+}
+
+static void bench_run(bool use_ring, bench_result_t* result)
+{
+  tu_memclr(result, sizeof(bench_result_t));
+  tuh_hid_ring_init(&ring);
+
+  // interrupt transfers queued on host controller and completions waiting for tuh_task()
+  uint8_t* ctrl[CTRL_MAX];
+  uint8_t  ctrl_count = 0;
+  uint8_t  done_count = 0;
+
+  // legacy: single buffer owned by application
+  uint8_t legacy_buf[REPORT_LEN];
+
+  uint32_t next_seq   = 0;
+  uint32_t stall_from = 0;
+  uint32_t seed       = 1;
+
+  if ( use_ring )
+  {
+    uint8_t* buffer;
+    while ( NULL != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+    {
+      ctrl[ctrl_count++] = buffer;
+      tuh_hid_ring_xfer_queued(&ring);
+    }
+  }
+  else
+  {
+    ctrl[ctrl_count++] = legacy_buf;
+  }
+
+  for(uint32_t now = 0; now < BENCH_MS*1000; now += TICK_US)
+  {
+    // device sends report of microframe if a transfer is queued, otherwise it is lost
+    if ( now % POLL_US == 0 && ctrl_count )
+    {
+      uint32_t const seq = now / POLL_US;
+      memcpy(ctrl[0], &seq, sizeof(seq));
+      memmove(&ctrl[0], &ctrl[1], (CTRL_MAX-1)*sizeof(uint8_t*));
+      ctrl_count--;
+      done_count++;
+    }
+
+    // main loop is held up once per ms at random point, stalls of adjacent ms do not join
+    if ( now % 1000 == 0 ) stall_from = now + STALL_US + (bench_rand(&seed) % ((1000 - 3*STALL_US)/TICK_US))*TICK_US;
+    if ( now >= stall_from && now < stall_from + STALL_US ) continue;
+    if ( now % TASK_US ) continue;
+
+    // tuh_task() then application
+    if ( use_ring )
+    {
+      for(; done_count; done_count--)
+      {
+        tuh_hid_ring_xfer_complete(&ring, XFER_RESULT_SUCCESS, REPORT_LEN, now);
+
+        uint8_t* buffer;
+        while ( NULL != (buffer = tuh_hid_ring_xfer_buffer(&ring)) )
+        {
+          ctrl[ctrl_count++] = buffer;
+          tuh_hid_ring_xfer_queued(&ring);
+        }
+      }
+
+      tuh_hid_report_t report;
+      while ( tuh_hid_ring_read(&ring, &report) )
+      {
+        uint32_t seq;
+        memcpy(&seq, report.data, sizeof(seq));
+        bench_app_read(result, &next_seq, seq, now);
+      }
+    }
+    else if ( done_count )
+    {
+      // isr callback reads report then calls get_report() to re-arm
+      uint32_t seq;
+      memcpy(&seq, legacy_buf, sizeof(seq));
+      bench_app_read(result, &next_seq, seq, now);
+
+      done_count = 0;
+      ctrl[ctrl_count++] = legacy_buf;
+    }
+  }
+}
+
+void test_benchmark_report_rate(void)
+{
+  bench_result_t legacy, ringed;
+  bench_run(false, &legacy);
+  bench_run(true , &ringed);
+
+  uint32_t const total = BENCH_MS*1000/POLL_US;
+
+  char msg[200];
+  snprintf(msg, sizeof(msg), "8 kHz reports/s %lu -> %lu, lost %lu -> %lu, latency avg %lu -> %lu us max %lu -> %lu us, overrun %lu",
+           (unsigned long) (legacy.received/(BENCH_MS/1000)), (unsigned long) (ringed.received/(BENCH_MS/1000)),
+           (unsigned long) legacy.lost, (unsigned long) ringed.lost,
+           (unsigned long) (legacy.latency_sum/legacy.received), (unsigned long) (ringed.latency_sum/ringed.received),
+           (unsigned long) legacy.latency_max, (unsigned long) ringed.latency_max,
+           (unsigned long) tuh_hid_ring_get_stats(&ring)->overrun_count);
+  TEST_MESSAGE(msg);
+
+  // every report of every microframe is received, the last one may still be in flight
+  TEST_ASSERT_TRUE(legacy.lost > 0);
+  TEST_ASSERT_EQUAL(0, ringed.lost);
+  TEST_ASSERT_TRUE(ringed.received + 2 >= total);
+  TEST_ASSERT_EQUAL(0, tuh_hid_ring_get_stats(&ring)->overrun_count);
+}
@@ -0,0 +1,238 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <stdlib.h>
+
+#include "unity.h"
+
+// Files to test
+#include "msc_host_cache.h"
+
+//--------------------------------------------------------------------+
+// RAM disk stand-in for MassStorage device
+//--------------------------------------------------------------------+
+enum
+{
+  DISK_BLOCK_NUM  = 1024,
+  DISK_BLOCK_SIZE = CFG_TUH_MSC_CACHE_BLOCK_SIZE
+};
+
+static uint8_t ram_disk[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+static uint8_t shadow[DISK_BLOCK_NUM][DISK_BLOCK_SIZE]; // expected content as seen by application
+
+static uint32_t disk_reads, disk_writes;
+
+static bool ram_read(void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count)
+{
+  (void) ctx;
+  TEST_ASSERT_TRUE(lba + count <= DISK_BLOCK_NUM);
+
+  disk_reads++;
+  memcpy(buffer, ram_disk[lba], count*DISK_BLOCK_SIZE);
+  return true;
+}
+
+static bool ram_write(void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count)
+{
+  (void) ctx;
+  TEST_ASSERT_TRUE(lba + count <= DISK_BLOCK_NUM);
+
+  disk_writes++;
+  memcpy(ram_disk[lba], buffer, count*DISK_BLOCK_SIZE);
+  return true;
+}
+
+static tuh_msc_cache_backend_t const ram_backend = { .read = ram_read, .write = ram_write };
+
+static tuh_msc_cache_t cache;
+static uint8_t buf[16][DISK_BLOCK_SIZE];
+
+static void fill_sector(uint8_t* sector, uint32_t lba, uint32_t gen)
+{
+  for(uint32_t i=0; i<DISK_BLOCK_SIZE; i++) sector[i] = (uint8_t) (lba*7 + gen*13 + i);
+}
+
+void setUp(void)
+{
+  for(uint32_t lba=0; lba<DISK_BLOCK_NUM; lba++) fill_sector(ram_disk[lba], lba, 0);
+  memcpy(shadow, ram_disk, sizeof(ram_disk));
+
+  disk_reads = disk_writes = 0;
+  tuh_msc_cache_init(&cache, &ram_backend, NULL, DISK_BLOCK_NUM);
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_read_hit(void)
+{
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 5, buf[0], 1) );
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 100, buf[1], 1) );
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 5, buf[2], 1) );
+
+  TEST_ASSERT_EQUAL(2, disk_reads);
+  TEST_ASSERT_EQUAL_MEMORY(shadow[5], buf[2], DISK_BLOCK_SIZE);
+  TEST_ASSERT_EQUAL(1, tuh_msc_cache_get_stats(&cache)->read_hits);
+  TEST_ASSERT_EQUAL(2, tuh_msc_cache_get_stats(&cache)->read_misses);
+  TEST_ASSERT_EQUAL(33, tuh_msc_cache_hit_rate(&cache));
+}
+
+void test_readahead_sequential(void)
+{
+  for(uint32_t lba=10; lba<10+CFG_TUH_MSC_CACHE_BURST+1; lba++)
+  {
+    TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, lba, buf[0], 1) );
+    TEST_ASSERT_EQUAL_MEMORY(shadow[lba], buf[0], DISK_BLOCK_SIZE);
+  }
+
+  // first sector alone, second sector starts read-ahead covering the rest
+  TEST_ASSERT_EQUAL(2, disk_reads);
+  TEST_ASSERT_EQUAL(CFG_TUH_MSC_CACHE_BURST-1, tuh_msc_cache_get_stats(&cache)->readahead_hits);
+}
+
+void test_readahead_limited_by_block_count(void)
+{
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-3, buf[0], 1) );
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-2, buf[0], 1) );
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, DISK_BLOCK_NUM-1, buf[0], 1) );
+
+  TEST_ASSERT_EQUAL(2, disk_reads);
+  TEST_ASSERT_EQUAL_MEMORY(shadow[DISK_BLOCK_NUM-1], buf[0], DISK_BLOCK_SIZE);
+}
+
+void test_write_coalesce(void)
+{
+  for(uint32_t lba=23; lba>=20; lba--)
+  {
+    fill_sector(buf[0], lba, 1);
+    TEST_ASSERT_TRUE( tuh_msc_cache_write(&cache, lba, buf[0], 1) );
+    memcpy(shadow[lba], buf[0], DISK_BLOCK_SIZE);
+  }
+
+  TEST_ASSERT_EQUAL(0, disk_writes);
+
+  TEST_ASSERT_TRUE( tuh_msc_cache_sync(&cache) );
+  TEST_ASSERT_EQUAL(1, disk_writes);
+  TEST_ASSERT_EQUAL(4, tuh_msc_cache_get_stats(&cache)->device_write_sectors);
+  TEST_ASSERT_EQUAL_MEMORY(shadow, ram_disk, sizeof(ram_disk));
+
+  // nothing left to write back
+  TEST_ASSERT_TRUE( tuh_msc_cache_sync(&cache) );
+  TEST_ASSERT_EQUAL(1, disk_writes);
+}
+
+void test_multiple_read_sees_dirty_sector(void)
+{
+  fill_sector(buf[0], 30, 1);
+  TEST_ASSERT_TRUE( tuh_msc_cache_write(&cache, 30, buf[0], 1) );
+  memcpy(shadow[30], buf[0], DISK_BLOCK_SIZE);
+
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 28, buf[1], 6) );
+  TEST_ASSERT_EQUAL_MEMORY(shadow[28], buf[1], 6*DISK_BLOCK_SIZE);
+}
+
+void test_multiple_write_updates_line(void)
+{
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 50, buf[0], 1) );
+
+  for(uint32_t i=0; i<4; i++) fill_sector(buf[i], 48+i, 2);
+  TEST_ASSERT_TRUE( tuh_msc_cache_write(&cache, 48, buf[0], 4) );
+  memcpy(shadow[48], buf[0], 4*DISK_BLOCK_SIZE);
+
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 50, buf[8], 1) );
+  TEST_ASSERT_EQUAL_MEMORY(shadow[50], buf[8], DISK_BLOCK_SIZE);
+  TEST_ASSERT_EQUAL(1, disk_reads);
+}
+
+void test_lru_eviction(void)
+{
+  // keep sector 0 recently used while filling the cache with others
+  for(uint32_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS+4; i++)
+  {
+    TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 0, buf[0], 1) );
+    TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 200 + 2*i, buf[0], 1) );
+  }
+
+  uint32_t const reads = disk_reads;
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 0, buf[0], 1) );
+  TEST_ASSERT_EQUAL(reads, disk_reads);
+
+  // the oldest is evicted
+  TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 200, buf[0], 1) );
+  TEST_ASSERT_EQUAL(reads+1, disk_reads);
+}
+
+void test_dirty_eviction_writes_back(void)
+{
+  fill_sector(buf[0], 300, 3);
+  TEST_ASSERT_TRUE( tuh_msc_cache_write(&cache, 300, buf[0], 1) );
+  memcpy(shadow[300], buf[0], DISK_BLOCK_SIZE);
+
+  for(uint32_t i=0; i<CFG_TUH_MSC_CACHE_SECTORS; i++)
+  {
+    TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, 400 + 2*i, buf[1], 1) );
+  }
+
+  TEST_ASSERT_EQUAL(1, disk_writes);
+  TEST_ASSERT_EQUAL_MEMORY(shadow[300], ram_disk[300], DISK_BLOCK_SIZE);
+}
+
+// random mix of accesses must always see latest data, and device has it after sync
+void test_random_consistency(void)
+{
+  srand(1234);
+
+  for(uint32_t n=0; n<5000; n++)
+  {
+    uint32_t const lba   = (uint32_t) rand() % 64;
+    uint32_t const count = (rand() % 4) ? 1 : 1 + (uint32_t) rand() % 8;
+    uint32_t const op    = (uint32_t) rand() % 3;
+
+    if ( op == 0 )
+    {
+      for(uint32_t i=0; i<count; i++) fill_sector(buf[i], lba+i, n);
+      TEST_ASSERT_TRUE( tuh_msc_cache_write(&cache, lba, buf[0], count) );
+      memcpy(shadow[lba], buf[0], count*DISK_BLOCK_SIZE);
+    }
+    else
+    {
+      TEST_ASSERT_TRUE( tuh_msc_cache_read(&cache, lba, buf[0], count) );
+      TEST_ASSERT_EQUAL_MEMORY(shadow[lba], buf[0], count*DISK_BLOCK_SIZE);
+    }
+
+    if ( (n % 1000) == 999 )
+    {
+      TEST_ASSERT_TRUE( tuh_msc_cache_sync(&cache) );
+    }
+  }
+
+  TEST_ASSERT_TRUE( tuh_msc_cache_sync(&cache) );
+  TEST_ASSERT_EQUAL_MEMORY(shadow, ram_disk, sizeof(ram_disk));
+}
@@ -0,0 +1,200 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+// Files to test
+#include "msc_host_cache.h"
+
+//--------------------------------------------------------------------+
+// RAM disk stand-in for MassStorage device, counting commands and sectors
+//--------------------------------------------------------------------+
+enum
+{
+  DISK_BLOCK_NUM  = 1024,
+  DISK_BLOCK_SIZE = CFG_TUH_MSC_CACHE_BLOCK_SIZE
+};
+
+static uint8_t ram_disk[DISK_BLOCK_NUM][DISK_BLOCK_SIZE];
+static uint8_t shadow[DISK_BLOCK_NUM][DISK_BLOCK_SIZE]; // expected content as seen by application
+
+static uint32_t disk_reads, disk_writes, disk_sectors;
+
+static bool ram_read(void* ctx, uint64_t lba, uint8_t* buffer, uint32_t count)
+{
+  (void) ctx;
+  TEST_ASSERT_TRUE(lba + count <= DISK_BLOCK_NUM);
+
+  disk_reads++;
+  disk_sectors += count;
+  memcpy(buffer, ram_disk[lba], count*DISK_BLOCK_SIZE);
+  return true;
+}
+
+static bool ram_write(void* ctx, uint64_t lba, uint8_t const* buffer, uint32_t count)
+{
+  (void) ctx;
+  TEST_ASSERT_TRUE(lba + count <= DISK_BLOCK_NUM);
+
+  disk_writes++;
+  disk_sectors += count;
+  memcpy(ram_disk[lba], buffer, count*DISK_BLOCK_SIZE);
+  return true;
+}
+
+static tuh_msc_cache_backend_t const ram_backend = { .read = ram_read, .write = ram_write };
+
+static tuh_msc_cache_t cache;
+static uint8_t buf[2][DISK_BLOCK_SIZE];
+
+static void fill_sector(uint8_t* sector, uint32_t lba, uint32_t gen)
+{
+  for(uint32_t i=0; i<DISK_BLOCK_SIZE; i++) sector[i] = (uint8_t) (lba*7 + gen*13 + i);
+}
+
+void setUp(void)
+{
+  for(uint32_t lba=0; lba<DISK_BLOCK_NUM; lba++) fill_sector(ram_disk[lba], lba, 0);
+  memcpy(shadow, ram_disk, sizeof(ram_disk));
+
+  disk_reads = disk_writes = disk_sectors = 0;
+  tuh_msc_cache_init(&cache, &ram_backend, NULL, DISK_BLOCK_NUM);
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Benchmark: FAT file system like workload, uncached vs cached.
+// Cost model of a BOT command: 1 ms command overhead + 512 bytes per 40 us (~12 MB/s)
+//--------------------------------------------------------------------+
+enum
+{
+  FAT_LBA  = 32,
+  DIR_LBA  = 64,
+  DATA_LBA = 128,
+  FILE_SECTORS = 256
+};
+
+typedef struct
+{
+  bool (* read ) (void* ctx, uint64_t lba, void* buffer, uint32_t count);
+  bool (* write) (void* ctx, uint64_t lba, void const* buffer, uint32_t count);
+  void* ctx;
+} bench_io_t;
+
+// uncached access for comparison
+static bool direct_read(void* ctx, uint64_t lba, void* buffer, uint32_t count)
+{
+  return ram_read(ctx, lba, (uint8_t*) buffer, count);
+}
+
+static bool direct_write(void* ctx, uint64_t lba, void const* buffer, uint32_t count)
+{
+  return ram_write(ctx, lba, (uint8_t const*) buffer, count);
+}
+
+static bool cache_read(void* ctx, uint64_t lba, void* buffer, uint32_t count)
+{
+  return tuh_msc_cache_read((tuh_msc_cache_t*) ctx, lba, buffer, count);
+}
+
+static bool cache_write(void* ctx, uint64_t lba, void const* buffer, uint32_t count)
+{
+  return tuh_msc_cache_write((tuh_msc_cache_t*) ctx, lba, buffer, count);
+}
+
+static void bench_workload(bench_io_t const* io)
+{
+  // open file: directory then FAT chain
+  TEST_ASSERT_TRUE( io->read(io->ctx, DIR_LBA, buf[0], 1) );
+
+  // read file sector by sector, FAT is consulted every 16 sectors (one cluster)
+  for(uint32_t i=0; i<FILE_SECTORS; i++)
+  {
+    if ( (i % 16) == 0 ) TEST_ASSERT_TRUE( io->read(io->ctx, FAT_LBA + i/128, buf[1], 1) );
+    TEST_ASSERT_TRUE( io->read(io->ctx, DATA_LBA + i, buf[0], 1) );
+    TEST_ASSERT_EQUAL_MEMORY(shadow[DATA_LBA+i], buf[0], DISK_BLOCK_SIZE);
+  }
+
+  // append a file sector by sector, updating FAT and directory entry for each cluster
+  for(uint32_t i=0; i<FILE_SECTORS/2; i++)
+  {
+    fill_sector(buf[0], DATA_LBA + FILE_SECTORS + i, 5);
+    TEST_ASSERT_TRUE( io->write(io->ctx, DATA_LBA + FILE_SECTORS + i, buf[0], 1) );
+    memcpy(shadow[DATA_LBA + FILE_SECTORS + i], buf[0], DISK_BLOCK_SIZE);
+
+    if ( (i % 16) == 15 )
+    {
+      TEST_ASSERT_TRUE( io->read (io->ctx, FAT_LBA + 2, buf[1], 1) );
+      buf[1][i/16] = 0xAA;
+      TEST_ASSERT_TRUE( io->write(io->ctx, FAT_LBA + 2, buf[1], 1) );
+      memcpy(shadow[FAT_LBA + 2], buf[1], DISK_BLOCK_SIZE);
+
+      TEST_ASSERT_TRUE( io->read (io->ctx, DIR_LBA, buf[1], 1) );
+      buf[1][0] = (uint8_t) i;
+      TEST_ASSERT_TRUE( io->write(io->ctx, DIR_LBA, buf[1], 1) );
+      memcpy(shadow[DIR_LBA], buf[1], DISK_BLOCK_SIZE);
+    }
+  }
+}
+
+static uint32_t bench_cost_us(void)
+{
+  return (disk_reads + disk_writes)*1000 + disk_sectors*40;
+}
+
+void test_benchmark_fat_workload(void)
+{
+  bench_io_t const direct = { .read = direct_read, .write = direct_write, .ctx = NULL };
+  bench_workload(&direct);
+  TEST_ASSERT_EQUAL_MEMORY(shadow, ram_disk, sizeof(ram_disk));
+
+  uint32_t const direct_cmds = disk_reads + disk_writes;
+  uint32_t const direct_cost = bench_cost_us();
+
+  setUp();
+  bench_io_t const cached = { .read = cache_read, .write = cache_write, .ctx = &cache };
+  bench_workload(&cached);
+  TEST_ASSERT_TRUE( tuh_msc_cache_sync(&cache) );
+  TEST_ASSERT_EQUAL_MEMORY(shadow, ram_disk, sizeof(ram_disk));
+
+  uint32_t const cached_cmds = disk_reads + disk_writes;
+  uint32_t const cached_cost = bench_cost_us();
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "commands %lu -> %lu, estimated %lu ms -> %lu ms, read hit rate %u%%",
+           (unsigned long) direct_cmds, (unsigned long) cached_cmds,
+           (unsigned long) direct_cost/1000, (unsigned long) cached_cost/1000, tuh_msc_cache_hit_rate(&cache));
+  TEST_MESSAGE(msg);
+
+  TEST_ASSERT_TRUE(cached_cmds*4 < direct_cmds);
+  TEST_ASSERT_TRUE(tuh_msc_cache_hit_rate(&cache) >= 80);
+}
@@ -0,0 +1,168 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+// Files to test
+#include "net_host_frame.h"
+
+//--------------------------------------------------------------------+
+// Benchmark: simulated adapter echoing every frame back, aggregated the same way in both directions.
+// Cost model of a high speed bulk transfer: 250 us completion, tuh_task() hand-off and re-arm of next transfer,
+// plus bus time at 40 MB/s (40 bytes per us) for headers and frames.
+//--------------------------------------------------------------------+
+enum
+{
+  BUFSIZE      = 8192,
+  FRAME_COUNT  = 2000,
+  XFER_COST_US = 250,
+  BYTES_PER_US = 40
+};
+
+static uint8_t buffer[BUFSIZE] TU_ATTR_ALIGNED(4);
+static uint8_t frame[1514];
+
+// traffic mix of small (ACK, ARP) and full size frames
+static uint16_t const mix_len[] = { 60, 590, 1514, 1024, 1000, 64, 1514, 1514, 512, 42 };
+
+typedef struct
+{
+  uint32_t xfers;
+  uint32_t bytes;   // transferred on bus, including framing headers
+  uint32_t frames;  // received back intact
+} bench_result_t;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static uint16_t bench_frame_len(uint32_t index)
+{
+  return mix_len[index % TU_ARRAY_SIZE(mix_len)];
+}
+
+static void bench_fill(uint8_t* p, uint32_t index)
+{
+  uint16_t const len = bench_frame_len(index);
+  for(uint16_t i=0; i<len; i++) p[i] = (uint8_t) (index + i);
+}
+
+// Device echoes the transfer back unchanged, parse it as a received one. Frames are sent in order
+static void bench_echo(neth_tx_param_t const* param, uint16_t len, bench_result_t* result)
+{
+  neth_rx_cursor_t cursor = { 0 };
+  uint8_t const* p;
+  uint16_t flen;
+
+  while ( neth_rx_frame_next(param->protocol, buffer, len, &cursor, &p, &flen) )
+  {
+    uint32_t const index = result->frames;
+    bench_fill(frame, index);
+    TEST_ASSERT_EQUAL(bench_frame_len(index), flen);
+    TEST_ASSERT_EQUAL_MEMORY(frame, p, flen);
+    result->frames++;
+  }
+
+  result->xfers += 2;
+  result->bytes += 2u*len;
+}
+
+static bench_result_t bench_run(neth_tx_param_t const* param)
+{
+  bench_result_t result = { 0 };
+  neth_tx_block_t block;
+  uint16_t sequence = 0;
+
+  neth_tx_block_init(param, &block, buffer);
+
+  for(uint32_t i=0; i<FRAME_COUNT; i++)
+  {
+    uint16_t const len = bench_frame_len(i);
+
+    // transfer is sent once the next frame does not fit
+    if ( !neth_tx_block_fits(param, &block, len) )
+    {
+      uint16_t const xfer_len = neth_tx_block_finalize(param, &block, buffer, sequence++);
+      bench_echo(param, xfer_len, &result);
+      neth_tx_block_init(param, &block, buffer);
+    }
+
+    uint8_t* p = neth_tx_block_add(param, &block, buffer, len);
+    TEST_ASSERT_NOT_NULL(p);
+    bench_fill(p, i);
+  }
+
+  bench_echo(param, neth_tx_block_finalize(param, &block, buffer, sequence), &result);
+  TEST_ASSERT_EQUAL(FRAME_COUNT, result.frames);
+
+  return result;
+}
+
+// frames per second in each direction, both share the bus
+static uint32_t bench_report(char const* name, bench_result_t const* result)
+{
+  uint32_t const cost_us = result->xfers*XFER_COST_US + result->bytes/BYTES_PER_US;
+  uint32_t const rate    = (FRAME_COUNT*1000000UL) / cost_us;
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%-5s %lu frames in %lu transfers, %lu bytes, estimated %lu ms, %lu frames/s",
+           name, (unsigned long) result->frames, (unsigned long) result->xfers, (unsigned long) result->bytes,
+           (unsigned long) cost_us/1000, (unsigned long) rate);
+  TEST_MESSAGE(msg);
+
+  return rate;
+}
+
+void test_benchmark_aggregation(void)
+{
+  neth_tx_param_t const param_ecm   = { .max_len = 1514, .max_count = 1, .protocol = NETH_PROTOCOL_ECM };
+  neth_tx_param_t const param_ncm   = { .max_len = BUFSIZE, .max_count = CFG_TUH_NET_TX_FRAMES, .protocol = NETH_PROTOCOL_NCM,
+                                        .divisor = 4, .remainder = 2, .ndp_alignment = 4 };
+  neth_tx_param_t const param_rndis = { .max_len = BUFSIZE, .max_count = CFG_TUH_NET_TX_FRAMES, .protocol = NETH_PROTOCOL_RNDIS,
+                                        .divisor = 8 };
+
+  bench_result_t const ecm   = bench_run(&param_ecm);
+  bench_result_t const ncm   = bench_run(&param_ncm);
+  bench_result_t const rndis = bench_run(&param_rndis);
+
+  uint32_t const ecm_rate   = bench_report("ECM"  , &ecm);
+  uint32_t const ncm_rate   = bench_report("NCM"  , &ncm);
+  uint32_t const rndis_rate = bench_report("RNDIS", &rndis);
+
+  // one frame per transfer for ECM, aggregation is bounded by CFG_TUH_NET_TX_FRAMES and buffer size
+  TEST_ASSERT_EQUAL(2*FRAME_COUNT, ecm.xfers);
+  TEST_ASSERT_TRUE(ncm.xfers*4   < ecm.xfers);
+  TEST_ASSERT_TRUE(rndis.xfers*4 < ecm.xfers);
+  TEST_ASSERT_TRUE(ncm_rate   >= 3*ecm_rate);
+  TEST_ASSERT_TRUE(rndis_rate >= 3*ecm_rate);
+}
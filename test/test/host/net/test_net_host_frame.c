@@ -0,0 +1,280 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+// Files to test
+#include "net_host_frame.h"
+#include "ncm.h"
+#include "class/cdc/cdc_rndis.h"
+
+//--------------------------------------------------------------------+
+// Setup/Teardown + helper declare
+//--------------------------------------------------------------------+
+enum { BUFSIZE = 2048 };
+
+static uint8_t buffer[BUFSIZE] TU_ATTR_ALIGNED(4);
+static uint8_t frames[4][600];
+static uint16_t const frame_len[4] = { 60, 591, 42, 400 };
+
+static neth_tx_param_t const param_ncm   = { .max_len = BUFSIZE, .max_count = 4, .protocol = NETH_PROTOCOL_NCM, .divisor = 4, .remainder = 2, .ndp_alignment = 4 };
+static neth_tx_param_t const param_rndis = { .max_len = BUFSIZE, .max_count = 4, .protocol = NETH_PROTOCOL_RNDIS, .divisor = 8 };
+static neth_tx_param_t const param_ecm   = { .max_len = BUFSIZE, .max_count = 1, .protocol = NETH_PROTOCOL_ECM };
+
+void setUp(void)
+{
+  memset(buffer, 0xee, sizeof(buffer));
+  for(uint8_t i=0; i<4; i++) memset(frames[i], 0x10 + i, sizeof(frames[i]));
+}
+
+void tearDown(void)
+{
+}
+
+// Build transfer of all frames, return its length
+static uint16_t build(neth_tx_param_t const* param, uint8_t count)
+{
+  neth_tx_block_t block;
+  neth_tx_block_init(param, &block, buffer);
+
+  for(uint8_t i=0; i<count; i++)
+  {
+    uint8_t* frame = neth_tx_block_add(param, &block, buffer, frame_len[i]);
+    TEST_ASSERT_NOT_NULL(frame);
+    memcpy(frame, frames[i], frame_len[i]);
+  }
+
+  return neth_tx_block_finalize(param, &block, buffer, 7);
+}
+
+// Parse transfer and compare with frames, return number of frames found
+static uint8_t parse(uint8_t protocol, uint16_t len)
+{
+  neth_rx_cursor_t cursor = { 0 };
+  uint8_t const* frame;
+  uint16_t flen;
+  uint8_t count = 0;
+
+  while ( neth_rx_frame_next(protocol, buffer, len, &cursor, &frame, &flen) )
+  {
+    TEST_ASSERT_EQUAL(frame_len[count], flen);
+    TEST_ASSERT_EQUAL_MEMORY(frames[count], frame, flen);
+    count++;
+  }
+
+  return count;
+}
+
+static void put_u32(uint8_t* p, uint32_t value)
+{
+  p[0] = (uint8_t) value;
+  p[1] = (uint8_t) (value >> 8);
+  p[2] = (uint8_t) (value >> 16);
+  p[3] = (uint8_t) (value >> 24);
+}
+
+//--------------------------------------------------------------------+
+// CDC-NCM
+//--------------------------------------------------------------------+
+void test_ncm_round_trip(void)
+{
+  uint16_t const len = build(&param_ncm, 4);
+
+  ncm_nth16_t const* nth = (ncm_nth16_t const*) buffer;
+  TEST_ASSERT_EQUAL_HEX32(NCM_NTH16_SIGNATURE, nth->dwSignature);
+  TEST_ASSERT_EQUAL(7, nth->wSequence);
+  TEST_ASSERT_EQUAL(len, nth->wBlockLength);
+
+  ncm_ndp16_t const* ndp = (ncm_ndp16_t const*) (buffer + nth->wNdpIndex);
+  TEST_ASSERT_EQUAL(0, nth->wNdpIndex % 4);
+  TEST_ASSERT_EQUAL_HEX32(NCM_NDP16_SIGNATURE_NCM0, ndp->dwSignature);
+  TEST_ASSERT_EQUAL(sizeof(ncm_ndp16_t) + 5*sizeof(ncm_datagram16_t), ndp->wLength);
+
+  // payload alignment requested by device
+  for(uint8_t i=0; i<4; i++) TEST_ASSERT_EQUAL(2, ndp->datagram[i].wDatagramIndex % 4);
+  TEST_ASSERT_EQUAL(0, ndp->datagram[4].wDatagramIndex);
+
+  TEST_ASSERT_EQUAL(4, parse(NETH_PROTOCOL_NCM, len));
+}
+
+void test_ncm_block_full(void)
+{
+  neth_tx_block_t block;
+  neth_tx_block_init(&param_ncm, &block, buffer);
+
+  // datagram count limit
+  for(uint8_t i=0; i<4; i++) TEST_ASSERT_NOT_NULL(neth_tx_block_add(&param_ncm, &block, buffer, 60));
+  TEST_ASSERT_FALSE(neth_tx_block_fits(&param_ncm, &block, 60));
+  TEST_ASSERT_NULL(neth_tx_block_add(&param_ncm, &block, buffer, 60));
+
+  // size limit
+  neth_tx_block_init(&param_ncm, &block, buffer);
+  TEST_ASSERT_NOT_NULL(neth_tx_block_add(&param_ncm, &block, buffer, 1514));
+  TEST_ASSERT_FALSE(neth_tx_block_fits(&param_ncm, &block, 1514));
+  TEST_ASSERT_TRUE(neth_tx_block_fits(&param_ncm, &block, 60));
+}
+
+void test_ncm_ndp_chain(void)
+{
+  uint16_t const len = build(&param_ncm, 4);
+  ncm_nth16_t const* nth = (ncm_nth16_t const*) buffer;
+  ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + nth->wNdpIndex);
+
+  // move last two datagrams to second table at end of NTB with CRC included in length
+  uint16_t const next = (uint16_t) ((len + 3) & ~3u);
+  ncm_ndp16_t* ndp2 = (ncm_ndp16_t*) (buffer + next);
+  ndp2->dwSignature   = NCM_NDP16_SIGNATURE_NCM1;
+  ndp2->wLength       = sizeof(ncm_ndp16_t) + 3*sizeof(ncm_datagram16_t);
+  ndp2->wNextNdpIndex = 0;
+  for(uint8_t i=0; i<2; i++)
+  {
+    ndp2->datagram[i].wDatagramIndex  = ndp->datagram[2+i].wDatagramIndex;
+    ndp2->datagram[i].wDatagramLength = (uint16_t) (ndp->datagram[2+i].wDatagramLength + 4);
+  }
+  ndp2->datagram[2].wDatagramIndex  = 0;
+  ndp2->datagram[2].wDatagramLength = 0;
+
+  ndp->datagram[2].wDatagramIndex  = 0;
+  ndp->datagram[2].wDatagramLength = 0;
+  ndp->wNextNdpIndex = next;
+  ((ncm_nth16_t*) buffer)->wBlockLength = (uint16_t) (next + ndp2->wLength);
+
+  TEST_ASSERT_EQUAL(4, parse(NETH_PROTOCOL_NCM, (uint16_t) (next + ndp2->wLength)));
+}
+
+void test_ncm_malformed(void)
+{
+  neth_rx_cursor_t cursor = { 0 };
+  uint8_t const* frame;
+  uint16_t flen;
+
+  uint16_t const len = build(&param_ncm, 2);
+  ncm_nth16_t* nth = (ncm_nth16_t*) buffer;
+  ncm_ndp16_t* ndp = (ncm_ndp16_t*) (buffer + nth->wNdpIndex);
+
+  // shorter than header
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, 8, &cursor, &frame, &flen));
+
+  // block length beyond transfer
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, (uint16_t) (len - 1), &cursor, &frame, &flen));
+
+  // datagram beyond NTB is skipped
+  ndp->datagram[0].wDatagramLength = 4000;
+  memset(&cursor, 0, sizeof(cursor));
+  TEST_ASSERT_TRUE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen));
+  TEST_ASSERT_EQUAL(frame_len[1], flen);
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen));
+
+  // table pointing backward must not loop
+  ndp->wNextNdpIndex = nth->wNdpIndex;
+  memset(&cursor, 0, sizeof(cursor));
+  TEST_ASSERT_TRUE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen));
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen));
+
+  // bad signature
+  nth->dwSignature = 0;
+  memset(&cursor, 0, sizeof(cursor));
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_NCM, buffer, len, &cursor, &frame, &flen));
+}
+
+//--------------------------------------------------------------------+
+// RNDIS
+//--------------------------------------------------------------------+
+void test_rndis_round_trip(void)
+{
+  uint16_t const len = build(&param_rndis, 4);
+
+  // each message starts aligned and its length reaches the next one
+  uint16_t offset = 0;
+  for(uint8_t i=0; i<4; i++)
+  {
+    rndis_msg_packet_t const* msg = (rndis_msg_packet_t const*) (buffer + offset);
+    TEST_ASSERT_EQUAL(0, offset % 8);
+    TEST_ASSERT_EQUAL_HEX32(RNDIS_MSG_PACKET, msg->type);
+    TEST_ASSERT_EQUAL(frame_len[i], msg->data_length);
+    offset = (uint16_t) (offset + msg->length);
+  }
+  TEST_ASSERT_EQUAL(len, offset);
+
+  TEST_ASSERT_EQUAL(4, parse(NETH_PROTOCOL_RNDIS, len));
+}
+
+void test_rndis_skip_messages(void)
+{
+  // status message before packets and one byte padding after them
+  uint8_t const status_len = sizeof(rndis_msg_indicate_status_t);
+  uint16_t const len = build(&param_rndis, 2);
+
+  memmove(buffer + status_len, buffer, len);
+  memset(buffer, 0, status_len);
+  put_u32(buffer    , RNDIS_MSG_INDICATE_STATUS);
+  put_u32(buffer + 4, status_len);
+  buffer[status_len + len] = 0;
+
+  TEST_ASSERT_EQUAL(2, parse(NETH_PROTOCOL_RNDIS, (uint16_t) (status_len + len + 1)));
+}
+
+void test_rndis_malformed(void)
+{
+  uint16_t const len = build(&param_rndis, 2);
+  rndis_msg_packet_t* msg = (rndis_msg_packet_t*) buffer;
+
+  // data beyond message is skipped
+  msg->data_length = 2000;
+  neth_rx_cursor_t cursor = { 0 };
+  uint8_t const* frame;
+  uint16_t flen;
+  TEST_ASSERT_TRUE(neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen));
+  TEST_ASSERT_EQUAL(frame_len[1], flen);
+
+  // message length beyond transfer stops parsing
+  msg->length = 0xFFFFFFF0UL;
+  memset(&cursor, 0, sizeof(cursor));
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen));
+
+  // zero length must not loop
+  msg->length = 0;
+  memset(&cursor, 0, sizeof(cursor));
+  TEST_ASSERT_FALSE(neth_rx_frame_next(NETH_PROTOCOL_RNDIS, buffer, len, &cursor, &frame, &flen));
+}
+
+//--------------------------------------------------------------------+
+// CDC-ECM
+//--------------------------------------------------------------------+
+void test_ecm_single_frame(void)
+{
+  neth_tx_block_t block;
+  neth_tx_block_init(&param_ecm, &block, buffer);
+
+  TEST_ASSERT_EQUAL_PTR(buffer, neth_tx_block_add(&param_ecm, &block, buffer, frame_len[0]));
+  memcpy(buffer, frames[0], frame_len[0]);
+  TEST_ASSERT_FALSE(neth_tx_block_fits(&param_ecm, &block, 60));
+  TEST_ASSERT_EQUAL(frame_len[0], neth_tx_block_finalize(&param_ecm, &block, buffer, 0));
+
+  TEST_ASSERT_EQUAL(1, parse(NETH_PROTOCOL_ECM, frame_len[0]));
+}
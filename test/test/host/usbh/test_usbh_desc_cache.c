@@ -0,0 +1,228 @@
+/* 
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019, hathach (tinyusb.org)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * This file is part of the TinyUSB stack.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+// Files to test
+#include "usbh_desc_cache.h"
+
+//--------------------------------------------------------------------+
+// Devices
+//--------------------------------------------------------------------+
+static const tusb_desc_device_t desc_device =
+{
+  .bLength            = sizeof(tusb_desc_device_t),
+  .bDescriptorType    = TUSB_DESC_DEVICE,
+  .bcdUSB             = 0x0200,
+  .bMaxPacketSize0    = 64,
+  .idVendor           = 0xCafe,
+  .idProduct          = 0x4001,
+  .bcdDevice          = 0x0100,
+  .iSerialNumber      = 0x03,
+  .bNumConfigurations = 0x01
+};
+
+// configuration + interface
+static uint8_t desc_config[18] = { 9, TUSB_DESC_CONFIGURATION, 18, 0, 1, 1, 0, 0x80, 50, 9, TUSB_DESC_INTERFACE, 0, 0, 0, 0xff, 0, 0, 0 };
+
+static const uint8_t str_serial_a[] = { 8, TUSB_DESC_STRING, '1', 0, '2', 0, '3', 0 };
+static const uint8_t str_serial_b[] = { 8, TUSB_DESC_STRING, '1', 0, '2', 0, '4', 0 };
+
+static tuh_desc_cache_key_t make_key(uint16_t pid, uint8_t const* serial)
+{
+  tuh_desc_cache_key_t key;
+  memset(&key, 0, sizeof(key));
+
+  key.device = desc_device;
+  key.device.idProduct = pid;
+  key.serial_hash = serial ? tuh_desc_cache_serial_hash(serial) : 0;
+
+  return key;
+}
+
+//--------------------------------------------------------------------+
+// Persistent backend stand-in
+//--------------------------------------------------------------------+
+static uint8_t  flash_config[CFG_TUH_DESC_CACHE_CONFIG_SIZE];
+static uint16_t flash_len;
+static uint32_t flash_loads, flash_stores;
+
+uint16_t tuh_desc_cache_load_cb(tuh_desc_cache_key_t const* key, uint8_t* config, uint16_t bufsize)
+{
+  (void) key;
+  flash_loads++;
+  if ( flash_len == 0 || flash_len > bufsize ) return 0;
+  memcpy(config, flash_config, flash_len);
+  return flash_len;
+}
+
+void tuh_desc_cache_store_cb(tuh_desc_cache_key_t const* key, uint8_t const* config, uint16_t len)
+{
+  (void) key;
+  flash_stores++;
+  memcpy(flash_config, config, len);
+  flash_len = len;
+}
+
+void setUp(void)
+{
+  tuh_desc_cache_clear();
+  flash_len = 0;
+  flash_loads = flash_stores = 0;
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_serial_hash(void)
+{
+  TEST_ASSERT_NOT_EQUAL(0, tuh_desc_cache_serial_hash(str_serial_a));
+  TEST_ASSERT_NOT_EQUAL(tuh_desc_cache_serial_hash(str_serial_a), tuh_desc_cache_serial_hash(str_serial_b));
+}
+
+void test_store_lookup(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[64];
+
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+
+  tuh_desc_cache_store(&key, desc_config);
+  TEST_ASSERT_EQUAL(1, flash_stores);
+
+  memset(buf, 0, sizeof(buf));
+  TEST_ASSERT_EQUAL(sizeof(desc_config), tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL_MEMORY(desc_config, buf, sizeof(desc_config));
+
+  // buffer too small
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(desc_config)-1));
+}
+
+void test_key_mismatch(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[64];
+
+  tuh_desc_cache_store(&key, desc_config);
+  flash_len = 0; // only RAM entries
+
+  // other serial number
+  tuh_desc_cache_key_t other = make_key(0x4001, str_serial_b);
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&other, buf, sizeof(buf)));
+
+  // other firmware version
+  other = key;
+  other.device.bcdDevice = 0x0101;
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&other, buf, sizeof(buf)));
+
+  // other product
+  other = make_key(0x4002, str_serial_a);
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&other, buf, sizeof(buf)));
+}
+
+void test_lru_replacement(void)
+{
+  uint8_t buf[64];
+
+  for(uint16_t i=0; i<CFG_TUH_DESC_CACHE_ENTRIES; i++)
+  {
+    tuh_desc_cache_key_t key = make_key(i, NULL);
+    tuh_desc_cache_store(&key, desc_config);
+  }
+
+  // use first device so that second one is the least recently used
+  tuh_desc_cache_key_t first = make_key(0, NULL);
+  TEST_ASSERT_NOT_EQUAL(0, tuh_desc_cache_lookup(&first, buf, sizeof(buf)));
+
+  tuh_desc_cache_key_t key = make_key(CFG_TUH_DESC_CACHE_ENTRIES, NULL);
+  tuh_desc_cache_store(&key, desc_config);
+  flash_len = 0;
+
+  tuh_desc_cache_key_t second = make_key(1, NULL);
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&second, buf, sizeof(buf)));
+  TEST_ASSERT_NOT_EQUAL(0, tuh_desc_cache_lookup(&first, buf, sizeof(buf)));
+  TEST_ASSERT_NOT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+}
+
+void test_invalidate(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[64];
+
+  tuh_desc_cache_store(&key, desc_config);
+  flash_len = 0;
+
+  tuh_desc_cache_invalidate(&key);
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+}
+
+void test_config_too_long(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[8];
+  uint8_t long_config[9] = { 9, TUSB_DESC_CONFIGURATION, U16_TO_U8S_LE(CFG_TUH_DESC_CACHE_CONFIG_SIZE+1), 1, 1, 0, 0x80, 50 };
+
+  tuh_desc_cache_store(&key, long_config);
+
+  TEST_ASSERT_EQUAL(0, flash_stores);
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+}
+
+void test_persistent_load(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[64];
+
+  memcpy(flash_config, desc_config, sizeof(desc_config));
+  flash_len = sizeof(desc_config);
+
+  // RAM miss loaded from backend, then kept in RAM
+  TEST_ASSERT_EQUAL(sizeof(desc_config), tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL_MEMORY(desc_config, buf, sizeof(desc_config));
+  TEST_ASSERT_EQUAL(1, flash_loads);
+
+  TEST_ASSERT_EQUAL(sizeof(desc_config), tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(1, flash_loads);
+}
+
+void test_persistent_load_corrupted(void)
+{
+  tuh_desc_cache_key_t key = make_key(0x4001, str_serial_a);
+  uint8_t buf[64];
+
+  // wTotalLength does not match loaded length
+  memcpy(flash_config, desc_config, sizeof(desc_config));
+  flash_config[2] = 30;
+  flash_len = sizeof(desc_config);
+
+  TEST_ASSERT_EQUAL(0, tuh_desc_cache_lookup(&key, buf, sizeof(buf)));
+}
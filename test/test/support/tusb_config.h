@@ -44,6 +44,7 @@
 #endif
 
 #define CFG_TUSB_RHPORT0_MODE    (OPT_MODE_DEVICE | OPT_MODE_HIGH_SPEED)
+#define CFG_TUSB_RHPORT1_MODE    (OPT_MODE_DEVICE | OPT_MODE_FULL_SPEED)
 #define CFG_TUSB_OS              OPT_OS_NONE
 
 // CFG_TUSB_DEBUG is defined by compiler in DEBUG build
@@ -72,6 +73,7 @@
 
 #define CFG_TUD_TASK_QUEUE_SZ    100
 #define CFG_TUD_ENDOINT0_SIZE    64
+#define CFG_TUD_STATS            1
 
 //------------- CLASS -------------//
 //#define CFG_TUD_CDC              0
@@ -96,6 +98,20 @@
 // Should be sufficient to hold ID (if any) + Data
 #define CFG_TUD_HID_BUFSIZE      16
 
+//------------- VENDOR BRIDGE -------------//
+#define CFG_TUD_VENDOR_BRIDGE    1
+
+//--------------------------------------------------------------------
+// HOST CONFIGURATION
+//--------------------------------------------------------------------
+
+#define CFG_TUH_MSC_CACHE        1
+#define CFG_TUH_HID_PARSER       1
+#define CFG_TUH_HID_RING         1
+#define CFG_TUH_ISO              1
+#define CFG_TUH_DESC_CACHE       1
+#define CFG_TUH_NET              1
+
 #ifdef __cplusplus
  }
 #endif
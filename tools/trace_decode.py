@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Decode binary trace records (CFG_TUSB_TRACE, src/common/tusb_trace.h) into readable log.
+#
+# Usage:
+#   python3 tools/trace_decode.py trace.bin [--hz N]
+#
+# Records are captured from RTT channel 1 (e.g JLinkRTTLogger -RTTChannel 1 trace.bin)
+# or from UART when built with TRACE=1 and LOGGER=uart. With --hz the timestamp is
+# shown in microseconds, e.g --hz 64000000 for DWT->CYCCNT of a 64 MHz MCU.
+
+import argparse
+import struct
+import sys
+
+RECORD = struct.Struct('<IBBH')
+
+# dcd_eventid_t
+DCD_EVENTS = ['Invalid', 'Bus Reset', 'Unplugged', 'SOF', 'Suspend', 'Resume',
+              'Setup Received', 'Xfer Complete', 'Func Call']
+
+STD_REQUESTS = ['Get Status', 'Clear Feature', 'Reserved', 'Set Feature', 'Reserved',
+                'Set Address', 'Get Descriptor', 'Set Descriptor', 'Get Configuration',
+                'Set Configuration', 'Get Interface', 'Set Interface', 'Synch Frame']
+
+SCSI_CMDS = {0x00: 'Test Unit Ready', 0x03: 'Request Sense', 0x12: 'Inquiry',
+             0x1A: 'Mode Sense6', 0x1B: 'Start Stop Unit', 0x1E: 'Prevent Allow Medium Removal',
+             0x23: 'Read Format Capacity', 0x25: 'Read Capacity10', 0x28: 'Read10', 0x2A: 'Write10',
+             0x35: 'Synchronize Cache10', 0x88: 'Read16', 0x8A: 'Write16', 0x9E: 'Read Capacity16'}
+
+# Must be kept in sync with tusb_trace.h
+TRACE_IDS = {
+    0x01: 'OVERFLOW',
+    0x30: 'Queue',
+    0x31: 'Queue failed',
+    0x32: 'Stall',
+    0x33: 'Clear Stall',
+    0x34: 'Open',
+    0x35: 'Close',
+    0x40: 'Control Data',
+    0x41: 'Control Status',
+    0x42: 'Control Stall',
+    0x43: 'Control Complete',
+    0x50: 'CDC Line Coding',
+    0x51: 'CDC Line State',
+    0x58: 'SCSI Command',
+    0x59: 'SCSI Data',
+    0x5A: 'SCSI Status',
+}
+
+
+def describe(rec_id, ep, length):
+    if 0x10 <= rec_id < 0x30:
+        prefix = 'DCD ' if rec_id < 0x20 else 'USBD'
+        eid = rec_id & 0x0f
+        name = DCD_EVENTS[eid] if eid < len(DCD_EVENTS) else 'event {}'.format(eid)
+        if name == 'Setup Received':
+            req = STD_REQUESTS[length] if (ep & 0x60) == 0 and length < len(STD_REQUESTS) else 'bRequest {:02X}'.format(length)
+            return '{} {}: bmRequestType {:02X} {}'.format(prefix, name, ep, req)
+        if name == 'Xfer Complete':
+            return '{} {}: EP {:02X} with {} bytes'.format(prefix, name, ep, length)
+        return '{} {}'.format(prefix, name)
+
+    name = TRACE_IDS.get(rec_id)
+    if name is None:
+        return 'Unknown {:02X}: {:02X} {}'.format(rec_id, ep, length)
+    if rec_id == 0x01:
+        return '{}: {} records dropped'.format(name, length)
+    if rec_id == 0x58:
+        return '  {}: {} with {} bytes'.format(name, SCSI_CMDS.get(ep, '{:02X}'.format(ep)), length)
+    if rec_id in (0x50, 0x51):
+        return '  {}: interface {} value {}'.format(name, ep, length)
+    if rec_id == 0x43:
+        return '  {}: bRequest {:02X}'.format(name, length)
+    return '  {}: EP {:02X} {}'.format(name, ep, length)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode tinyusb binary trace')
+    parser.add_argument('file', help='binary trace file, - for stdin')
+    parser.add_argument('--hz', type=float, default=0, help='timestamp frequency, print raw ticks if not set')
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.file == '-' else open(args.file, 'rb').read()
+    if len(data) % RECORD.size:
+        print('warning: {} trailing bytes ignored'.format(len(data) % RECORD.size), file=sys.stderr)
+
+    prev = None
+    for offset in range(0, len(data) - RECORD.size + 1, RECORD.size):
+        timestamp, rec_id, ep, length = RECORD.unpack_from(data, offset)
+        delta = 0 if prev is None else (timestamp - prev) & 0xffffffff
+        prev = timestamp
+        if args.hz:
+            stamp = '{:12.3f} +{:9.3f}'.format(timestamp * 1e6 / args.hz, delta * 1e6 / args.hz)
+        else:
+            stamp = '{:10} +{:8}'.format(timestamp, delta)
+        print('{} {}'.format(stamp, describe(rec_id, ep, length)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+#
+# Minimal USB/IP client to exercise a device running on the usbip board
+# (src/portable/usbip/dcd_usbip.c) without root or the vhci-hcd kernel module.
+#
+# Usage:
+#   python3 tools/usbip_client.py list
+#   python3 tools/usbip_client.py enum
+#   python3 tools/usbip_client.py cdc   [--count N] [--size N] [--depth N]
+#   python3 tools/usbip_client.py msc   [--count N] [--blocks N] [--depth N]
+#   python3 tools/usbip_client.py stats --request N [--clear]
+#
+# cdc: loopback through the CDC echo of examples/device/cdc_msc
+# msc: sequential READ10 through Bulk-Only Transport, each command keeps
+#      data and CSW URBs queued ahead so several URBs are in flight
+# stats: read tud_stats_t with vendor request CFG_TUD_STATS_VENDOR_REQUEST
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+USBIP_VERSION = 0x0111
+OP_REQ_DEVLIST = 0x8005
+OP_REQ_IMPORT = 0x8003
+CMD_SUBMIT = 1
+CMD_UNLINK = 2
+RET_SUBMIT = 3
+RET_UNLINK = 4
+
+DIR_OUT = 0
+DIR_IN = 1
+
+
+def recv_exact(sock, n):
+    buf = bytearray()
+    while len(buf) < n:
+        chunk = sock.recv(n - len(buf))
+        if not chunk:
+            raise ConnectionError('connection closed by device')
+        buf += chunk
+    return bytes(buf)
+
+
+def parse_device(data):
+    path, busid = data[:256].rstrip(b'\0').decode(), data[256:288].rstrip(b'\0').decode()
+    busnum, devnum, speed, vid, pid, bcd, cls, subcls, proto, cfg, ncfg, nitf = \
+        struct.unpack('>IIIHHHBBBBBB', data[288:312])
+    return dict(path=path, busid=busid, speed=speed, vid=vid, pid=pid, bcd=bcd, cls=cls,
+                subclass=subcls, protocol=proto, cfg=cfg, num_cfg=ncfg, num_itf=nitf)
+
+
+class UsbipClient:
+    def __init__(self, host, port):
+        self.host = host
+        self.port = port
+        self.sock = None
+        self.seqnum = 0
+        self.done = {}
+
+    def connect(self):
+        self.sock = socket.create_connection((self.host, self.port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def devlist(self):
+        self.connect()
+        self.sock.sendall(struct.pack('>HHI', USBIP_VERSION, OP_REQ_DEVLIST, 0))
+        _, _, status, ndev = struct.unpack('>HHII', recv_exact(self.sock, 12))
+        devices = []
+        for _ in range(ndev):
+            dev = parse_device(recv_exact(self.sock, 312))
+            dev['interfaces'] = [struct.unpack('BBBx', recv_exact(self.sock, 4)) for _ in range(dev['num_itf'])]
+            devices.append(dev)
+        self.sock.close()
+        return devices
+
+    def attach(self, busid):
+        self.connect()
+        self.sock.sendall(struct.pack('>HHI32s', USBIP_VERSION, OP_REQ_IMPORT, 0, busid.encode()))
+        _, _, status = struct.unpack('>HHI', recv_exact(self.sock, 8))
+        if status != 0:
+            raise RuntimeError('import of {} failed'.format(busid))
+        return parse_device(recv_exact(self.sock, 312))
+
+    # Submit an URB without waiting, return its sequence number
+    def submit(self, ep, direction, length=0, data=b'', setup=b'\0' * 8, flags=0):
+        self.seqnum += 1
+        hdr = struct.pack('>IIIIIIiiii8s', CMD_SUBMIT, self.seqnum, 0x00010001, direction, ep,
+                          flags, len(data) if direction == DIR_OUT else length, 0, -1, 0, setup)
+        self.sock.sendall(hdr + (data if direction == DIR_OUT else b''))
+        self.done[self.seqnum] = None
+        return self.seqnum
+
+    def unlink(self, seqnum):
+        self.seqnum += 1
+        self.sock.sendall(struct.pack('>IIIIII24x', CMD_UNLINK, self.seqnum, 0x00010001, 0, 0, seqnum))
+        return self.seqnum
+
+    # Read one reply from device
+    def _recv_reply(self, in_lengths):
+        command, seqnum, _, _, _, status, actual = struct.unpack('>IIIIIiI', recv_exact(self.sock, 28))
+        recv_exact(self.sock, 20)
+        data = b''
+        if command == RET_SUBMIT and in_lengths.get(seqnum) and status == 0 and actual:
+            data = recv_exact(self.sock, actual)
+        self.done[seqnum] = (status, actual, data)
+
+    # Wait for URB completion, return (status, actual, data)
+    def wait(self, seqnum, in_lengths=None):
+        in_lengths = in_lengths if in_lengths is not None else self.in_urbs
+        while self.done.get(seqnum) is None:
+            self._recv_reply(in_lengths)
+        return self.done.pop(seqnum)
+
+    in_urbs = {}
+
+    def xfer(self, ep, direction, length=0, data=b'', setup=b'\0' * 8):
+        seq = self.submit(ep, direction, length, data, setup)
+        if direction == DIR_IN:
+            self.in_urbs[seq] = length
+        result = self.wait(seq)
+        self.in_urbs.pop(seq, None)
+        return result
+
+    def control(self, bm_request_type, b_request, w_value, w_index, w_length, data=b''):
+        setup = struct.pack('<BBHHH', bm_request_type, b_request, w_value, w_index, w_length)
+        direction = DIR_IN if bm_request_type & 0x80 else DIR_OUT
+        status, actual, rdata = self.xfer(0, direction, w_length, data, setup)
+        if status != 0:
+            raise RuntimeError('control request {:02X} {:02X} failed with {}'.format(bm_request_type, b_request, status))
+        return rdata
+
+    def get_descriptor(self, desc_type, index, length):
+        return self.control(0x80, 6, (desc_type << 8) | index, 0, length)
+
+
+def enumerate_device(client, verbose=True):
+    desc_dev = client.get_descriptor(1, 0, 18)
+    vid, pid = struct.unpack('<HH', desc_dev[8:12])
+    cfg_header = client.get_descriptor(2, 0, 9)
+    total_len = struct.unpack('<H', cfg_header[2:4])[0]
+    desc_cfg = client.get_descriptor(2, 0, total_len)
+    client.control(0x00, 9, desc_cfg[5], 0, 0)  # SET_CONFIGURATION
+
+    endpoints = []
+    i = 0
+    itf_class = 0
+    while i < len(desc_cfg):
+        length, dtype = desc_cfg[i], desc_cfg[i + 1]
+        if dtype == 4:
+            itf_class = desc_cfg[i + 5]
+        elif dtype == 5:
+            endpoints.append((itf_class, desc_cfg[i + 2], desc_cfg[i + 3] & 3, struct.unpack('<H', desc_cfg[i + 4:i + 6])[0]))
+        i += length
+
+    if verbose:
+        print('Device {:04X}:{:04X}, configuration {} bytes'.format(vid, pid, total_len))
+        for cls, addr, xfer, mps in endpoints:
+            print('  class {:02X} EP {:02X} type {} size {}'.format(cls, addr, xfer, mps))
+    return endpoints
+
+
+def find_bulk(endpoints, cls):
+    ep_out = next(e[1] for e in endpoints if e[0] == cls and e[2] == 2 and not e[1] & 0x80)
+    ep_in = next(e[1] for e in endpoints if e[0] == cls and e[2] == 2 and e[1] & 0x80)
+    return ep_out & 0x7f, ep_in & 0x7f
+
+
+def report(nbytes, elapsed):
+    print('{} bytes in {:.3f} s: {:.2f} MB/s'.format(nbytes, elapsed, nbytes / elapsed / 1e6))
+
+
+def cmd_cdc(client, args):
+    endpoints = enumerate_device(client)
+    # CDC data interface class is 0x0A
+    ep_out, ep_in = find_bulk(endpoints, 0x0A)
+    client.control(0x21, 0x22, 0x0003, 0, 0)  # SET_CONTROL_LINE_STATE DTR | RTS
+
+    # greeting is only flushed together with the first echo, drain both
+    client.xfer(ep_out, DIR_OUT, data=b'x')
+    while not client.xfer(ep_in, DIR_IN, 512)[2].endswith(b'x'):
+        pass
+
+    payload = bytes((i * 7 + 1) % 256 for i in range(args.size)).replace(b'\r', b'.')
+    mps = 512
+    total = 0
+    start = time.monotonic()
+
+    # keep IN URBs of one packet queued. The example echoes 64 bytes per flush (each followed
+    # by a ZLP at high speed) and drops data when its tx fifo is full, so there must be room
+    # for the whole payload in short packets.
+    pending = []
+    for _ in range(max(args.depth, 2 * (args.size // 64) + 1)):
+        seq = client.submit(ep_in, DIR_IN, mps)
+        client.in_urbs[seq] = mps
+        pending.append(seq)
+
+    for _ in range(args.count):
+        out_seq = client.submit(ep_out, DIR_OUT, data=payload)
+
+        received = b''
+        while len(received) < len(payload):
+            received += client.wait(pending.pop(0))[2]
+            seq = client.submit(ep_in, DIR_IN, mps)
+            client.in_urbs[seq] = mps
+            pending.append(seq)
+
+        client.wait(out_seq)
+        if received != payload:
+            sys.exit('loopback mismatch')
+        total += len(payload)
+    report(total, time.monotonic() - start)
+
+    for seq in pending:
+        client.wait(client.unlink(seq))
+
+
+def cmd_msc(client, args):
+    endpoints = enumerate_device(client)
+    ep_out, ep_in = find_bulk(endpoints, 0x08)
+    block_size = 512
+    total = 0
+    start = time.monotonic()
+    lba = 0
+    for tag in range(args.count):
+        length = args.blocks * block_size
+        cdb = struct.pack('>BBIBHB', 0x28, 0, lba, 0, args.blocks, 0).ljust(16, b'\0')
+        cbw = struct.pack('<IIIBBB16s', 0x43425355, tag, length, 0x80, 0, 10, cdb)
+
+        # queue data and status URBs ahead of the command
+        data_seqs = []
+        for _ in range(args.depth):
+            seq = client.submit(ep_in, DIR_IN, length // args.depth)
+            client.in_urbs[seq] = length // args.depth
+            data_seqs.append(seq)
+        client.wait(client.submit(ep_out, DIR_OUT, data=cbw))
+        for seq in data_seqs:
+            total += client.wait(seq)[1]
+        csw = client.xfer(ep_in, DIR_IN, 13)[2]
+        signature, csw_tag, residue, status = struct.unpack('<IIIB', csw)
+        if signature != 0x53425355 or csw_tag != tag or status != 0:
+            sys.exit('bad CSW {}'.format(csw.hex()))
+        lba = (lba + args.blocks) % 8
+    report(total, time.monotonic() - start)
+
+
+def cmd_stats(client, args):
+    enumerate_device(client, verbose=False)
+    if args.clear:
+        client.control(0x40, args.request, 0, 0, 0)
+        return
+
+    edpt = struct.Struct('<IIIIHHHH')
+    data = client.control(0xC0, args.request, 0, 0, 4 + 16 * edpt.size)
+    queue_hwm, queue_overflow = struct.unpack_from('<HH', data)
+    print('event queue: high-water mark {}, overflow {}'.format(queue_hwm, queue_overflow))
+    print('  EP   xfers      bytes  avg latency  max latency  stalls  errors  busy')
+    for i in range(16):
+        count, nbytes, lat_sum, lat_max, stalls, errors, busy, _ = edpt.unpack_from(data, 4 + i * edpt.size)
+        if count or stalls or errors or busy:
+            ep_addr = (i // 2) | (0x80 if i % 2 else 0)
+            print('  {:02X} {:7} {:10} {:12} {:12} {:7} {:7} {:5}'.format(
+                ep_addr, count, nbytes, lat_sum // count if count else 0, lat_max, stalls, errors, busy))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='USB/IP test client for tinyusb usbip board')
+    parser.add_argument('command', choices=['list', 'enum', 'cdc', 'msc', 'stats'])
+    parser.add_argument('--host', default='localhost')
+    parser.add_argument('--port', type=int, default=3240)
+    parser.add_argument('--busid', default='1-1')
+    parser.add_argument('--count', type=int, default=100)
+    parser.add_argument('--size', type=int, default=4096)
+    parser.add_argument('--blocks', type=int, default=8)
+    parser.add_argument('--depth', type=int, default=16)
+    parser.add_argument('--request', type=lambda x: int(x, 0), default=0, help='CFG_TUD_STATS_VENDOR_REQUEST of device')
+    parser.add_argument('--clear', action='store_true', help='clear device statistics')
+    args = parser.parse_args()
+
+    client = UsbipClient(args.host, args.port)
+
+    if args.command == 'list':
+        for dev in client.devlist():
+            print('{busid}: {vid:04X}:{pid:04X} class {cls:02X} interfaces {num_itf}'.format(**dev))
+            for itf in dev['interfaces']:
+                print('  interface class {:02X}/{:02X}/{:02X}'.format(*itf))
+        return
+
+    client.attach(args.busid)
+    if args.command == 'enum':
+        enumerate_device(client)
+    elif args.command == 'cdc':
+        cmd_cdc(client, args)
+    elif args.command == 'msc':
+        cmd_msc(client, args)
+    elif args.command == 'stats':
+        cmd_stats(client, args)
+
+
+if __name__ == '__main__':
+    main()